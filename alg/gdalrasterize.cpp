@@ -37,6 +37,8 @@
 #include <cstring>
 #include <cfloat>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <algorithm>
 
@@ -45,9 +47,11 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -690,6 +694,373 @@ gv_rasterize_one_shape( unsigned char *pabyChunkBuf, int nXOff, int nYOff,
     }
 }
 
+/************************************************************************/
+/*                     GDALRasterizeGetThreadCount()                    */
+/************************************************************************/
+
+static int GDALRasterizeGetThreadCount( CSLConstList papszOptions )
+{
+    const char* pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if( pszNumThreads == nullptr )
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    return CPLGetNumThreads(pszNumThreads, 128);
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                     GDALRasterizeMultiThreaded                       */
+/*                                                                      */
+/*      Burns the geometries into a swath with several threads. The     */
+/*      swath is partitioned into horizontal bands, each band being     */
+/*      processed by a single job. The geometries are assigned to the   */
+/*      bands they intersect, and burnt in their original order, so     */
+/*      that the result does not depend on the scheduling of jobs, even */
+/*      with MERGE_ALG=ADD.                                             */
+/* ==================================================================== */
+/************************************************************************/
+
+namespace {
+
+class GDALRasterizeMultiThreaded
+{
+    struct BandJob
+    {
+        GDALRasterizeMultiThreaded* poParent = nullptr;
+        unsigned char* pabyBuf = nullptr;
+        int nXSize = 0;
+        int nYOff = 0;
+        int nYSize = 0;
+        GSpacing nLineSpace = 0;
+        GSpacing nBandSpace = 0;
+        std::vector<int> anGeomIdx{};
+    };
+
+    struct YRangeJob
+    {
+        GDALRasterizeMultiThreaded* poParent = nullptr;
+        int iStart = 0;
+        int iEnd = 0;
+    };
+
+    // Number of bands per thread, to balance the load when the geometries
+    // are not evenly distributed.
+    static constexpr int BANDS_PER_THREAD = 4;
+
+    const int m_nThreads;
+    const int m_nGeomCount;
+    const OGRGeometryH* const m_pahGeometries;
+    const int m_nBandCount;
+    const GDALDataType m_eType;
+    const int m_bAllTouched;
+    const GDALDataType m_eBurnValueType;
+    const double* const m_padfGeomBurnValues;
+    const int64_t* const m_panGeomBurnValues;
+    const GDALBurnValueSrc m_eBurnValueSource;
+    const GDALRasterMergeAlg m_eMergeAlg;
+    const GDALTransformerFunc m_pfnTransformer;
+
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::mutex m_oMutex{};
+    std::vector<void*> m_apTransformArgs{};
+    std::vector<void*> m_apFreeTransformArgs{};
+
+    // Extent in lines of each geometry, in pixel coordinates
+    std::vector<double> m_adfMinY{};
+    std::vector<double> m_adfMaxY{};
+    // Geometry indices sorted by increasing minimum line
+    std::vector<int> m_anSortedGeomIdx{};
+    size_t m_nNextSortedIdx = 0;
+    // Geometries that may intersect the current band
+    std::vector<int> m_anActiveGeomIdx{};
+
+    void* AcquireTransformArg();
+    void ReleaseTransformArg(void* pTransformArg);
+
+    static void YRangeJobFunc(void* pData);
+    static void BandJobFunc(void* pData);
+
+    GDALRasterizeMultiThreaded(const GDALRasterizeMultiThreaded&) = delete;
+    GDALRasterizeMultiThreaded& operator=(const GDALRasterizeMultiThreaded&) = delete;
+
+  public:
+    GDALRasterizeMultiThreaded(int nThreads,
+                               int nGeomCount,
+                               const OGRGeometryH* pahGeometries,
+                               int nBandCount, GDALDataType eType,
+                               int bAllTouched,
+                               GDALDataType eBurnValueType,
+                               const double* padfGeomBurnValues,
+                               const int64_t* panGeomBurnValues,
+                               GDALBurnValueSrc eBurnValueSource,
+                               GDALRasterMergeAlg eMergeAlg,
+                               GDALTransformerFunc pfnTransformer):
+        m_nThreads(nThreads),
+        m_nGeomCount(nGeomCount),
+        m_pahGeometries(pahGeometries),
+        m_nBandCount(nBandCount),
+        m_eType(eType),
+        m_bAllTouched(bAllTouched),
+        m_eBurnValueType(eBurnValueType),
+        m_padfGeomBurnValues(padfGeomBurnValues),
+        m_panGeomBurnValues(panGeomBurnValues),
+        m_eBurnValueSource(eBurnValueSource),
+        m_eMergeAlg(eMergeAlg),
+        m_pfnTransformer(pfnTransformer)
+    {}
+
+    ~GDALRasterizeMultiThreaded();
+
+    bool Init(void* pTransformArg);
+    void ProcessSwath(unsigned char* pabyChunkBuf, int nXSize,
+                      int nYOff, int nYSize);
+};
+
+/************************************************************************/
+/*                    ~GDALRasterizeMultiThreaded()                     */
+/************************************************************************/
+
+GDALRasterizeMultiThreaded::~GDALRasterizeMultiThreaded()
+{
+    if( m_poJobQueue )
+        m_poJobQueue->WaitCompletion();
+    for( void* pTransformArg: m_apTransformArgs )
+        GDALDestroyTransformer(pTransformArg);
+}
+
+/************************************************************************/
+/*                        AcquireTransformArg()                         */
+/************************************************************************/
+
+void* GDALRasterizeMultiThreaded::AcquireTransformArg()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    // There are never more jobs running than transformers
+    CPLAssert(!m_apFreeTransformArgs.empty());
+    void* pTransformArg = m_apFreeTransformArgs.back();
+    m_apFreeTransformArgs.pop_back();
+    return pTransformArg;
+}
+
+/************************************************************************/
+/*                        ReleaseTransformArg()                         */
+/************************************************************************/
+
+void GDALRasterizeMultiThreaded::ReleaseTransformArg(void* pTransformArg)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_apFreeTransformArgs.push_back(pTransformArg);
+}
+
+/************************************************************************/
+/*                           YRangeJobFunc()                            */
+/************************************************************************/
+
+void GDALRasterizeMultiThreaded::YRangeJobFunc(void* pData)
+{
+    const YRangeJob* psJob = static_cast<const YRangeJob*>(pData);
+    GDALRasterizeMultiThreaded* poThis = psJob->poParent;
+    void* pTransformArg = poThis->AcquireTransformArg();
+
+    std::vector<double> aPointX;
+    std::vector<double> aPointY;
+    std::vector<double> aPointVariant;
+    std::vector<int> aPartSize;
+    std::vector<int> anSuccess;
+    for( int iShape = psJob->iStart; iShape < psJob->iEnd; ++iShape )
+    {
+        aPointX.clear();
+        aPointY.clear();
+        aPointVariant.clear();
+        aPartSize.clear();
+        GDALCollectRingsFromGeometry(
+            OGRGeometry::FromHandle(poThis->m_pahGeometries[iShape]),
+            aPointX, aPointY, aPointVariant, aPartSize, GBV_UserBurnValue );
+        if( aPointX.empty() )
+            continue;
+
+        anSuccess.resize(aPointX.size());
+        poThis->m_pfnTransformer( pTransformArg, FALSE,
+                                  static_cast<int>(aPointX.size()),
+                                  aPointX.data(), aPointY.data(), nullptr,
+                                  anSuccess.data() );
+
+        // Like gv_rasterize_one_shape(), ignore the success flags.
+        double dfMinY = std::numeric_limits<double>::infinity();
+        double dfMaxY = -std::numeric_limits<double>::infinity();
+        for( const double dfY: aPointY )
+        {
+            if( dfY < dfMinY )
+                dfMinY = dfY;
+            if( dfY > dfMaxY )
+                dfMaxY = dfY;
+        }
+        poThis->m_adfMinY[iShape] = dfMinY;
+        poThis->m_adfMaxY[iShape] = dfMaxY;
+    }
+
+    poThis->ReleaseTransformArg(pTransformArg);
+}
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+bool GDALRasterizeMultiThreaded::Init(void* pTransformArg)
+{
+    CPLWorkerThreadPool* poThreadPool = GDALGetGlobalThreadPool(m_nThreads);
+    if( poThreadPool == nullptr )
+        return false;
+    m_poJobQueue = poThreadPool->CreateJobQueue();
+
+    for( int i = 0; i < m_nThreads; ++i )
+    {
+        void* pClonedTransformArg = GDALCloneTransformer(pTransformArg);
+        if( pClonedTransformArg == nullptr )
+            return false;
+        m_apTransformArgs.push_back(pClonedTransformArg);
+    }
+    m_apFreeTransformArgs = m_apTransformArgs;
+
+/* -------------------------------------------------------------------- */
+/*      Compute the extent in lines of each geometry.                   */
+/* -------------------------------------------------------------------- */
+    m_adfMinY.resize(m_nGeomCount, std::numeric_limits<double>::infinity());
+    m_adfMaxY.resize(m_nGeomCount, -std::numeric_limits<double>::infinity());
+
+    std::vector<YRangeJob> asJobs(m_nThreads);
+    const int nGeomsPerJob = (m_nGeomCount + m_nThreads - 1) / m_nThreads;
+    for( int i = 0; i < m_nThreads; ++i )
+    {
+        asJobs[i].poParent = this;
+        asJobs[i].iStart = std::min(m_nGeomCount, i * nGeomsPerJob);
+        asJobs[i].iEnd = std::min(m_nGeomCount, (i + 1) * nGeomsPerJob);
+        if( !m_poJobQueue->SubmitJob(YRangeJobFunc, &asJobs[i]) )
+        {
+            m_poJobQueue->WaitCompletion();
+            return false;
+        }
+    }
+    m_poJobQueue->WaitCompletion();
+
+/* -------------------------------------------------------------------- */
+/*      Sort the geometries by increasing minimum line.                 */
+/* -------------------------------------------------------------------- */
+    for( int iShape = 0; iShape < m_nGeomCount; ++iShape )
+    {
+        // Empty geometries, or geometries with only invalid coordinates
+        if( m_adfMinY[iShape] <= m_adfMaxY[iShape] )
+            m_anSortedGeomIdx.push_back(iShape);
+    }
+    std::stable_sort(m_anSortedGeomIdx.begin(), m_anSortedGeomIdx.end(),
+                     [this](int a, int b)
+                     { return m_adfMinY[a] < m_adfMinY[b]; });
+
+    return true;
+}
+
+/************************************************************************/
+/*                            BandJobFunc()                             */
+/************************************************************************/
+
+void GDALRasterizeMultiThreaded::BandJobFunc(void* pData)
+{
+    const BandJob* psJob = static_cast<const BandJob*>(pData);
+    GDALRasterizeMultiThreaded* poThis = psJob->poParent;
+    void* pTransformArg = poThis->AcquireTransformArg();
+    const int nBandCount = poThis->m_nBandCount;
+
+    for( const int iShape: psJob->anGeomIdx )
+    {
+        gv_rasterize_one_shape(
+            psJob->pabyBuf, 0, psJob->nYOff,
+            psJob->nXSize, psJob->nYSize,
+            nBandCount, poThis->m_eType,
+            GDALGetDataTypeSizeBytes(poThis->m_eType),
+            psJob->nLineSpace, psJob->nBandSpace,
+            poThis->m_bAllTouched,
+            OGRGeometry::FromHandle(poThis->m_pahGeometries[iShape]),
+            poThis->m_eBurnValueType,
+            poThis->m_padfGeomBurnValues ?
+                poThis->m_padfGeomBurnValues + iShape * nBandCount : nullptr,
+            poThis->m_panGeomBurnValues ?
+                poThis->m_panGeomBurnValues + iShape * nBandCount : nullptr,
+            poThis->m_eBurnValueSource, poThis->m_eMergeAlg,
+            poThis->m_pfnTransformer, pTransformArg );
+    }
+
+    poThis->ReleaseTransformArg(pTransformArg);
+}
+
+/************************************************************************/
+/*                            ProcessSwath()                            */
+/*                                                                      */
+/*      Swaths must be processed by increasing nYOff.                   */
+/************************************************************************/
+
+void GDALRasterizeMultiThreaded::ProcessSwath(unsigned char* pabyChunkBuf,
+                                              int nXSize,
+                                              int nYOff, int nYSize)
+{
+    const GSpacing nLineSpace =
+        static_cast<GSpacing>(nXSize) * GDALGetDataTypeSizeBytes(m_eType);
+    const GSpacing nBandSpace = nLineSpace * nYSize;
+
+    const int nBands = std::max(1, std::min(nYSize,
+                                            m_nThreads * BANDS_PER_THREAD));
+    std::vector<BandJob> asJobs(nBands);
+    for( int iBand = 0; iBand < nBands; ++iBand )
+    {
+        const int nBandYStart =
+            static_cast<int>(static_cast<GIntBig>(nYSize) * iBand / nBands);
+        const int nBandYEnd =
+            static_cast<int>(static_cast<GIntBig>(nYSize) * (iBand + 1) / nBands);
+
+        // Margin of one line to account for ALL_TOUCHED and rounding.
+        const double dfMinLine = nYOff + nBandYStart - 1.0;
+        const double dfMaxLine = nYOff + nBandYEnd + 1.0;
+
+        // Add geometries starting before the end of this band...
+        while( m_nNextSortedIdx < m_anSortedGeomIdx.size() &&
+               m_adfMinY[m_anSortedGeomIdx[m_nNextSortedIdx]] < dfMaxLine )
+        {
+            m_anActiveGeomIdx.push_back(m_anSortedGeomIdx[m_nNextSortedIdx]);
+            ++m_nNextSortedIdx;
+        }
+        // ... and discard the ones that end before its start. As bands are
+        // processed by increasing line, they will not be needed anymore.
+        m_anActiveGeomIdx.erase(
+            std::remove_if(m_anActiveGeomIdx.begin(), m_anActiveGeomIdx.end(),
+                           [this, dfMinLine](int iShape)
+                           { return m_adfMaxY[iShape] < dfMinLine; }),
+            m_anActiveGeomIdx.end());
+
+        BandJob& sJob = asJobs[iBand];
+        sJob.poParent = this;
+        sJob.pabyBuf = pabyChunkBuf + nBandYStart * nLineSpace;
+        sJob.nXSize = nXSize;
+        sJob.nYOff = nYOff + nBandYStart;
+        sJob.nYSize = nBandYEnd - nBandYStart;
+        sJob.nLineSpace = nLineSpace;
+        sJob.nBandSpace = nBandSpace;
+        sJob.anGeomIdx = m_anActiveGeomIdx;
+        // Burn in the original order of geometries
+        std::sort(sJob.anGeomIdx.begin(), sJob.anGeomIdx.end());
+    }
+
+    for( auto& sJob: asJobs )
+    {
+        if( sJob.anGeomIdx.empty() )
+            continue;
+        // Never more jobs in flight than transformers
+        m_poJobQueue->WaitCompletion(m_nThreads - 1);
+        if( !m_poJobQueue->SubmitJob(BandJobFunc, &sJob) )
+            BandJobFunc(&sJob);
+    }
+    m_poJobQueue->WaitCompletion();
+}
+
+} // namespace
+
 /************************************************************************/
 /*                        GDALRasterizeOptions()                        */
 /*                                                                      */
@@ -844,6 +1215,12 @@ CPLErr GDALRasterizeGeometriesInternal( GDALDatasetH hDS,
  * used. Default size will be estimated based on the GDAL cache buffer size
  * using formula: cache_size_bytes/scanline_size_bytes, so the chunk will
  * not exceed the cache. Not used in OPTIM=RASTER mode.</li>
+ * <li>"NUM_THREADS": (GDAL >= 3.7) Number of worker threads, or ALL_CPUS,
+ * used to burn the geometries in OPTIM=RASTER mode. Each chunk is split into
+ * horizontal bands that are burnt concurrently, which gives the same result as
+ * a single thread. Only used when pfnTransformer is NULL or
+ * GDALGenImgProjTransform. Defaults to the value of the GDAL_NUM_THREADS
+ * configuration option, or 1.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1121,6 +1498,31 @@ CPLErr GDALRasterizeGeometriesInternal( GDALDatasetH hDS,
             return CE_Failure;
         }
 
+/* -------------------------------------------------------------------- */
+/*      Burn the swaths with several threads if requested. This needs   */
+/*      to clone the transformer, which we can only do for GDAL ones.   */
+/* -------------------------------------------------------------------- */
+        std::unique_ptr<GDALRasterizeMultiThreaded> poMT;
+        const int nThreads =
+            std::min(GDALRasterizeGetThreadCount(papszOptions), nGeomCount);
+        if( nThreads > 1 && pfnTransformer == GDALGenImgProjTransform )
+        {
+            poMT = cpl::make_unique<GDALRasterizeMultiThreaded>(
+                nThreads, nGeomCount, pahGeometries, nBandCount, eType,
+                bAllTouched, eBurnValueType,
+                padfGeomBurnValues, panGeomBurnValues,
+                eBurnValueSource, eMergeAlg, pfnTransformer);
+            if( !poMT->Init(pTransformArg) )
+            {
+                CPLDebug("GDAL", "Cannot use multithreaded rasterization");
+                poMT.reset();
+            }
+            else
+            {
+                CPLDebug("GDAL", "Rasterizing with %d threads", nThreads);
+            }
+        }
+
 /* ==================================================================== */
 /*      Loop over image in designated chunks.                           */
 /* ==================================================================== */
@@ -1144,19 +1546,27 @@ CPLErr GDALRasterizeGeometriesInternal( GDALDatasetH hDS,
             if( eErr != CE_None )
                 break;
 
-            for( int iShape = 0; iShape < nGeomCount; iShape++ )
+            if( poMT )
             {
-                gv_rasterize_one_shape( pabyChunkBuf, 0, iY,
-                                        poDS->GetRasterXSize(), nThisYChunkSize,
-                                        nBandCount, eType,
-                                        0, 0, 0,
-                                        bAllTouched,
-                                        OGRGeometry::FromHandle(pahGeometries[iShape]),
-                                        eBurnValueType,
-                                        padfGeomBurnValues ? padfGeomBurnValues + iShape*nBandCount : nullptr,
-                                        panGeomBurnValues ? panGeomBurnValues + iShape*nBandCount : nullptr,
-                                        eBurnValueSource, eMergeAlg,
-                                        pfnTransformer, pTransformArg );
+                poMT->ProcessSwath(pabyChunkBuf, poDS->GetRasterXSize(),
+                                   iY, nThisYChunkSize);
+            }
+            else
+            {
+                for( int iShape = 0; iShape < nGeomCount; iShape++ )
+                {
+                    gv_rasterize_one_shape( pabyChunkBuf, 0, iY,
+                                            poDS->GetRasterXSize(), nThisYChunkSize,
+                                            nBandCount, eType,
+                                            0, 0, 0,
+                                            bAllTouched,
+                                            OGRGeometry::FromHandle(pahGeometries[iShape]),
+                                            eBurnValueType,
+                                            padfGeomBurnValues ? padfGeomBurnValues + iShape*nBandCount : nullptr,
+                                            panGeomBurnValues ? panGeomBurnValues + iShape*nBandCount : nullptr,
+                                            eBurnValueSource, eMergeAlg,
+                                            pfnTransformer, pTransformArg );
+                }
             }
 
             eErr =
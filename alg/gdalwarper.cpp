@@ -1185,6 +1185,11 @@ GDALWarpDstAlphaMasker( void *pMaskFuncArg, int nBandCount,
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>NUM_CHUNKS_IN_FLIGHT: (GDAL >= 3.7) Number of chunks processed
+ * concurrently by GDALWarpOperation::ChunkAndWarpMulti(). Defaults to 2.
+ * Source windows of the chunks in flight are advised to the source dataset
+ * so that they can be prefetched while earlier chunks are warped.</li>
+ *
  * <li>STREAMABLE_OUTPUT: (GDAL >= 2.0) This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
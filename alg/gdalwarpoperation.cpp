@@ -37,10 +37,12 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -1020,66 +1022,151 @@ CPLErr GDALChunkAndWarpImage( GDALWarpOperationH hOperation,
 }
 
 /************************************************************************/
-/*                          ChunkThreadMain()                           */
+/*                          ChunkSchedulerData                          */
 /************************************************************************/
 
-typedef struct
+// State shared by all the chunk threads of a ChunkAndWarpMulti() run.
+struct ChunkSchedulerData
 {
-    GDALWarpOperation *poOperation;
-    GDALWarpChunk     *pasChunkInfo;
-    CPLJoinableThread *hThreadHandle;
-    CPLErr             eErr;
-    double             dfProgressBase;
-    double             dfProgressScale;
-    CPLMutex          *hIOMutex;
-
-    CPLMutex          *hCondMutex;
-    volatile int       bIOMutexTaken;
-    CPLCond           *hCond;
-} ChunkThreadData;
+    GDALWarpOperation *poOperation = nullptr;
+    GDALWarpOptions   *psOptions = nullptr;
+    GDALWarpChunk     *pasChunkList = nullptr;
+    int                nChunkListCount = 0;
+    int                nChunksInFlight = 0;
+    CPLMutex          *hIOMutex = nullptr;
+
+    std::mutex              oMutex{};
+    std::condition_variable oCV{};
+    // Index of the next chunk allowed to start its source I/O. The source
+    // dataset is only accessed by that chunk, until it hands it over with
+    // HandOverSourceToNextChunk().
+    int                nNextChunkToStart = 0;
+    // Index of the last chunk whose source window has been advised.
+    int                nLastAdvisedChunk = -1;
+};
+
+struct ChunkThreadData
+{
+    ChunkSchedulerData *psScheduler = nullptr;
+    int                 iChunk = 0;
+    CPLJoinableThread  *hThreadHandle = nullptr;
+    CPLErr              eErr = CE_None;
+    double              dfProgressBase = 0;
+    double              dfProgressScale = 0;
+    bool                bSourceHandedOver = false;
+};
+
+// Chunk processed by the current thread, if it is a ChunkThreadMain() one.
+static thread_local ChunkThreadData* tlpsCurrentChunk = nullptr;
+
+/************************************************************************/
+/*                     HandOverSourceToNextChunk()                      */
+/************************************************************************/
+
+// Called by WarpRegionToBuffer() once the source window of the current
+// chunk has been read and the IO mutex released, and by ChunkThreadMain()
+// as a fallback. Advises the source dataset of the window of each of the
+// chunks that will be processed next, so that drivers that support it can
+// prefetch them while this chunk is warped, and then lets the next chunk
+// start its source read. One call per chunk, rather than a single one over
+// their bounding box, avoids prefetching blocks that no chunk needs.
+
+static void HandOverSourceToNextChunk()
+{
+    ChunkThreadData* psData = tlpsCurrentChunk;
+    if( psData == nullptr || psData->bSourceHandedOver )
+        return;
+    psData->bSourceHandedOver = true;
+    ChunkSchedulerData* psScheduler = psData->psScheduler;
+
+    const int iLastChunkToAdvise =
+        std::min(psData->iChunk + psScheduler->nChunksInFlight - 1,
+                 psScheduler->nChunkListCount - 1);
+    for( int iChunk = std::max(psScheduler->nLastAdvisedChunk + 1,
+                               psData->iChunk + 1);
+         iChunk <= iLastChunkToAdvise; ++iChunk )
+    {
+        const GDALWarpChunk* psNextChunk = psScheduler->pasChunkList + iChunk;
+        if( psNextChunk->ssx > 0 && psNextChunk->ssy > 0 )
+        {
+            const GDALWarpOptions* psOptions = psScheduler->psOptions;
+            CPLErrorStateBackuper oBackuper;
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            GDALDatasetAdviseRead(
+                psOptions->hSrcDS,
+                psNextChunk->sx, psNextChunk->sy,
+                psNextChunk->ssx, psNextChunk->ssy,
+                psNextChunk->ssx, psNextChunk->ssy,
+                psOptions->eWorkingDataType,
+                psOptions->nBandCount, psOptions->panSrcBands, nullptr);
+            CPLPopErrorHandler();
+        }
+        psScheduler->nLastAdvisedChunk = iChunk;
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(psScheduler->oMutex);
+        psScheduler->nNextChunkToStart ++;
+    }
+    psScheduler->oCV.notify_all();
+}
+
+/************************************************************************/
+/*                          ChunkThreadMain()                           */
+/************************************************************************/
 
 static void ChunkThreadMain( void *pThreadData )
 
 {
-    volatile ChunkThreadData* psData =
-        static_cast<volatile ChunkThreadData*>(pThreadData);
+    ChunkThreadData* psData = static_cast<ChunkThreadData*>(pThreadData);
+    ChunkSchedulerData* psScheduler = psData->psScheduler;
 
-    GDALWarpChunk *pasChunkInfo = psData->pasChunkInfo;
+    GDALWarpChunk *pasChunkInfo = psScheduler->pasChunkList + psData->iChunk;
 
 /* -------------------------------------------------------------------- */
-/*      Acquire IO mutex.                                               */
+/*      Wait for our turn, so that chunks start reading their source    */
+/*      window in order, and acquire the IO mutex.                      */
 /* -------------------------------------------------------------------- */
-    if( !CPLAcquireMutex( psData->hIOMutex, 600.0 ) )
+    {
+        std::unique_lock<std::mutex> oLock(psScheduler->oMutex);
+        psScheduler->oCV.wait(oLock, [psScheduler, psData] {
+            return psScheduler->nNextChunkToStart == psData->iChunk; });
+    }
+
+    psData->bSourceHandedOver = false;
+    tlpsCurrentChunk = psData;
+
+    if( !CPLAcquireMutex( psScheduler->hIOMutex, 600.0 ) )
     {
         CPLError( CE_Failure, CPLE_AppDefined,
                     "Failed to acquire IOMutex in WarpRegion()." );
         psData->eErr = CE_Failure;
+        HandOverSourceToNextChunk();
+        tlpsCurrentChunk = nullptr;
+        return;
     }
-    else
-    {
-        if( psData->hCond != nullptr )
-        {
-            CPLAcquireMutex( psData->hCondMutex, 1.0 );
-            psData->bIOMutexTaken = TRUE;
-            CPLCondSignal(psData->hCond);
-            CPLReleaseMutex( psData->hCondMutex );
-        }
 
-        psData->eErr = psData->poOperation->WarpRegion(
-                                    pasChunkInfo->dx, pasChunkInfo->dy,
-                                    pasChunkInfo->dsx, pasChunkInfo->dsy,
-                                    pasChunkInfo->sx, pasChunkInfo->sy,
-                                    pasChunkInfo->ssx, pasChunkInfo->ssy,
-                                    pasChunkInfo->sExtraSx,
-                                    pasChunkInfo->sExtraSy,
-                                    psData->dfProgressBase,
-                                    psData->dfProgressScale);
+    // WarpRegion() releases the IO mutex during the computation, and takes
+    // it again before writing the output buffer. Once it has read the source
+    // window, it calls HandOverSourceToNextChunk().
+    psData->eErr = psScheduler->poOperation->WarpRegion(
+                                pasChunkInfo->dx, pasChunkInfo->dy,
+                                pasChunkInfo->dsx, pasChunkInfo->dsy,
+                                pasChunkInfo->sx, pasChunkInfo->sy,
+                                pasChunkInfo->ssx, pasChunkInfo->ssy,
+                                pasChunkInfo->sExtraSx,
+                                pasChunkInfo->sExtraSy,
+                                psData->dfProgressBase,
+                                psData->dfProgressScale);
 
-    /* -------------------------------------------------------------------- */
-    /*      Release the IO mutex.                                           */
-    /* -------------------------------------------------------------------- */
-        CPLReleaseMutex( psData->hIOMutex );
-    }
+/* -------------------------------------------------------------------- */
+/*      Release the IO mutex.                                           */
+/* -------------------------------------------------------------------- */
+    CPLReleaseMutex( psScheduler->hIOMutex );
+
+    // In case WarpRegion() failed before reading the source window.
+    HandOverSourceToNextChunk();
+    tlpsCurrentChunk = nullptr;
 }
 
 /************************************************************************/
@@ -1098,6 +1185,13 @@ static void ChunkThreadMain( void *pThreadData )
  * internally this method uses multiple threads to interleave input/output
  * for one region while the processing is being done for another.
  *
+ * By default, two chunks are processed at a time. The NUM_CHUNKS_IN_FLIGHT
+ * warping option may be set to a larger value to keep more chunks in flight,
+ * in which case the source windows of the next chunks are advised to the
+ * source dataset (see GDALDataset::AdviseRead()) while the current one is
+ * warped, and chunks are made smaller so that the total memory used remains
+ * bounded by twice GDALWarpOptions::dfWarpMemoryLimit.
+ *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
  * @param nDstXSize Width of output window on destination file to be produced.
@@ -1116,122 +1210,105 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(
     CPLReleaseMutex( hIOMutex );
     CPLReleaseMutex( hWarpMutex );
 
-    CPLCond* hCond = CPLCreateCond();
-    CPLMutex* hCondMutex = CPLCreateMutex();
-    CPLReleaseMutex(hCondMutex);
+    const int nChunksInFlight = std::max(2, std::min(64, atoi(
+        CSLFetchNameValueDef(psOptions->papszWarpOptions,
+                             "NUM_CHUNKS_IN_FLIGHT", "2"))));
 
 /* -------------------------------------------------------------------- */
-/*      Collect the list of chunks to operate on.                       */
+/*      Collect the list of chunks to operate on. With more than two    */
+/*      chunks in flight, reduce their size so that the overall memory  */
+/*      use stays the same as with two chunks.                          */
 /* -------------------------------------------------------------------- */
+    const double dfWarpMemoryLimit = psOptions->dfWarpMemoryLimit;
+    psOptions->dfWarpMemoryLimit = dfWarpMemoryLimit * 2 / nChunksInFlight;
     CollectChunkList( nDstXOff, nDstYOff, nDstXSize, nDstYSize );
+    psOptions->dfWarpMemoryLimit = dfWarpMemoryLimit;
 
 /* -------------------------------------------------------------------- */
-/*      Process them one at a time, updating the progress               */
-/*      information for each region.                                    */
+/*      Process them, with at most nChunksInFlight threads alive at a   */
+/*      time, updating the progress information for each region.       */
 /* -------------------------------------------------------------------- */
-    ChunkThreadData volatile asThreadData[2] = {};
-    memset(reinterpret_cast<void*>(
-        const_cast<ChunkThreadData(*)[2]>(&asThreadData)), 0, sizeof(asThreadData));
-    asThreadData[0].poOperation = this;
-    asThreadData[0].hIOMutex = hIOMutex;
-    asThreadData[1].poOperation = this;
-    asThreadData[1].hIOMutex = hIOMutex;
+    ChunkSchedulerData sScheduler;
+    sScheduler.poOperation = this;
+    sScheduler.psOptions = psOptions;
+    sScheduler.pasChunkList = pasChunkList;
+    sScheduler.nChunkListCount = nChunkListCount;
+    sScheduler.nChunksInFlight = nChunksInFlight;
+    sScheduler.hIOMutex = hIOMutex;
+
+    std::vector<ChunkThreadData> asThreadData(nChunksInFlight);
+    for( auto& sThreadData: asThreadData )
+        sThreadData.psScheduler = &sScheduler;
 
     double dfPixelsProcessed = 0.0;
     double dfTotalPixels = static_cast<double>(nDstXSize)*nDstYSize;
 
     CPLErr eErr = CE_None;
-    for( int iChunk = 0; iChunk < nChunkListCount+1; iChunk++ )
+    int iChunk = 0;
+    for( ; pasChunkList != nullptr && iChunk < nChunkListCount; iChunk++ )
     {
-        int iThread = iChunk % 2;
+        auto& sThreadData = asThreadData[iChunk % nChunksInFlight];
 
 /* -------------------------------------------------------------------- */
-/*      Launch thread for this chunk.                                   */
+/*      Wait for the chunk previously using this slot to complete.      */
 /* -------------------------------------------------------------------- */
-        if( pasChunkList != nullptr && iChunk < nChunkListCount )
+        if( sThreadData.hThreadHandle )
         {
-            GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
-            const double dfChunkPixels =
-                pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
+            CPLJoinThread(sThreadData.hThreadHandle);
+            sThreadData.hThreadHandle = nullptr;
 
-            asThreadData[iThread].dfProgressBase =
-                dfPixelsProcessed / dfTotalPixels;
-            asThreadData[iThread].dfProgressScale =
-                dfChunkPixels / dfTotalPixels;
+            CPLDebug( "GDAL", "Finished chunk %d / %d.",
+                      sThreadData.iChunk, nChunkListCount );
 
-            dfPixelsProcessed += dfChunkPixels;
-
-            asThreadData[iThread].pasChunkInfo = pasThisChunk;
-
-            if( iChunk == 0 )
-            {
-                asThreadData[iThread].hCond = hCond;
-                asThreadData[iThread].hCondMutex = hCondMutex;
-            }
-            else
-            {
-                asThreadData[iThread].hCond = nullptr;
-                asThreadData[iThread].hCondMutex = nullptr;
-            }
-            asThreadData[iThread].bIOMutexTaken = FALSE;
-
-            CPLDebug( "GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount );
-            asThreadData[iThread].hThreadHandle = CPLCreateJoinableThread(
-                ChunkThreadMain,
-                const_cast<ChunkThreadData *>(&asThreadData[iThread]));
-            if( asThreadData[iThread].hThreadHandle == nullptr )
-            {
-                CPLError(
-                    CE_Failure, CPLE_AppDefined,
-                    "CPLCreateJoinableThread() failed in ChunkAndWarpMulti()");
-                eErr = CE_Failure;
+            eErr = sThreadData.eErr;
+            if( eErr != CE_None )
                 break;
-            }
-
-            // Wait that the first thread has acquired the IO mutex before
-            // proceeding.  This will ensure that the first thread will run
-            // before the second one.
-            if( iChunk == 0 )
-            {
-                CPLAcquireMutex(hCondMutex, 1.0);
-                while( asThreadData[iThread].bIOMutexTaken == FALSE )
-                    CPLCondWait(hCond, hCondMutex);
-                CPLReleaseMutex(hCondMutex);
-            }
         }
 
 /* -------------------------------------------------------------------- */
-/*      Wait for previous chunks thread to complete.                    */
+/*      Launch thread for this chunk.                                   */
 /* -------------------------------------------------------------------- */
-        if( iChunk > 0 )
-        {
-            iThread = (iChunk-1) % 2;
-
-            // Wait for thread to finish.
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
-            asThreadData[iThread].hThreadHandle = nullptr;
+        GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
+        const double dfChunkPixels =
+            pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
 
-            CPLDebug( "GDAL", "Finished chunk %d / %d.", iChunk-1, nChunkListCount );
+        sThreadData.iChunk = iChunk;
+        sThreadData.eErr = CE_None;
+        sThreadData.dfProgressBase = dfPixelsProcessed / dfTotalPixels;
+        sThreadData.dfProgressScale = dfChunkPixels / dfTotalPixels;
 
-            eErr = asThreadData[iThread].eErr;
+        dfPixelsProcessed += dfChunkPixels;
 
-            if( eErr != CE_None )
-                break;
+        CPLDebug( "GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount );
+        sThreadData.hThreadHandle = CPLCreateJoinableThread(
+            ChunkThreadMain, &sThreadData);
+        if( sThreadData.hThreadHandle == nullptr )
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "CPLCreateJoinableThread() failed in ChunkAndWarpMulti()");
+            eErr = CE_Failure;
+            break;
         }
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Wait for all threads to complete.                               */
-    /* -------------------------------------------------------------------- */
-    for( int iThread = 0; iThread < 2; iThread++ )
+/* -------------------------------------------------------------------- */
+/*      Wait for all threads to complete, in chunk order.               */
+/* -------------------------------------------------------------------- */
+    for( int i = 0; i < nChunksInFlight; i++ )
     {
-        if( asThreadData[iThread].hThreadHandle )
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
+        auto& sThreadData = asThreadData[(iChunk + i) % nChunksInFlight];
+        if( sThreadData.hThreadHandle )
+        {
+            CPLJoinThread(sThreadData.hThreadHandle);
+            sThreadData.hThreadHandle = nullptr;
+            CPLDebug( "GDAL", "Finished chunk %d / %d.",
+                      sThreadData.iChunk, nChunkListCount );
+            if( eErr == CE_None )
+                eErr = sThreadData.eErr;
+        }
     }
 
-    CPLDestroyCond(hCond);
-    CPLDestroyMutex(hCondMutex);
-
     WipeChunkList();
 
     return eErr;
@@ -2244,6 +2321,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     if( hIOMutex != nullptr )
     {
         CPLReleaseMutex( hIOMutex );
+        HandOverSourceToNextChunk();
         if( !CPLAcquireMutex( hWarpMutex, 600.0 ) )
         {
             CPLError( CE_Failure, CPLE_AppDefined,
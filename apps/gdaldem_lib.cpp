@@ -109,13 +109,16 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__SSE2__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -297,6 +300,337 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
     return nVal;
 }
 
+/************************************************************************/
+/*                    GDALGeneric3x3LineHasNoData()                     */
+/************************************************************************/
+
+template<class T>
+static bool GDALGeneric3x3LineHasNoData( const T* pafLine, int nXSize,
+                                         T fSrcNoDataValue )
+{
+    int iX = 0;
+    for( ; iX + 3 < nXSize; iX +=4 )
+    {
+        if( pafLine[iX] == fSrcNoDataValue ||
+            pafLine[iX + 1] == fSrcNoDataValue ||
+            pafLine[iX + 2] == fSrcNoDataValue ||
+            pafLine[iX + 3] == fSrcNoDataValue )
+        {
+            return true;
+        }
+    }
+    for( ; iX < nXSize; iX++ )
+    {
+        if( pafLine[iX] == fSrcNoDataValue )
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     GDALGeneric3x3ProcessLine()                      */
+/************************************************************************/
+
+template<class T>
+struct GDALGeneric3x3LineParams
+{
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type pfnAlg_multisample;
+    void *pData;
+    bool bComputeAtEdges;
+    int nXSize;
+    bool bSrcHasNoData;
+    T fSrcNoDataValue;
+    bool bIsSrcNoDataNan;
+    float fDstNoDataValue;
+};
+
+// Computes an output line, other than the first and last ones, from the
+// three source lines centered on it.
+template<class T>
+static void GDALGeneric3x3ProcessLine(
+    const GDALGeneric3x3LineParams<T>& sParams,
+    const T* pafThreeLineWin,
+    int nLine1Off, int nLine2Off, int nLine3Off,
+    bool bOneOfThreeLinesHasNoData,
+    float* pafOutputBuf )
+{
+    const int nXSize = sParams.nXSize;
+    const bool bSrcHasNoData = sParams.bSrcHasNoData;
+    const T fSrcNoDataValue = sParams.fSrcNoDataValue;
+    const float fDstNoDataValue = sParams.fDstNoDataValue;
+    const bool bComputeAtEdges = sParams.bComputeAtEdges;
+
+    if( bComputeAtEdges && nXSize >= 2 )
+    {
+        int j = 0;
+        T afWin[9] = {
+            INTERPOL(pafThreeLineWin[nLine1Off + j],
+                     pafThreeLineWin[nLine1Off + j+1],
+                     bSrcHasNoData, fSrcNoDataValue),
+            pafThreeLineWin[nLine1Off + j],
+            pafThreeLineWin[nLine1Off + j+1],
+            INTERPOL(pafThreeLineWin[nLine2Off + j],
+                     pafThreeLineWin[nLine2Off + j+1],
+                     bSrcHasNoData, fSrcNoDataValue),
+            pafThreeLineWin[nLine2Off + j],
+            pafThreeLineWin[nLine2Off + j+1],
+            INTERPOL(pafThreeLineWin[nLine3Off + j],
+                     pafThreeLineWin[nLine3Off + j+1],
+                     bSrcHasNoData, fSrcNoDataValue),
+            pafThreeLineWin[nLine3Off + j],
+            pafThreeLineWin[nLine3Off + j+1]
+        };
+
+        pafOutputBuf[j] =
+            ComputeVal(
+                bOneOfThreeLinesHasNoData,
+                fSrcNoDataValue,
+                sParams.bIsSrcNoDataNan,
+                afWin, fDstNoDataValue,
+                sParams.pfnAlg, sParams.pData, bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        pafOutputBuf[0] = fDstNoDataValue;
+    }
+
+    int j = 1;
+    if( sParams.pfnAlg_multisample && !bOneOfThreeLinesHasNoData )
+    {
+        j = sParams.pfnAlg_multisample(pafThreeLineWin,
+                                       nLine1Off,
+                                       nLine2Off,
+                                       nLine3Off,
+                                       nXSize,
+                                       sParams.pData,
+                                       pafOutputBuf);
+    }
+
+    for( ; j < nXSize - 1; j++ )
+    {
+        T afWin[9] = {
+            pafThreeLineWin[nLine1Off + j-1],
+            pafThreeLineWin[nLine1Off + j],
+            pafThreeLineWin[nLine1Off + j+1],
+            pafThreeLineWin[nLine2Off + j-1],
+            pafThreeLineWin[nLine2Off + j],
+            pafThreeLineWin[nLine2Off + j+1],
+            pafThreeLineWin[nLine3Off + j-1],
+            pafThreeLineWin[nLine3Off + j],
+            pafThreeLineWin[nLine3Off + j+1]
+        };
+
+        pafOutputBuf[j] =
+            ComputeVal(
+                bOneOfThreeLinesHasNoData,
+                fSrcNoDataValue,
+                sParams.bIsSrcNoDataNan,
+                afWin, fDstNoDataValue,
+                sParams.pfnAlg, sParams.pData, bComputeAtEdges);
+    }
+
+    if( bComputeAtEdges && nXSize >= 2 )
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {
+            pafThreeLineWin[nLine1Off + j-1],
+            pafThreeLineWin[nLine1Off + j],
+            INTERPOL(pafThreeLineWin[nLine1Off + j],
+                     pafThreeLineWin[nLine1Off + j-1],
+                     bSrcHasNoData, fSrcNoDataValue),
+            pafThreeLineWin[nLine2Off + j-1],
+            pafThreeLineWin[nLine2Off + j],
+            INTERPOL(pafThreeLineWin[nLine2Off + j],
+                     pafThreeLineWin[nLine2Off + j-1],
+                     bSrcHasNoData, fSrcNoDataValue),
+            pafThreeLineWin[nLine3Off + j-1],
+            pafThreeLineWin[nLine3Off + j],
+            INTERPOL(pafThreeLineWin[nLine3Off + j],
+                     pafThreeLineWin[nLine3Off + j-1],
+                     bSrcHasNoData, fSrcNoDataValue)
+        };
+
+        pafOutputBuf[j] =
+            ComputeVal(
+                bOneOfThreeLinesHasNoData,
+                fSrcNoDataValue,
+                sParams.bIsSrcNoDataNan,
+                afWin, fDstNoDataValue,
+                sParams.pfnAlg, sParams.pData, bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if( nXSize > 1 )
+            pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+    }
+}
+
+/************************************************************************/
+/*               GDALGeneric3x3ProcessingMultiThreaded()                */
+/************************************************************************/
+
+template<class T>
+struct GDALGeneric3x3Job
+{
+    const GDALGeneric3x3LineParams<T>* psParams = nullptr;
+    // nLines + 2 source lines, starting with the one above the first
+    // output line.
+    const T* pafSrc = nullptr;
+    float* pafDst = nullptr;
+    int nLines = 0;
+};
+
+template<class T>
+static void GDALGeneric3x3JobFunc( void* pData )
+{
+    const GDALGeneric3x3Job<T>* psJob =
+        static_cast<const GDALGeneric3x3Job<T>*>(pData);
+    const GDALGeneric3x3LineParams<T>& sParams = *(psJob->psParams);
+    const int nXSize = sParams.nXSize;
+
+    bool abLineHasNoDataValue[3] = {
+        sParams.bSrcHasNoData, sParams.bSrcHasNoData, sParams.bSrcHasNoData
+    };
+    const bool bCheckNoData =
+        std::numeric_limits<T>::is_integer && sParams.bSrcHasNoData;
+    if( bCheckNoData )
+    {
+        for( int i = 0; i < 2; i++ )
+        {
+            abLineHasNoDataValue[i] = GDALGeneric3x3LineHasNoData(
+                psJob->pafSrc + static_cast<size_t>(i) * nXSize,
+                nXSize, sParams.fSrcNoDataValue);
+        }
+    }
+
+    for( int i = 0; i < psJob->nLines; i++ )
+    {
+        const T* pafThreeLineWin =
+            psJob->pafSrc + static_cast<size_t>(i) * nXSize;
+
+        bool bOneOfThreeLinesHasNoData = sParams.bSrcHasNoData;
+        if( bCheckNoData )
+        {
+            abLineHasNoDataValue[(i + 2) % 3] = GDALGeneric3x3LineHasNoData(
+                pafThreeLineWin + 2 * nXSize, nXSize, sParams.fSrcNoDataValue);
+            bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
+                                        abLineHasNoDataValue[1] ||
+                                        abLineHasNoDataValue[2];
+        }
+
+        GDALGeneric3x3ProcessLine(sParams, pafThreeLineWin,
+                                  0, nXSize, 2 * nXSize,
+                                  bOneOfThreeLinesHasNoData,
+                                  psJob->pafDst + static_cast<size_t>(i) * nXSize);
+    }
+}
+
+// Computes the output lines 1 to nYSize - 2 with several threads. The
+// lines are processed by swaths, each of them being partitioned into bands
+// of consecutive lines processed by a single job. On success, the last two
+// source lines are left in pafLastTwoLines.
+template<class T>
+static CPLErr GDALGeneric3x3ProcessingMultiThreaded(
+    GDALRasterBandH hSrcBand,
+    GDALRasterBandH hDstBand,
+    GDALDataType eReadDT,
+    const GDALGeneric3x3LineParams<T>& sParams,
+    CPLWorkerThreadPool* poThreadPool,
+    int nThreads,
+    T* pafLastTwoLines,
+    GDALProgressFunc pfnProgress,
+    void *pProgressData )
+{
+    const int nXSize = sParams.nXSize;
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    // Aim at about 1 MB of source data per job.
+    const int nLinesPerJob = std::max(1, std::min(nYSize,
+        static_cast<int>((1024 * 1024) / (static_cast<size_t>(nXSize) * sizeof(T)))));
+    const int nMaxSwathLines = std::min(nYSize - 2, nLinesPerJob * nThreads);
+
+    std::vector<T> afSrc;
+    std::vector<float> afDst;
+    try
+    {
+        afSrc.resize(static_cast<size_t>(nMaxSwathLines + 2) * nXSize);
+        afDst.resize(static_cast<size_t>(nMaxSwathLines) * nXSize);
+    }
+    catch( const std::exception& )
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffers for multithreaded processing");
+        return CE_Failure;
+    }
+
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    std::vector<GDALGeneric3x3Job<T>> asJobs(nThreads);
+
+    // Lines already in afSrc (the last two lines of the previous swath)
+    int nLinesInBuffer = 0;
+    for( int iLine = 1; iLine < nYSize - 1; )
+    {
+        const int nSwathLines = std::min(nMaxSwathLines, nYSize - 1 - iLine);
+
+        // Source lines iLine - 1 to iLine + nSwathLines
+        const int nLinesToRead = nSwathLines + 2 - nLinesInBuffer;
+        if( GDALRasterIO( hSrcBand, GF_Read,
+                          0, iLine - 1 + nLinesInBuffer,
+                          nXSize, nLinesToRead,
+                          afSrc.data() + static_cast<size_t>(nLinesInBuffer) * nXSize,
+                          nXSize, nLinesToRead,
+                          eReadDT, 0, 0 ) != CE_None )
+        {
+            return CE_Failure;
+        }
+
+        const int nJobs = std::min(nThreads, nSwathLines);
+        for( int iJob = 0; iJob < nJobs; iJob++ )
+        {
+            const int nStart = static_cast<int>(
+                static_cast<GIntBig>(nSwathLines) * iJob / nJobs);
+            const int nEnd = static_cast<int>(
+                static_cast<GIntBig>(nSwathLines) * (iJob + 1) / nJobs);
+            auto& sJob = asJobs[iJob];
+            sJob.psParams = &sParams;
+            sJob.pafSrc = afSrc.data() + static_cast<size_t>(nStart) * nXSize;
+            sJob.pafDst = afDst.data() + static_cast<size_t>(nStart) * nXSize;
+            sJob.nLines = nEnd - nStart;
+            if( !poJobQueue->SubmitJob(GDALGeneric3x3JobFunc<T>, &sJob) )
+                GDALGeneric3x3JobFunc<T>(&sJob);
+        }
+        poJobQueue->WaitCompletion();
+
+        if( GDALRasterIO( hDstBand, GF_Write,
+                          0, iLine, nXSize, nSwathLines,
+                          afDst.data(), nXSize, nSwathLines,
+                          GDT_Float32, 0, 0 ) != CE_None )
+        {
+            return CE_Failure;
+        }
+
+        // Keep the last two source lines for the next swath
+        memmove(afSrc.data(),
+                afSrc.data() + static_cast<size_t>(nSwathLines) * nXSize,
+                2 * nXSize * sizeof(T));
+        nLinesInBuffer = 2;
+        iLine += nSwathLines;
+
+        if( !pfnProgress( 1.0 * iLine / nYSize, nullptr, pProgressData ) )
+        {
+            CPLError( CE_Failure, CPLE_UserInterrupt, "User terminated" );
+            return CE_Failure;
+        }
+    }
+
+    memcpy(pafLastTwoLines, afSrc.data(), 2 * nXSize * sizeof(T));
+    return CE_None;
+}
+
 /************************************************************************/
 /*                  GDALGeneric3x3Processing()                          */
 /************************************************************************/
@@ -388,6 +722,17 @@ CPLErr GDALGeneric3x3Processing(
     if( !bDstHasNoData )
         fDstNoDataValue = 0.0;
 
+    GDALGeneric3x3LineParams<T> sLineParams;
+    sLineParams.pfnAlg = pfnAlg;
+    sLineParams.pfnAlg_multisample = pfnAlg_multisample;
+    sLineParams.pData = pData;
+    sLineParams.bComputeAtEdges = bComputeAtEdges;
+    sLineParams.nXSize = nXSize;
+    sLineParams.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
+    sLineParams.fSrcNoDataValue = fSrcNoDataValue;
+    sLineParams.bIsSrcNoDataNan = CPL_TO_BOOL(bIsSrcNoDataNan);
+    sLineParams.fDstNoDataValue = fDstNoDataValue;
+
     int nLine1Off = 0;
     int nLine2Off = nXSize;
     int nLine3Off = 2*nXSize;
@@ -500,6 +845,32 @@ CPLErr GDALGeneric3x3Processing(
     }
 
     int i = 1;  // Used after for.
+
+/* -------------------------------------------------------------------- */
+/*      Process the inner lines with several threads if asked.          */
+/* -------------------------------------------------------------------- */
+    const int nThreads =
+        CPLGetNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
+    CPLWorkerThreadPool* poThreadPool =
+        (nThreads > 1 && nYSize > 3) ? GDALGetGlobalThreadPool(nThreads)
+                                     : nullptr;
+    if( poThreadPool )
+    {
+        eErr = GDALGeneric3x3ProcessingMultiThreaded(
+            hSrcBand, hDstBand, eReadDT, sLineParams,
+            poThreadPool, nThreads, pafThreeLineWin,
+            pfnProgress, pProgressData);
+        if( eErr != CE_None )
+        {
+            CPLFree(pafOutputBuf);
+            CPLFree(pafThreeLineWin);
+
+            return eErr;
+        }
+        // Last two source lines are now at the start of pafThreeLineWin
+        i = nYSize - 1;
+    }
+
     for( ; i < nYSize-1; i++ )
     {
         /* Read third line of the line buffer */
@@ -524,142 +895,18 @@ CPLErr GDALGeneric3x3Processing(
         bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
         if( std::numeric_limits<T>::is_integer && bSrcHasNoData )
         {
-            bool bLastLineHasNoDataValue = false;
-            int iX = 0;
-            for( ; iX + 3 < nXSize; iX +=4 )
-            {
-                if( pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 1] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 2] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue )
-                {
-                    bLastLineHasNoDataValue = true;
-                    break;
-                }
-            }
-            if( !bLastLineHasNoDataValue )
-            {
-                for( ; iX < nXSize; iX++ )
-                {
-                    if( pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue )
-                    {
-                        bLastLineHasNoDataValue = true;
-                    }
-                }
-            }
-            abLineHasNoDataValue[nLine3Off / nXSize] = bLastLineHasNoDataValue;
+            abLineHasNoDataValue[nLine3Off / nXSize] =
+                GDALGeneric3x3LineHasNoData(pafThreeLineWin + nLine3Off,
+                                            nXSize, fSrcNoDataValue);
 
             bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
                                 abLineHasNoDataValue[1] ||
                                 abLineHasNoDataValue[2];
         }
 
-        if( bComputeAtEdges && nXSize >= 2 )
-        {
-            int j = 0;
-            T afWin[9] = {
-                INTERPOL(pafThreeLineWin[nLine1Off + j],
-                         pafThreeLineWin[nLine1Off + j+1],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[nLine1Off + j],
-                pafThreeLineWin[nLine1Off + j+1],
-                INTERPOL(pafThreeLineWin[nLine2Off + j],
-                         pafThreeLineWin[nLine2Off + j+1],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[nLine2Off + j],
-                pafThreeLineWin[nLine2Off + j+1],
-                INTERPOL(pafThreeLineWin[nLine3Off + j],
-                         pafThreeLineWin[nLine3Off + j+1],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[nLine3Off + j],
-                pafThreeLineWin[nLine3Off + j+1]
-            };
-
-            pafOutputBuf[j] =
-                ComputeVal(
-                    CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                    fSrcNoDataValue,
-                    CPL_TO_BOOL(bIsSrcNoDataNan),
-                    afWin, fDstNoDataValue,
-                    pfnAlg, pData, bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
-
-        int j = 1;
-        if( pfnAlg_multisample && !bOneOfThreeLinesHasNoData )
-        {
-            j = pfnAlg_multisample(pafThreeLineWin,
-                                   nLine1Off,
-                                   nLine2Off,
-                                   nLine3Off,
-                                   nXSize,
-                                   pData,
-                                   pafOutputBuf);
-        }
-
-        for( ; j < nXSize - 1; j++ )
-        {
-            T afWin[9] = {
-                pafThreeLineWin[nLine1Off + j-1],
-                pafThreeLineWin[nLine1Off + j],
-                pafThreeLineWin[nLine1Off + j+1],
-                pafThreeLineWin[nLine2Off + j-1],
-                pafThreeLineWin[nLine2Off + j],
-                pafThreeLineWin[nLine2Off + j+1],
-                pafThreeLineWin[nLine3Off + j-1],
-                pafThreeLineWin[nLine3Off + j],
-                pafThreeLineWin[nLine3Off + j+1]
-            };
-
-            pafOutputBuf[j] =
-                ComputeVal(
-                    CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                    fSrcNoDataValue,
-                    CPL_TO_BOOL(bIsSrcNoDataNan),
-                    afWin, fDstNoDataValue,
-                    pfnAlg, pData, bComputeAtEdges);
-        }
-
-        if( bComputeAtEdges && nXSize >= 2 )
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {
-                pafThreeLineWin[nLine1Off + j-1],
-                pafThreeLineWin[nLine1Off + j],
-                INTERPOL(pafThreeLineWin[nLine1Off + j],
-                         pafThreeLineWin[nLine1Off + j-1],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[nLine2Off + j-1],
-                pafThreeLineWin[nLine2Off + j],
-                INTERPOL(pafThreeLineWin[nLine2Off + j],
-                         pafThreeLineWin[nLine2Off + j-1],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[nLine3Off + j-1],
-                pafThreeLineWin[nLine3Off + j],
-                INTERPOL(pafThreeLineWin[nLine3Off + j],
-                         pafThreeLineWin[nLine3Off + j-1],
-                         bSrcHasNoData, fSrcNoDataValue)
-            };
-
-            pafOutputBuf[j] =
-                ComputeVal(
-                    CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                    fSrcNoDataValue,
-                    CPL_TO_BOOL(bIsSrcNoDataNan),
-                    afWin, fDstNoDataValue,
-                    pfnAlg, pData, bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            if( nXSize > 1 )
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
-        }
+        GDALGeneric3x3ProcessLine(sLineParams, pafThreeLineWin,
+                                  nLine1Off, nLine2Off, nLine3Off,
+                                  bOneOfThreeLinesHasNoData, pafOutputBuf);
 
         /* -----------------------------------------
          * Write Line to Raster
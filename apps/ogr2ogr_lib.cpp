@@ -50,6 +50,7 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -57,12 +58,14 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_featurestyle.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_recordbatch.h"
 #include "ogr_spatialref.h"
 #include "ogrlayerdecorator.h"
 #include "ogrsf_frmts.h"
@@ -375,6 +378,11 @@ struct TargetLayerInfo
     GIntBig      m_nFeaturesRead = 0;
     bool         m_bPerFeatureCT = 0;
     OGRLayer    *m_poDstLayer = nullptr;
+    // Fetched once on the main thread, as drivers may build them lazily:
+    // LayerTranslator::ProcessFeature() must not call into the layers.
+    OGRFeatureDefn *m_poSrcFDefn = nullptr;
+    OGRFeatureDefn *m_poDstFDefn = nullptr;
+    std::string  m_osSrcLayerName{};
     std::vector<std::unique_ptr<OGRCoordinateTransformation>> m_apoCT{};
     std::vector<CPLStringList> m_aosTransformOptions{};
     std::vector<int> m_anMap{};
@@ -472,6 +480,60 @@ public:
                                   GDALProgressFunc pfnProgress,
                                   void *pProgressArg,
                                   GDALVectorTranslateOptions *psOptions);
+
+private:
+    enum class FeatureStatus
+    {
+        OK,
+        DISCARD,
+        FAILURE
+    };
+
+    struct PendingFeature;
+    struct ProcessJob;
+
+    FeatureStatus       ProcessFeature(TargetLayerInfo* psInfo,
+                                       std::unique_ptr<OGRFeature>& poFeature,
+                                       std::unique_ptr<OGRFeature>& poDstFeature,
+                                       OGRGeometryCollection* poCollToExplode,
+                                       int iGeomCollToExplode,
+                                       GIntBig nSrcFID,
+                                       GIntBig nDesiredFID,
+                                       OGRSpatialReference* poOutputSRS,
+                                       const std::vector<std::unique_ptr<OGRCoordinateTransformation>>& apoCT,
+                                       const OGRGeometryFactory::TransformWithOptionsCache& oCache,
+                                       GDALVectorTranslateOptions *psOptions,
+                                       bool& bReprojectionFailed) const;
+    bool                StartNewTransactionIfNeeded(OGRLayer* poDstLayer,
+                                                    int& nFeaturesInTransaction,
+                                                    GIntBig& nTotalEventsDone,
+                                                    GDALVectorTranslateOptions *psOptions);
+    bool                WriteFeature(TargetLayerInfo* psInfo,
+                                     OGRFeature* poDstFeature,
+                                     GIntBig nSrcFID,
+                                     GIntBig nDesiredFID,
+                                     GIntBig& nFeaturesWritten,
+                                     GDALVectorTranslateOptions *psOptions);
+    static void         ProcessFeaturesJob(void* pData);
+    int                 TranslateMultiThreaded(TargetLayerInfo* psInfo,
+                                               GIntBig nCountLayerFeatures,
+                                               GIntBig* pnReadFeatureCount,
+                                               GIntBig& nTotalEventsDone,
+                                               GDALProgressFunc pfnProgress,
+                                               void *pProgressArg,
+                                               OGRSpatialReference* poOutputSRS,
+                                               int nThreads,
+                                               GDALVectorTranslateOptions *psOptions);
+
+    bool                CanUseArrowAPI(TargetLayerInfo* psInfo,
+                                       GDALVectorTranslateOptions *psOptions) const;
+    bool                TranslateArrow(TargetLayerInfo* psInfo,
+                                       GIntBig nCountLayerFeatures,
+                                       GIntBig* pnReadFeatureCount,
+                                       GIntBig& nTotalEventsDone,
+                                       GDALProgressFunc pfnProgress,
+                                       void *pProgressArg,
+                                       GDALVectorTranslateOptions *psOptions);
 };
 
 static OGRLayer* GetLayerAndOverwriteIfNecessary(GDALDataset *poDstDS,
@@ -4466,6 +4528,9 @@ std::unique_ptr<TargetLayerInfo> SetupTargetLayer::Setup(OGRLayer* poSrcLayer,
     psInfo->m_bPerFeatureCT = false;
     psInfo->m_poSrcLayer = poSrcLayer;
     psInfo->m_poDstLayer = poDstLayer;
+    psInfo->m_poSrcFDefn = poSrcLayer->GetLayerDefn();
+    psInfo->m_poDstFDefn = poDstLayer->GetLayerDefn();
+    psInfo->m_osSrcLayerName = poSrcLayer->GetName();
     psInfo->m_apoCT.resize(poDstLayer->GetLayerDefn()->GetGeomFieldCount());
     psInfo->m_aosTransformOptions.resize(poDstLayer->GetLayerDefn()->GetGeomFieldCount());
     psInfo->m_anMap = std::move(anMap);
@@ -4736,530 +4801,1127 @@ static bool SetupCT( TargetLayerInfo* psInfo,
 }
 
 /************************************************************************/
-/*                     LayerTranslator::Translate()                     */
+/*                  LayerTranslator::CanUseArrowAPI()                   */
 /************************************************************************/
 
-int LayerTranslator::Translate( OGRFeature* poFeatureIn,
-                                TargetLayerInfo* psInfo,
-                                GIntBig nCountLayerFeatures,
-                                GIntBig* pnReadFeatureCount,
-                                GIntBig& nTotalEventsDone,
-                                GDALProgressFunc pfnProgress,
-                                void *pProgressArg,
-                                GDALVectorTranslateOptions *psOptions )
+/* Whether features can be transferred as Arrow batches, that is when the */
+/* source and target layers both have a fast columnar implementation and */
+/* that no per-feature processing is requested. */
+bool LayerTranslator::CanUseArrowAPI(TargetLayerInfo* psInfo,
+                                     GDALVectorTranslateOptions *psOptions) const
 {
-    const int eGType = m_eGType;
-    OGRSpatialReference* poOutputSRS = m_poOutputSRS;
+    if( !CPLTestBool(CPLGetConfigOption("OGR2OGR_USE_ARROW_API", "YES")) )
+        return false;
 
     OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
     OGRLayer *poDstLayer = psInfo->m_poDstLayer;
-    const int* const panMap = psInfo->m_anMap.data();
-    const int iSrcZField = psInfo->m_iSrcZField;
-    const bool bPreserveFID = psInfo->m_bPreserveFID;
+    if( !poSrcLayer->TestCapability(OLCFastGetArrowStream) ||
+        !poDstLayer->TestCapability(OLCFastWriteArrowBatch) )
+    {
+        return false;
+    }
+
+    if( m_bTransform || m_bWrapDateline || m_poGCPCoordTrans != nullptr ||
+        m_poUserSourceSRS != nullptr ||
+        m_eGType != GEOMTYPE_UNCHANGED ||
+        m_eGeomTypeConversion != GTC_DEFAULT ||
+        m_bMakeValid ||
+        m_nCoordDim != COORD_DIM_UNCHANGED ||
+        m_eGeomOp != GEOMOP_NONE ||
+        m_poClipSrc != nullptr || m_poClipDst != nullptr ||
+        m_bExplodeCollections ||
+        m_nLimit >= 0 ||
+        psOptions->nFIDToFetch != OGRNullFID ||
+        psOptions->bSkipFailures ||
+        psOptions->bUpsert ||
+        psOptions->bEmptyStrAsNull ||
+        psInfo->m_iSrcZField >= 0 ||
+        psInfo->m_iSrcFIDField >= 0 ||
+        psInfo->m_iRequestedSrcGeomField >= 0 ||
+        psInfo->m_bPerFeatureCT ||
+        !psInfo->m_oMapResolved.empty() )
+    {
+        return false;
+    }
+
+    // Source fields that are not ignored must map to a target field of
+    // same name and type, since the Arrow columns are matched by name.
     const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
     const auto poDstFDefn = poDstLayer->GetLayerDefn();
-    const int nSrcGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
-    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
-    const bool bExplodeCollections = m_bExplodeCollections && nDstGeomFieldCount <= 1;
-    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
-
-    if( poOutputSRS == nullptr && !m_bNullifyOutputSRS )
+    for( int iField = 0; iField < poSrcFDefn->GetFieldCount(); ++iField )
     {
-        if( nSrcGeomFieldCount == 1 )
-        {
-            poOutputSRS = poSrcLayer->GetSpatialRef();
-        }
-        else if( iRequestedSrcGeomField > 0 )
+        const auto poSrcFieldDefn = poSrcFDefn->GetFieldDefn(iField);
+        if( poSrcFieldDefn->IsIgnored() )
+            continue;
+        const int iDstField = psInfo->m_anMap[iField];
+        if( iDstField < 0 )
+            return false;
+        const auto poDstFieldDefn = poDstFDefn->GetFieldDefn(iDstField);
+        if( strcmp(poSrcFieldDefn->GetNameRef(),
+                   poDstFieldDefn->GetNameRef()) != 0 ||
+            poSrcFieldDefn->GetType() != poDstFieldDefn->GetType() ||
+            poSrcFieldDefn->GetSubType() != poDstFieldDefn->GetSubType() )
         {
-            poOutputSRS = poSrcLayer->GetLayerDefn()->GetGeomFieldDefn(
-                iRequestedSrcGeomField)->GetSpatialRef();
+            return false;
         }
     }
 
-/* -------------------------------------------------------------------- */
-/*      Transfer features.                                              */
-/* -------------------------------------------------------------------- */
-    if( psOptions->nGroupTransactions )
+    int nSrcGeomFieldCount = 0;
+    for( int iGeom = 0; iGeom < poSrcFDefn->GetGeomFieldCount(); ++iGeom )
     {
-        if( psOptions->nLayerTransaction )
-        {
-            if( poDstLayer->StartTransaction() == OGRERR_FAILURE )
-            {
-                delete poFeatureIn;
-                return false;
-            }
-        }
+        if( !poSrcFDefn->GetGeomFieldDefn(iGeom)->IsIgnored() )
+            nSrcGeomFieldCount ++;
     }
+    return nSrcGeomFieldCount <= 1 &&
+           nSrcGeomFieldCount == poDstFDefn->GetGeomFieldCount();
+}
 
-    std::unique_ptr<OGRFeature> poFeature;
-    std::unique_ptr<OGRFeature> poDstFeature(new OGRFeature(poDstFDefn));
-    int         nFeaturesInTransaction = 0;
-    GIntBig      nCount = 0; /* written + failed */
-    GIntBig      nFeaturesWritten = 0;
+/************************************************************************/
+/*                  LayerTranslator::TranslateArrow()                   */
+/************************************************************************/
 
-    bool bRet = true;
-    CPLErrorReset();
-    while( true )
+bool LayerTranslator::TranslateArrow( TargetLayerInfo* psInfo,
+                                      GIntBig nCountLayerFeatures,
+                                      GIntBig* pnReadFeatureCount,
+                                      GIntBig& nTotalEventsDone,
+                                      GDALProgressFunc pfnProgress,
+                                      void *pProgressArg,
+                                      GDALVectorTranslateOptions *psOptions )
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+
+    CPLStringList aosStreamOptions;
+    CPLStringList aosWriteOptions;
+    if( psInfo->m_bPreserveFID )
     {
-        if( m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit )
-        {
-            break;
-        }
+        const char* pszFIDColumn = poSrcLayer->GetFIDColumn();
+        aosWriteOptions.SetNameValue("FID",
+            (pszFIDColumn && pszFIDColumn[0]) ? pszFIDColumn : "OGC_FID");
+    }
+    else
+    {
+        aosStreamOptions.SetNameValue("INCLUDE_FID", "NO");
+    }
 
-        if( poFeatureIn != nullptr )
-            poFeature.reset(poFeatureIn);
-        else if( psOptions->nFIDToFetch != OGRNullFID )
-            poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
-        else
-            poFeature.reset(poSrcLayer->GetNextFeature());
+    struct ArrowArrayStream stream;
+    if( !poSrcLayer->GetArrowStream(&stream, aosStreamOptions.List()) )
+        return false;
 
-        if( poFeature == nullptr )
+    struct ArrowSchema schema;
+    if( stream.get_schema(&stream, &schema) != 0 )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "stream.get_schema() failed");
+        stream.release(&stream);
+        return false;
+    }
+
+    if( psOptions->nGroupTransactions && psOptions->nLayerTransaction )
+    {
+        if( poDstLayer->StartTransaction() == OGRERR_FAILURE )
         {
-            if( CPLGetLastErrorType() == CE_Failure )
-            {
-                bRet = false;
-            }
-            break;
+            schema.release(&schema);
+            stream.release(&stream);
+            return false;
         }
+    }
 
-        if( psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT )
+    int         nFeaturesInTransaction = 0;
+    GIntBig     nCount = 0;
+    bool        bRet = true;
+    while( true )
+    {
+        struct ArrowArray array;
+        if( stream.get_next(&stream, &array) != 0 )
         {
-            if( !SetupCT( psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
-                          m_osDateLineOffset, m_poUserSourceSRS,
-                          poFeature.get(), poOutputSRS, m_poGCPCoordTrans) )
-            {
-                return false;
-            }
+            CPLError(CE_Failure, CPLE_AppDefined, "stream.get_next() failed");
+            bRet = false;
+            break;
         }
+        if( array.release == nullptr )
+            break;
 
-        psInfo->m_nFeaturesRead ++;
-
-        int nIters = 1;
-        std::unique_ptr<OGRGeometryCollection> poCollToExplode;
-        int iGeomCollToExplode = -1;
-        if (bExplodeCollections)
-        {
-            OGRGeometry* poSrcGeometry;
-            if( iRequestedSrcGeomField >= 0 )
-                poSrcGeometry = poFeature->GetGeomFieldRef(
-                                        iRequestedSrcGeomField);
-            else
-                poSrcGeometry = poFeature->GetGeometryRef();
-            if (poSrcGeometry &&
-                OGR_GT_IsSubClassOf(poSrcGeometry->getGeometryType(), wkbGeometryCollection) )
-            {
-                const int nParts = poSrcGeometry->toGeometryCollection()->getNumGeometries();
-                if( nParts > 0 )
-                {
-                    iGeomCollToExplode = iRequestedSrcGeomField >= 0 ?
-                        iRequestedSrcGeomField : 0;
-                    poCollToExplode.reset(
-                        poFeature->StealGeometry(iGeomCollToExplode)->toGeometryCollection());
-                    nIters = nParts;
-                }
-            }
+        const int nBatchSize = static_cast<int>(array.length);
+        const bool bWriteOK = poDstLayer->WriteArrowBatch(
+            &schema, &array, aosWriteOptions.List());
+        array.release(&array);
+        if( !bWriteOK )
+        {
+            if( psOptions->nGroupTransactions && psOptions->nLayerTransaction )
+                poDstLayer->RollbackTransaction();
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unable to write features from layer %s.",
+                     poSrcLayer->GetName());
+            bRet = false;
+            break;
         }
 
-        const GIntBig nSrcFID = poFeature->GetFID();
-        GIntBig nDesiredFID = OGRNullFID;
-        if( bPreserveFID )
-            nDesiredFID = nSrcFID;
-        else if( psInfo->m_iSrcFIDField >= 0 &&
-                 poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
-            nDesiredFID = poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
+        psInfo->m_nFeaturesRead += nBatchSize;
+        nCount += nBatchSize;
 
-        for(int iPart = 0; iPart < nIters; iPart++)
+        // Transactions are committed at batch boundaries, which may be
+        // less often than every -gt features.
+        if( psOptions->nLayerTransaction )
         {
-            if( psOptions->nLayerTransaction &&
-                ++nFeaturesInTransaction == psOptions->nGroupTransactions )
+            nFeaturesInTransaction += nBatchSize;
+            if( psOptions->nGroupTransactions &&
+                nFeaturesInTransaction >= psOptions->nGroupTransactions )
             {
                 if( poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
                     poDstLayer->StartTransaction() == OGRERR_FAILURE )
                 {
-                    return false;
+                    bRet = false;
+                    break;
                 }
                 nFeaturesInTransaction = 0;
             }
-            else if( !psOptions->nLayerTransaction &&
-                     psOptions->nGroupTransactions >= 0 &&
-                     ++nTotalEventsDone >= psOptions->nGroupTransactions )
+        }
+        else if( psOptions->nGroupTransactions >= 0 )
+        {
+            nTotalEventsDone += nBatchSize;
+            if( nTotalEventsDone >= psOptions->nGroupTransactions )
             {
                 if( m_poODS->CommitTransaction() == OGRERR_FAILURE ||
-                        m_poODS->StartTransaction(psOptions->bForceTransaction) == OGRERR_FAILURE )
+                    m_poODS->StartTransaction(psOptions->bForceTransaction) == OGRERR_FAILURE )
                 {
-                    return false;
+                    bRet = false;
+                    break;
                 }
                 nTotalEventsDone = 0;
             }
+        }
 
-            CPLErrorReset();
-            if( psInfo->m_bCanAvoidSetFrom )
-            {
-                poDstFeature = std::move(poFeature);
-                // From now on, poFeature is null !
-                poDstFeature->SetFDefnUnsafe(poDstFDefn);
-                poDstFeature->SetFID(nDesiredFID);
-            }
-            else
-            {
-                /* Optimization to avoid duplicating the source geometry in the */
-                /* target feature : we steal it from the source feature for now... */
-                OGRGeometry* poStolenGeometry = nullptr;
-                if( !bExplodeCollections && nSrcGeomFieldCount == 1 &&
-                    (nDstGeomFieldCount == 1 ||
-                     (nDstGeomFieldCount == 0 && m_poClipSrc)) )
-                {
-                    poStolenGeometry = poFeature->StealGeometry();
-                }
-                else if( !bExplodeCollections &&
-                         iRequestedSrcGeomField >= 0 )
-                {
-                    poStolenGeometry = poFeature->StealGeometry(
-                        iRequestedSrcGeomField);
-                }
+        if( pnReadFeatureCount )
+            *pnReadFeatureCount = nCount;
 
-                if( nDstGeomFieldCount == 0 && poStolenGeometry && m_poClipSrc )
-                {
-                    OGRGeometry* poClipped = poStolenGeometry->Intersection(m_poClipSrc);
-                    delete poStolenGeometry;
-                    poStolenGeometry = nullptr;
-                    if (poClipped == nullptr || poClipped->IsEmpty())
-                    {
-                        delete poClipped;
-                        goto end_loop;
-                    }
-                    delete poClipped;
-                }
+        if( pfnProgress &&
+            !pfnProgress(nCountLayerFeatures ?
+                            nCount * 1.0 / nCountLayerFeatures: 1.0,
+                         "", pProgressArg) )
+        {
+            bRet = false;
+            break;
+        }
+    }
 
-                poDstFeature->Reset();
-                if( poDstFeature->SetFrom( poFeature.get(), panMap, TRUE ) != OGRERR_NONE )
-                {
-                    if( psOptions->nGroupTransactions )
-                    {
-                        if( psOptions->nLayerTransaction )
-                        {
-                            if( poDstLayer->CommitTransaction() != OGRERR_NONE )
-                            {
-                                OGRGeometryFactory::destroyGeometry( poStolenGeometry );
-                                return false;
-                            }
-                        }
-                    }
+    schema.release(&schema);
+    stream.release(&stream);
 
-                    CPLError( CE_Failure, CPLE_AppDefined,
-                            "Unable to translate feature " CPL_FRMT_GIB " from layer %s.",
-                            nSrcFID, poSrcLayer->GetName() );
+    if( bRet && psOptions->nGroupTransactions && psOptions->nLayerTransaction )
+    {
+        if( poDstLayer->CommitTransaction() != OGRERR_NONE )
+            bRet = false;
+    }
 
-                    OGRGeometryFactory::destroyGeometry( poStolenGeometry );
-                    return false;
-                }
+    CPLDebug("GDALVectorTranslate",
+             CPL_FRMT_GIB " features written in layer '%s' (Arrow API)",
+             nCount, poDstLayer->GetName());
 
-                /* ... and now we can attach the stolen geometry */
-                if( poStolenGeometry )
-                {
-                    poDstFeature->SetGeometryDirectly(poStolenGeometry);
-                }
+    return bRet;
+}
 
-                if( !psInfo->m_oMapResolved.empty() )
-                {
-                    for( const auto& kv: psInfo->m_oMapResolved )
-                    {
-                        const int nDstField = kv.first;
-                        const int nSrcField = kv.second.nSrcField;
-                        if( poFeature->IsFieldSetAndNotNull(nSrcField) )
-                        {
-                            const auto poDomain = kv.second.poDomain;
-                            const auto& oMapKV = psInfo->m_oMapDomainToKV[poDomain];
-                            const auto iter = oMapKV.find(
-                                poFeature->GetFieldAsString(nSrcField));
-                            if( iter != oMapKV.end() )
-                            {
-                                poDstFeature->SetField(nDstField, iter->second.c_str());
-                            }
-                        }
-                    }
-                }
+/************************************************************************/
+/*                   LayerTranslator::ProcessFeature()                  */
+/************************************************************************/
 
-                if( nDesiredFID != OGRNullFID )
-                    poDstFeature->SetFID( nDesiredFID );
-            }
+/* Fill poDstFeature from poFeature and apply the requested geometry */
+/* operations. This does not access the source and target datasets and */
+/* layers (their definitions and names are fetched by SetupTargetLayer), */
+/* so it can run in worker threads, provided that apoCT and oCache are */
+/* private to the calling thread. */
+LayerTranslator::FeatureStatus
+LayerTranslator::ProcessFeature( TargetLayerInfo* psInfo,
+                                 std::unique_ptr<OGRFeature>& poFeature,
+                                 std::unique_ptr<OGRFeature>& poDstFeature,
+                                 OGRGeometryCollection* poCollToExplode,
+                                 int iGeomCollToExplode,
+                                 GIntBig nSrcFID,
+                                 GIntBig nDesiredFID,
+                                 OGRSpatialReference* poOutputSRS,
+                                 const std::vector<std::unique_ptr<OGRCoordinateTransformation>>& apoCT,
+                                 const OGRGeometryFactory::TransformWithOptionsCache& oCache,
+                                 GDALVectorTranslateOptions *psOptions,
+                                 bool& bReprojectionFailed ) const
+{
+    const int eGType = m_eGType;
+    const char* pszSrcLayerName = psInfo->m_osSrcLayerName.c_str();
+    const int* const panMap = psInfo->m_anMap.data();
+    const int iSrcZField = psInfo->m_iSrcZField;
+    const auto poDstFDefn = psInfo->m_poDstFDefn;
+    const int nSrcGeomFieldCount = psInfo->m_poSrcFDefn->GetGeomFieldCount();
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
+    const bool bExplodeCollections = m_bExplodeCollections && nDstGeomFieldCount <= 1;
+    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
 
-            if (psOptions->bEmptyStrAsNull) {
-                for( int i=0; i < poDstFeature->GetFieldCount(); i++ )
-                {
-                    if (!poDstFeature->IsFieldSetAndNotNull(i))
-                        continue;
-                    auto fieldDef = poDstFeature->GetFieldDefnRef(i);
-                    if (fieldDef->GetType() != OGRFieldType::OFTString)
-                        continue;
-                    auto str = poDstFeature->GetFieldAsString(i);
-                    if (strcmp(str, "") == 0)
-                        poDstFeature->SetFieldNull(i);
-                }
-            }
+    bReprojectionFailed = false;
 
-            /* Erase native data if asked explicitly */
-            if( !m_bNativeData )
-            {
-                poDstFeature->SetNativeData(nullptr);
-                poDstFeature->SetNativeMediaType(nullptr);
-            }
+    if( psInfo->m_bCanAvoidSetFrom )
+    {
+        poDstFeature = std::move(poFeature);
+        // From now on, poFeature is null !
+        poDstFeature->SetFDefnUnsafe(poDstFDefn);
+        poDstFeature->SetFID(nDesiredFID);
+    }
+    else
+    {
+        /* Optimization to avoid duplicating the source geometry in the */
+        /* target feature : we steal it from the source feature for now... */
+        OGRGeometry* poStolenGeometry = nullptr;
+        if( !bExplodeCollections && nSrcGeomFieldCount == 1 &&
+            (nDstGeomFieldCount == 1 ||
+             (nDstGeomFieldCount == 0 && m_poClipSrc)) )
+        {
+            poStolenGeometry = poFeature->StealGeometry();
+        }
+        else if( !bExplodeCollections &&
+                 iRequestedSrcGeomField >= 0 )
+        {
+            poStolenGeometry = poFeature->StealGeometry(
+                iRequestedSrcGeomField);
+        }
 
-            for( int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom ++ )
+        if( nDstGeomFieldCount == 0 && poStolenGeometry && m_poClipSrc )
+        {
+            OGRGeometry* poClipped = poStolenGeometry->Intersection(m_poClipSrc);
+            delete poStolenGeometry;
+            poStolenGeometry = nullptr;
+            if (poClipped == nullptr || poClipped->IsEmpty())
             {
-                OGRGeometry* poDstGeometry;
+                delete poClipped;
+                return FeatureStatus::DISCARD;
+            }
+            delete poClipped;
+        }
 
-                if( poCollToExplode && iGeom == iGeomCollToExplode )
-                {
-                    OGRGeometry* poPart = poCollToExplode->getGeometryRef(0);
-                    poCollToExplode->removeGeometry(0, FALSE);
-                    poDstGeometry = poPart;
-                    assert(poDstGeometry);
-                }
-                else
-                {
-                    poDstGeometry = poDstFeature->StealGeometry(iGeom);
-                    if (poDstGeometry == nullptr)
-                        continue;
-                }
+        poDstFeature->Reset();
+        if( poDstFeature->SetFrom( poFeature.get(), panMap, TRUE ) != OGRERR_NONE )
+        {
+            CPLError( CE_Failure, CPLE_AppDefined,
+                    "Unable to translate feature " CPL_FRMT_GIB " from layer %s.",
+                    nSrcFID, pszSrcLayerName );
 
-                // poFeature hasn't been moved if iSrcZField != -1
-                // cppcheck-suppress accessMoved
-                if (iSrcZField != -1 && poFeature != nullptr)
-                {
-                    SetZ(poDstGeometry, poFeature->GetFieldAsDouble(iSrcZField));
-                    /* This will correct the coordinate dimension to 3 */
-                    OGRGeometry* poDupGeometry = poDstGeometry->clone();
-                    delete poDstGeometry;
-                    poDstGeometry = poDupGeometry;
-                }
+            OGRGeometryFactory::destroyGeometry( poStolenGeometry );
+            return FeatureStatus::FAILURE;
+        }
 
-                if (m_nCoordDim == 2 || m_nCoordDim == 3)
-                {
-                    poDstGeometry->setCoordinateDimension( m_nCoordDim );
-                }
-                else if (m_nCoordDim == 4)
-                {
-                    poDstGeometry->set3D( TRUE );
-                    poDstGeometry->setMeasured( TRUE );
-                }
-                else if (m_nCoordDim == COORD_DIM_XYM)
-                {
-                    poDstGeometry->set3D( FALSE );
-                    poDstGeometry->setMeasured( TRUE );
-                }
-                else if ( m_nCoordDim == COORD_DIM_LAYER_DIM )
-                {
-                    const OGRwkbGeometryType eDstLayerGeomType =
-                      poDstLayer->GetLayerDefn()->GetGeomFieldDefn(iGeom)->GetType();
-                    poDstGeometry->set3D( wkbHasZ(eDstLayerGeomType) );
-                    poDstGeometry->setMeasured( wkbHasM(eDstLayerGeomType) );
-                }
+        /* ... and now we can attach the stolen geometry */
+        if( poStolenGeometry )
+        {
+            poDstFeature->SetGeometryDirectly(poStolenGeometry);
+        }
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
-                {
-                    if (m_dfGeomOpParam > 0)
-                        poDstGeometry->segmentize(m_dfGeomOpParam);
-                }
-                else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+        if( !psInfo->m_oMapResolved.empty() )
+        {
+            for( const auto& kv: psInfo->m_oMapResolved )
+            {
+                const int nDstField = kv.first;
+                const int nSrcField = kv.second.nSrcField;
+                if( poFeature->IsFieldSetAndNotNull(nSrcField) )
                 {
-                    if (m_dfGeomOpParam > 0)
+                    const auto poDomain = kv.second.poDomain;
+                    // Use find() rather than operator[] since this
+                    // may run concurrently in several threads.
+                    const auto oIterKV =
+                        psInfo->m_oMapDomainToKV.find(poDomain);
+                    if( oIterKV == psInfo->m_oMapDomainToKV.end() )
+                        continue;
+                    const auto& oMapKV = oIterKV->second;
+                    const auto iter = oMapKV.find(
+                        poFeature->GetFieldAsString(nSrcField));
+                    if( iter != oMapKV.end() )
                     {
-                        OGRGeometry* poNewGeom = poDstGeometry->SimplifyPreserveTopology(m_dfGeomOpParam);
-                        if (poNewGeom)
-                        {
-                            delete poDstGeometry;
-                            poDstGeometry = poNewGeom;
-                        }
+                        poDstFeature->SetField(nDstField, iter->second.c_str());
                     }
                 }
+            }
+        }
 
-                if (m_poClipSrc)
-                {
-                    OGRGeometry* poClipped = poDstGeometry->Intersection(m_poClipSrc);
-                    if (poClipped == nullptr || poClipped->IsEmpty())
-                    {
-                        delete poDstGeometry;
-                        delete poClipped;
-                        goto end_loop;
-                    }
+        if( nDesiredFID != OGRNullFID )
+            poDstFeature->SetFID( nDesiredFID );
+    }
 
-                    const int nDim = poDstGeometry->getDimension();
-                    if (poClipped->getDimension() < nDim &&
-                        wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) != wkbUnknown)
-                    {
-                        CPLDebug("OGR2OGR",
-                                 "Discarding feature " CPL_FRMT_GIB " of layer %s, "
-                                 "as its intersection with -clipsrc is a %s "
-                                 "whereas the input is a %s",
-                                 nSrcFID, poSrcLayer->GetName(),
-                                 OGRToOGCGeomType(poClipped->getGeometryType()),
-                                 OGRToOGCGeomType(poDstGeometry->getGeometryType()));
-                        delete poDstGeometry;
-                        delete poClipped;
-                        goto end_loop;
-                    }
+    if (psOptions->bEmptyStrAsNull) {
+        for( int i=0; i < poDstFeature->GetFieldCount(); i++ )
+        {
+            if (!poDstFeature->IsFieldSetAndNotNull(i))
+                continue;
+            auto fieldDef = poDstFeature->GetFieldDefnRef(i);
+            if (fieldDef->GetType() != OGRFieldType::OFTString)
+                continue;
+            auto str = poDstFeature->GetFieldAsString(i);
+            if (strcmp(str, "") == 0)
+                poDstFeature->SetFieldNull(i);
+        }
+    }
+
+    /* Erase native data if asked explicitly */
+    if( !m_bNativeData )
+    {
+        poDstFeature->SetNativeData(nullptr);
+        poDstFeature->SetNativeMediaType(nullptr);
+    }
+
+    for( int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom ++ )
+    {
+        OGRGeometry* poDstGeometry;
+
+        if( poCollToExplode && iGeom == iGeomCollToExplode )
+        {
+            OGRGeometry* poPart = poCollToExplode->getGeometryRef(0);
+            poCollToExplode->removeGeometry(0, FALSE);
+            poDstGeometry = poPart;
+            assert(poDstGeometry);
+        }
+        else
+        {
+            poDstGeometry = poDstFeature->StealGeometry(iGeom);
+            if (poDstGeometry == nullptr)
+                continue;
+        }
+
+        // poFeature hasn't been moved if iSrcZField != -1
+        // cppcheck-suppress accessMoved
+        if (iSrcZField != -1 && poFeature != nullptr)
+        {
+            SetZ(poDstGeometry, poFeature->GetFieldAsDouble(iSrcZField));
+            /* This will correct the coordinate dimension to 3 */
+            OGRGeometry* poDupGeometry = poDstGeometry->clone();
+            delete poDstGeometry;
+            poDstGeometry = poDupGeometry;
+        }
+
+        if (m_nCoordDim == 2 || m_nCoordDim == 3)
+        {
+            poDstGeometry->setCoordinateDimension( m_nCoordDim );
+        }
+        else if (m_nCoordDim == 4)
+        {
+            poDstGeometry->set3D( TRUE );
+            poDstGeometry->setMeasured( TRUE );
+        }
+        else if (m_nCoordDim == COORD_DIM_XYM)
+        {
+            poDstGeometry->set3D( FALSE );
+            poDstGeometry->setMeasured( TRUE );
+        }
+        else if ( m_nCoordDim == COORD_DIM_LAYER_DIM )
+        {
+            const OGRwkbGeometryType eDstLayerGeomType =
+              poDstFDefn->GetGeomFieldDefn(iGeom)->GetType();
+            poDstGeometry->set3D( wkbHasZ(eDstLayerGeomType) );
+            poDstGeometry->setMeasured( wkbHasM(eDstLayerGeomType) );
+        }
 
+        if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+        {
+            if (m_dfGeomOpParam > 0)
+                poDstGeometry->segmentize(m_dfGeomOpParam);
+        }
+        else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+        {
+            if (m_dfGeomOpParam > 0)
+            {
+                OGRGeometry* poNewGeom = poDstGeometry->SimplifyPreserveTopology(m_dfGeomOpParam);
+                if (poNewGeom)
+                {
                     delete poDstGeometry;
-                    poDstGeometry = poClipped;
+                    poDstGeometry = poNewGeom;
                 }
+            }
+        }
+
+        if (m_poClipSrc)
+        {
+            OGRGeometry* poClipped = poDstGeometry->Intersection(m_poClipSrc);
+            if (poClipped == nullptr || poClipped->IsEmpty())
+            {
+                delete poDstGeometry;
+                delete poClipped;
+                return FeatureStatus::DISCARD;
+            }
+
+            const int nDim = poDstGeometry->getDimension();
+            if (poClipped->getDimension() < nDim &&
+                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) != wkbUnknown)
+            {
+                CPLDebug("OGR2OGR",
+                         "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                         "as its intersection with -clipsrc is a %s "
+                         "whereas the input is a %s",
+                         nSrcFID, pszSrcLayerName,
+                         OGRToOGCGeomType(poClipped->getGeometryType()),
+                         OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                delete poDstGeometry;
+                delete poClipped;
+                return FeatureStatus::DISCARD;
+            }
+
+            delete poDstGeometry;
+            poDstGeometry = poClipped;
+        }
 
-                OGRCoordinateTransformation* const poCT = psInfo->m_apoCT[iGeom].get();
-                char** const papszTransformOptions = psInfo->m_aosTransformOptions[iGeom].List();
+        OGRCoordinateTransformation* const poCT = apoCT[iGeom].get();
+        char** const papszTransformOptions = psInfo->m_aosTransformOptions[iGeom].List();
 
-                if( poCT != nullptr || papszTransformOptions != nullptr)
+        if( poCT != nullptr || papszTransformOptions != nullptr)
+        {
+            OGRGeometry* poReprojectedGeom =
+                OGRGeometryFactory::transformWithOptions(
+                    poDstGeometry, poCT, papszTransformOptions, oCache);
+            if( poReprojectedGeom == nullptr )
+            {
+                bReprojectionFailed = true;
+                CPLError( CE_Failure, CPLE_AppDefined, "Failed to reproject feature " CPL_FRMT_GIB " (geometry probably out of source or destination SRS).",
+                          nSrcFID );
+                if( !psOptions->bSkipFailures )
                 {
-                    OGRGeometry* poReprojectedGeom =
-                        OGRGeometryFactory::transformWithOptions(
-                            poDstGeometry, poCT, papszTransformOptions, m_transformWithOptionsCache);
-                    if( poReprojectedGeom == nullptr )
-                    {
-                        if( psOptions->nGroupTransactions )
-                        {
-                            if( psOptions->nLayerTransaction )
-                            {
-                                if( poDstLayer->CommitTransaction() != OGRERR_NONE &&
-                                    !psOptions->bSkipFailures )
-                                {
-                                    delete poDstGeometry;
-                                    return false;
-                                }
-                            }
-                        }
+                    delete poDstGeometry;
+                    return FeatureStatus::FAILURE;
+                }
+            }
 
-                        CPLError( CE_Failure, CPLE_AppDefined, "Failed to reproject feature " CPL_FRMT_GIB " (geometry probably out of source or destination SRS).",
-                                  nSrcFID );
-                        if( !psOptions->bSkipFailures )
-                        {
-                            delete poDstGeometry;
-                            return false;
-                        }
-                    }
+            delete poDstGeometry;
+            poDstGeometry = poReprojectedGeom;
+        }
+        else if (poOutputSRS != nullptr)
+        {
+            poDstGeometry->assignSpatialReference(poOutputSRS);
+        }
 
+        if( poDstGeometry != nullptr )
+        {
+            if (m_poClipDst)
+            {
+                OGRGeometry* poClipped = poDstGeometry->Intersection(m_poClipDst);
+                if (poClipped == nullptr || poClipped->IsEmpty())
+                {
                     delete poDstGeometry;
-                    poDstGeometry = poReprojectedGeom;
+                    delete poClipped;
+                    return FeatureStatus::DISCARD;
                 }
-                else if (poOutputSRS != nullptr)
+
+                const int nDim = poDstGeometry->getDimension();
+                if (poClipped->getDimension() < nDim &&
+                    wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) != wkbUnknown)
                 {
-                    poDstGeometry->assignSpatialReference(poOutputSRS);
+                    CPLDebug("OGR2OGR",
+                             "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                             "as its intersection with -clipdst is a %s "
+                             "whereas the input is a %s",
+                             nSrcFID, pszSrcLayerName,
+                             OGRToOGCGeomType(poClipped->getGeometryType()),
+                             OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                    delete poDstGeometry;
+                    delete poClipped;
+                    return FeatureStatus::DISCARD;
                 }
 
-                if( poDstGeometry != nullptr )
+                delete poDstGeometry;
+                poDstGeometry = poClipped;
+            }
+
+            if( m_bMakeValid )
+            {
+                const bool bIsGeomCollection =
+                    wkbFlatten(poDstGeometry->getGeometryType()) == wkbGeometryCollection;
+                OGRGeometry* poValidGeom = poDstGeometry->MakeValid();
+                delete poDstGeometry;
+                poDstGeometry = poValidGeom;
+                if( poDstGeometry == nullptr )
+                    return FeatureStatus::DISCARD;
+                if( !bIsGeomCollection )
                 {
-                    if (m_poClipDst)
-                    {
-                        OGRGeometry* poClipped = poDstGeometry->Intersection(m_poClipDst);
-                        if (poClipped == nullptr || poClipped->IsEmpty())
-                        {
-                            delete poDstGeometry;
-                            delete poClipped;
-                            goto end_loop;
-                        }
+                    OGRGeometry* poCleanedGeom =
+                        OGRGeometryFactory::removeLowerDimensionSubGeoms(poDstGeometry);
+                    delete poDstGeometry;
+                    poDstGeometry = poCleanedGeom;
+                }
+            }
 
-                        const int nDim = poDstGeometry->getDimension();
-                        if (poClipped->getDimension() < nDim &&
-                            wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) != wkbUnknown)
-                        {
-                            CPLDebug("OGR2OGR",
-                                     "Discarding feature " CPL_FRMT_GIB " of layer %s, "
-                                     "as its intersection with -clipdst is a %s "
-                                     "whereas the input is a %s",
-                                     nSrcFID, poSrcLayer->GetName(),
-                                     OGRToOGCGeomType(poClipped->getGeometryType()),
-                                     OGRToOGCGeomType(poDstGeometry->getGeometryType()));
-                            delete poDstGeometry;
-                            delete poClipped;
-                            goto end_loop;
-                        }
+            if( eGType != GEOMTYPE_UNCHANGED )
+            {
+                poDstGeometry = OGRGeometryFactory::forceTo(
+                        poDstGeometry, static_cast<OGRwkbGeometryType>(eGType));
+            }
+            else if( m_eGeomTypeConversion == GTC_PROMOTE_TO_MULTI ||
+                    m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+                    m_eGeomTypeConversion == GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR ||
+                    m_eGeomTypeConversion == GTC_CONVERT_TO_CURVE )
+            {
+                OGRwkbGeometryType eTargetType = poDstGeometry->getGeometryType();
+                eTargetType = ConvertType(m_eGeomTypeConversion, eTargetType);
+                poDstGeometry = OGRGeometryFactory::forceTo(poDstGeometry, eTargetType);
+            }
+        }
 
-                        delete poDstGeometry;
-                        poDstGeometry = poClipped;
-                    }
+        poDstFeature->SetGeomFieldDirectly(iGeom, poDstGeometry);
+    }
 
-                    if( m_bMakeValid )
-                    {
-                        const bool bIsGeomCollection =
-                            wkbFlatten(poDstGeometry->getGeometryType()) == wkbGeometryCollection;
-                        OGRGeometry* poValidGeom = poDstGeometry->MakeValid();
-                        delete poDstGeometry;
-                        poDstGeometry = poValidGeom;
-                        if( poDstGeometry == nullptr )
-                            goto end_loop;
-                        if( !bIsGeomCollection )
-                        {
-                            OGRGeometry* poCleanedGeom =
-                                OGRGeometryFactory::removeLowerDimensionSubGeoms(poDstGeometry);
-                            delete poDstGeometry;
-                            poDstGeometry = poCleanedGeom;
-                        }
-                    }
 
-                    if( eGType != GEOMTYPE_UNCHANGED )
-                    {
-                        poDstGeometry = OGRGeometryFactory::forceTo(
-                                poDstGeometry, static_cast<OGRwkbGeometryType>(eGType));
-                    }
-                    else if( m_eGeomTypeConversion == GTC_PROMOTE_TO_MULTI ||
-                            m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                            m_eGeomTypeConversion == GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR ||
-                            m_eGeomTypeConversion == GTC_CONVERT_TO_CURVE )
+    return FeatureStatus::OK;
+}
+
+/************************************************************************/
+/*            LayerTranslator::StartNewTransactionIfNeeded()            */
+/************************************************************************/
+
+/* Account for a new feature, and commit the current transaction and start */
+/* a new one when -gt features have been processed. */
+bool LayerTranslator::StartNewTransactionIfNeeded(
+                                        OGRLayer* poDstLayer,
+                                        int& nFeaturesInTransaction,
+                                        GIntBig& nTotalEventsDone,
+                                        GDALVectorTranslateOptions *psOptions )
+{
+    if( psOptions->nLayerTransaction &&
+        ++nFeaturesInTransaction == psOptions->nGroupTransactions )
+    {
+        if( poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+            poDstLayer->StartTransaction() == OGRERR_FAILURE )
+        {
+            return false;
+        }
+        nFeaturesInTransaction = 0;
+    }
+    else if( !psOptions->nLayerTransaction &&
+             psOptions->nGroupTransactions >= 0 &&
+             ++nTotalEventsDone >= psOptions->nGroupTransactions )
+    {
+        if( m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+                m_poODS->StartTransaction(psOptions->bForceTransaction) == OGRERR_FAILURE )
+        {
+            return false;
+        }
+        nTotalEventsDone = 0;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    LayerTranslator::WriteFeature()                   */
+/************************************************************************/
+
+/* Returns false if the translation must be aborted. */
+bool LayerTranslator::WriteFeature( TargetLayerInfo* psInfo,
+                                    OGRFeature* poDstFeature,
+                                    GIntBig nSrcFID,
+                                    GIntBig nDesiredFID,
+                                    GIntBig& nFeaturesWritten,
+                                    GDALVectorTranslateOptions *psOptions )
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+
+    CPLErrorReset();
+    if( (psOptions->bUpsert ?
+            poDstLayer->UpsertFeature( poDstFeature ) :
+            poDstLayer->CreateFeature( poDstFeature )) == OGRERR_NONE )
+    {
+        nFeaturesWritten ++;
+        if( nDesiredFID != OGRNullFID  && poDstFeature->GetFID() != nDesiredFID )
+        {
+            CPLError( CE_Warning, CPLE_AppDefined,
+                      "Feature id not preserved");
+        }
+    }
+    else if( !psOptions->bSkipFailures )
+    {
+        if( psOptions->nGroupTransactions )
+        {
+            if( psOptions->nLayerTransaction )
+                poDstLayer->RollbackTransaction();
+        }
+
+        CPLError( CE_Failure, CPLE_AppDefined,
+                "Unable to write feature " CPL_FRMT_GIB " from layer %s.",
+                nSrcFID, poSrcLayer->GetName() );
+
+        return false;
+    }
+    else
+    {
+        CPLDebug( "GDALVectorTranslate", "Unable to write feature " CPL_FRMT_GIB " into layer %s.",
+                   nSrcFID, poSrcLayer->GetName() );
+        if( psOptions->nGroupTransactions )
+        {
+            if( psOptions->nLayerTransaction )
+            {
+                poDstLayer->RollbackTransaction();
+                CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
+            }
+            else
+            {
+                m_poODS->RollbackTransaction();
+                m_poODS->StartTransaction(psOptions->bForceTransaction);
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                LayerTranslator::ProcessFeaturesJob()                 */
+/************************************************************************/
+
+struct LayerTranslator::PendingFeature
+{
+    std::unique_ptr<OGRFeature> poSrcFeature{};
+    std::unique_ptr<OGRFeature> poDstFeature{};
+    GIntBig       nSrcFID = OGRNullFID;
+    GIntBig       nDesiredFID = OGRNullFID;
+    FeatureStatus eStatus = FeatureStatus::OK;
+    bool          bReprojectionFailed = false;
+    // Errors emitted while processing the feature in a worker thread,
+    // re-emitted from the calling thread when the feature is written.
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+
+struct LayerTranslator::ProcessJob
+{
+    const LayerTranslator* poTranslator = nullptr;
+    TargetLayerInfo* psInfo = nullptr;
+    OGRSpatialReference* poOutputSRS = nullptr;
+    GDALVectorTranslateOptions* psOptions = nullptr;
+    // Coordinate transformations are not thread-safe: each job has its own.
+    std::vector<std::unique_ptr<OGRCoordinateTransformation>> apoCT{};
+    OGRGeometryFactory::TransformWithOptionsCache oCache{};
+    PendingFeature* pasFeatures = nullptr;
+    size_t nFeatures = 0;
+};
+
+void LayerTranslator::ProcessFeaturesJob(void* pData)
+{
+    auto psJob = static_cast<ProcessJob*>(pData);
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+    for( size_t i = 0; i < psJob->nFeatures; ++i )
+    {
+        auto& oFeature = psJob->pasFeatures[i];
+        oFeature.eStatus = psJob->poTranslator->ProcessFeature(
+            psJob->psInfo, oFeature.poSrcFeature, oFeature.poDstFeature,
+            nullptr, -1, oFeature.nSrcFID, oFeature.nDesiredFID,
+            psJob->poOutputSRS, psJob->apoCT, psJob->oCache,
+            psJob->psOptions, oFeature.bReprojectionFailed);
+        oFeature.aoErrors.clear();
+        std::swap(oFeature.aoErrors, aoErrors);
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*              LayerTranslator::TranslateMultiThreaded()               */
+/************************************************************************/
+
+/* Pipelined version of Translate(): the main thread reads a batch of      */
+/* features, and writes the previous one in order, while worker threads    */
+/* apply the geometry processing on the current batch. At most two batches */
+/* are in flight. */
+int LayerTranslator::TranslateMultiThreaded( TargetLayerInfo* psInfo,
+                                             GIntBig nCountLayerFeatures,
+                                             GIntBig* pnReadFeatureCount,
+                                             GIntBig& nTotalEventsDone,
+                                             GDALProgressFunc pfnProgress,
+                                             void *pProgressArg,
+                                             OGRSpatialReference* poOutputSRS,
+                                             int nThreads,
+                                             GDALVectorTranslateOptions *psOptions )
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    const auto poDstFDefn = poDstLayer->GetLayerDefn();
+    const bool bPreserveFID = psInfo->m_bPreserveFID;
+
+    CPLWorkerThreadPool* poPool = GDALGetGlobalThreadPool(nThreads);
+    if( poPool == nullptr )
+        return false;
+    auto poQueue = poPool->CreateJobQueue();
+
+    if( psOptions->nGroupTransactions && psOptions->nLayerTransaction )
+    {
+        if( poDstLayer->StartTransaction() == OGRERR_FAILURE )
+            return false;
+    }
+
+    const size_t nBatchSize = static_cast<size_t>(nThreads) * 256;
+    std::vector<PendingFeature> aoBatches[2];
+    size_t anBatchCount[2] = { 0, 0 };
+    std::vector<std::unique_ptr<ProcessJob>> apoJobs;
+
+    bool bRet = true;
+    bool bEOF = false;
+    const auto ReadBatch = [&](int iBatch)
+    {
+        auto& aoBatch = aoBatches[iBatch];
+        size_t nRead = 0;
+        while( !bEOF && nRead < nBatchSize )
+        {
+            if( m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit )
+            {
+                bEOF = true;
+                break;
+            }
+
+            CPLErrorReset();
+            std::unique_ptr<OGRFeature> poFeature(poSrcLayer->GetNextFeature());
+            if( poFeature == nullptr )
+            {
+                if( CPLGetLastErrorType() == CE_Failure )
+                    bRet = false;
+                bEOF = true;
+                break;
+            }
+
+            if( psInfo->m_nFeaturesRead == 0 )
+            {
+                if( !SetupCT( psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                              m_osDateLineOffset, m_poUserSourceSRS,
+                              poFeature.get(), poOutputSRS, m_poGCPCoordTrans) )
+                {
+                    bRet = false;
+                    bEOF = true;
+                    break;
+                }
+            }
+            psInfo->m_nFeaturesRead ++;
+
+            if( nRead == aoBatch.size() )
+                aoBatch.resize(nRead + 1);
+            auto& oFeature = aoBatch[nRead];
+            oFeature.nSrcFID = poFeature->GetFID();
+            oFeature.nDesiredFID = OGRNullFID;
+            if( bPreserveFID )
+                oFeature.nDesiredFID = oFeature.nSrcFID;
+            else if( psInfo->m_iSrcFIDField >= 0 &&
+                     poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
+                oFeature.nDesiredFID = poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
+            oFeature.poSrcFeature = std::move(poFeature);
+            if( oFeature.poDstFeature == nullptr )
+                oFeature.poDstFeature.reset(new OGRFeature(poDstFDefn));
+            ++nRead;
+        }
+        anBatchCount[iBatch] = nRead;
+    };
+
+    const auto SubmitBatch = [&](int iBatch)
+    {
+        if( apoJobs.empty() )
+        {
+            // Done after the first feature has been read, so that SetupCT()
+            // has run.
+            for( int i = 0; i < nThreads; ++i )
+            {
+                auto poJob = cpl::make_unique<ProcessJob>();
+                poJob->poTranslator = this;
+                poJob->psInfo = psInfo;
+                poJob->poOutputSRS = poOutputSRS;
+                poJob->psOptions = psOptions;
+                for( const auto& poCT: psInfo->m_apoCT )
+                {
+                    poJob->apoCT.emplace_back(poCT ? poCT->Clone() : nullptr);
+                    if( poCT && poJob->apoCT.back() == nullptr )
                     {
-                        OGRwkbGeometryType eTargetType = poDstGeometry->getGeometryType();
-                        eTargetType = ConvertType(m_eGeomTypeConversion, eTargetType);
-                        poDstGeometry = OGRGeometryFactory::forceTo(poDstGeometry, eTargetType);
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Cannot clone coordinate transformation");
+                        return false;
                     }
                 }
+                apoJobs.emplace_back(std::move(poJob));
+            }
+        }
+
+        const size_t nCount = anBatchCount[iBatch];
+        const size_t nPerJob = (nCount + apoJobs.size() - 1) / apoJobs.size();
+        for( size_t iJob = 0; iJob < apoJobs.size(); ++iJob )
+        {
+            const size_t nStart = iJob * nPerJob;
+            if( nStart >= nCount )
+                break;
+            apoJobs[iJob]->pasFeatures = aoBatches[iBatch].data() + nStart;
+            apoJobs[iJob]->nFeatures = std::min(nPerJob, nCount - nStart);
+            poQueue->SubmitJob(ProcessFeaturesJob, apoJobs[iJob].get());
+        }
+        return true;
+    };
+
+    int         nFeaturesInTransaction = 0;
+    GIntBig     nCount = 0; /* written + failed */
+    GIntBig     nFeaturesWritten = 0;
+    const auto WriteBatch = [&](int iBatch)
+    {
+        for( size_t i = 0; i < anBatchCount[iBatch]; ++i )
+        {
+            auto& oFeature = aoBatches[iBatch][i];
+            // In feature order, so that the error handlers of the caller
+            // see the same sequence as in the single-threaded case.
+            for( const auto& oError: oFeature.aoErrors )
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            oFeature.aoErrors.clear();
 
-                poDstFeature->SetGeomFieldDirectly(iGeom, poDstGeometry);
+            if( !StartNewTransactionIfNeeded(poDstLayer, nFeaturesInTransaction,
+                                             nTotalEventsDone, psOptions) )
+            {
+                return false;
             }
 
-            CPLErrorReset();
-            if( (psOptions->bUpsert ?
-                    poDstLayer->UpsertFeature( poDstFeature.get() ) :
-                    poDstLayer->CreateFeature( poDstFeature.get() )) == OGRERR_NONE )
+            if( (oFeature.eStatus == FeatureStatus::FAILURE ||
+                 oFeature.bReprojectionFailed) &&
+                psOptions->nGroupTransactions && psOptions->nLayerTransaction )
             {
-                nFeaturesWritten ++;
-                if( nDesiredFID != OGRNullFID  && poDstFeature->GetFID() != nDesiredFID )
+                if( poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                    !psOptions->bSkipFailures )
                 {
-                    CPLError( CE_Warning, CPLE_AppDefined,
-                              "Feature id not preserved");
+                    return false;
                 }
             }
-            else if( !psOptions->bSkipFailures )
+            if( oFeature.eStatus == FeatureStatus::FAILURE )
+                return false;
+            if( oFeature.eStatus == FeatureStatus::OK &&
+                !WriteFeature(psInfo, oFeature.poDstFeature.get(),
+                              oFeature.nSrcFID, oFeature.nDesiredFID,
+                              nFeaturesWritten, psOptions) )
+            {
+                return false;
+            }
+            oFeature.poSrcFeature.reset();
+
+            nCount ++;
+            if( pfnProgress &&
+                !pfnProgress(nCountLayerFeatures ?
+                                nCount * 1.0 / nCountLayerFeatures: 1.0,
+                             "", pProgressArg) )
+            {
+                return false;
+            }
+            if( pnReadFeatureCount )
+                *pnReadFeatureCount = nCount;
+        }
+        return true;
+    };
+
+    int iCur = 0;
+    ReadBatch(iCur);
+    bool bOK = anBatchCount[iCur] == 0 || SubmitBatch(iCur);
+    while( bOK && anBatchCount[iCur] > 0 )
+    {
+        const int iNext = 1 - iCur;
+        ReadBatch(iNext);
+        poQueue->WaitCompletion();
+        if( anBatchCount[iNext] > 0 && !SubmitBatch(iNext) )
+            bOK = false;
+        else if( !WriteBatch(iCur) )
+            bOK = false;
+        iCur = iNext;
+    }
+    poQueue->WaitCompletion();
+    if( !bOK )
+        return false;
+
+    if( psOptions->nGroupTransactions && psOptions->nLayerTransaction )
+    {
+        if( poDstLayer->CommitTransaction() != OGRERR_NONE )
+            bRet = false;
+    }
+
+    CPLDebug("GDALVectorTranslate", CPL_FRMT_GIB " features written in layer '%s'",
+             nFeaturesWritten, poDstLayer->GetName());
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                     LayerTranslator::Translate()                     */
+/************************************************************************/
+
+int LayerTranslator::Translate( OGRFeature* poFeatureIn,
+                                TargetLayerInfo* psInfo,
+                                GIntBig nCountLayerFeatures,
+                                GIntBig* pnReadFeatureCount,
+                                GIntBig& nTotalEventsDone,
+                                GDALProgressFunc pfnProgress,
+                                void *pProgressArg,
+                                GDALVectorTranslateOptions *psOptions )
+{
+    OGRSpatialReference* poOutputSRS = m_poOutputSRS;
+
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    const bool bPreserveFID = psInfo->m_bPreserveFID;
+    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
+    const auto poDstFDefn = poDstLayer->GetLayerDefn();
+    const int nSrcGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
+    const bool bExplodeCollections = m_bExplodeCollections && nDstGeomFieldCount <= 1;
+    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
+
+    if( poFeatureIn == nullptr && CanUseArrowAPI(psInfo, psOptions) )
+    {
+        return TranslateArrow(psInfo, nCountLayerFeatures, pnReadFeatureCount,
+                              nTotalEventsDone, pfnProgress, pProgressArg,
+                              psOptions);
+    }
+
+    if( poOutputSRS == nullptr && !m_bNullifyOutputSRS )
+    {
+        if( nSrcGeomFieldCount == 1 )
+        {
+            poOutputSRS = poSrcLayer->GetSpatialRef();
+        }
+        else if( iRequestedSrcGeomField > 0 )
+        {
+            poOutputSRS = poSrcLayer->GetLayerDefn()->GetGeomFieldDefn(
+                iRequestedSrcGeomField)->GetSpatialRef();
+        }
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Use a pipeline with worker threads for geometry processing if   */
+/*      asked to.                                                       */
+/* -------------------------------------------------------------------- */
+    if( poFeatureIn == nullptr &&
+        psOptions->nFIDToFetch == OGRNullFID &&
+        !bExplodeCollections &&
+        !psInfo->m_bPerFeatureCT )
+    {
+        const int nThreads = CPLGetNumThreads(
+            CPLGetConfigOption("OGR2OGR_NUM_THREADS", "1"), 128);
+        if( nThreads > 1 )
+        {
+            return TranslateMultiThreaded(psInfo, nCountLayerFeatures,
+                                          pnReadFeatureCount, nTotalEventsDone,
+                                          pfnProgress, pProgressArg,
+                                          poOutputSRS, nThreads, psOptions);
+        }
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Transfer features.                                              */
+/* -------------------------------------------------------------------- */
+    if( psOptions->nGroupTransactions )
+    {
+        if( psOptions->nLayerTransaction )
+        {
+            if( poDstLayer->StartTransaction() == OGRERR_FAILURE )
+            {
+                delete poFeatureIn;
+                return false;
+            }
+        }
+    }
+
+    std::unique_ptr<OGRFeature> poFeature;
+    std::unique_ptr<OGRFeature> poDstFeature(new OGRFeature(poDstFDefn));
+    int         nFeaturesInTransaction = 0;
+    GIntBig      nCount = 0; /* written + failed */
+    GIntBig      nFeaturesWritten = 0;
+
+    bool bRet = true;
+    CPLErrorReset();
+    while( true )
+    {
+        if( m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit )
+        {
+            break;
+        }
+
+        if( poFeatureIn != nullptr )
+            poFeature.reset(poFeatureIn);
+        else if( psOptions->nFIDToFetch != OGRNullFID )
+            poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+        else
+            poFeature.reset(poSrcLayer->GetNextFeature());
+
+        if( poFeature == nullptr )
+        {
+            if( CPLGetLastErrorType() == CE_Failure )
+            {
+                bRet = false;
+            }
+            break;
+        }
+
+        if( psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT )
+        {
+            if( !SetupCT( psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                          m_osDateLineOffset, m_poUserSourceSRS,
+                          poFeature.get(), poOutputSRS, m_poGCPCoordTrans) )
+            {
+                return false;
+            }
+        }
+
+        psInfo->m_nFeaturesRead ++;
+
+        int nIters = 1;
+        std::unique_ptr<OGRGeometryCollection> poCollToExplode;
+        int iGeomCollToExplode = -1;
+        if (bExplodeCollections)
+        {
+            OGRGeometry* poSrcGeometry;
+            if( iRequestedSrcGeomField >= 0 )
+                poSrcGeometry = poFeature->GetGeomFieldRef(
+                                        iRequestedSrcGeomField);
+            else
+                poSrcGeometry = poFeature->GetGeometryRef();
+            if (poSrcGeometry &&
+                OGR_GT_IsSubClassOf(poSrcGeometry->getGeometryType(), wkbGeometryCollection) )
             {
-                if( psOptions->nGroupTransactions )
+                const int nParts = poSrcGeometry->toGeometryCollection()->getNumGeometries();
+                if( nParts > 0 )
                 {
-                    if( psOptions->nLayerTransaction )
-                        poDstLayer->RollbackTransaction();
+                    iGeomCollToExplode = iRequestedSrcGeomField >= 0 ?
+                        iRequestedSrcGeomField : 0;
+                    poCollToExplode.reset(
+                        poFeature->StealGeometry(iGeomCollToExplode)->toGeometryCollection());
+                    nIters = nParts;
                 }
+            }
+        }
 
-                CPLError( CE_Failure, CPLE_AppDefined,
-                        "Unable to write feature " CPL_FRMT_GIB " from layer %s.",
-                        nSrcFID, poSrcLayer->GetName() );
+        const GIntBig nSrcFID = poFeature->GetFID();
+        GIntBig nDesiredFID = OGRNullFID;
+        if( bPreserveFID )
+            nDesiredFID = nSrcFID;
+        else if( psInfo->m_iSrcFIDField >= 0 &&
+                 poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
+            nDesiredFID = poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
 
+        for(int iPart = 0; iPart < nIters; iPart++)
+        {
+            if( !StartNewTransactionIfNeeded(poDstLayer, nFeaturesInTransaction,
+                                             nTotalEventsDone, psOptions) )
+            {
                 return false;
             }
-            else
+
+            CPLErrorReset();
             {
-                CPLDebug( "GDALVectorTranslate", "Unable to write feature " CPL_FRMT_GIB " into layer %s.",
-                           nSrcFID, poSrcLayer->GetName() );
-                if( psOptions->nGroupTransactions )
+                bool bReprojectionFailed = false;
+                const auto eStatus = ProcessFeature(
+                    psInfo, poFeature, poDstFeature,
+                    poCollToExplode.get(), iGeomCollToExplode,
+                    nSrcFID, nDesiredFID, poOutputSRS,
+                    psInfo->m_apoCT, m_transformWithOptionsCache,
+                    psOptions, bReprojectionFailed);
+                if( (eStatus == FeatureStatus::FAILURE || bReprojectionFailed) &&
+                    psOptions->nGroupTransactions && psOptions->nLayerTransaction )
                 {
-                    if( psOptions->nLayerTransaction )
-                    {
-                        poDstLayer->RollbackTransaction();
-                        CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
-                    }
-                    else
+                    if( poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                        !psOptions->bSkipFailures )
                     {
-                        m_poODS->RollbackTransaction();
-                        m_poODS->StartTransaction(psOptions->bForceTransaction);
+                        return false;
                     }
                 }
+                if( eStatus == FeatureStatus::FAILURE )
+                    return false;
+                if( eStatus == FeatureStatus::DISCARD )
+                    continue;
             }
 
-end_loop:
-            ; // nothing
+            if( !WriteFeature(psInfo, poDstFeature.get(), nSrcFID, nDesiredFID,
+                              nFeaturesWritten, psOptions) )
+            {
+                return false;
+            }
         }
 
         /* Report progress */
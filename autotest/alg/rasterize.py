@@ -30,6 +30,7 @@
 
 import struct
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -802,3 +803,63 @@ def test_rasterize_merge_alg_add_polygon(wkt):
         10,
     )
     assert got == expected, "%s" % str(got)
+
+
+###############################################################################
+# Test that multithreaded rasterization gives the same result as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("merge_alg", ["REPLACE", "ADD"])
+@pytest.mark.parametrize("all_touched", [False, True])
+def test_rasterize_num_threads(merge_alg, all_touched):
+
+    sr_wkt = 'LOCAL_CS["arbitrary"]'
+    sr = osr.SpatialReference(sr_wkt)
+
+    data_source = ogr.GetDriverByName("MEMORY").CreateDataSource("")
+    layer = data_source.CreateLayer("", sr, geom_type=ogr.wkbUnknown)
+    layer.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    for i in range(500):
+        x = (i * 37) % 97
+        y = (i * 61) % 89
+        size = 1 + (i % 13)
+        feature = ogr.Feature(layer.GetLayerDefn())
+        feature["val"] = 1 + (i % 7)
+        if i % 5 == 0:
+            wkt = "LINESTRING(%d %d,%d %d)" % (x, y, x + 2 * size, y + size)
+        else:
+            wkt = "POLYGON((%d %d,%d %d,%d %d,%d %d))" % (
+                x,
+                y,
+                x + size,
+                y + size / 2,
+                x + size / 2,
+                y + size,
+                x,
+                y,
+            )
+        feature.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        layer.CreateFeature(feature)
+
+    def rasterize():
+        ds = gdal.Rasterize(
+            "",
+            data_source,
+            format="MEM",
+            outputType=gdal.GDT_Int16,
+            outputBounds=[0, 0, 110, 100],
+            width=220,
+            height=200,
+            attribute="val",
+            allTouched=all_touched,
+            add=merge_alg == "ADD",
+            optim="RASTER",
+        )
+        return ds.ReadRaster()
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
+        expected = rasterize()
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        got = rasterize()
+    assert got == expected
@@ -56,6 +56,7 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_threadsafe_queue.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <limits>
 #include <fstream>
@@ -4135,4 +4136,18 @@ namespace
         EXPECT_FALSE( CPLGetExecPath(achBuffer.data(), static_cast<int>(achBuffer.size())) );
     }
 
+    // Test CPLGetNumThreads()
+    TEST_F(test_cpl, CPLGetNumThreads)
+    {
+        EXPECT_EQ( CPLGetNumThreads(nullptr, 128), 1 );
+        EXPECT_EQ( CPLGetNumThreads("", 128), 1 );
+        EXPECT_EQ( CPLGetNumThreads("invalid", 128), 1 );
+        EXPECT_EQ( CPLGetNumThreads("-2", 128), 1 );
+        EXPECT_EQ( CPLGetNumThreads("4", 128), 4 );
+        EXPECT_EQ( CPLGetNumThreads("1000", 128), 128 );
+        EXPECT_EQ( CPLGetNumThreads("ALL_CPUS", 1024),
+                   std::min(1024, CPLGetNumCPUs()) );
+        EXPECT_EQ( CPLGetNumThreads("all_cpus", 1), 1 );
+    }
+
 } // namespace
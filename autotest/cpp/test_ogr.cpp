@@ -32,6 +32,7 @@
 #include "ogrsf_frmts.h"
 #include "../../ogr/ogrsf_frmts/osm/gpb.h"
 #include "ogr_recordbatch.h"
+#include "ogr_wkb.h"
 
 #include <string>
 
@@ -2083,6 +2084,120 @@ namespace
         stream.release(&stream);
     }
 
+    // Test OGR_L_WriteArrowBatch
+    TEST_F(test_ogr, OGR_L_WriteArrowBatch)
+    {
+        auto poDriver = GetGDALDriverManager()->GetDriverByName("Memory");
+        auto poSrcDS = std::unique_ptr<GDALDataset>(
+            poDriver->Create("", 0, 0, 0, GDT_Unknown, nullptr));
+        auto poDstDS = std::unique_ptr<GDALDataset>(
+            poDriver->Create("", 0, 0, 0, GDT_Unknown, nullptr));
+        auto poSrcLayer = poSrcDS->CreateLayer("src", nullptr, wkbPoint);
+        auto poDstLayer = poDstDS->CreateLayer("dst", nullptr, wkbPoint);
+        for( auto poLayer: { poSrcLayer, poDstLayer } )
+        {
+            {
+                OGRFieldDefn oFieldDefn("str", OFTString);
+                poLayer->CreateField(&oFieldDefn);
+            }
+            {
+                OGRFieldDefn oFieldDefn("int32", OFTInteger);
+                poLayer->CreateField(&oFieldDefn);
+            }
+            {
+                OGRFieldDefn oFieldDefn("int64", OFTInteger64);
+                poLayer->CreateField(&oFieldDefn);
+            }
+            {
+                OGRFieldDefn oFieldDefn("float64", OFTReal);
+                poLayer->CreateField(&oFieldDefn);
+            }
+            {
+                OGRFieldDefn oFieldDefn("date", OFTDate);
+                poLayer->CreateField(&oFieldDefn);
+            }
+            {
+                OGRFieldDefn oFieldDefn("datetime", OFTDateTime);
+                poLayer->CreateField(&oFieldDefn);
+            }
+            {
+                OGRFieldDefn oFieldDefn("strlist", OFTStringList);
+                poLayer->CreateField(&oFieldDefn);
+            }
+            {
+                OGRFieldDefn oFieldDefn("int64list", OFTInteger64List);
+                poLayer->CreateField(&oFieldDefn);
+            }
+        }
+        {
+            OGRFeature oFeat(poSrcLayer->GetLayerDefn());
+            oFeat.SetField("str", "foo");
+            oFeat.SetField("int32", 123);
+            oFeat.SetField("int64", static_cast<GIntBig>(1234567890123));
+            oFeat.SetField("float64", 1.25);
+            oFeat.SetField("date", 2022, 5, 31);
+            oFeat.SetField("datetime", 2022, 5, 31, 12, 34, 56.5f, 0);
+            const char* const apszList[] = { "a", "bc", nullptr };
+            oFeat.SetField("strlist", apszList);
+            const GIntBig anList[] = { -1, 1234567890123 };
+            oFeat.SetField("int64list", 2, anList);
+            oFeat.SetGeometryDirectly(new OGRPoint(1, 2));
+            ASSERT_EQ(poSrcLayer->CreateFeature(&oFeat), OGRERR_NONE);
+        }
+        {
+            OGRFeature oFeat(poSrcLayer->GetLayerDefn());
+            oFeat.SetFieldNull(oFeat.GetFieldIndex("str"));
+            ASSERT_EQ(poSrcLayer->CreateFeature(&oFeat), OGRERR_NONE);
+        }
+
+        struct ArrowArrayStream stream;
+        ASSERT_TRUE(OGR_L_GetArrowStream(OGRLayer::ToHandle(poSrcLayer), &stream, nullptr));
+        struct ArrowSchema schema;
+        ASSERT_EQ(stream.get_schema(&stream, &schema), 0);
+        while( true )
+        {
+            struct ArrowArray array;
+            ASSERT_EQ(stream.get_next(&stream, &array), 0);
+            if( array.release == nullptr )
+                break;
+            EXPECT_TRUE(OGR_L_WriteArrowBatch(OGRLayer::ToHandle(poDstLayer),
+                                              &schema, &array, nullptr));
+            array.release(&array);
+        }
+        schema.release(&schema);
+        stream.release(&stream);
+
+        ASSERT_EQ(poDstLayer->GetFeatureCount(), 2);
+        poSrcLayer->ResetReading();
+        poDstLayer->ResetReading();
+        for( int i = 0; i < 2; ++i )
+        {
+            auto poSrcFeat = std::unique_ptr<OGRFeature>(poSrcLayer->GetNextFeature());
+            auto poDstFeat = std::unique_ptr<OGRFeature>(poDstLayer->GetNextFeature());
+            ASSERT_TRUE(poSrcFeat != nullptr);
+            ASSERT_TRUE(poDstFeat != nullptr);
+            EXPECT_TRUE(poDstFeat->Equal(poSrcFeat.get()));
+        }
+
+        // Unknown column name
+        {
+            OGRFieldDefn oFieldDefn("extra", OFTString);
+            poSrcLayer->CreateField(&oFieldDefn);
+            ASSERT_TRUE(OGR_L_GetArrowStream(OGRLayer::ToHandle(poSrcLayer), &stream, nullptr));
+            ASSERT_EQ(stream.get_schema(&stream, &schema), 0);
+            struct ArrowArray array;
+            ASSERT_EQ(stream.get_next(&stream, &array), 0);
+            ASSERT_TRUE(array.release != nullptr);
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            EXPECT_TRUE(!OGR_L_WriteArrowBatch(OGRLayer::ToHandle(poDstLayer),
+                                               &schema, &array, nullptr));
+            CPLPopErrorHandler();
+            array.release(&array);
+            schema.release(&schema);
+            stream.release(&stream);
+        }
+    }
+
     // Test field domain cloning
     TEST_F(test_ogr, field_domain_cloning)
     {
@@ -2180,4 +2295,256 @@ namespace
         EXPECT_EQ(i, oFDefn.GetGeomFieldCount());
     }
 
+    // Test OGRWKBGetBoundingBox()
+    TEST_F(test_ogr, OGRWKBGetBoundingBox)
+    {
+        const char* const apszWKT[] = {
+            "POINT (1 2)",
+            "POINT Z (1 2 3)",
+            "LINESTRING (1 2,3 -4)",
+            "LINESTRING ZM (1 2 3 4,3 -4 5 6)",
+            "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 2,2 2,1 1))",
+            "MULTIPOINT ((1 2),(-3 4))",
+            "MULTILINESTRING ((1 2,3 4),(-5 6,7 -8))",
+            "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((10 10,10 11,11 11,10 10)))",
+            "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING M (3 4 5,6 7 8))",
+            "TIN (((0 0,0 1,1 1,0 0)))",
+        };
+        for( const char* pszWKT: apszWKT )
+        {
+            OGRGeometry* poGeom = nullptr;
+            ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom),
+                      OGRERR_NONE);
+            OGREnvelope sExpected;
+            poGeom->getEnvelope(&sExpected);
+            for( const auto eByteOrder: { wkbNDR, wkbXDR } )
+            {
+                std::vector<GByte> abyWkb(poGeom->WkbSize());
+                poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+                OGREnvelope sEnvelope;
+                EXPECT_TRUE(OGRWKBGetBoundingBox(abyWkb.data(), abyWkb.size(),
+                                                 sEnvelope)) << pszWKT;
+                EXPECT_EQ(sEnvelope, sExpected) << pszWKT;
+                // Truncated WKB
+                EXPECT_FALSE(OGRWKBGetBoundingBox(abyWkb.data(),
+                                                  abyWkb.size() - 1,
+                                                  sEnvelope)) << pszWKT;
+            }
+            delete poGeom;
+        }
+
+        // Not handled: empty and curve geometries
+        for( const char* pszWKT: { "POINT EMPTY", "LINESTRING EMPTY",
+                                   "CIRCULARSTRING (0 0,1 1,2 0)" } )
+        {
+            OGRGeometry* poGeom = nullptr;
+            ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom),
+                      OGRERR_NONE);
+            std::vector<GByte> abyWkb(poGeom->WkbSize());
+            poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+            OGREnvelope sEnvelope;
+            EXPECT_FALSE(OGRWKBGetBoundingBox(abyWkb.data(), abyWkb.size(),
+                                              sEnvelope)) << pszWKT;
+            delete poGeom;
+        }
+    }
+
+    // Test OGRFeature::SetGeomFieldFromWkb() and related methods
+    TEST_F(test_ogr, feature_geom_field_from_wkb)
+    {
+        OGRSpatialReference oSRS;
+        oSRS.SetFromUserInput("WGS84");
+        OGRFeatureDefn* poFDefn = new OGRFeatureDefn();
+        poFDefn->Reference();
+        poFDefn->GetGeomFieldDefn(0)->SetSpatialRef(&oSRS);
+
+        OGRLineString oLS;
+        oLS.addPoint(1, 2);
+        oLS.addPoint(3, -4);
+        std::vector<GByte> abyWkb(oLS.WkbSize());
+        oLS.exportToWkb(wkbNDR, abyWkb.data());
+
+        {
+            OGRFeature oFeature(poFDefn);
+            EXPECT_EQ(oFeature.SetGeomFieldFromWkb(1, abyWkb.data(),
+                                                   abyWkb.size()),
+                      OGRERR_FAILURE);
+            EXPECT_EQ(oFeature.SetGeomFieldFromWkb(0, abyWkb.data(), 4),
+                      OGRERR_FAILURE);
+            EXPECT_EQ(oFeature.GetGeomFieldGeometryType(0), wkbNone);
+            EXPECT_EQ(oFeature.SetGeomFieldFromWkb(0, abyWkb.data(),
+                                                   abyWkb.size()),
+                      OGRERR_NONE);
+
+            // Served from the WKB
+            size_t nWkbSize = 0;
+            const GByte* pabyWkb = oFeature.GetGeomFieldRawWkb(0, nWkbSize);
+            ASSERT_TRUE(pabyWkb != nullptr);
+            EXPECT_EQ(nWkbSize, abyWkb.size());
+            EXPECT_TRUE(memcmp(pabyWkb, abyWkb.data(), nWkbSize) == 0);
+            EXPECT_EQ(oFeature.GetGeomFieldGeometryType(0), wkbLineString);
+            OGREnvelope sEnvelope;
+            EXPECT_EQ(oFeature.GetGeomFieldEnvelope(0, sEnvelope), OGRERR_NONE);
+            EXPECT_EQ(sEnvelope.MinX, 1);
+            EXPECT_EQ(sEnvelope.MinY, -4);
+            EXPECT_EQ(sEnvelope.MaxX, 3);
+            EXPECT_EQ(sEnvelope.MaxY, 2);
+            EXPECT_TRUE(oFeature.GetGeomFieldRawWkb(0, nWkbSize) != nullptr);
+
+            // Clone keeps the WKB
+            std::unique_ptr<OGRFeature> poClone(oFeature.Clone());
+            EXPECT_TRUE(poClone->GetGeomFieldRawWkb(0, nWkbSize) != nullptr);
+            EXPECT_TRUE(poClone->Equal(&oFeature));
+
+            // Instantiation
+            const OGRGeometry* poGeom = oFeature.GetGeometryRef();
+            ASSERT_TRUE(poGeom != nullptr);
+            EXPECT_TRUE(poGeom->Equals(&oLS));
+            EXPECT_EQ(poGeom->getSpatialReference(),
+                      poFDefn->GetGeomFieldDefn(0)->GetSpatialRef());
+            EXPECT_TRUE(oFeature.GetGeomFieldRawWkb(0, nWkbSize) == nullptr);
+            EXPECT_EQ(oFeature.GetGeomFieldGeometryType(0), wkbLineString);
+
+            // Setting a geometry discards the WKB
+            EXPECT_EQ(poClone->SetGeometry(nullptr), OGRERR_NONE);
+            EXPECT_TRUE(poClone->GetGeomFieldRawWkb(0, nWkbSize) == nullptr);
+            EXPECT_TRUE(poClone->GetGeometryRef() == nullptr);
+            EXPECT_EQ(poClone->GetGeomFieldEnvelope(0, sEnvelope),
+                      OGRERR_FAILURE);
+
+            // Corrupted WKB is reported at instantiation time
+            EXPECT_EQ(poClone->SetGeomFieldFromWkb(0, abyWkb.data(),
+                                                   abyWkb.size() - 1),
+                      OGRERR_NONE);
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            EXPECT_TRUE(poClone->GetGeometryRef() == nullptr);
+            CPLPopErrorHandler();
+
+            // Reset discards the WKB
+            EXPECT_EQ(oFeature.SetGeomFieldFromWkb(0, abyWkb.data(),
+                                                   abyWkb.size()),
+                      OGRERR_NONE);
+            oFeature.Reset();
+            EXPECT_TRUE(oFeature.GetGeomFieldRawWkb(0, nWkbSize) == nullptr);
+            EXPECT_TRUE(oFeature.GetGeometryRef() == nullptr);
+        }
+
+        poFDefn->Release();
+    }
+
+    // Test OGRLayer::GetNextFeatureInto()
+    TEST_F(test_ogr, GetNextFeatureInto)
+    {
+        std::string file(data_ + SEP + "poly.shp");
+        GDALDatasetUniquePtr poSrcDS(
+            GDALDataset::Open(file.c_str(), GDAL_OF_VECTOR));
+        ASSERT_TRUE( poSrcDS != nullptr );
+
+        // Shapefile, GeoPackage and Memory (default implementation) layers
+        std::vector<GDALDatasetUniquePtr> apoDS;
+        for( const char* pszDriver: { "GPKG", "Memory" } )
+        {
+            auto poDriver = GetGDALDriverManager()->GetDriverByName(pszDriver);
+            if( poDriver == nullptr )
+                continue;
+            std::string osFilename("/vsimem/GetNextFeatureInto_");
+            osFilename += pszDriver;
+            if( EQUAL(pszDriver, "GPKG") )
+                osFilename += ".gpkg";
+            GDALDatasetUniquePtr poDS(poDriver->Create(
+                osFilename.c_str(), 0, 0, 0, GDT_Unknown, nullptr));
+            ASSERT_TRUE( poDS != nullptr );
+            ASSERT_TRUE( poDS->CopyLayer(poSrcDS->GetLayer(0), "poly") != nullptr );
+            apoDS.emplace_back(std::move(poDS));
+        }
+        apoDS.emplace_back(std::move(poSrcDS));
+
+        for( auto& poDS: apoDS )
+        {
+            OGRLayer* poLayer = poDS->GetLayer(0);
+            for( int iIter = 0; iIter < 3; ++iIter )
+            {
+                if( iIter == 1 )
+                    poLayer->SetAttributeFilter("EAS_ID > 170");
+                else if( iIter == 2 )
+                {
+                    poLayer->SetAttributeFilter(nullptr);
+                    poLayer->SetSpatialFilterRect(479000, 4763000,
+                                                  481000, 4765000);
+                }
+
+                std::vector<std::unique_ptr<OGRFeature>> apoExpected;
+                poLayer->ResetReading();
+                while( auto poFeature = poLayer->GetNextFeature() )
+                    apoExpected.emplace_back(poFeature);
+                ASSERT_TRUE( !apoExpected.empty() );
+
+                OGRFeature oFeature(poLayer->GetLayerDefn());
+                poLayer->ResetReading();
+                size_t nCount = 0;
+                while( poLayer->GetNextFeatureInto(oFeature) )
+                {
+                    ASSERT_LT( nCount, apoExpected.size() );
+                    EXPECT_TRUE( oFeature.Equal(apoExpected[nCount].get()) )
+                        << poDS->GetDescription() << " " << iIter;
+                    ++nCount;
+                }
+                EXPECT_EQ( nCount, apoExpected.size() )
+                    << poDS->GetDescription() << " " << iIter;
+
+                // Through the C API, and with a feature of another
+                // definition
+                OGRFeatureDefn* poOtherDefn = new OGRFeatureDefn();
+                poOtherDefn->Reference();
+                OGRFeatureH hFeature = OGR_F_Create(poOtherDefn);
+                poLayer->ResetReading();
+                nCount = 0;
+                while( OGR_L_GetNextFeatureInto(OGRLayer::ToHandle(poLayer),
+                                                hFeature) )
+                {
+                    ASSERT_LT( nCount, apoExpected.size() );
+                    EXPECT_TRUE( OGRFeature::FromHandle(hFeature)->Equal(
+                                        apoExpected[nCount].get()) );
+                    ++nCount;
+                }
+                EXPECT_EQ( nCount, apoExpected.size() );
+                OGR_F_Destroy(hFeature);
+                poOtherDefn->Release();
+            }
+            poLayer->SetSpatialFilter(nullptr);
+        }
+
+        for( const char* pszFilename: { "/vsimem/GetNextFeatureInto_GPKG.gpkg",
+                                        "/vsimem/GetNextFeatureInto_Memory" } )
+        {
+            VSIUnlink(pszFilename);
+        }
+    }
+
+    // Test OGRLayer::GetNextFeatureInto() on CSV
+    TEST_F(test_ogr, GetNextFeatureInto_CSV)
+    {
+        std::string file(data_ + SEP + "multi_geom.csv");
+        GDALDatasetUniquePtr poDS(
+            GDALDataset::Open(file.c_str(), GDAL_OF_VECTOR));
+        ASSERT_TRUE( poDS != nullptr );
+        OGRLayer* poLayer = poDS->GetLayer(0);
+
+        std::vector<std::unique_ptr<OGRFeature>> apoExpected;
+        while( auto poFeature = poLayer->GetNextFeature() )
+            apoExpected.emplace_back(poFeature);
+        ASSERT_TRUE( !apoExpected.empty() );
+
+        OGRFeature oFeature(poLayer->GetLayerDefn());
+        poLayer->ResetReading();
+        size_t nCount = 0;
+        while( poLayer->GetNextFeatureInto(oFeature) )
+        {
+            ASSERT_LT( nCount, apoExpected.size() );
+            EXPECT_TRUE( oFeature.Equal(apoExpected[nCount].get()) );
+            ++nCount;
+        }
+        EXPECT_EQ( nCount, apoExpected.size() );
+    }
+
 } // namespace
@@ -1611,3 +1611,48 @@ def test_cog_overview_count_existing():
     assert ds.GetRasterBand(1).GetOverview(0).Checksum() == 0
     ds = None
     gdal.Unlink(tmpfilename)
+
+
+###############################################################################
+# Test that temporary overviews give the same result whether they are kept in
+# memory or on disk
+
+
+def test_cog_tmp_overviews_in_memory():
+
+    tmpfilename = "/vsimem/test_cog_tmp_overviews_in_memory.tif"
+
+    src_ds = gdal.Translate(
+        "", "data/byte.tif", options="-of MEM -outsize 1024 1024 -b 1 -b 1 -mask 1"
+    )
+
+    def get_checksums(max_mem, expect_in_memory):
+
+        tmp_files_in_memory = []
+
+        def my_progress(pct, msg, user_data):
+            tmp_files_in_memory.extend(
+                f for f in (gdal.ReadDir("/vsimem/") or []) if f.startswith("cog_")
+            )
+            return 1
+
+        with gdaltest.config_option("COG_TMP_OVERVIEW_MAX_MEM", max_mem):
+            gdal.GetDriverByName("COG").CreateCopy(
+                tmpfilename, src_ds, options=["BLOCKSIZE=256"], callback=my_progress
+            )
+        # Check that the temporary overviews went to /vsimem/cog_XXXX only
+        # when they fit in COG_TMP_OVERVIEW_MAX_MEM
+        assert (len(tmp_files_in_memory) != 0) == expect_in_memory
+        assert not [
+            f for f in (gdal.ReadDir("/vsimem/") or []) if f.startswith("cog_")
+        ]
+        ds = gdal.Open(tmpfilename)
+        band = ds.GetRasterBand(1)
+        assert band.GetOverviewCount() == 2
+        ret = [band.GetOverview(i).Checksum() for i in range(2)]
+        ret += [band.GetMaskBand().GetOverview(i).Checksum() for i in range(2)]
+        ds = None
+        gdal.Unlink(tmpfilename)
+        return ret
+
+    assert get_checksums("0", False) == get_checksums("1000000000", True)
@@ -905,3 +905,183 @@ def test_stats_computeminmax(datatype, minval, maxval, nodata):
         buf_ysize=1,
     )
     assert ds.GetRasterBand(1).ComputeRasterMinMax(0) == (expected_minval, maxval)
+
+
+###############################################################################
+# Test that block-parallel computation of statistics, min/max and histogram
+# gives the same results as the single-threaded code path
+
+
+@pytest.mark.parametrize(
+    "datatype,struct_frmt",
+    [
+        (gdal.GDT_Byte, "B"),
+        (gdal.GDT_UInt16, "H"),
+        (gdal.GDT_Int16, "h"),
+        (gdal.GDT_Int32, "i"),
+        (gdal.GDT_Float32, "f"),
+        (gdal.GDT_Float64, "d"),
+    ],
+)
+@pytest.mark.parametrize("nodata", [None, 7])
+def test_stats_multithreaded(datatype, struct_frmt, nodata):
+
+    # MEM datasets have one block per line
+    ds = gdal.GetDriverByName("MEM").Create("", 100, 100, 1, datatype)
+    band = ds.GetRasterBand(1)
+    if nodata is not None:
+        band.SetNoDataValue(nodata)
+    data = [((i * 37 + (i // 100) * 11) % 251) for i in range(100 * 100)]
+    band.WriteRaster(0, 0, 100, 100, struct.pack(struct_frmt * len(data), *data))
+
+    def compute():
+        ds.ClearStatistics()
+        return (
+            band.ComputeStatistics(False),
+            band.ComputeRasterMinMax(False),
+            band.GetHistogram(-0.5, 255.5, 256, approx_ok=False),
+            band.ComputeStatistics(True),
+        )
+
+    st_stats, st_minmax, st_hist, st_approx = compute()
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        mt_stats, mt_minmax, mt_hist, mt_approx = compute()
+
+    assert mt_minmax == st_minmax
+    assert mt_hist == st_hist
+    assert mt_stats[0] == st_stats[0]
+    assert mt_stats[1] == st_stats[1]
+    assert mt_stats[2] == pytest.approx(st_stats[2], rel=1e-12)
+    assert mt_stats[3] == pytest.approx(st_stats[3], rel=1e-12)
+    assert mt_approx == pytest.approx(st_approx, rel=1e-12)
+
+
+###############################################################################
+# Test the vectorized statistics code paths, with NaN and nodata values, and
+# a width that is not a multiple of the vector size
+
+
+@pytest.mark.parametrize(
+    "datatype,struct_frmt",
+    [
+        (gdal.GDT_Int16, "h"),
+        (gdal.GDT_Int32, "i"),
+        (gdal.GDT_Float32, "f"),
+        (gdal.GDT_Float64, "d"),
+    ],
+)
+@pytest.mark.parametrize("nodata", [None, -3])
+def test_stats_simd_kernels(datatype, struct_frmt, nodata):
+
+    width = 13
+    height = 7
+    is_float = datatype in (gdal.GDT_Float32, gdal.GDT_Float64)
+    data = []
+    for i in range(width * height):
+        if is_float and i % 11 == 5:
+            data.append(float("nan"))
+        elif i % 7 == 3:
+            data.append(-3)
+        else:
+            data.append(((i * 37) % 101) - 50)
+
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, datatype)
+    band = ds.GetRasterBand(1)
+    if nodata is not None:
+        band.SetNoDataValue(nodata)
+    band.WriteRaster(0, 0, width, height, struct.pack(struct_frmt * len(data), *data))
+
+    valid = [v for v in data if not math.isnan(v) and v != nodata]
+    mean = sum(valid) / len(valid)
+    stddev = math.sqrt(sum((v - mean) ** 2 for v in valid) / len(valid))
+
+    stats = band.ComputeStatistics(False)
+    assert stats[0] == min(valid)
+    assert stats[1] == max(valid)
+    assert stats[2] == pytest.approx(mean, rel=1e-12)
+    assert stats[3] == pytest.approx(stddev, rel=1e-12)
+    assert band.ComputeRasterMinMax(False) == (min(valid), max(valid))
+
+
+###############################################################################
+# Test that blocks of a dataset that can be reopened are decoded by the
+# worker threads when GDAL_STATS_REOPEN_DATASET=YES, and only then
+
+
+def test_stats_multithreaded_decode_in_jobs(tmp_path):
+
+    filename = str(tmp_path / "test_stats_multithreaded_decode_in_jobs.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        128,
+        128,
+        1,
+        gdal.GDT_UInt16,
+        options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "COMPRESS=DEFLATE"],
+    )
+    data = [((i * 37 + (i // 128) * 11) % 1009) for i in range(128 * 128)]
+    ds.GetRasterBand(1).WriteRaster(
+        0, 0, 128, 128, struct.pack("H" * len(data), *data)
+    )
+    ds = None
+
+    def compute():
+        ds = gdal.Open(filename)
+        band = ds.GetRasterBand(1)
+        return (
+            band.ComputeStatistics(False),
+            band.ComputeRasterMinMax(False),
+            band.GetHistogram(-0.5, 1023.5, 1024, approx_ok=False),
+        )
+
+    st_res = compute()
+
+    for reopen in ("NO", "YES"):
+        debug_msgs = []
+
+        def handler(eErrClass, errno, msg):
+            if eErrClass == gdal.CE_Debug:
+                debug_msgs.append(msg)
+
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": "4",
+                "GDAL_STATS_REOPEN_DATASET": reopen,
+                "CPL_DEBUG": "ON",
+            }
+        ):
+            gdal.PushErrorHandler(handler)
+            try:
+                mt_res = compute()
+            finally:
+                gdal.PopErrorHandler()
+
+        assert mt_res[1] == st_res[1]
+        assert mt_res[2] == st_res[2]
+        assert mt_res[0] == pytest.approx(st_res[0], rel=1e-12)
+        assert any("Decoding blocks of " + filename in msg for msg in debug_msgs) == (
+            reopen == "YES"
+        )
+
+    # Datasets not backed by a local file are never reopened
+    mem_filename = "/vsimem/test_stats_multithreaded_decode_in_jobs.tif"
+    gdal.Translate(mem_filename, filename)
+    try:
+        debug_msgs = []
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": "4",
+                "GDAL_STATS_REOPEN_DATASET": "YES",
+                "CPL_DEBUG": "ON",
+            }
+        ):
+            gdal.PushErrorHandler(handler)
+            try:
+                ds = gdal.Open(mem_filename)
+                assert ds.GetRasterBand(1).ComputeRasterMinMax(False) == st_res[1]
+                ds = None
+            finally:
+                gdal.PopErrorHandler()
+        assert not any("Decoding blocks of" in msg for msg in debug_msgs)
+    finally:
+        gdal.Unlink(mem_filename)
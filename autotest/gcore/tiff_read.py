@@ -4927,6 +4927,100 @@ def test_tiff_read_multi_threaded_vsicurl(use_dataset_readraster):
         gdal.VSICurlClearCache()
 
 
+###############################################################################
+# Test AdviseRead() with /vsicurl
+
+
+@pytest.mark.skipif(platform.system() == "Darwin", reason="fails randomly")
+def test_tiff_read_advise_read_vsicurl():
+
+    if gdal.GetDriverByName("HTTP") is None:
+        pytest.skip()
+
+    webserver_process = None
+    webserver_port = 0
+
+    (webserver_process, webserver_port) = webserver.launch(
+        handler=webserver.DispatcherHttpHandler
+    )
+    if webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    tmpfilename = "/vsimem/test_tiff_read_advise_read_vsicurl.tif"
+    ref_ds = gdal.Translate(
+        tmpfilename,
+        "data/byte.tif",
+        creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+    )
+    ref_data = ref_ds.ReadRaster()
+    ref_ds = None
+    f = gdal.VSIFOpenL(tmpfilename, "rb")
+    filedata = gdal.VSIFReadL(1, gdal.VSIStatL(tmpfilename).size, f)
+    gdal.VSIFCloseL(f)
+    gdal.Unlink(tmpfilename)
+
+    class RangeHandler(object):
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", len(filedata))
+            request.end_headers()
+
+        def do_GET(self, request):
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), len(filedata) - 1)
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(filedata))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.end_headers()
+            request.wfile.write(filedata[start : end + 1])
+
+    try:
+        with webserver.install_http_handler(RangeHandler()):
+            with gdaltest.config_options(
+                {
+                    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS": ".tif",
+                    "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                }
+            ):
+                ds = gdal.Open("/vsicurl/http://127.0.0.1:%d/byte.tif" % webserver_port)
+                assert ds is not None, "could not open dataset"
+                assert ds.AdviseRead(0, 0, 20, 20) == gdal.CE_None
+                assert ds.ReadRaster() == ref_data
+
+                # Several batches in flight, without waiting for the
+                # previous ones
+                ds.FlushCache()
+                gdal.VSICurlClearCache()
+                assert ds.AdviseRead(0, 0, 20, 10) == gdal.CE_None
+                assert ds.AdviseRead(0, 10, 20, 10) == gdal.CE_None
+                assert ds.ReadRaster(0, 10, 20, 10) == ref_data[200:]
+                assert ds.ReadRaster(0, 0, 20, 10) == ref_data[0:200]
+
+                # The window is consumed by reads that cover it in
+                # several requests
+                ds.FlushCache()
+                gdal.VSICurlClearCache()
+                assert ds.AdviseRead(0, 0, 20, 20) == gdal.CE_None
+                assert ds.ReadRaster(0, 0, 20, 10) == ref_data[0:200]
+                assert ds.ReadRaster(0, 10, 20, 10) == ref_data[200:]
+                ds.FlushCache()
+                gdal.VSICurlClearCache()
+                assert ds.ReadRaster() == ref_data
+                ds = None
+    finally:
+        webserver.server_stop(webserver_process, webserver_port)
+
+        gdal.VSICurlClearCache()
+
+
 ###############################################################################
 # Test that a user receives a warning when it queries
 # GetMetadataItem("PIXELTYPE", "IMAGE_STRUCTURE")
@@ -2105,3 +2105,109 @@ def test_vrt_read_compute_statistics_mosaic_optimization_not_triggered():
 
     vrt_stats = vrt_ds.GetRasterBand(1).ComputeStatistics(False)
     assert vrt_stats == src_ds.GetRasterBand(1).ComputeStatistics(False)
+
+
+###############################################################################
+# Test reading a mosaic with enough sources to trigger the use of the
+# spatial index of sources, and check that source priority is preserved
+
+
+def test_vrt_read_many_sources_spatial_index():
+
+    src_ds = gdal.Translate("", gdal.Open("data/byte.tif"), format="MEM")
+    tiles = []
+    for y in range(0, 20, 2):
+        for x in range(0, 20, 2):
+            tiles.append(
+                gdal.Translate(
+                    "", src_ds, options="-of MEM -srcwin %d %d 2 2" % (x, y)
+                )
+            )
+    assert len(tiles) == 100
+    vrt_ds = gdal.BuildVRT("", tiles)
+    assert vrt_ds.GetRasterBand(1).Checksum() == 4672
+    for (xoff, yoff, xsize, ysize) in [(0, 0, 20, 20), (3, 5, 7, 2), (19, 19, 1, 1)]:
+        assert vrt_ds.ReadRaster(xoff, yoff, xsize, ysize) == src_ds.ReadRaster(
+            xoff, yoff, xsize, ysize
+        )
+        assert vrt_ds.GetRasterBand(1).ReadRaster(
+            xoff, yoff, xsize, ysize
+        ) == src_ds.GetRasterBand(1).ReadRaster(xoff, yoff, xsize, ysize)
+
+    # Add a last source on top of the others: it must win
+    overlay_ds = gdal.Translate(
+        "", src_ds, options="-of MEM -srcwin 4 4 5 5 -scale 0 255 1 1"
+    )
+    vrt_ds = gdal.BuildVRT("", tiles + [overlay_ds])
+    ref = struct.unpack("B" * 9, src_ds.ReadRaster(3, 3, 3, 3))
+    expected = ref[0:3] + (ref[3], 1, 1) + (ref[6], 1, 1)
+    assert struct.unpack("B" * 9, vrt_ds.ReadRaster(3, 3, 3, 3)) == expected
+    assert (
+        struct.unpack("B" * 9, vrt_ds.GetRasterBand(1).ReadRaster(3, 3, 3, 3))
+        == expected
+    )
+
+
+###############################################################################
+# Test RasterIO() reading non-overlapping sources in parallel
+
+
+@pytest.mark.parametrize("overlapping", [False, True])
+def test_vrt_read_sources_in_parallel(overlapping):
+
+    src_ds = gdal.Translate("", gdal.Open("data/byte.tif"), format="MEM")
+    if overlapping:
+        src_ds1 = gdal.Translate("", src_ds, options="-of MEM -srcwin 0 0 11 20")
+        src_ds2 = gdal.Translate(
+            "", src_ds, options="-of MEM -srcwin 9 0 11 20 -scale 0 255 1 1"
+        )
+    else:
+        src_ds1 = gdal.Translate("", src_ds, options="-of MEM -srcwin 0 0 10 20")
+        src_ds2 = gdal.Translate("", src_ds, options="-of MEM -srcwin 10 0 10 20")
+    vrt_ds = gdal.BuildVRT("", [src_ds1, src_ds2])
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        data = vrt_ds.GetRasterBand(1).ReadRaster()
+        ds_data = vrt_ds.ReadRaster()
+        subsampled = vrt_ds.GetRasterBand(1).ReadRaster(
+            buf_xsize=7, buf_ysize=7, resample_alg=gdal.GRIORA_Bilinear
+        )
+
+    assert ds_data == data
+    assert (
+        vrt_ds.GetRasterBand(1).ReadRaster(
+            buf_xsize=7, buf_ysize=7, resample_alg=gdal.GRIORA_Bilinear
+        )
+        == subsampled
+    )
+    if overlapping:
+        # Second source must win in the overlapping area
+        assert struct.unpack("B" * 20, data[0:20])[9:] == (1,) * 11
+    else:
+        assert data == src_ds.GetRasterBand(1).ReadRaster()
+
+
+###############################################################################
+# Test that nested VRTs read from worker threads of the global thread pool
+# are read serially, instead of waiting on the pool they are running on.
+
+
+def test_vrt_read_sources_in_parallel_nested():
+
+    src_ds = gdal.Translate("", gdal.Open("data/byte.tif"), format="MEM")
+    inner_vrts = []
+    for yoff in (0, 10):
+        src_ds1 = gdal.Translate(
+            "", src_ds, options=f"-of MEM -srcwin 0 {yoff} 10 10"
+        )
+        src_ds2 = gdal.Translate(
+            "", src_ds, options=f"-of MEM -srcwin 10 {yoff} 10 10"
+        )
+        inner_vrts.append(gdal.BuildVRT("", [src_ds1, src_ds2]))
+    vrt_ds = gdal.BuildVRT("", inner_vrts)
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "2"):
+        data = vrt_ds.GetRasterBand(1).ReadRaster()
+        assert vrt_ds.GetRasterBand(1).ComputeRasterMinMax(False) == (74, 255)
+
+    assert data == src_ds.GetRasterBand(1).ReadRaster()
@@ -28,6 +28,8 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import os
+import sys
 import time
 
 import gdaltest
@@ -1093,6 +1095,187 @@ def test_vsicurl_GDAL_HTTP_HEADERS():
     assert statres.size == 3
 
 
+###############################################################################
+# Test CPL_VSIL_CURL_PERSISTENT_CACHE_DIR
+
+
+def test_vsicurl_persistent_cache(tmp_path):
+
+    if gdaltest.webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = str(tmp_path / "cache")
+    filename = (
+        "/vsicurl/http://localhost:%d/test_vsicurl_persistent_cache.bin"
+        % gdaltest.webserver_port
+    )
+
+    def read_file(etag, data=None):
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_persistent_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"%s"' % etag},
+        )
+        if data is not None:
+            handler.add(
+                "GET", "/test_vsicurl_persistent_cache.bin", 200, {}, data
+            )
+        with webserver.install_http_handler(handler):
+            with gdaltest.config_options(
+                {
+                    "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": cache_dir,
+                    "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                }
+            ):
+                f = gdal.VSIFOpenL(filename, "rb")
+                assert f is not None
+                ret = gdal.VSIFReadL(1, 3, f).decode("ascii")
+                gdal.VSIFCloseL(f)
+        gdal.VSICurlClearCache()
+        return ret
+
+    # Data is downloaded and persisted
+    assert read_file("etag1", "foo") == "foo"
+    assert len(gdal.ReadDir(cache_dir)) > 0
+
+    # The cache is private to the user
+    if sys.platform != "win32":
+        assert (os.stat(cache_dir).st_mode & 0o777) == 0o700
+        for name in os.listdir(cache_dir):
+            mode = os.stat(os.path.join(cache_dir, name)).st_mode
+            assert (mode & 0o777) == 0o600
+
+    # Data is read from the persistent cache: no GET request
+    assert read_file("etag1") == "foo"
+
+    # ETag changed: data is downloaded again
+    assert read_file("etag2", "bar") == "bar"
+    assert read_file("etag2") == "bar"
+
+
+###############################################################################
+# Test that CPL_VSIL_CURL_PERSISTENT_CACHE_DIR does not store signed URLs
+
+
+def test_vsicurl_persistent_cache_signed_url(tmp_path):
+
+    if gdaltest.webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = str(tmp_path / "cache")
+
+    def read_file(signature, data=None):
+        path = (
+            "/test_vsicurl_persistent_cache_signed_url.bin?foo=bar&X-Amz-Signature=%s"
+            % signature
+        )
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", path, 200, {"Content-Length": "3", "ETag": '"etag"'})
+        if data is not None:
+            handler.add("GET", path, 200, {}, data)
+        with webserver.install_http_handler(handler):
+            with gdaltest.config_options(
+                {
+                    "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": cache_dir,
+                    "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                }
+            ):
+                f = gdal.VSIFOpenL(
+                    "/vsicurl/http://localhost:%d%s" % (gdaltest.webserver_port, path),
+                    "rb",
+                )
+                assert f is not None
+                ret = gdal.VSIFReadL(1, 3, f).decode("ascii")
+                gdal.VSIFCloseL(f)
+        gdal.VSICurlClearCache()
+        return ret
+
+    assert read_file("secret1", "foo") == "foo"
+
+    # Neither the URL nor its signature are stored in the cache
+    for name in os.listdir(cache_dir):
+        content = open(os.path.join(cache_dir, name), "rb").read()
+        assert b"secret1" not in content
+        assert b"localhost" not in content
+
+    # A new signature of the same URL hits the cache: no GET request
+    assert read_file("secret2") == "foo"
+
+
+###############################################################################
+# Test eviction of the CPL_VSIL_CURL_PERSISTENT_CACHE_DIR cache
+
+
+def test_vsicurl_persistent_cache_eviction(tmp_path):
+
+    if gdaltest.webserver_port == 0:
+        pytest.skip()
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = str(tmp_path / "cache")
+    data = "x" * 100
+
+    def read_file(idx, max_size, download):
+        path = "/test_vsicurl_persistent_cache_eviction_%d.bin" % idx
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", path, 200, {"Content-Length": "100", "ETag": '"etag"'})
+        if download:
+            handler.add("GET", path, 200, {}, data)
+        with webserver.install_http_handler(handler):
+            with gdaltest.config_options(
+                {
+                    "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": cache_dir,
+                    "CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE": str(max_size),
+                    "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                }
+            ):
+                f = gdal.VSIFOpenL(
+                    "/vsicurl/http://localhost:%d%s" % (gdaltest.webserver_port, path),
+                    "rb",
+                )
+                assert f is not None
+                ret = gdal.VSIFReadL(1, 100, f).decode("ascii")
+                gdal.VSIFCloseL(f)
+        gdal.VSICurlClearCache()
+        return ret
+
+    def set_entries_age(age):
+        # Make the entries written so far older than the next one, as the
+        # eviction is based on the modification time.
+        now = time.time()
+        for name in os.listdir(cache_dir):
+            filename = os.path.join(cache_dir, name)
+            if os.stat(filename).st_mtime > now - 1000:
+                os.utime(filename, (now - age, now - age))
+
+    assert read_file(1, 1000000, True) == data
+    entries = os.listdir(cache_dir)
+    assert len(entries) == 1
+    entry_size = os.stat(os.path.join(cache_dir, entries[0])).st_size
+    set_entries_age(3000)
+
+    # Room for 2 entries, but not 3
+    max_size = entry_size * 5 // 2
+
+    assert read_file(2, max_size, True) == data
+    assert len(os.listdir(cache_dir)) == 2
+    set_entries_age(2000)
+
+    # The least recently used entry (the first one) is evicted
+    assert read_file(3, max_size, True) == data
+    assert len(os.listdir(cache_dir)) == 2
+    assert read_file(2, max_size, False) == data
+    assert read_file(3, max_size, False) == data
+    assert read_file(1, max_size, True) == data
+
+
 ###############################################################################
 
 
@@ -30,6 +30,7 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import json
 import os
 import shutil
 import struct
@@ -2166,3 +2167,107 @@ def test_grib_grib2_parameter_in_wmo_tables_only():
         ds.GetRasterBand(1).GetMetadataItem("GRIB_ELEMENT")
         == "Latent heat net flux due to evaporation"
     )
+
+
+# Test writing and reusing the inventory cache sidecar file
+def test_grib_inventory_cache(tmp_path):
+
+    tmpfilename = str(tmp_path / "test_grib_inventory_cache.grib2")
+    shutil.copy("data/grib/gfs.t06z.pgrb2.10p0.f010.grib2", tmpfilename)
+    cache_filename = tmpfilename + ".gdal_idx.json"
+
+    ds = gdal.OpenEx(tmpfilename, open_options=["INVENTORY_CACHE=NO"])
+    ref_descriptions = [
+        ds.GetRasterBand(i + 1).GetDescription() for i in range(ds.RasterCount)
+    ]
+    ref_metadata = [
+        ds.GetRasterBand(i + 1).GetMetadata() for i in range(ds.RasterCount)
+    ]
+    ref_checksums = [
+        ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+    ]
+    ds = None
+    assert gdal.VSIStatL(cache_filename) is None
+
+    with gdaltest.config_option("GRIB_INVENTORY_CACHE", "YES"):
+        # First open writes the cache, second one reads it
+        for _ in range(2):
+            ds = gdal.Open(tmpfilename)
+            assert gdal.VSIStatL(cache_filename) is not None
+            assert [
+                ds.GetRasterBand(i + 1).GetDescription() for i in range(ds.RasterCount)
+            ] == ref_descriptions
+            assert [
+                ds.GetRasterBand(i + 1).GetMetadata() for i in range(ds.RasterCount)
+            ] == ref_metadata
+            assert [
+                ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+            ] == ref_checksums
+            ds = None
+
+    # Check that the cache is really used
+    with open(cache_filename, "rt") as f:
+        j = json.load(f)
+    j["messages"][0]["long_fst_level"] = "from cache"
+    with open(cache_filename, "wt") as f:
+        json.dump(j, f)
+    ds = gdal.OpenEx(tmpfilename, open_options=["INVENTORY_CACHE=YES"])
+    assert ds.GetRasterBand(1).GetDescription() == "from cache"
+    ds = None
+
+    # Check that an out of date cache is ignored and rewritten
+    j["file_size"] += 1
+    with open(cache_filename, "wt") as f:
+        json.dump(j, f)
+    ds = gdal.OpenEx(tmpfilename, open_options=["INVENTORY_CACHE=YES"])
+    assert ds.GetRasterBand(1).GetDescription() == ref_descriptions[0]
+    ds = None
+    with open(cache_filename, "rt") as f:
+        j = json.load(f)
+    assert j["messages"][0]["long_fst_level"] == ref_descriptions[0]
+
+
+# Test decoding the messages of several bands with several threads
+def test_grib_num_threads():
+
+    ds = gdal.OpenEx(
+        "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2", open_options=["USE_IDX=NO"]
+    )
+    expected_data = ds.ReadRaster()
+    expected_data_subset = ds.ReadRaster(band_list=[3, 1])
+    ds = None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.OpenEx(
+            "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2", open_options=["USE_IDX=NO"]
+        )
+        assert ds.ReadRaster(band_list=[3, 1]) == expected_data_subset
+        assert ds.ReadRaster() == expected_data
+        ds = None
+
+
+# Test decoding in parallel messages with several subgrids, for which the
+# unpacker must not share state between threads
+def test_grib_num_threads_subgrids(tmp_path):
+
+    tmpfilename = str(tmp_path / "test_grib_num_threads_subgrids.grib2")
+    with open("data/grib/subgrids.grib2", "rb") as f:
+        data = f.read()
+    with open(tmpfilename, "wb") as f:
+        for _ in range(8):
+            f.write(data)
+
+    ds = gdal.OpenEx(tmpfilename, open_options=["USE_IDX=NO"])
+    assert ds.RasterCount == 16
+    expected_data = ds.ReadRaster()
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(16)] == [
+        4672,
+        4563,
+    ] * 8
+    ds = None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "8"):
+        for _ in range(4):
+            ds = gdal.OpenEx(tmpfilename, open_options=["USE_IDX=NO"])
+            assert ds.ReadRaster() == expected_data
+            ds = None
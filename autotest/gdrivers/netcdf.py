@@ -5599,6 +5599,57 @@ def test_netcdf_chunked_not_multiple():
     assert ds.GetRasterBand(1).Checksum() == 4672
 
 
+###############################################################################
+# Test reading chunks outside of the netCDF library, with several threads
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("checksum", ["NO", "YES"])
+def test_netcdf_direct_chunk_read(num_threads, checksum):
+
+    if not gdaltest.netcdf_drv_has_nc4:
+        pytest.skip()
+
+    tmpfilename = "tmp/test_netcdf_direct_chunk_read.nc"
+    with gdaltest.config_options({"BLOCKXSIZE": "7", "BLOCKYSIZE": "6"}):
+        gdal.Translate(
+            tmpfilename,
+            "data/byte.tif",
+            options="-of netCDF -co FORMAT=NC4 -co COMPRESS=DEFLATE -co WRITE_BOTTOMUP=NO "
+            + "-co CHECKSUM="
+            + checksum,
+        )
+
+    with gdaltest.config_option("GDAL_NETCDF_DIRECT_CHUNK_READ", "NO"):
+        ds = gdal.Open(tmpfilename)
+        expected_data = ds.ReadRaster()
+        ds = None
+
+    messages = []
+
+    def my_handler(typ, err, msg):
+        if typ == gdal.CE_Debug:
+            messages.append(msg)
+
+    with gdaltest.config_options({"GDAL_NUM_THREADS": num_threads, "CPL_DEBUG": "ON"}):
+        ds = gdal.Open(tmpfilename)
+        assert ds.GetRasterBand(1).GetBlockSize() == [7, 6]
+        gdal.PushErrorHandler(my_handler)
+        try:
+            assert ds.ReadRaster() == expected_data
+        finally:
+            gdal.PopErrorHandler()
+        assert ds.GetRasterBand(1).Checksum() == 4672
+        ds = None
+
+    gdal.Unlink(tmpfilename)
+
+    # Check that the direct chunk path was actually taken
+    assert any("read and decompressed outside of the netCDF library" in m for m in messages)
+    if num_threads != "1":
+        assert any("prefetching 12 chunks" in m for m in messages)
+
+
 def test_netcdf_create():
 
     ds = gdaltest.netcdf_drv.Create("tmp/test_create.nc", 2, 2)
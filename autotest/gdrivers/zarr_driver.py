@@ -2985,6 +2985,205 @@ def test_zarr_advise_read(compression):
         gdal.RmdirRecursive(filename)
 
 
+@pytest.mark.parametrize("compression", ["NONE", "ZLIB"])
+def test_zarr_write_multithreaded(compression):
+
+    filename = "tmp/test_zarr_write_multithreaded.zarr"
+    try:
+        dim0_size = 230
+        dim1_size = 570
+        dim0_blocksize = 20
+        dim1_blocksize = 30
+        data = array.array("B", [(i % 255) + 1 for i in range(dim0_size * dim1_size)])
+
+        with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+            ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename)
+            rg = ds.GetRootGroup()
+            dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+            dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+            ar = rg.CreateMDArray(
+                "test",
+                [dim0, dim1],
+                gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+                [
+                    "COMPRESS=" + compression,
+                    "BLOCKSIZE=%d,%d" % (dim0_blocksize, dim1_blocksize),
+                ],
+            )
+            assert ar.Write(data) == gdal.CE_None
+
+            # Partial update of a tile that may still be being written
+            assert (
+                ar.Write(b"\x00" * 10, array_start_idx=[1, 2], count=[1, 10])
+                == gdal.CE_None
+            )
+            for i in range(10):
+                data[dim1_size + 2 + i] = 0
+
+            # Read back from the same array
+            assert ar.Read() == data
+            ds = None
+
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.Read() == data
+
+    finally:
+        gdal.RmdirRecursive(filename)
+
+
+@pytest.mark.parametrize("compression", ["NONE", "ZLIB"])
+def test_zarr_write_read_sharding(compression):
+
+    filename = "/vsimem/test_zarr_write_read_sharding.zarr"
+    try:
+        dim0_size = 100
+        dim1_size = 70
+        data = array.array("B", [(i % 255) + 1 for i in range(dim0_size * dim1_size)])
+
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            filename, options=["FORMAT=ZARR_V3"]
+        )
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+        dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+        with gdaltest.error_handler():
+            assert (
+                rg.CreateMDArray(
+                    "invalid",
+                    [dim0, dim1],
+                    gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+                    ["CHUNKS_PER_SHARD=2"],
+                )
+                is None
+            )
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+            ["COMPRESS=" + compression, "BLOCKSIZE=10,20", "CHUNKS_PER_SHARD=4,2"],
+        )
+        assert ar.Write(data) == gdal.CE_None
+        # Partial update of a chunk of an already written shard
+        assert (
+            ar.Write(b"\x00" * 30, array_start_idx=[45, 10], count=[1, 30])
+            == gdal.CE_None
+        )
+        for i in range(30):
+            data[45 * dim1_size + 10 + i] = 0
+        ds = None
+
+        j = json.loads(
+            gdal.VSIFReadL(
+                1, 10000, gdal.VSIFOpenL(filename + "/meta/root/test.array.json", "rb")
+            )
+        )
+        assert j["storage_transformers"][0]["configuration"] == {
+            "chunks_per_shard": [4, 2]
+        }
+        # 3 shards along dim0, 2 shards along dim1
+        assert len(gdal.ReadDir(filename + "/data/root/test/c0")) == 2
+        assert len(gdal.ReadDir(filename + "/data/root/test")) == 3
+
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.Read() == data
+        assert ar.Read(array_start_idx=[41, 15], count=[10, 30]) == array.array(
+            "B",
+            [
+                data[(41 + j) * dim1_size + 15 + i]
+                for j in range(10)
+                for i in range(30)
+            ],
+        )
+
+        with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+            assert ar.AdviseRead() == gdal.CE_None
+        assert ar.Read() == data
+
+    finally:
+        gdal.RmdirRecursive(filename)
+
+
+def test_zarr_write_sharding_multithreaded_row_by_row():
+
+    filename = "/vsimem/test_zarr_write_sharding_multithreaded_row_by_row.zarr"
+    try:
+        dim0_size = 100
+        dim1_size = 70
+        data = array.array("B", [(i % 255) + 1 for i in range(dim0_size * dim1_size)])
+
+        messages = []
+
+        def my_handler(typ, err, msg):
+            if typ == gdal.CE_Debug:
+                messages.append(msg)
+
+        with gdaltest.config_options({"GDAL_NUM_THREADS": "4", "CPL_DEBUG": "ON"}):
+            ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+                filename, options=["FORMAT=ZARR_V3"]
+            )
+            rg = ds.GetRootGroup()
+            dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+            dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+            ar = rg.CreateMDArray(
+                "test",
+                [dim0, dim1],
+                gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+                ["COMPRESS=ZLIB", "BLOCKSIZE=10,20", "CHUNKS_PER_SHARD=4,2"],
+            )
+            gdal.PushErrorHandler(my_handler)
+            try:
+                # Row-major write, crossing shards along dim1 for each row
+                for j in range(dim0_size):
+                    assert (
+                        ar.Write(
+                            data[j * dim1_size : (j + 1) * dim1_size],
+                            array_start_idx=[j, 0],
+                            count=[1, dim1_size],
+                        )
+                        == gdal.CE_None
+                    )
+                ds = None
+            finally:
+                gdal.PopErrorHandler()
+
+        # Each of the 3 x 2 shards must have been written only once
+        shard_writes = [m for m in messages if "Writing shard" in m]
+        assert len(shard_writes) == 6
+        assert len(set(shard_writes)) == 6
+
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("test")
+        assert ar.Read() == data
+
+    finally:
+        gdal.RmdirRecursive(filename)
+
+
+def test_zarr_write_sharding_v2_warning():
+
+    filename = "/vsimem/test_zarr_write_sharding_v2_warning.zarr"
+    try:
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename)
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 10)
+        gdal.ErrorReset()
+        with gdaltest.error_handler():
+            ar = rg.CreateMDArray(
+                "test",
+                [dim0],
+                gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+                ["CHUNKS_PER_SHARD=2"],
+            )
+        assert ar is not None
+        assert "CHUNKS_PER_SHARD ignored" in gdal.GetLastErrorMsg()
+        ds = None
+
+    finally:
+        gdal.RmdirRecursive(filename)
+
+
 def test_zarr_read_invalid_nczarr_dim():
 
     try:
@@ -989,6 +989,39 @@ def test_ogr_flatgeobuf_invalid_output_filename():
         assert ds.CreateLayer("foo") is None
 
 
+###############################################################################
+# Test boolean values beyond the first feature of an Arrow batch
+
+
+def test_ogr_flatgeobuf_arrow_stream_bool():
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = "/vsimem/test_ogr_flatgeobuf_arrow_stream_bool.fgb"
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    field = ogr.FieldDefn("bool", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    expected = [i % 3 == 1 for i in range(20)]
+    for i, val in enumerate(expected):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["bool"] = val
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(%d 0)" % i))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+    batches = [batch for batch in stream]
+    assert len(batches) == 1
+    assert [bool(x) for x in batches[0]["bool"]] == expected
+    ds = None
+
+    gdal.Unlink(filename)
+
+
 ###############################################################################
 
 
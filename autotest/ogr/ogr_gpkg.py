@@ -7315,6 +7315,38 @@ def test_ogr_gpkg_alter_geom_field_defn():
     gdal.Unlink(filename)
 
 
+###############################################################################
+# Test boolean values beyond the first feature of an Arrow batch
+
+
+def test_ogr_gpkg_arrow_stream_bool():
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = "/vsimem/test_ogr_gpkg_arrow_stream_bool.gpkg"
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    field = ogr.FieldDefn("bool", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    expected = [i % 3 == 1 for i in range(20)]
+    for val in expected:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["bool"] = val
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+    batches = [batch for batch in stream]
+    assert len(batches) == 1
+    assert [bool(x) for x in batches[0]["bool"]] == expected
+    ds = None
+
+    gdal.Unlink(filename)
+
+
 ###############################################################################
 # Test GetArrowStreamAsNumPy()
 
@@ -8237,3 +8269,98 @@ def test_ogr_gpkg_sql_gdal_get_pixel_value():
         assert f[0] is None
 
     gdal.Unlink(filename)
+
+
+###############################################################################
+# Test WriteArrowBatch()
+
+
+def test_ogr_gpkg_write_arrow_batch():
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("src")
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("bin", ogr.OFTBinary))
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["int"] = 1
+    f["int64"] = 1234567890123
+    f["real"] = 1.5
+    f["str"] = "foo"
+    f.SetFieldBinaryFromHexString("bin", "0123")
+    f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+    src_lyr.CreateFeature(f)
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["str"] = ""
+    src_lyr.CreateFeature(f)
+    f = ogr.Feature(src_lyr.GetLayerDefn())
+    f["int"] = -1
+    f["real"] = -2.5
+    f.SetGeometryDirectly(
+        ogr.CreateGeometryFromWkt("POLYGON ((10 20,10 21,11 21,10 20))")
+    )
+    src_lyr.CreateFeature(f)
+
+    def write_batch(dst_lyr):
+        stream = src_lyr.GetArrowStream(["INCLUDE_FID=NO"])
+        schema = stream.GetSchema()
+        array = stream.GetNextRecordBatch()
+        assert dst_lyr.WriteArrowBatch(schema, array)
+
+    filename = "/vsimem/test_ogr_gpkg_write_arrow_batch.gpkg"
+    try:
+        ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+        assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch)
+        for i in range(src_lyr.GetLayerDefn().GetFieldCount()):
+            lyr.CreateField(src_lyr.GetLayerDefn().GetFieldDefn(i))
+
+        # Direct path
+        write_batch(lyr)
+
+        # Fallback to the generic implementation for a field with a default
+        # value that is not part of the batch
+        fld_defn = ogr.FieldDefn("extra", ogr.OFTString)
+        fld_defn.SetDefault("'x'")
+        lyr.CreateField(fld_defn)
+        write_batch(lyr)
+        ds = None
+
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 6
+        assert lyr.GetExtent() == (1, 11, 2, 21)
+        for i in range(2):
+            f = lyr.GetNextFeature()
+            assert f["int"] == 1
+            assert f["int64"] == 1234567890123
+            assert f["real"] == 1.5
+            assert f["str"] == "foo"
+            assert f.GetFieldAsBinary("bin") == b"\x01\x23"
+            assert f.GetGeometryRef().ExportToWkt() == "POINT (1 2)"
+            assert f["extra"] == (None if i == 0 else "x")
+            f = lyr.GetNextFeature()
+            assert f.IsFieldNull("int")
+            assert f.IsFieldNull("int64")
+            assert f["str"] == ""
+            assert f.GetGeometryRef() is None
+            f = lyr.GetNextFeature()
+            assert f["int"] == -1
+            assert f["real"] == -2.5
+            assert (
+                f.GetGeometryRef().ExportToWkt()
+                == "POLYGON ((10 20,10 21,11 21,10 20))"
+            )
+
+        # Check the spatial index
+        lyr.SetSpatialFilterRect(9, 19, 12, 22)
+        assert lyr.GetFeatureCount() == 2
+        lyr.SetSpatialFilter(None)
+        sql_lyr = ds.ExecuteSQL("SELECT COUNT(*) FROM rtree_test_geom")
+        assert sql_lyr.GetNextFeature().GetField(0) == 4
+        ds.ReleaseResultSet(sql_lyr)
+        ds = None
+    finally:
+        gdal.Unlink(filename)
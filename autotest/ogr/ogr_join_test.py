@@ -28,6 +28,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -588,3 +589,170 @@ def test_ogr_join_23():
     ds.ReleaseResultSet(sql_lyr)
 
     ds = None
+
+
+###############################################################################
+# Test that the hash join gives the same results as the attribute-filter based
+# join, including when the memory limit is reached
+
+
+@pytest.mark.parametrize(
+    "config_options",
+    [
+        {"OGR_SQL_HASH_JOIN": "NO"},
+        {},
+        {"OGR_SQL_HASH_JOIN_MAX_MEMORY": "100"},
+    ],
+)
+def test_ogr_join_hash_join(config_options):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("real_key", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    for i in range(20):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i != 5:
+            f["int_key"] = i % 7
+        f["real_key"] = i % 4
+        f["str_key"] = "Key%d" % (i % 3)
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real_key", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_key"] = i % 5
+        f["real_key"] = i * 0.5
+        f["str_key"] = "Key%d" % i
+        f["val"] = "val%d" % i
+        lyr.CreateFeature(f)
+
+    res = []
+    with gdaltest.config_options(config_options):
+        for on in [
+            "first.int_key = second.int_key",
+            "second.real_key = first.real_key",
+            "first.int_key = second.real_key",
+            "first.str_key = second.str_key",
+            "first.int_key = second.int_key AND first.real_key = second.real_key",
+        ]:
+            sql_lyr = ds.ExecuteSQL(
+                "SELECT first.*, second.val FROM first LEFT JOIN second ON " + on
+            )
+            res.append([f["val"] for f in sql_lyr])
+            ds.ReleaseResultSet(sql_lyr)
+
+    assert res == [
+        [
+            "val0",
+            "val1",
+            "val2",
+            "val3",
+            "val4",
+            None,
+            None,
+            "val0",
+            "val1",
+            "val2",
+            "val3",
+            "val4",
+            None,
+            None,
+            "val0",
+            "val1",
+            "val2",
+            "val3",
+            "val4",
+            None,
+        ],
+        ["val0", "val2", "val4", "val6"] * 5,
+        [
+            "val0",
+            "val2",
+            "val4",
+            "val6",
+            "val8",
+            None,
+            None,
+            "val0",
+            "val2",
+            "val4",
+            "val6",
+            "val8",
+            None,
+            None,
+            "val0",
+            "val2",
+            "val4",
+            "val6",
+            "val8",
+            None,
+        ],
+        ["val0", "val1", "val2"] * 6 + ["val0", "val1"],
+        [
+            "val0",
+            None,
+            None,
+            None,
+            None,
+            None,
+            None,
+            None,
+            None,
+            "val2",
+            None,
+            None,
+            None,
+            None,
+            None,
+            "val6",
+            None,
+            None,
+            "val4",
+            None,
+        ],
+    ]
+
+
+###############################################################################
+# Test that the hash join compares strings exactly, and is rebuilt when
+# the secondary layer changes
+
+
+def test_ogr_join_hash_join_string_case_and_reset():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    for key in ["a", "A", "b"]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str_key"] = key
+        lyr.CreateFeature(f)
+
+    second_lyr = ds.CreateLayer("second")
+    second_lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    second_lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    f = ogr.Feature(second_lyr.GetLayerDefn())
+    f["str_key"] = "a"
+    f["val"] = "val_a"
+    second_lyr.CreateFeature(f)
+
+    sql_lyr = ds.ExecuteSQL(
+        "SELECT first.*, second.val FROM first LEFT JOIN second "
+        "ON first.str_key = second.str_key"
+    )
+    assert [f["val"] for f in sql_lyr] == ["val_a", None, None]
+
+    f = ogr.Feature(second_lyr.GetLayerDefn())
+    f["str_key"] = "b"
+    f["val"] = "val_b"
+    second_lyr.CreateFeature(f)
+
+    sql_lyr.ResetReading()
+    assert [f["val"] for f in sql_lyr] == ["val_a", None, "val_b"]
+    ds.ReleaseResultSet(sql_lyr)
@@ -2433,6 +2433,89 @@ def test_ogr_openfilegdb_read_relationships():
     assert rel.GetRelatedTableType() == "media"
 
 
+###############################################################################
+# Test the Arrow stream interface
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/filegdb/testopenfilegdb.gdb.zip",
+        "data/filegdb/curves.gdb",
+        "data/filegdb/multilinestringzm_with_dummy_m_array.gdb.zip",
+        "data/filegdb/testdatetimeutc.gdb",
+    ],
+)
+def test_ogr_openfilegdb_arrow_stream(filename):
+    pa = pytest.importorskip("pyarrow")
+
+    ds = ogr.Open(filename)
+
+    def get_rows(lyr, options=[]):
+        stream = lyr.GetArrowStreamAsPyArrow(options=options)
+        rows = []
+        for batch in stream:
+            rows += pa.Table.from_batches([batch]).to_pylist()
+        return rows
+
+    def check(lyr, options=[]):
+        rows = get_rows(lyr, options)
+        with gdaltest.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+            expected_rows = get_rows(lyr, options)
+        assert rows == expected_rows, lyr.GetName()
+        return rows
+
+    for lyr in ds:
+        assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+        rows = check(lyr, ["MAX_FEATURES_IN_BATCH=3"])
+        assert len(rows) == lyr.GetFeatureCount()
+
+        # Ignored fields
+        if lyr.GetLayerDefn().GetFieldCount() > 0:
+            ignored = [lyr.GetLayerDefn().GetFieldDefn(0).GetName(), "OGR_GEOMETRY"]
+            assert lyr.SetIgnoredFields(ignored) == ogr.OGRERR_NONE
+            check(lyr, ["INCLUDE_FID=NO"])
+            lyr.SetIgnoredFields([])
+
+        # Spatial filter
+        if lyr.GetGeomType() != ogr.wkbNone:
+            minx, maxx, miny, maxy = lyr.GetExtent()
+            lyr.SetSpatialFilterRect(
+                minx, miny, (minx + maxx) / 2, (miny + maxy) / 2
+            )
+            check(lyr)
+            lyr.SetSpatialFilter(None)
+
+
+def test_ogr_openfilegdb_arrow_stream_attribute_filter():
+    pa = pytest.importorskip("pyarrow")
+
+    ds = ogr.Open("data/filegdb/testopenfilegdb.gdb.zip")
+    lyr = ds.GetLayerByName("point")
+
+    def get_rows():
+        stream = lyr.GetArrowStreamAsPyArrow()
+        rows = []
+        for batch in stream:
+            rows += pa.Table.from_batches([batch]).to_pylist()
+        return rows
+
+    # Fully evaluated by the attribute index
+    lyr.SetAttributeFilter("id = 1")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+    rows = get_rows()
+    assert [row["OBJECTID"] for row in rows] == [1]
+    with gdaltest.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+        assert get_rows() == rows
+
+    # Evaluated on features
+    lyr.SetAttributeFilter("id = id")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+    assert len(get_rows()) == lyr.GetFeatureCount()
+
+    lyr.SetAttributeFilter(None)
+
+
 ###############################################################################
 # Cleanup
 
@@ -374,6 +374,88 @@ def test_ogr_osm_3_custom_compress_nodes():
     return ret
 
 
+###############################################################################
+# Test ogr2ogr with --config OSM_USE_FLAT_NODES YES
+
+
+def test_ogr_osm_3_flat_nodes():
+    with gdaltest.config_option("OSM_USE_FLAT_NODES", "YES"):
+        return test_ogr_osm_3()
+
+
+###############################################################################
+# Test flat nodes with node ids that require growing the flat node file past
+# its initial size, and after ResetReading()
+
+
+def test_ogr_osm_flat_nodes_grow_and_reset_reading():
+
+    if ogrtest.osm_drv is None or not ogrtest.osm_drv_parse_osm:
+        pytest.skip()
+
+    # The initial mapping is for 64 M nodes: node 150000000 requires to grow
+    # it beyond twice that size.
+    filename = "/vsimem/test_ogr_osm_flat_nodes_grow_and_reset_reading.osm"
+    gdal.FileFromMemBuffer(
+        filename,
+        """<osm>
+  <node id="1" lat="2" lon="49"/>
+  <node id="2" lat="2.1" lon="49"/>
+  <node id="150000000" lat="2.2" lon="49.1"/>
+  <way id="1">
+    <nd ref="1"/>
+    <nd ref="2"/>
+    <nd ref="150000000"/>
+    <tag k="highway" v="road"/>
+  </way>
+</osm>""",
+    )
+
+    def read_lines(lyr):
+        debug_msgs = []
+
+        def handler(eErrClass, errno, msg):
+            if eErrClass == gdal.CE_Debug and "Flat node file mapped" in msg:
+                debug_msgs.append(msg)
+
+        lyr.ResetReading()
+        with gdaltest.config_option("CPL_DEBUG", "ON"):
+            gdal.PushErrorHandler(handler)
+            try:
+                f = lyr.GetNextFeature()
+            finally:
+                gdal.PopErrorHandler()
+        assert f is not None
+        assert f["osm_id"] == "1"
+        assert f.GetGeometryRef().GetPoints() == [
+            pytest.approx((49, 2), abs=1e-7),
+            pytest.approx((49, 2.1), abs=1e-7),
+            pytest.approx((49.1, 2.2), abs=1e-7),
+        ]
+        return debug_msgs
+
+    try:
+        with gdaltest.error_handler():
+            ds = gdal.OpenEx(filename, open_options=["USE_FLAT_NODES=YES"])
+        assert ds is not None
+        lyr = ds.GetLayerByName("lines")
+
+        debug_msgs = read_lines(lyr)
+        if not debug_msgs:
+            pytest.skip("flat nodes not supported on this platform")
+        expected_msgs = [
+            "Flat node file mapped for 67108864 nodes",
+            "Flat node file mapped for 201326592 nodes",
+        ]
+        assert debug_msgs == expected_msgs
+
+        # ResetReading() resets the flat node file, which must be grown again
+        assert read_lines(lyr) == expected_msgs
+        ds = None
+    finally:
+        gdal.Unlink(filename)
+
+
 ###############################################################################
 # Test ogr2ogr with all layers
 
@@ -6178,6 +6178,174 @@ def test_ogr_pg_temp():
         gdaltest.pg_ds.ExecuteSQL("DELLAYER:" + layer_name)
 
 
+###############################################################################
+# Test reading with a binary COPY
+
+
+def _create_ogr_pg_binary_copy_layer(layer_name):
+
+    lyr = gdaltest.pg_ds.CreateLayer(
+        layer_name,
+        geom_type=ogr.wkbPoint if gdaltest.pg_has_postgis else ogr.wkbNone,
+        options=["GEOMETRY_NAME=geom"],
+    )
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    fld_defn = ogr.FieldDefn("int16", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTInt16)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    fld_defn = ogr.FieldDefn("float32", ogr.OFTReal)
+    fld_defn.SetSubType(ogr.OFSTFloat32)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    lyr.CreateField(ogr.FieldDefn("time", ogr.OFTTime))
+    lyr.CreateField(ogr.FieldDefn("datetime", ogr.OFTDateTime))
+    lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 3 != 2:
+            f["bool"] = i % 2
+            f["int16"] = -i
+            f["int32"] = i * 1000
+            f["int64"] = 1234567890123 * i
+            f["float32"] = 1.1 * i
+            f["float64"] = 1.25 * i
+            f["str"] = "foo%d" % i
+            f["date"] = "2023/01/%02d" % (i + 1)
+            f["time"] = "12:34:%02d" % i
+            f["datetime"] = "2023/01/%02d 12:34:56.789+02" % (i + 1)
+            f.SetFieldBinaryFromHexString("binary", "0123%02X" % i)
+            if gdaltest.pg_has_postgis:
+                f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+    lyr.ResetReading()
+
+
+def test_ogr_pg_binary_copy():
+
+    if gdaltest.pg_ds is None:
+        pytest.skip()
+
+    layer_name = "test_ogr_pg_binary_copy"
+    try:
+        _create_ogr_pg_binary_copy_layer(layer_name)
+
+        ds = ogr.Open("PG:" + gdaltest.pg_connection_string)
+        lyr = ds.GetLayerByName(layer_name)
+        expected_features = [f for f in lyr]
+        assert len(expected_features) == 10
+
+        with gdaltest.config_option("OGR_PG_BINARY_COPY", "YES"):
+            lyr.ResetReading()
+            features = [f for f in lyr]
+            assert len(features) == len(expected_features)
+            for f, expected_f in zip(features, expected_features):
+                if not f.Equal(expected_f):
+                    f.DumpReadable()
+                    expected_f.DumpReadable()
+                    pytest.fail()
+
+            # Ignored fields
+            lyr.SetIgnoredFields(["int32", "OGR_GEOMETRY"])
+            lyr.ResetReading()
+            f = lyr.GetNextFeature()
+            assert f.GetFID() == expected_features[0].GetFID()
+            assert not f.IsFieldSet("int32")
+            assert f["str"] == "foo0"
+            assert f.GetGeometryRef() is None
+            lyr.SetIgnoredFields([])
+
+            # Attribute filter
+            lyr.SetAttributeFilter("int16 = -4")
+            lyr.ResetReading()
+            f = lyr.GetNextFeature()
+            assert f.Equal(expected_features[4])
+            assert lyr.GetNextFeature() is None
+            lyr.SetAttributeFilter(None)
+
+            # Another request on the connection interrupts the COPY
+            lyr.ResetReading()
+            assert lyr.GetNextFeature() is not None
+            sql_lyr = ds.ExecuteSQL("SELECT 1")
+            ds.ReleaseResultSet(sql_lyr)
+            with gdaltest.error_handler():
+                assert lyr.GetNextFeature() is None
+            assert gdal.GetLastErrorMsg() != ""
+
+            lyr.ResetReading()
+            assert len([f for f in lyr]) == len(expected_features)
+
+            # Interrupting the COPY in a transaction leaves it usable
+            assert ds.StartTransaction() == ogr.OGRERR_NONE
+            lyr.ResetReading()
+            assert lyr.GetNextFeature() is not None
+            sql_lyr = ds.ExecuteSQL("SELECT 1")
+            f = sql_lyr.GetNextFeature()
+            assert f.GetField(0) == 1
+            ds.ReleaseResultSet(sql_lyr)
+            assert ds.CommitTransaction() == ogr.OGRERR_NONE
+
+    finally:
+        gdaltest.pg_ds.ExecuteSQL("DELLAYER:" + layer_name)
+
+
+###############################################################################
+# Test the Arrow stream interface
+
+
+def test_ogr_pg_arrow_stream():
+
+    if gdaltest.pg_ds is None:
+        pytest.skip()
+    pa = pytest.importorskip("pyarrow")
+
+    layer_name = "test_ogr_pg_arrow_stream"
+    try:
+        _create_ogr_pg_binary_copy_layer(layer_name)
+
+        ds = ogr.Open("PG:" + gdaltest.pg_connection_string)
+        lyr = ds.GetLayerByName(layer_name)
+        assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+        def get_rows(options=[]):
+            stream = lyr.GetArrowStreamAsPyArrow(options=options)
+            rows = []
+            for batch in stream:
+                rows += pa.Table.from_batches([batch]).to_pylist()
+            return rows
+
+        rows = get_rows(["MAX_FEATURES_IN_BATCH=3"])
+        with gdaltest.config_option("OGR_PG_STREAM_BASE_IMPL", "YES"):
+            expected_rows = get_rows(["MAX_FEATURES_IN_BATCH=3"])
+        assert rows == expected_rows
+        assert len(rows) == lyr.GetFeatureCount()
+
+        # Ignored fields
+        lyr.SetIgnoredFields(["int32", "OGR_GEOMETRY"])
+        rows = get_rows(["INCLUDE_FID=NO"])
+        with gdaltest.config_option("OGR_PG_STREAM_BASE_IMPL", "YES"):
+            expected_rows = get_rows(["INCLUDE_FID=NO"])
+        assert rows == expected_rows
+        lyr.SetIgnoredFields([])
+
+        # Attribute filter
+        lyr.SetAttributeFilter("int16 < -4")
+        rows = get_rows()
+        with gdaltest.config_option("OGR_PG_STREAM_BASE_IMPL", "YES"):
+            expected_rows = get_rows()
+        assert rows == expected_rows
+        lyr.SetAttributeFilter(None)
+
+    finally:
+        gdaltest.pg_ds.ExecuteSQL("DELLAYER:" + layer_name)
+
+
 ###############################################################################
 #
 
@@ -5822,6 +5822,96 @@ def test_ogr_shape_alter_geom_field_defn():
     ogr.GetDriverByName("ESRI Shapefile").DeleteDataSource(outfilename)
 
 
+###############################################################################
+# Test that the native Arrow stream implementation returns the same content
+# as the generic one
+
+
+@pytest.mark.parametrize(
+    "filename,spatial_filter",
+    [
+        ("data/poly.shp", None),
+        ("data/poly.shp", (479750, 4764000, 481000, 4765000)),
+        ("data/shp/testpoly.shp", (-10, -10, 10, 10)),
+        ("data/shp/gjpoint.shp", (-10, -10, 10, 10)),
+        ("data/shp/testpointzm.shp", None),
+        ("data/shp/pointz_without_m.shp", None),
+        ("data/shp/pointzm_with_one_valid_m.shp", None),
+        ("data/shp/multipointz_non_constant_z.shp", None),
+        ("data/shp/water_main_dist.dbf", None),
+    ],
+)
+def test_ogr_shape_arrow_stream(filename, spatial_filter):
+    pa = pytest.importorskip("pyarrow")
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+    if spatial_filter:
+        lyr.SetSpatialFilterRect(*spatial_filter)
+
+    def get_rows(options=[]):
+        stream = lyr.GetArrowStreamAsPyArrow(options=options)
+        rows = []
+        for batch in stream:
+            rows += pa.Table.from_batches([batch]).to_pylist()
+        return rows
+
+    rows = get_rows(["MAX_FEATURES_IN_BATCH=3"])
+    with gdaltest.config_option("OGR_SHAPE_STREAM_BASE_IMPL", "YES"):
+        expected_rows = get_rows(["MAX_FEATURES_IN_BATCH=3"])
+    assert rows == expected_rows
+    assert len(rows) == lyr.GetFeatureCount()
+
+    # Ignored fields
+    if lyr.GetLayerDefn().GetFieldCount() > 0:
+        ignored = [lyr.GetLayerDefn().GetFieldDefn(0).GetName(), "OGR_GEOMETRY"]
+        assert lyr.SetIgnoredFields(ignored) == ogr.OGRERR_NONE
+        rows = get_rows(["INCLUDE_FID=NO"])
+        with gdaltest.config_option("OGR_SHAPE_STREAM_BASE_IMPL", "YES"):
+            expected_rows = get_rows(["INCLUDE_FID=NO"])
+        assert rows == expected_rows
+        lyr.SetIgnoredFields([])
+
+    # Attribute filters use the generic implementation
+    lyr.SetAttributeFilter("1 = 1")
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 0
+    lyr.SetAttributeFilter(None)
+
+
+###############################################################################
+# Test that the native Arrow stream signals its end with a released array,
+# as C consumers such as ogr2ogr expect, and not with empty batches
+
+
+def test_ogr_shape_arrow_stream_end_of_stream():
+
+    ds = ogr.Open("data/poly.shp")
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    stream = lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=4"])
+    lengths = []
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        lengths.append(array.GetLength())
+        assert len(lengths) <= 3
+    assert lengths == [4, 4, 2]
+
+    # Further calls keep on signaling the end of stream
+    assert stream.GetNextRecordBatch() is None
+    del stream
+
+    # Same with a spatial filter that selects no feature
+    lyr.SetSpatialFilterRect(0, 0, 1, 1)
+    stream = lyr.GetArrowStream()
+    assert stream.GetNextRecordBatch() is None
+    del stream
+    lyr.SetSpatialFilter(None)
+
+
 ###############################################################################
 
 
@@ -1649,6 +1649,125 @@ def test_ogr_sql_string_int_array_comparison():
     del ds
 
 
+###############################################################################
+# Test GROUP BY
+
+
+def test_ogr_sql_group_by():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("cls"))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    for cls, val, r in [
+        ("a", 1, 1.5),
+        ("b", 2, None),
+        ("a", 3, 2.5),
+        (None, 4, 1.0),
+        ("b", 5, None),
+        ("a", None, 3.0),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if cls is not None:
+            f["cls"] = cls
+        if val is not None:
+            f["val"] = val
+        if r is not None:
+            f["r"] = r
+        lyr.CreateFeature(f)
+
+    sql_lyr = ds.ExecuteSQL(
+        "SELECT cls, COUNT(*) AS cnt, COUNT(val) AS cnt_val, SUM(val) AS sum_val, "
+        "MIN(r) AS min_r, MAX(r) AS max_r, AVG(val) AS avg_val, "
+        "COUNT(DISTINCT r) AS cnt_distinct_r FROM test GROUP BY cls"
+    )
+    assert sql_lyr.GetFeatureCount() == 3
+    assert (
+        sql_lyr.GetLayerDefn()
+        .GetFieldDefn(sql_lyr.GetLayerDefn().GetFieldIndex("cnt"))
+        .GetType()
+        == ogr.OFTInteger
+    )
+    res = [
+        (
+            f["cls"],
+            f["cnt"],
+            f["cnt_val"],
+            f["sum_val"],
+            f["min_r"],
+            f["max_r"],
+            f["avg_val"],
+            f["cnt_distinct_r"],
+        )
+        for f in sql_lyr
+    ]
+    ds.ReleaseResultSet(sql_lyr)
+    assert res == [
+        ("a", 3, 2, 4, 1.5, 3.0, 2.0, 3),
+        ("b", 2, 2, 7, None, None, 3.5, 0),
+        (None, 1, 1, 4, 1.0, 1.0, 4.0, 1),
+    ]
+
+    sql_lyr = ds.ExecuteSQL(
+        "SELECT cls, COUNT(*) AS cnt FROM test GROUP BY cls ORDER BY cls DESC"
+    )
+    res = [(f["cls"], f["cnt"]) for f in sql_lyr]
+    ds.ReleaseResultSet(sql_lyr)
+    assert res == [("b", 2), ("a", 3), (None, 1)]
+
+    sql_lyr = ds.ExecuteSQL(
+        "SELECT cls FROM test WHERE val > 1 GROUP BY cls ORDER BY cls LIMIT 1 OFFSET 1"
+    )
+    assert sql_lyr.GetFeatureCount() == 1
+    res = [f["cls"] for f in sql_lyr]
+    ds.ReleaseResultSet(sql_lyr)
+    assert res == ["a"]
+
+    sql_lyr = ds.ExecuteSQL(
+        "SELECT cls, val, COUNT(*) AS cnt FROM test GROUP BY cls, val ORDER BY val"
+    )
+    assert sql_lyr.GetFeatureCount() == 6
+    ds.ReleaseResultSet(sql_lyr)
+
+    for sql in [
+        "SELECT cls, val FROM test GROUP BY cls",
+        "SELECT DISTINCT cls FROM test GROUP BY cls",
+        "SELECT cls FROM test GROUP BY cls ORDER BY val",
+        "SELECT cls FROM test GROUP BY unknown_field",
+    ]:
+        with gdaltest.error_handler():
+            sql_lyr = ds.ExecuteSQL(sql)
+        assert sql_lyr is None, sql
+
+
+###############################################################################
+# Test that GROUP is only a keyword when followed by BY
+
+
+def test_ogr_sql_group_as_column_name():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("group"))
+    for group in ["a", "A", "a"]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["group"] = group
+        lyr.CreateFeature(f)
+
+    sql_lyr = ds.ExecuteSQL("SELECT group FROM test WHERE group = 'a' ORDER BY group")
+    assert sql_lyr.GetFeatureCount() == 2
+    ds.ReleaseResultSet(sql_lyr)
+
+    # Grouping on string values is case sensitive
+    sql_lyr = ds.ExecuteSQL(
+        "SELECT group, COUNT(*) AS cnt FROM test GROUP\nBY group ORDER BY group"
+    )
+    res = [(f["group"], f["cnt"]) for f in sql_lyr]
+    ds.ReleaseResultSet(sql_lyr)
+    assert res == [("A", 1), ("a", 2)]
+
+
 ###############################################################################
 
 
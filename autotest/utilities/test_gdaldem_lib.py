@@ -701,3 +701,80 @@ def test_gdaldem_lib_nodata():
     if cs != 10:
         print(ds.ReadAsArray())  # Should be 0 0 0 0 181 0 0 0 0
         pytest.fail("Bad checksum")
+
+
+###############################################################################
+# Test that multithreaded processing gives the same result as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("processing", ["hillshade", "slope", "aspect", "TRI"])
+@pytest.mark.parametrize("datatype", [gdal.GDT_Int16, gdal.GDT_Float32])
+@pytest.mark.parametrize("compute_edges", [False, True])
+def test_gdaldem_lib_num_threads(processing, datatype, compute_edges):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/n43.tif", format="MEM", outputType=datatype
+    )
+    # Add a few nodata pixels
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    src_ds.GetRasterBand(1).WriteRaster(
+        10, 20, 2, 2, struct.pack("f" * 4, 0, 0, 0, 0), buf_type=gdal.GDT_Float32
+    )
+
+    def compute():
+        ds = gdal.DEMProcessing(
+            "",
+            src_ds,
+            processing,
+            format="MEM",
+            scale=111120,
+            computeEdges=compute_edges,
+        )
+        return ds.GetRasterBand(1).ReadRaster()
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
+        expected = compute()
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        got = compute()
+    assert got == expected
+
+
+###############################################################################
+# Test multithreaded processing on a raster processed by several swaths
+# (about 1 MB of source data per job), so that the carry-over of the last two
+# lines from one swath to the next is exercised.
+
+
+@pytest.mark.parametrize("processing", ["hillshade", "slope", "TPI"])
+@pytest.mark.parametrize("compute_edges", [False, True])
+def test_gdaldem_lib_num_threads_several_swaths(processing, compute_edges):
+
+    # 16384 Float32 values per line: 16 lines per job, so 32 lines per swath
+    # with 2 threads, and 4 swaths for 100 lines (the last one partial).
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/n43.tif",
+        format="MEM",
+        outputType=gdal.GDT_Float32,
+        width=16384,
+        height=100,
+        resampleAlg=gdal.GRIORA_Bilinear,
+    )
+
+    def compute():
+        ds = gdal.DEMProcessing(
+            "",
+            src_ds,
+            processing,
+            format="MEM",
+            scale=111120,
+            computeEdges=compute_edges,
+        )
+        return ds.GetRasterBand(1).ReadRaster()
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
+        expected = compute()
+    with gdaltest.config_option("GDAL_NUM_THREADS", "2"):
+        got = compute()
+    assert got == expected
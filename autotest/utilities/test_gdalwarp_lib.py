@@ -3143,3 +3143,30 @@ def test_gdalwarp_lib_cleanup():
         os.remove("tmp/testgdalwarp_gcp.tif")
     except OSError:
         pass
+
+
+###############################################################################
+# Test ChunkAndWarpMulti() with more than 2 chunks in flight
+
+
+@pytest.mark.parametrize("num_chunks", ["2", "5"])
+def test_gdalwarp_lib_multi_num_chunks_in_flight(num_chunks):
+
+    src_ds = gdal.Open("../gcore/data/utmsmall.tif")
+
+    # Use exact transformations, so that results do not depend on chunking
+    ref_ds = gdal.Warp(
+        "", src_ds, format="MEM", dstSRS="EPSG:4326", errorThreshold=0
+    )
+
+    ds = gdal.Warp(
+        "",
+        src_ds,
+        format="MEM",
+        dstSRS="EPSG:4326",
+        errorThreshold=0,
+        multithread=True,
+        warpMemoryLimit=100000,
+        warpOptions=["NUM_CHUNKS_IN_FLIGHT=" + num_chunks],
+    )
+    assert ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
@@ -1145,3 +1145,111 @@ def test_ogr2ogr_lib_clipdst_discard_lower_dimensionality():
     ds = gdal.VectorTranslate("", srcDS, options="-f Memory -clipdst -1 -1 0 0")
     lyr = ds.GetLayer(0)
     assert lyr.GetFeatureCount() == 0
+
+
+###############################################################################
+# Test the Arrow columnar transfer path (Shapefile -> GeoPackage)
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("options", ["", "-where EAS_ID=170", "-select AREA,EAS_ID"])
+def test_ogr2ogr_lib_arrow_api(options):
+
+    src_ds = gdal.OpenEx("../ogr/data/poly.shp")
+    assert src_ds.GetLayer(0).TestCapability(ogr.OLCFastGetArrowStream)
+
+    filename_arrow = "/vsimem/test_ogr2ogr_lib_arrow_api.gpkg"
+    filename_ref = "/vsimem/test_ogr2ogr_lib_arrow_api_ref.gpkg"
+    try:
+        with gdaltest.config_option("OGR2OGR_USE_ARROW_API", "YES"):
+            ds = gdal.VectorTranslate(filename_arrow, src_ds, options=options)
+            assert ds.GetLayer(0).TestCapability("FastWriteArrowBatch")
+            ds = None
+        with gdaltest.config_option("OGR2OGR_USE_ARROW_API", "NO"):
+            gdal.VectorTranslate(filename_ref, src_ds, options=options)
+
+        ds = ogr.Open(filename_arrow)
+        ds_ref = ogr.Open(filename_ref)
+        lyr = ds.GetLayer(0)
+        lyr_ref = ds_ref.GetLayer(0)
+        assert lyr.GetFeatureCount() == lyr_ref.GetFeatureCount()
+        assert lyr.GetFeatureCount() > 0
+        for f_ref in lyr_ref:
+            f = lyr.GetNextFeature()
+            assert f.Equal(f_ref)
+        ds = None
+        ds_ref = None
+    finally:
+        gdal.Unlink(filename_arrow)
+        gdal.Unlink(filename_ref)
+
+
+###############################################################################
+# Test OGR2OGR_NUM_THREADS
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        "-t_srs EPSG:4326",
+        "-t_srs EPSG:4326 -segmentize 100 -gt 3",
+        "-nlt MULTIPOLYGON -limit 7 -preserve_fid",
+        "-where EAS_ID=170",
+    ],
+)
+def test_ogr2ogr_lib_num_threads(options):
+
+    src_ds = gdal.OpenEx("../ogr/data/poly.shp")
+
+    with gdaltest.config_option("OGR2OGR_NUM_THREADS", "3"):
+        ds = gdal.VectorTranslate("", src_ds, format="Memory", options=options)
+    ds_ref = gdal.VectorTranslate("", src_ds, format="Memory", options=options)
+
+    lyr = ds.GetLayer(0)
+    lyr_ref = ds_ref.GetLayer(0)
+    assert lyr.GetFeatureCount() == lyr_ref.GetFeatureCount()
+    assert lyr.GetFeatureCount() > 0
+    for f_ref in lyr_ref:
+        f = lyr.GetNextFeature()
+        assert f.Equal(f_ref)
+
+
+###############################################################################
+# Test that errors raised by OGR2OGR_NUM_THREADS workers reach the caller
+
+
+def test_ogr2ogr_lib_num_threads_errors():
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    src_lyr = src_ds.CreateLayer("test", srs=srs)
+    for i in range(20):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt("POINT (0 %d)" % (90 if i == 10 else i))
+        )
+        src_lyr.CreateFeature(f)
+
+    def translate():
+        errors = []
+
+        def handler(err_type, err_no, err_msg):
+            if err_type == gdal.CE_Failure:
+                errors.append(err_msg)
+
+        with gdaltest.error_handler(handler):
+            ds = gdal.VectorTranslate(
+                "",
+                src_ds,
+                format="Memory",
+                options="-t_srs EPSG:3857 -skipfailures",
+            )
+        return ds.GetLayer(0).GetFeatureCount(), errors
+
+    with gdaltest.config_option("OGR2OGR_NUM_THREADS", "3"):
+        res = translate()
+    res_ref = translate()
+    assert res == res_ref
+    assert len([msg for msg in res[1] if "Failed to reproject feature" in msg]) == 1
@@ -923,6 +923,10 @@ int ReadGrib2Record (VSILFILE *fp, sChar f_unit, double **Grib_Data,
                                     * unpack GRIB2 library. */
    sInt4 ndjer = UNPK_NUM_ERRORS; /* The number of rows in JER( ). */
    sInt4 kjer;          /* The actual number of errors returned in JER. */
+   unsigned int unpkSubgNum = 0; /* Unpacker state: the sub grid read most
+                                  * recently. */
+   sInt4 unpkNumFields = 1; /* Unpacker state: number of sub grids in this
+                             * message. */
    size_t i;            /* counter as we loop through jer. */
    double unitM, unitB; /* values in y = m x + b used for unit conversion. */
    char unitName[15];   /* Holds the string name of the current unit. */
@@ -1194,7 +1198,8 @@ int ReadGrib2Record (VSILFILE *fp, sChar f_unit, double **Grib_Data,
                   &(IS->ns[4]), IS->is[5], &(IS->ns[5]), IS->is[6],
                   &(IS->ns[6]), IS->is[7], &(IS->ns[7]), IS->ib, &ibitmap,
                   c_ipack, &(IS->nd5), &xmissp, &xmisss, &inew, &iclean,
-                  &l3264b, f_endMsg, jer, &ndjer, &kjer);
+                  &l3264b, f_endMsg, jer, &ndjer, &kjer,
+                  &unpkSubgNum, &unpkNumFields);
 /*
       unpk_grib2 (&kfildo, (float *) (IS->iain), IS->iain, &(IS->nd2x3),
                   IS->idat, &(IS->nidat), IS->rdat, &(IS->nrdat), IS->is[0],
@@ -1443,6 +1448,10 @@ int ReadGrib2RecordFast (FILE *fp, sChar f_unit, double **Grib_Data,
                                     * unpack GRIB2 library. */
    sInt4 ndjer = UNPK_NUM_ERRORS; /* The number of rows in JER( ). */
    sInt4 kjer;          /* The actual number of errors returned in JER. */
+   unsigned int unpkSubgNum = 0; /* Unpacker state: the sub grid read most
+                                  * recently. */
+   sInt4 unpkNumFields = 1; /* Unpacker state: number of sub grids in this
+                             * message. */
    size_t i;            /* counter as we loop through jer. */
    double unitM, unitB; /* values in y = m x + b used for unit conversion. */
    char unitName[15];   /* Holds the string name of the current unit. */
@@ -1623,7 +1632,8 @@ int ReadGrib2RecordFast (FILE *fp, sChar f_unit, double **Grib_Data,
                   &(IS->ns[4]), IS->is[5], &(IS->ns[5]), IS->is[6],
                   &(IS->ns[6]), IS->is[7], &(IS->ns[7]), IS->ib, &ibitmap,
                   c_ipack, &(IS->nd5), &xmissp, &xmisss, &inew, &iclean,
-                  &l3264b, f_endMsg, jer, &ndjer, &kjer);
+                  &l3264b, f_endMsg, jer, &ndjer, &kjer,
+                  &unpkSubgNum, &unpkNumFields);
 
 
       /*
@@ -488,9 +488,9 @@ void preErrSprintf (const char *fmt, ...)
  *****************************************************************************
  */
 /* Following variables used in the myWarn routines */
-static char *warnBuff = NULL; /* Stores the current built up message. */
-static size_t warnBuffLen = 0; /* Allocated length of warnBuff. */
-static sChar warnLevel = -1; /* Current warning level. */
+static thread_local char *warnBuff = NULL; /* Stores the current built up message. */
+static thread_local size_t warnBuffLen = 0; /* Allocated length of warnBuff. */
+static thread_local sChar warnLevel = -1; /* Current warning level. */
 static uChar warnOutType = 0; /* Output type as set in myWarnSet. */
 static uChar warnDetail = 0; /* Detail level as set in myWarnSet. */
 static uChar warnFileDetail = 0; /* Detail level as set in myWarnSet. */
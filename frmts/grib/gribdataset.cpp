@@ -49,10 +49,13 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "cpl_json.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
 #include "degrib/degrib/degrib2.h"
 #include "degrib/degrib/inventory.h"
 #include "degrib/degrib/meta.h"
@@ -67,6 +70,7 @@ CPL_C_END
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_spatialref.h"
 #include "memdataset.h"
 
@@ -861,48 +865,65 @@ CPLErr GRIBRasterBand::LoadData()
             m_Grib_MetaData = nullptr;
         }
         ReadGribData(poGDS->fp, start, subgNum, &m_Grib_Data, &m_Grib_MetaData);
-        if( !m_Grib_Data )
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
-            if (m_Grib_MetaData != nullptr)
-            {
-                MetaFree(m_Grib_MetaData);
-                delete m_Grib_MetaData;
-                m_Grib_MetaData = nullptr;
-            }
-            return CE_Failure;
-        }
+        return CheckLoadedData();
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                          CheckLoadedData()                           */
+/*                                                                      */
+/*      Validates the data just decoded into m_Grib_Data and accounts   */
+/*      for it in the dataset cache.                                    */
+/************************************************************************/
 
-        // Check the band matches the dataset as a whole, size wise. (#3246)
-        nGribDataXSize = m_Grib_MetaData->gds.Nx;
-        nGribDataYSize = m_Grib_MetaData->gds.Ny;
-        if( nGribDataXSize <= 0 || nGribDataYSize <= 0 )
+CPLErr GRIBRasterBand::CheckLoadedData()
+
+{
+    GRIBDataset *poGDS = static_cast<GRIBDataset *>(poDS);
+
+    if( !m_Grib_Data )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
+        if (m_Grib_MetaData != nullptr)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d.",
-                     nBand,
-                     nGribDataXSize, nGribDataYSize);
             MetaFree(m_Grib_MetaData);
             delete m_Grib_MetaData;
             m_Grib_MetaData = nullptr;
-            return CE_Failure;
         }
+        return CE_Failure;
+    }
 
-        poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
-                               nGribDataYSize * sizeof(double);
-        poGDS->poLastUsedBand = this;
+    // Check the band matches the dataset as a whole, size wise. (#3246)
+    nGribDataXSize = m_Grib_MetaData->gds.Nx;
+    nGribDataYSize = m_Grib_MetaData->gds.Ny;
+    if( nGribDataXSize <= 0 || nGribDataYSize <= 0 )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d.",
+                 nBand,
+                 nGribDataXSize, nGribDataYSize);
+        MetaFree(m_Grib_MetaData);
+        delete m_Grib_MetaData;
+        m_Grib_MetaData = nullptr;
+        return CE_Failure;
+    }
 
-        if( nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize )
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d, while the first band "
-                     "and dataset is %dx%d.  Georeferencing of band %d may "
-                     "be incorrect, and data access may be incomplete.",
-                     nBand,
-                     nGribDataXSize, nGribDataYSize,
-                     nRasterXSize, nRasterYSize,
-                     nBand);
-        }
+    poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
+                           nGribDataYSize * sizeof(double);
+    poGDS->poLastUsedBand = this;
+
+    if( nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize )
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d, while the first band "
+                 "and dataset is %dx%d.  Georeferencing of band %d may "
+                 "be incorrect, and data access may be incomplete.",
+                 nBand,
+                 nGribDataXSize, nGribDataYSize,
+                 nRasterXSize, nRasterYSize,
+                 nBand);
     }
 
     return CE_None;
@@ -1240,6 +1261,137 @@ class InventoryWrapperSidecar : public gdal::grib::InventoryWrapper
     }
 };
 
+/************************************************************************/
+/*                           InventoryWrapperCache                      */
+/************************************************************************/
+
+// Inventory persisted by GDAL in a <GRIB>.gdal_idx.json sidecar, so that
+// later opens of a large file do not have to scan all message headers.
+class InventoryWrapperCache : public gdal::grib::InventoryWrapper
+{
+  public:
+    static constexpr const char* SIGNATURE = "GDAL GRIB inventory";
+    static constexpr int VERSION = 1;
+
+    InventoryWrapperCache(const CPLJSONDocument& oDoc,
+                          const VSIStatBufL& sStatGrib) :
+        gdal::grib::InventoryWrapper()
+    {
+        result_ = -1;
+        const auto oRoot = oDoc.GetRoot();
+        if( oRoot.GetString("type") != SIGNATURE ||
+            oRoot.GetInteger("version") != VERSION ||
+            oRoot.GetLong("file_size", -1) !=
+                static_cast<GInt64>(sStatGrib.st_size) ||
+            oRoot.GetLong("file_mtime", -1) !=
+                static_cast<GInt64>(sStatGrib.st_mtime) )
+        {
+            CPLDebug("GRIB", "Inventory cache is out of date");
+            return;
+        }
+
+        const auto oMessages = oRoot.GetArray("messages");
+        if( !oMessages.IsValid() || oMessages.Size() == 0 )
+            return;
+        inv_len_ = static_cast<uInt4>(oMessages.Size());
+        inv_ = new inventoryType[inv_len_]();
+
+        const auto GetString = [](const CPLJSONObject& oObj,
+                                  const char* pszKey) -> char*
+        {
+            const auto oVal = oObj.GetObj(pszKey);
+            if( oVal.GetType() != CPLJSONObject::Type::String )
+                return nullptr;
+            return VSIStrdup(oVal.ToString().c_str());
+        };
+
+        for( uInt4 i = 0; i < inv_len_; ++i )
+        {
+            const auto oMsg = oMessages[static_cast<int>(i)];
+            inv_[i].GribVersion =
+                static_cast<sChar>(oMsg.GetInteger("grib_version"));
+            inv_[i].start =
+                static_cast<vsi_l_offset>(oMsg.GetLong("start"));
+            inv_[i].msgNum =
+                static_cast<unsigned short>(oMsg.GetInteger("msg_num"));
+            inv_[i].subgNum =
+                static_cast<unsigned short>(oMsg.GetInteger("subg_num"));
+            inv_[i].refTime = oMsg.GetDouble("ref_time");
+            inv_[i].validTime = oMsg.GetDouble("valid_time");
+            inv_[i].foreSec = oMsg.GetDouble("fore_sec");
+            inv_[i].element = GetString(oMsg, "element");
+            inv_[i].comment = GetString(oMsg, "comment");
+            inv_[i].unitName = GetString(oMsg, "unit_name");
+            inv_[i].shortFstLevel = GetString(oMsg, "short_fst_level");
+            inv_[i].longFstLevel = GetString(oMsg, "long_fst_level");
+        }
+
+        num_messages_ = oRoot.GetInteger("num_messages");
+        result_ = oRoot.GetInteger("result");
+    }
+
+    ~InventoryWrapperCache() override
+    {
+        if (inv_ == nullptr)
+            return;
+
+        for (uInt4 i = 0; i < inv_len_; i++)
+        {
+            VSIFree(inv_[i].element);
+            VSIFree(inv_[i].comment);
+            VSIFree(inv_[i].unitName);
+            VSIFree(inv_[i].shortFstLevel);
+            VSIFree(inv_[i].longFstLevel);
+        }
+
+        delete [] inv_;
+    }
+
+    static bool Write(const std::string& osCacheFilename,
+                      const gdal::grib::InventoryWrapper& oInventories,
+                      const VSIStatBufL& sStatGrib)
+    {
+        CPLJSONDocument oDoc;
+        auto oRoot = oDoc.GetRoot();
+        oRoot.Add("type", SIGNATURE);
+        oRoot.Add("version", VERSION);
+        oRoot.Add("file_size", static_cast<GInt64>(sStatGrib.st_size));
+        oRoot.Add("file_mtime", static_cast<GInt64>(sStatGrib.st_mtime));
+        oRoot.Add("num_messages",
+                  static_cast<int>(oInventories.num_messages()));
+        oRoot.Add("result", oInventories.result());
+
+        CPLJSONArray oMessages;
+        for( uInt4 i = 0; i < oInventories.length(); ++i )
+        {
+            const inventoryType* psInv = oInventories.get(i);
+            CPLJSONObject oMsg;
+            oMsg.Add("grib_version", static_cast<int>(psInv->GribVersion));
+            oMsg.Add("start", static_cast<GInt64>(psInv->start));
+            oMsg.Add("msg_num", static_cast<int>(psInv->msgNum));
+            oMsg.Add("subg_num", static_cast<int>(psInv->subgNum));
+            oMsg.Add("ref_time", psInv->refTime);
+            oMsg.Add("valid_time", psInv->validTime);
+            oMsg.Add("fore_sec", psInv->foreSec);
+            if( psInv->element )
+                oMsg.Add("element", psInv->element);
+            if( psInv->comment )
+                oMsg.Add("comment", psInv->comment);
+            if( psInv->unitName )
+                oMsg.Add("unit_name", psInv->unitName);
+            if( psInv->shortFstLevel )
+                oMsg.Add("short_fst_level", psInv->shortFstLevel);
+            if( psInv->longFstLevel )
+                oMsg.Add("long_fst_level", psInv->longFstLevel);
+            oMessages.Add(oMsg);
+        }
+        oRoot.Add("messages", oMessages);
+
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+        return oDoc.Save(osCacheFilename);
+    }
+};
+
 /************************************************************************/
 /* ==================================================================== */
 /*                              GRIBDataset                             */
@@ -1289,6 +1441,157 @@ CPLErr GRIBDataset::GetGeoTransform( double *padfTransform )
     return CE_None;
 }
 
+/************************************************************************/
+/*                           PrefetchBands()                            */
+/*                                                                      */
+/*      Decodes in parallel the messages of the requested bands that    */
+/*      are not cached yet, within the limit of GRIB_CACHEMAX.          */
+/************************************************************************/
+
+namespace {
+struct GRIBDecodeJob
+{
+    std::string osFilename{};
+    vsi_l_offset nStart = 0;
+    int nSubgNum = 0;
+    double* padfData = nullptr;
+    grib_MetaData* psMetaData = nullptr;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+} // namespace
+
+static void GRIBDecodeJobFunc( void* pData )
+{
+    auto psJob = static_cast<GRIBDecodeJob*>(pData);
+    // Errors are re-emitted from the calling thread.
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    // Use a dedicated file handle, as the one of the dataset is not
+    // thread-safe.
+    VSILFILE* fp = VSIFOpenL(psJob->osFilename.c_str(), "rb");
+    if( fp != nullptr )
+    {
+        GRIBRasterBand::ReadGribData(fp, psJob->nStart, psJob->nSubgNum,
+                                     &psJob->padfData, &psJob->psMetaData);
+        VSIFCloseL(fp);
+    }
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+void GRIBDataset::PrefetchBands( int nBandCount, const int* panBandMap )
+{
+    const int nThreads =
+        CPLGetNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
+    if( nThreads <= 1 || bCacheOnlyOneBand )
+        return;
+
+    // Only decode what LoadData() would keep in cache.
+    const GIntBig nBandBytes = static_cast<GIntBig>(nRasterXSize) *
+                               nRasterYSize * sizeof(double);
+    GIntBig nCachedBytesAfter = nCachedBytes;
+    std::vector<GRIBRasterBand*> apoBands;
+    std::vector<GRIBDecodeJob> asJobs;
+    for( int i = 0; i < nBandCount; ++i )
+    {
+        auto poBand = cpl::down_cast<GRIBRasterBand *>(
+            GetRasterBand(panBandMap[i]));
+        if( poBand->m_Grib_Data != nullptr ||
+            std::find(apoBands.begin(), apoBands.end(), poBand) !=
+                apoBands.end() )
+        {
+            continue;
+        }
+        if( nCachedBytesAfter + nBandBytes > nCachedBytesThreshold )
+            break;
+        nCachedBytesAfter += nBandBytes;
+        apoBands.push_back(poBand);
+        GRIBDecodeJob sJob;
+        sJob.osFilename = GetDescription();
+        sJob.nStart = poBand->start;
+        sJob.nSubgNum = poBand->subgNum;
+        asJobs.emplace_back(std::move(sJob));
+    }
+    if( asJobs.size() <= 1 )
+        return;
+
+    // Do not wait on the pool we are running on, when called from one of
+    // its jobs (VRT source, block scan, etc.)
+    CPLWorkerThreadPool* poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if( poThreadPool == nullptr || poThreadPool->IsCurrentThreadWorker() )
+        return;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for( auto& sJob: asJobs )
+    {
+        if( !poJobQueue->SubmitJob(GRIBDecodeJobFunc, &sJob) )
+        {
+            poJobQueue->WaitCompletion();
+            for( auto& sJobToFree: asJobs )
+            {
+                free(sJobToFree.padfData);
+                if( sJobToFree.psMetaData )
+                {
+                    MetaFree(sJobToFree.psMetaData);
+                    delete sJobToFree.psMetaData;
+                }
+            }
+            return;
+        }
+    }
+    poJobQueue->WaitCompletion();
+
+    for( size_t i = 0; i < asJobs.size(); ++i )
+    {
+        auto poBand = apoBands[i];
+        auto& sJob = asJobs[i];
+        if( sJob.padfData == nullptr )
+        {
+            // Let LoadData() retry and report the error, instead of
+            // re-emitting the ones of the job.
+            if( sJob.psMetaData )
+            {
+                MetaFree(sJob.psMetaData);
+                delete sJob.psMetaData;
+            }
+            continue;
+        }
+        for( const auto& oError: sJob.aoErrors )
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        // Might contain the metadata read at opening or by GetNoDataValue()
+        poBand->UncacheData();
+        poBand->m_Grib_Data = sJob.padfData;
+        poBand->m_Grib_MetaData = sJob.psMetaData;
+        // Errors are reported as LoadData() would do.
+        poBand->CheckLoadedData();
+    }
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GRIBDataset::IRasterIO( GDALRWFlag eRWFlag,
+                               int nXOff, int nYOff, int nXSize, int nYSize,
+                               void * pData, int nBufXSize, int nBufYSize,
+                               GDALDataType eBufType,
+                               int nBandCount, int *panBandMap,
+                               GSpacing nPixelSpace, GSpacing nLineSpace,
+                               GSpacing nBandSpace,
+                               GDALRasterIOExtraArg* psExtraArg )
+
+{
+    // Each band is a GRIB message that must be decoded as a whole, so
+    // decode the messages of a multi-band request in parallel.
+    if( eRWFlag == GF_Read && nBandCount > 1 )
+        PrefetchBands(nBandCount, panBandMap);
+
+    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap,
+                                     nPixelSpace, nLineSpace, nBandSpace,
+                                     psExtraArg);
+}
+
 /************************************************************************/
 /*                            Identify()                                */
 /************************************************************************/
@@ -1338,11 +1641,62 @@ std::unique_ptr<gdal::grib::InventoryWrapper> GRIBDataset::Inventory(VSILFILE *f
     else
         CPLDebug("GRIB", "Failed opening sidecar %s", sSideCarFilename.c_str());
 
-    if (pInventories == nullptr)
+    if (pInventories != nullptr)
+        return pInventories;
+
+    // Optional inventory persisted by a previous open of the file.
+    bool bUseInventoryCache = CPLTestBool(
+        CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "INVENTORY_CACHE",
+            CPLGetConfigOption("GRIB_INVENTORY_CACHE", "NO")));
+    const std::string osCacheFilename =
+        std::string(poOpenInfo->pszFilename) + ".gdal_idx.json";
+    VSIStatBufL sStatGrib;
+    if (bUseInventoryCache &&
+        VSIStatL(poOpenInfo->pszFilename, &sStatGrib) == 0)
+    {
+        VSIStatBufL sStatCache;
+        CPLJSONDocument oDoc;
+        bool bLoaded = false;
+        if (VSIStatL(osCacheFilename.c_str(), &sStatCache) == 0)
+        {
+            CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+            bLoaded = oDoc.Load(osCacheFilename);
+        }
+        if (bLoaded)
+        {
+            CPLDebug("GRIB", "Reading inventories from cache file %s",
+                     osCacheFilename.c_str());
+            pInventories =
+                cpl::make_unique<InventoryWrapperCache>(oDoc, sStatGrib);
+            if (pInventories->result() <= 0 || pInventories->length() == 0)
+                pInventories = nullptr;
+            else
+                return pInventories;
+        }
+    }
+    else
     {
-        CPLDebug("GRIB", "Reading inventories from GRIB file %s", poOpenInfo->pszFilename);
-        // Contains an GRIB2 message inventory of the file.
-        pInventories = cpl::make_unique<InventoryWrapperGrib>(fp);
+        bUseInventoryCache = false;
+    }
+
+    CPLDebug("GRIB", "Reading inventories from GRIB file %s", poOpenInfo->pszFilename);
+    // Contains an GRIB2 message inventory of the file.
+    pInventories = cpl::make_unique<InventoryWrapperGrib>(fp);
+
+    if (bUseInventoryCache && pInventories->result() > 0 &&
+        pInventories->length() > 0)
+    {
+        if (InventoryWrapperCache::Write(osCacheFilename, *pInventories,
+                                         sStatGrib))
+        {
+            CPLDebug("GRIB", "Inventory cache written in %s",
+                     osCacheFilename.c_str());
+        }
+        else
+        {
+            CPLDebug("GRIB", "Cannot write inventory cache %s",
+                     osCacheFilename.c_str());
+        }
     }
 
     return pInventories;
@@ -2787,6 +3141,10 @@ char** GDALGRIBDriver::GetMetadata(const char* pszDomain)
               "    <Option name='USE_IDX' type='boolean' "
               "description='Load metadata from "
               "wgrib2 index file if available' default='YES'/>"
+              "    <Option name='INVENTORY_CACHE' type='boolean' "
+              "description='Whether to write the inventory of messages in a "
+              ".gdal_idx.json sidecar file, and reuse it in later opens' "
+              "default='NO'/>"
               "</OpenOptionList>");
         }
         return aosMetadata.List();
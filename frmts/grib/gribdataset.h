@@ -104,8 +104,16 @@ class GRIBDataset final: public GDALPamDataset
 
     std::shared_ptr<GDALGroup> GetRootGroup() const override { return m_poRootGroup; }
 
+  protected:
+    CPLErr IRasterIO( GDALRWFlag, int, int, int, int,
+                      void *, int, int, GDALDataType,
+                      int, int *, GSpacing nPixelSpace,
+                      GSpacing nLineSpace, GSpacing nBandSpace,
+                      GDALRasterIOExtraArg* psExtraArg ) override;
+
   private:
     void SetGribMetaData(grib_MetaData *meta);
+    void PrefetchBands(int nBandCount, const int* panBandMap);
     static GDALDataset *OpenMultiDim( GDALOpenInfo * );
     static std::unique_ptr<gdal::grib::InventoryWrapper> Inventory(VSILFILE *, GDALOpenInfo *);
 
@@ -158,6 +166,7 @@ public:
                               grib_MetaData ** );
 private:
     CPLErr       LoadData();
+    CPLErr       CheckLoadedData();
     void         FindNoDataGrib2(bool bSeekToStart = true);
     void         FindMetaData();
     // Heuristic search for the start of the message
@@ -975,9 +975,50 @@ GDALDataset* GDALCOGCreator::Create(const char * pszFilename,
             double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0)) * 4. / 3;
     }
 
+    // When the uncompressed size of the overview levels is small enough,
+    // keep the temporary overview files in /vsimem/ and uncompressed. This
+    // saves a round-trip to disk and a compression + decompression pass of
+    // the overview pixels, with a bounded memory cost.
+    // Larger rasters still go through temporary files on disk: as overview
+    // tiles precede full resolution ones in a COG, a single-pass writer would
+    // have to hold either the overviews or the full resolution level until
+    // the source has been entirely read.
+    bool bTmpOverviewsInMemory = false;
+    if( bGenerateMskOvr || bGenerateOvr )
+    {
+        const GIntBig nMaxMem = CPLAtoGIntBig(CPLGetConfigOption(
+            "COG_TMP_OVERVIEW_MAX_MEM",
+            CPLSPrintf(CPL_FRMT_GIB, GDALGetCacheMax64() / 4)));
+        const int nDTSize =
+            GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType());
+        double dfOvrMemSize = 0;
+        for( const auto& oDims: asOverviewDims )
+        {
+            const double dfOvrPixels = double(oDims.first) * oDims.second;
+            if( bGenerateOvr )
+                dfOvrMemSize += dfOvrPixels * nBands * nDTSize;
+            if( bGenerateMskOvr )
+                dfOvrMemSize += dfOvrPixels;
+        }
+        bTmpOverviewsInMemory = dfOvrMemSize <= static_cast<double>(nMaxMem);
+        CPLDebug("COG", "Temporary overviews of " CPL_FRMT_GIB " bytes "
+                 "will be stored %s",
+                 static_cast<GIntBig>(dfOvrMemSize),
+                 bTmpOverviewsInMemory ? "in memory" : "on disk");
+    }
+    const auto GetTmpOvrFilename = [this, pszFilename, bTmpOverviewsInMemory]
+                                                        (const char* pszExt)
+    {
+        if( !bTmpOverviewsInMemory )
+            return GetTmpFilename(pszFilename, pszExt);
+        return CPLString(CPLSPrintf("/vsimem/cog_%p/%s.%s", this,
+                                    CPLGetFilename(pszFilename), pszExt));
+    };
+
     CPLStringList aosOverviewOptions;
     aosOverviewOptions.SetNameValue("COMPRESS",
         CPLGetConfigOption("COG_TMP_COMPRESSION", // only for debug purposes
+                        bTmpOverviewsInMemory ? "NONE" :
                         HasZSTDCompression() ? "ZSTD" : "LZW"));
     aosOverviewOptions.SetNameValue("NUM_THREADS",
                         CSLFetchNameValue(papszOptions, "NUM_THREADS"));
@@ -987,7 +1028,7 @@ GDALDataset* GDALCOGCreator::Create(const char * pszFilename,
     if( bGenerateMskOvr )
     {
         CPLDebug("COG", "Generating overviews of the mask: start");
-        m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
+        m_osTmpMskOverviewFilename = GetTmpOvrFilename("msk.ovr.tmp");
         GDALRasterBand* poSrcMask = poFirstBand->GetMaskBand();
         const char* pszResampling = CSLFetchNameValueDef(papszOptions,
             "OVERVIEW_RESAMPLING",
@@ -1021,7 +1062,7 @@ GDALDataset* GDALCOGCreator::Create(const char * pszFilename,
     if( bGenerateOvr )
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+        m_osTmpOverviewFilename = GetTmpOvrFilename("ovr.tmp");
         std::vector<GDALRasterBand*> apoSrcBands;
         for( int i = 0; i < nBands; i++ )
             apoSrcBands.push_back( poCurDS->GetRasterBand(i+1) );
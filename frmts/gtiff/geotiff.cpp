@@ -436,6 +436,16 @@ private:
     int         m_nLastWrittenBlockId = -1; // used for m_bStreamingOut
     int         m_nRefBaseMapping = 0;
     int         m_nGCPCount = 0;
+    // Window of the last AdviseRead() request whose blocks have all been
+    // submitted for prefetching to the file handle. Empty if m_nAdviseReadXSize == 0
+    int         m_nAdviseReadXOff = 0;
+    int         m_nAdviseReadYOff = 0;
+    int         m_nAdviseReadXSize = 0;
+    int         m_nAdviseReadYSize = 0;
+    // Blocks of the AdviseRead() window not yet requested by IRasterIO().
+    // The window is cleared once all have been.
+    std::vector<bool> m_abAdviseReadBlockPending{};
+    int         m_nAdviseReadBlocksPending = 0;
 
     GTIFFKeysFlavorEnum m_eGeoTIFFKeysFlavor = GEOTIFF_KEYS_STANDARD;
     GeoTIFFVersionEnum m_eGeoTIFFVersion = GEOTIFF_VERSION_AUTO;
@@ -602,6 +612,10 @@ private:
     static void    ThreadCompressionFunc( void* pData );
     void           WaitCompletionForJobIdx( int i );
     void           WaitCompletionForBlock( int nBlockId );
+    void           SetAdviseReadWindow( int nXOff, int nYOff,
+                                        int nXSize, int nYSize );
+    bool           ConsumeAdviseReadWindow( int nXOff, int nYOff,
+                                            int nXSize, int nYSize );
     void           WriteRawStripOrTile( int nStripOrTile,
                                         GByte* pabyCompressedBuffer,
                                         GPtrDiff_t nCompressedBufferSize );
@@ -709,6 +723,11 @@ private:
                               GSpacing nPixelSpace, GSpacing nLineSpace,
                               GSpacing nBandSpace,
                               GDALRasterIOExtraArg* psExtraArg ) override;
+    virtual CPLErr AdviseRead( int nXOff, int nYOff, int nXSize, int nYSize,
+                               int nBufXSize, int nBufYSize,
+                               GDALDataType eBufType,
+                               int nBandCount, int *panBandList,
+                               char **papszOptions ) override;
     virtual char **GetFileList() override;
 
     virtual CPLErr IBuildOverviews( const char *,
@@ -1421,6 +1440,10 @@ public:
                               GDALDataType eBufType,
                               GSpacing nPixelSpace, GSpacing nLineSpace,
                               GDALRasterIOExtraArg* psExtraArg ) override final;
+    virtual CPLErr AdviseRead( int nXOff, int nYOff, int nXSize, int nYSize,
+                               int nBufXSize, int nBufYSize,
+                               GDALDataType eBufType,
+                               char **papszOptions ) override;
 
     virtual const char *GetDescription() const override final;
     virtual void        SetDescription( const char * ) override final;
@@ -2431,6 +2454,7 @@ CPLErr GTiffDataset::IRasterIO( GDALRWFlag eRWFlag,
 #ifdef SUPPORTS_GET_OFFSET_BYTECOUNT
     bool bCanUseMultiThreadedRead = false;
     if( m_poThreadPool &&
+             !m_poThreadPool->IsCurrentThreadWorker() &&
              eRWFlag == GF_Read &&
              nBufXSize == nXSize &&
              nBufYSize == nYSize &&
@@ -2498,6 +2522,228 @@ CPLErr GTiffDataset::IRasterIO( GDALRWFlag eRWFlag,
     return eErr;
 }
 
+/************************************************************************/
+/*                            AdviseRead()                              */
+/************************************************************************/
+
+CPLErr GTiffDataset::AdviseRead( int nXOff, int nYOff, int nXSize, int nYSize,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType,
+                                 int nBandCount, int *panBandList,
+                                 char **papszOptions )
+{
+    int bStopProcessing = FALSE;
+    const CPLErr eErr = ValidateRasterIOOrAdviseReadParameters(
+        "AdviseRead()", &bStopProcessing, nXOff, nYOff, nXSize, nYSize,
+        nBufXSize, nBufYSize, nBandCount, panBandList);
+    if( eErr != CE_None || bStopProcessing )
+        return eErr;
+
+    // Only the window of the last request is tracked
+    SetAdviseReadWindow(0, 0, 0, 0);
+
+    // Try to pass the request to the most appropriate overview dataset,
+    // consistently with what IRasterIO() does.
+    if( nBufXSize < nXSize && nBufYSize < nYSize )
+    {
+        GDALRasterIOExtraArg sExtraArg;
+        INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+        int nOvrXOff = nXOff;
+        int nOvrYOff = nYOff;
+        int nOvrXSize = nXSize;
+        int nOvrYSize = nYSize;
+        GDALDataset* poOvrDS = nullptr;
+        ++m_nJPEGOverviewVisibilityCounter;
+        const int iOvr = GDALBandGetBestOverviewLevel2(
+            GetRasterBand(1), nOvrXOff, nOvrYOff, nOvrXSize, nOvrYSize,
+            nBufXSize, nBufYSize, &sExtraArg);
+        if( iOvr >= 0 )
+        {
+            GDALRasterBand* poOvrBand = GetRasterBand(1)->GetOverview(iOvr);
+            if( poOvrBand )
+                poOvrDS = poOvrBand->GetDataset();
+        }
+        --m_nJPEGOverviewVisibilityCounter;
+        if( poOvrDS && poOvrDS != this &&
+            poOvrDS->GetRasterCount() == nBands )
+        {
+            return poOvrDS->AdviseRead(nOvrXOff, nOvrYOff,
+                                       nOvrXSize, nOvrYSize,
+                                       nBufXSize, nBufYSize, eBufType,
+                                       nBandCount, panBandList,
+                                       papszOptions);
+        }
+    }
+
+    if( eAccess != GA_ReadOnly || m_bStreamingIn ||
+        !HasOptimizedReadMultiRange() )
+    {
+        return CE_None;
+    }
+
+    // Collect the byte ranges of the blocks intersecting the window that
+    // are not already in the block cache, and let the file handle prefetch
+    // them in the background.
+    const int nBlockX1 = nXOff / m_nBlockXSize;
+    const int nBlockY1 = nYOff / m_nBlockYSize;
+    const int nBlockX2 = (nXOff + nXSize - 1) / m_nBlockXSize;
+    const int nBlockY2 = (nYOff + nYSize - 1) / m_nBlockYSize;
+    const int nBlocksPerRow = DIV_ROUND_UP(nRasterXSize, m_nBlockXSize);
+    const int nBandsToAdvise =
+        m_nPlanarConfig == PLANARCONFIG_SEPARATE ? nBandCount : 1;
+    const vsi_l_offset nMaxRawBlockCacheSize = static_cast<unsigned>(
+        atoi(CPLGetConfigOption("GDAL_MAX_RAW_BLOCK_CACHE_SIZE", "10485760")));
+
+    std::vector<std::pair<vsi_l_offset, vsi_l_offset>> aoRanges;
+    vsi_l_offset nTotalSize = 0;
+    bool bComplete = true;
+    for( int iY = nBlockY1; bComplete && iY <= nBlockY2; ++iY )
+    {
+        for( int iX = nBlockX1; bComplete && iX <= nBlockX2; ++iX )
+        {
+            for( int i = 0; i < nBandsToAdvise; ++i )
+            {
+                const int nBand = panBandList ? panBandList[i] : i + 1;
+                GDALRasterBlock* poBlock =
+                    GetRasterBand(nBand)->TryGetLockedBlockRef(iX, iY);
+                if( poBlock != nullptr )
+                {
+                    poBlock->DropLock();
+                    continue;
+                }
+                int nBlockId = iX + iY * nBlocksPerRow;
+                if( m_nPlanarConfig == PLANARCONFIG_SEPARATE )
+                    nBlockId += (nBand - 1) * m_nBlocksPerBand;
+
+                vsi_l_offset nOffset = 0;
+                vsi_l_offset nSize = 0;
+                if( IsBlockAvailable(nBlockId, &nOffset, &nSize) && nSize > 0 )
+                {
+                    aoRanges.emplace_back(nOffset, nSize);
+                    nTotalSize += nSize;
+                }
+                if( m_poMaskDS && m_bMaskInterleavedWithImagery &&
+                    m_poMaskDS->IsBlockAvailable(nBlockId, &nOffset, &nSize) &&
+                    nSize > 0 )
+                {
+                    aoRanges.emplace_back(nOffset, nSize);
+                    nTotalSize += nSize;
+                }
+                if( nTotalSize > nMaxRawBlockCacheSize )
+                {
+                    bComplete = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Ranges must be sorted and non-overlapping
+    std::sort(aoRanges.begin(), aoRanges.end());
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    for( const auto& oRange: aoRanges )
+    {
+        const vsi_l_offset nEnd = oRange.first + oRange.second;
+        if( !anOffsets.empty() &&
+            oRange.first <= anOffsets.back() + anSizes.back() )
+        {
+            const vsi_l_offset nLastEnd = anOffsets.back() + anSizes.back();
+            if( nEnd > nLastEnd )
+                anSizes.back() += static_cast<size_t>(nEnd - nLastEnd);
+        }
+        else
+        {
+            anOffsets.push_back(oRange.first);
+            anSizes.push_back(static_cast<size_t>(oRange.second));
+        }
+    }
+
+    if( !anOffsets.empty() )
+    {
+        VSIVirtualHandle* poHandle = reinterpret_cast<VSIVirtualHandle*>(
+            VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF)));
+        poHandle->AdviseRead(static_cast<int>(anOffsets.size()),
+                             anOffsets.data(), anSizes.data());
+    }
+
+    if( bComplete )
+        SetAdviseReadWindow(nXOff, nYOff, nXSize, nYSize);
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                        SetAdviseReadWindow()                         */
+/************************************************************************/
+
+// Set the window whose blocks have been submitted for prefetching, or clear
+// it if nXSize == 0.
+void GTiffDataset::SetAdviseReadWindow( int nXOff, int nYOff,
+                                        int nXSize, int nYSize )
+{
+    m_nAdviseReadXOff = nXOff;
+    m_nAdviseReadYOff = nYOff;
+    m_nAdviseReadXSize = nXSize;
+    m_nAdviseReadYSize = nYSize;
+    m_abAdviseReadBlockPending.clear();
+    m_nAdviseReadBlocksPending = 0;
+    if( nXSize > 0 && nYSize > 0 )
+    {
+        const int nBlocksX = (nXOff + nXSize - 1) / m_nBlockXSize -
+                             nXOff / m_nBlockXSize + 1;
+        const int nBlocksY = (nYOff + nYSize - 1) / m_nBlockYSize -
+                             nYOff / m_nBlockYSize + 1;
+        m_nAdviseReadBlocksPending = nBlocksX * nBlocksY;
+        m_abAdviseReadBlockPending.resize(m_nAdviseReadBlocksPending, true);
+    }
+}
+
+/************************************************************************/
+/*                      ConsumeAdviseReadWindow()                       */
+/************************************************************************/
+
+// Returns whether the request is contained in the AdviseRead() window, in
+// which case its blocks are marked as requested. The window is cleared once
+// all its blocks have been requested, so that later requests, whose blocks
+// might no longer be cached, go through CacheMultiRange() again.
+bool GTiffDataset::ConsumeAdviseReadWindow( int nXOff, int nYOff,
+                                            int nXSize, int nYSize )
+{
+    if( m_nAdviseReadXSize == 0 ||
+        nXOff < m_nAdviseReadXOff ||
+        nYOff < m_nAdviseReadYOff ||
+        nXOff + nXSize > m_nAdviseReadXOff + m_nAdviseReadXSize ||
+        nYOff + nYSize > m_nAdviseReadYOff + m_nAdviseReadYSize )
+    {
+        return false;
+    }
+
+    const int nWindowBlockX1 = m_nAdviseReadXOff / m_nBlockXSize;
+    const int nWindowBlockY1 = m_nAdviseReadYOff / m_nBlockYSize;
+    const int nWindowBlocksX = (m_nAdviseReadXOff + m_nAdviseReadXSize - 1) /
+                                    m_nBlockXSize - nWindowBlockX1 + 1;
+    const int nBlockX2 = (nXOff + nXSize - 1) / m_nBlockXSize;
+    const int nBlockY2 = (nYOff + nYSize - 1) / m_nBlockYSize;
+    for( int iY = nYOff / m_nBlockYSize; iY <= nBlockY2; ++iY )
+    {
+        for( int iX = nXOff / m_nBlockXSize; iX <= nBlockX2; ++iX )
+        {
+            const size_t nIdx =
+                static_cast<size_t>(iY - nWindowBlockY1) * nWindowBlocksX +
+                (iX - nWindowBlockX1);
+            if( m_abAdviseReadBlockPending[nIdx] )
+            {
+                m_abAdviseReadBlockPending[nIdx] = false;
+                --m_nAdviseReadBlocksPending;
+            }
+        }
+    }
+    if( m_nAdviseReadBlocksPending == 0 )
+        SetAdviseReadWindow(0, 0, 0, 0);
+    return true;
+}
+
 #ifdef SUPPORTS_GET_OFFSET_BYTECOUNT
 
 struct GTiffDecompressContext
@@ -5272,6 +5518,17 @@ void* GTiffRasterBand::CacheMultiRange( int nXOff, int nYOff,
     const double dfSrcXInc = dfXSize / static_cast<double>( nBufXSize );
     const double dfSrcYInc = dfYSize / static_cast<double>( nBufYSize );
     const double EPS = 1e-10;
+
+    // If AdviseRead() was called on a window containing this request, the
+    // blocks are already being fetched in the background by the file handle.
+    // Let them be read and decoded as soon as each one is available, rather
+    // than waiting for all of them here.
+    if( nBufXSize == nXSize && nBufYSize == nYSize &&
+        m_poGDS->ConsumeAdviseReadWindow(nXOff, nYOff, nXSize, nYSize) )
+    {
+        return nullptr;
+    }
+
     const int nBlockX1 = static_cast<int>(std::max(0.0, (0+0.5) * dfSrcXInc + dfXOff + EPS)) / nBlockXSize;
     const int nBlockY1 = static_cast<int>(std::max(0.0, (0+0.5) * dfSrcYInc + dfYOff + EPS)) / nBlockYSize;
     const int nBlockX2 = static_cast<int>(std::min(static_cast<double>(nRasterXSize - 1), (nBufXSize-1+0.5) * dfSrcXInc + dfXOff + EPS)) / nBlockXSize;
@@ -5733,6 +5990,7 @@ CPLErr GTiffRasterBand::IRasterIO( GDALRWFlag eRWFlag,
     bool bCanUseMultiThreadedRead = false;
     if( eRWFlag == GF_Read &&
         m_poGDS->m_poThreadPool != nullptr &&
+        !m_poGDS->m_poThreadPool->IsCurrentThreadWorker() &&
         nXSize == nBufXSize && nYSize == nBufYSize &&
         m_poGDS->IsMultiThreadedReadCompatible() )
     {
@@ -5849,6 +6107,21 @@ CPLErr GTiffRasterBand::IRasterIO( GDALRWFlag eRWFlag,
     return eErr;
 }
 
+/************************************************************************/
+/*                            AdviseRead()                              */
+/************************************************************************/
+
+CPLErr GTiffRasterBand::AdviseRead( int nXOff, int nYOff,
+                                    int nXSize, int nYSize,
+                                    int nBufXSize, int nBufYSize,
+                                    GDALDataType eBufType,
+                                    char **papszOptions )
+{
+    return m_poGDS->AdviseRead(nXOff, nYOff, nXSize, nYSize,
+                               nBufXSize, nBufYSize, eBufType,
+                               1, &nBand, papszOptions);
+}
+
 /************************************************************************/
 /*                       IGetDataCoverageStatus()                       */
 /************************************************************************/
@@ -11951,6 +12224,9 @@ void GTiffDataset::FlushCacheInternal( bool bAtClosing,
     m_nLoadedBlock = -1;
     m_bLoadedBlockDirty = false;
 
+    // Blocks prefetched for the AdviseRead() window are no longer cached
+    SetAdviseReadWindow(0, 0, 0, 0);
+
     // Finish compression
     auto poQueue = m_poBaseDS ? m_poBaseDS->m_poCompressQueue.get() : m_poCompressQueue.get();
     if( poQueue )
@@ -54,6 +54,7 @@
 // Must be included after standard includes, otherwise VS2015 fails when
 // including <ctime>
 #include "netcdfdataset.h"
+#include "netcdfdirectchunk.h"
 #include "netcdfsg.h"
 #include "netcdfuffd.h"
 
@@ -68,8 +69,10 @@
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_frmts.h"
+#include "gdal_thread_pool.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
 
@@ -254,10 +257,27 @@ class netCDFRasterBand final: public GDALPamRasterBand
                                         bool bCheckIsNan=false );
     void            SetBlockSize();
 
+    void            GetChunkStartAndEdge( size_t xstart, size_t ystart,
+                                          size_t* start, size_t* edge );
     bool            FetchNetcdfChunk( size_t xstart,
                                       size_t ystart,
                                       void* pImage );
 
+#ifdef NETCDF_HAS_DIRECT_CHUNK_READ
+    // Reads chunks with HDF5 so that they are decompressed without holding
+    // hNCMutex.
+    std::unique_ptr<netCDFDirectChunkReader> m_poDirectChunkReader{};
+    bool            m_bDirectChunkReaderInitialized = false;
+
+    netCDFDirectChunkReader* GetDirectChunkReader();
+    void            CopyDirectChunk( const std::vector<GByte>& abyChunk,
+                                     const size_t* edge, void* pImage );
+    CPLErr          ReadBlockDirect( int nBlockXOff, int nBlockYOff,
+                                     void* pImage, bool& bHandled );
+    void            PrefetchBlocksDirect( int nXOff, int nYOff,
+                                          int nXSize, int nYSize );
+#endif
+
     void            SetNoDataValueNoUpdate(double dfNoData);
     void            SetNoDataValueNoUpdate(int64_t nNoData);
     void            SetNoDataValueNoUpdate(uint64_t nNoData);
@@ -316,6 +336,10 @@ class netCDFRasterBand final: public GDALPamRasterBand
     virtual CPLErr SetUnitType( const char * ) override;
     virtual CPLErr IReadBlock( int, int, void * ) override;
     virtual CPLErr IWriteBlock( int, int, void * ) override;
+    virtual CPLErr IRasterIO( GDALRWFlag, int, int, int, int,
+                              void *, int, int, GDALDataType,
+                              GSpacing, GSpacing,
+                              GDALRasterIOExtraArg* psExtraArg ) override;
 
     virtual CPLErr SetMetadataItem( const char* pszName, const char* pszValue, const char* pszDomain = "" ) override;
     virtual CPLErr SetMetadata( char** papszMD, const char* pszDomain = "" ) override;
@@ -1165,6 +1189,13 @@ netCDFRasterBand::~netCDFRasterBand()
     netCDFRasterBand::FlushCache(true);
     CPLFree(panBandZPos);
     CPLFree(panBandZLev);
+#ifdef NETCDF_HAS_DIRECT_CHUNK_READ
+    if( m_poDirectChunkReader )
+    {
+        CPLMutexHolderD(&hNCMutex);
+        m_poDirectChunkReader.reset();
+    }
+#endif
 }
 
 /************************************************************************/
@@ -2297,16 +2328,12 @@ void netCDFRasterBand::CheckDataCpx( void *pImage, void *pImageNC,
 }
 
 /************************************************************************/
-/*                         FetchNetcdfChunk()                           */
+/*                       GetChunkStartAndEdge()                         */
 /************************************************************************/
 
-bool netCDFRasterBand::FetchNetcdfChunk( size_t xstart,
-                                         size_t ystart,
-                                         void* pImage )
+void netCDFRasterBand::GetChunkStartAndEdge( size_t xstart, size_t ystart,
+                                             size_t* start, size_t* edge )
 {
-    size_t start[MAX_NC_DIMS] = {};
-    size_t edge[MAX_NC_DIMS] = {};
-
     start[nBandXPos] = xstart;
     edge[nBandXPos] = nBlockXSize;
     if( (start[nBandXPos] + edge[nBandXPos]) > (size_t)nRasterXSize )
@@ -2318,14 +2345,6 @@ bool netCDFRasterBand::FetchNetcdfChunk( size_t xstart,
         if( (start[nBandYPos] + edge[nBandYPos]) > (size_t)nRasterYSize )
             edge[nBandYPos] = nRasterYSize - start[nBandYPos];
     }
-    const size_t nYChunkSize = nBandYPos < 0 ? 1 : edge[nBandYPos];
-
-#ifdef NCDF_DEBUG
-    CPLDebug("GDAL_netCDF", "start={%ld,%ld} edge={%ld,%ld} bBottomUp=%d",
-                start[nBandXPos], nBandYPos < 0 ? 0 : start[nBandYPos],
-                edge[nBandXPos],  nYChunkSize,
-                ((netCDFDataset *)poDS)->bBottomUp);
-#endif
 
     int nd = 0;
     nc_inq_varndims(cdfid, nZId, &nd);
@@ -2367,6 +2386,28 @@ bool netCDFRasterBand::FetchNetcdfChunk( size_t xstart,
             Taken += static_cast<int>(start[panBandZPos[i]]) * Sum;
         }
     }
+}
+
+/************************************************************************/
+/*                         FetchNetcdfChunk()                           */
+/************************************************************************/
+
+bool netCDFRasterBand::FetchNetcdfChunk( size_t xstart,
+                                         size_t ystart,
+                                         void* pImage )
+{
+    size_t start[MAX_NC_DIMS] = {};
+    size_t edge[MAX_NC_DIMS] = {};
+
+    GetChunkStartAndEdge(xstart, ystart, start, edge);
+    const size_t nYChunkSize = nBandYPos < 0 ? 1 : edge[nBandYPos];
+
+#ifdef NCDF_DEBUG
+    CPLDebug("GDAL_netCDF", "start={%ld,%ld} edge={%ld,%ld} bBottomUp=%d",
+                start[nBandXPos], nBandYPos < 0 ? 0 : start[nBandYPos],
+                edge[nBandXPos],  nYChunkSize,
+                ((netCDFDataset *)poDS)->bBottomUp);
+#endif
 
     // Make sure we are in data mode.
     static_cast<netCDFDataset *>(poDS)->SetDefineMode(false);
@@ -2551,6 +2592,16 @@ CPLErr netCDFRasterBand::IReadBlock( int nBlockXOff, int nBlockYOff,
                                      void *pImage )
 
 {
+#ifdef NETCDF_HAS_DIRECT_CHUNK_READ
+    {
+        bool bHandled = false;
+        const CPLErr eErr =
+            ReadBlockDirect(nBlockXOff, nBlockYOff, pImage, bHandled);
+        if( bHandled )
+            return eErr;
+    }
+#endif
+
     CPLMutexHolderD(&hNCMutex);
 
     // Locate X, Y and Z position in the array.
@@ -2655,6 +2706,350 @@ CPLErr netCDFRasterBand::IReadBlock( int nBlockXOff, int nBlockYOff,
     return FetchNetcdfChunk( xstart, ystart, pImage ) ? CE_None : CE_Failure;
 }
 
+#ifdef NETCDF_HAS_DIRECT_CHUNK_READ
+
+/************************************************************************/
+/*                        GetDirectChunkReader()                        */
+/*                                                                      */
+/*      Must be called with hNCMutex held.                              */
+/************************************************************************/
+
+netCDFDirectChunkReader* netCDFRasterBand::GetDirectChunkReader()
+{
+    if( m_bDirectChunkReaderInitialized )
+        return m_poDirectChunkReader.get();
+    m_bDirectChunkReaderInitialized = true;
+
+    // Only handle the simple case where a GDAL block is exactly a netCDF
+    // chunk, with the same memory layout.
+    auto poGDS = static_cast<netCDFDataset *>(poDS);
+    if( poGDS->eAccess != GA_ReadOnly || poGDS->bBottomUp ||
+        (poGDS->eFormat != NCDF_FORMAT_NC4 &&
+         poGDS->eFormat != NCDF_FORMAT_NC4C) ||
+        GDALDataTypeIsComplex(eDataType) ||
+        !CPLTestBool(CPLGetConfigOption("GDAL_NETCDF_DIRECT_CHUNK_READ",
+                                        "YES")) )
+    {
+        return nullptr;
+    }
+
+    int nd = 0;
+    if( nc_inq_varndims(cdfid, nZId, &nd) != NC_NOERR || nd < 2 ||
+        nBandXPos != nd - 1 || nBandYPos != nd - 2 )
+    {
+        return nullptr;
+    }
+
+    m_poDirectChunkReader = netCDFDirectChunkReader::Create(
+        poGDS->osFilename, cdfid, nZId,
+        GDALGetDataTypeSizeBytes(eDataType),
+        CPL_TO_BOOL(GDALDataTypeIsFloating(eDataType)));
+    if( m_poDirectChunkReader )
+    {
+        const auto& anChunkDims = m_poDirectChunkReader->GetChunkDims();
+        bool bOK = anChunkDims[nd - 1] == static_cast<size_t>(nBlockXSize) &&
+                   anChunkDims[nd - 2] == static_cast<size_t>(nBlockYSize);
+        for( int i = 0; bOK && i < nd - 2; ++i )
+            bOK = anChunkDims[i] == 1;
+        if( bOK )
+        {
+            CPLDebug("GDAL_netCDF",
+                     "Band %d: chunks read and decompressed outside of "
+                     "the netCDF library", nBand);
+        }
+        else
+        {
+            m_poDirectChunkReader.reset();
+        }
+    }
+    return m_poDirectChunkReader.get();
+}
+
+/************************************************************************/
+/*                          CopyDirectChunk()                           */
+/*                                                                      */
+/*      Must be called with hNCMutex held, as CheckData() updates the   */
+/*      band state.                                                     */
+/************************************************************************/
+
+void netCDFRasterBand::CopyDirectChunk( const std::vector<GByte>& abyChunk,
+                                        const size_t* edge, void* pImage )
+{
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const size_t nXChunkSize = edge[nBandXPos];
+    const size_t nYChunkSize = edge[nBandYPos];
+
+    // Arrange the data as nc_get_vara() does in FetchNetcdfChunk(), so that
+    // CheckData() processes it the same way.
+    GByte* pabyImageNC = static_cast<GByte *>(pImage);
+    if( nXChunkSize != static_cast<size_t>(nBlockXSize) )
+    {
+        pabyImageNC += (static_cast<size_t>(nBlockXSize) * nBlockYSize -
+                        nXChunkSize * nYChunkSize) * nDTSize;
+        for( size_t j = 0; j < nYChunkSize; j++ )
+        {
+            memcpy(pabyImageNC + j * nXChunkSize * nDTSize,
+                   abyChunk.data() + j * nBlockXSize * nDTSize,
+                   nXChunkSize * nDTSize);
+        }
+    }
+    else
+    {
+        memcpy(pabyImageNC, abyChunk.data(),
+               nYChunkSize * nXChunkSize * nDTSize);
+    }
+
+    switch( eDataType )
+    {
+        case GDT_Byte:
+            if( bSignedData )
+                CheckData<signed char>(pImage, pabyImageNC, nXChunkSize,
+                                       nYChunkSize, false);
+            else
+                CheckData<unsigned char>(pImage, pabyImageNC, nXChunkSize,
+                                         nYChunkSize, false);
+            break;
+        case GDT_Int8:
+            CheckData<signed char>(pImage, pabyImageNC, nXChunkSize,
+                                   nYChunkSize, false);
+            break;
+        case GDT_Int16:
+            CheckData<GInt16>(pImage, pabyImageNC, nXChunkSize,
+                              nYChunkSize, false);
+            break;
+        case GDT_UInt16:
+            CheckData<GUInt16>(pImage, pabyImageNC, nXChunkSize,
+                               nYChunkSize, false);
+            break;
+        case GDT_Int32:
+            CheckData<GInt32>(pImage, pabyImageNC, nXChunkSize,
+                              nYChunkSize, false);
+            break;
+        case GDT_UInt32:
+            CheckData<GUInt32>(pImage, pabyImageNC, nXChunkSize,
+                               nYChunkSize, false);
+            break;
+        case GDT_Int64:
+            CheckData<std::int64_t>(pImage, pabyImageNC, nXChunkSize,
+                                    nYChunkSize, false);
+            break;
+        case GDT_UInt64:
+            CheckData<std::uint64_t>(pImage, pabyImageNC, nXChunkSize,
+                                     nYChunkSize, false);
+            break;
+        case GDT_Float32:
+            CheckData<float>(pImage, pabyImageNC, nXChunkSize,
+                             nYChunkSize, true);
+            break;
+        case GDT_Float64:
+            CheckData<double>(pImage, pabyImageNC, nXChunkSize,
+                              nYChunkSize, true);
+            break;
+        default:
+            break;
+    }
+}
+
+/************************************************************************/
+/*                          ReadBlockDirect()                           */
+/*                                                                      */
+/*      Reads a block with netCDFDirectChunkReader, holding hNCMutex    */
+/*      only to locate the chunk and to post-process the decoded data.  */
+/*      bHandled is set to false if the netCDF API must be used.        */
+/************************************************************************/
+
+CPLErr netCDFRasterBand::ReadBlockDirect( int nBlockXOff, int nBlockYOff,
+                                          void* pImage, bool& bHandled )
+{
+    bHandled = false;
+
+    size_t start[MAX_NC_DIMS] = {};
+    size_t edge[MAX_NC_DIMS] = {};
+    netCDFDirectChunkReader* poReader = nullptr;
+    netCDFDirectChunkReader::ChunkLocation sLocation;
+    {
+        CPLMutexHolderD(&hNCMutex);
+        poReader = GetDirectChunkReader();
+        if( poReader == nullptr )
+            return CE_None;
+        GetChunkStartAndEdge(static_cast<size_t>(nBlockXOff) * nBlockXSize,
+                             static_cast<size_t>(nBlockYOff) * nBlockYSize,
+                             start, edge);
+        // Chunks not allocated in the file are read with the netCDF API
+        // to get the fill value.
+        if( !poReader->GetChunkLocation(start, sLocation) )
+            return CE_None;
+    }
+
+    bHandled = true;
+    std::vector<GByte> abyChunk;
+    if( !poReader->ReadChunk(sLocation, abyChunk) )
+        return CE_Failure;
+
+    CPLMutexHolderD(&hNCMutex);
+    CopyDirectChunk(abyChunk, edge, pImage);
+    return CE_None;
+}
+
+/************************************************************************/
+/*                        PrefetchBlocksDirect()                        */
+/*                                                                      */
+/*      Reads and decompresses in parallel the chunks intersecting a    */
+/*      RasterIO() request, and puts them in the block cache.           */
+/************************************************************************/
+
+namespace {
+struct netCDFDirectChunkJob
+{
+    const netCDFDirectChunkReader* poReader = nullptr;
+    int nBlockXOff = 0;
+    int nBlockYOff = 0;
+    netCDFDirectChunkReader::ChunkLocation sLocation{};
+    size_t anEdge[MAX_NC_DIMS] = {};
+    std::vector<GByte> abyChunk{};
+    bool bOK = false;
+};
+} // namespace
+
+static void netCDFDirectChunkJobFunc( void* pData )
+{
+    auto psJob = static_cast<netCDFDirectChunkJob*>(pData);
+    // Errors will be reported when the block is read again by IReadBlock()
+    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+    psJob->bOK = psJob->poReader->ReadChunk(psJob->sLocation,
+                                            psJob->abyChunk);
+}
+
+void netCDFRasterBand::PrefetchBlocksDirect( int nXOff, int nYOff,
+                                             int nXSize, int nYSize )
+{
+    const int nThreads =
+        CPLGetNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 128);
+    if( nThreads <= 1 )
+        return;
+
+    // Do not wait on the pool we are running on, when called from one of
+    // its jobs (VRT source, block scan, etc.)
+    CPLWorkerThreadPool* poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if( poThreadPool == nullptr || poThreadPool->IsCurrentThreadWorker() )
+        return;
+
+    const int nBlockXStart = nXOff / nBlockXSize;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockYStart = nYOff / nBlockYSize;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / nBlockYSize;
+    if( nBlockXStart == nBlockXEnd && nBlockYStart == nBlockYEnd )
+        return;
+
+    // Do not prefetch more than what the block cache can reasonably keep
+    // until RasterIO() gets to the blocks.
+    const GIntBig nBlockBytes = static_cast<GIntBig>(nBlockXSize) *
+                                nBlockYSize *
+                                GDALGetDataTypeSizeBytes(eDataType);
+    const GIntBig nMaxBlocks =
+        std::max<GIntBig>(1, GDALGetCacheMax64() / 4 / nBlockBytes);
+
+    std::vector<std::pair<int, int>> anBlocks;
+    for( int iY = nBlockYStart; iY <= nBlockYEnd; ++iY )
+    {
+        for( int iX = nBlockXStart; iX <= nBlockXEnd; ++iX )
+        {
+            if( static_cast<GIntBig>(anBlocks.size()) == nMaxBlocks )
+                break;
+            GDALRasterBlock* poBlock = TryGetLockedBlockRef(iX, iY);
+            if( poBlock != nullptr )
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            anBlocks.emplace_back(iX, iY);
+        }
+    }
+    if( anBlocks.size() <= 1 )
+        return;
+
+    std::vector<netCDFDirectChunkJob> asJobs;
+    {
+        CPLMutexHolderD(&hNCMutex);
+        const auto poReader = GetDirectChunkReader();
+        if( poReader == nullptr )
+            return;
+        asJobs.reserve(anBlocks.size());
+        for( const auto& oBlock: anBlocks )
+        {
+            netCDFDirectChunkJob sJob;
+            sJob.poReader = poReader;
+            sJob.nBlockXOff = oBlock.first;
+            sJob.nBlockYOff = oBlock.second;
+            size_t start[MAX_NC_DIMS] = {};
+            GetChunkStartAndEdge(
+                static_cast<size_t>(oBlock.first) * nBlockXSize,
+                static_cast<size_t>(oBlock.second) * nBlockYSize,
+                start, sJob.anEdge);
+            if( poReader->GetChunkLocation(start, sJob.sLocation) )
+                asJobs.emplace_back(std::move(sJob));
+        }
+    }
+    if( asJobs.size() <= 1 )
+        return;
+
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for( auto& sJob: asJobs )
+    {
+        if( !poJobQueue->SubmitJob(netCDFDirectChunkJobFunc, &sJob) )
+            break;
+    }
+    poJobQueue->WaitCompletion();
+
+    CPLDebug("GDAL_netCDF",
+             "Band %d: prefetching %d chunks with %d threads",
+             nBand, static_cast<int>(asJobs.size()), nThreads);
+
+    for( auto& sJob: asJobs )
+    {
+        if( !sJob.bOK )
+            continue;
+        GDALRasterBlock* poBlock =
+            GetLockedBlockRef(sJob.nBlockXOff, sJob.nBlockYOff, TRUE);
+        if( poBlock == nullptr )
+            continue;
+        {
+            CPLMutexHolderD(&hNCMutex);
+            CopyDirectChunk(sJob.abyChunk, sJob.anEdge, poBlock->GetDataRef());
+        }
+        poBlock->DropLock();
+        // Release memory as we go
+        std::vector<GByte>().swap(sJob.abyChunk);
+    }
+}
+
+#endif // NETCDF_HAS_DIRECT_CHUNK_READ
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr netCDFRasterBand::IRasterIO( GDALRWFlag eRWFlag,
+                                    int nXOff, int nYOff,
+                                    int nXSize, int nYSize,
+                                    void * pData,
+                                    int nBufXSize, int nBufYSize,
+                                    GDALDataType eBufType,
+                                    GSpacing nPixelSpace,
+                                    GSpacing nLineSpace,
+                                    GDALRasterIOExtraArg* psExtraArg )
+{
+#ifdef NETCDF_HAS_DIRECT_CHUNK_READ
+    if( eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize )
+        PrefetchBlocksDirect(nXOff, nYOff, nXSize, nYSize);
+#endif
+
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize,
+                                        eBufType, nPixelSpace, nLineSpace,
+                                        psExtraArg);
+}
+
 /************************************************************************/
 /*                             IWriteBlock()                            */
 /************************************************************************/
@@ -0,0 +1,468 @@
+/******************************************************************************
+ *
+ * Project:  netCDF read/write Driver
+ * Purpose:  Direct reading of netCDF-4 chunks through the HDF5 API.
+ *
+ ******************************************************************************
+ * Copyright (c) 2023, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "netcdfdirectchunk.h"
+
+#ifdef NETCDF_HAS_DIRECT_CHUNK_READ
+
+#include "cpl_compressor.h"
+#include "cpl_error.h"
+
+#include "netcdf.h"
+
+#include "hdf5.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+// H5Dget_chunk_info_by_coord() appeared in HDF5 1.10.5
+#if H5_VERSION_GE(1, 10, 5)
+#define HAVE_H5DGET_CHUNK_INFO_BY_COORD
+#endif
+
+// Registered HDF5 filter id of the Zstandard plugin
+constexpr unsigned NETCDF_H5Z_FILTER_ZSTD = 32015;
+
+namespace {
+
+/************************************************************************/
+/*                          H5ErrorSilencer                             */
+/************************************************************************/
+
+// Prevents the HDF5 library from printing its error stack, as failures
+// just mean that we fall back to the netCDF API.
+class H5ErrorSilencer
+{
+    H5E_auto2_t m_pfnFunc = nullptr;
+    void*       m_pClientData = nullptr;
+
+    H5ErrorSilencer(const H5ErrorSilencer&) = delete;
+    H5ErrorSilencer& operator=(const H5ErrorSilencer&) = delete;
+
+  public:
+    H5ErrorSilencer()
+    {
+        H5Eget_auto2(H5E_DEFAULT, &m_pfnFunc, &m_pClientData);
+        H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+    }
+
+    ~H5ErrorSilencer()
+    {
+        H5Eset_auto2(H5E_DEFAULT, m_pfnFunc, m_pClientData);
+    }
+};
+
+/************************************************************************/
+/*                             Unshuffle()                              */
+/************************************************************************/
+
+// Reverts the HDF5 shuffle filter, that groups together the n-th bytes of
+// all elements.
+static void Unshuffle( const GByte* pabySrc, size_t nSize, size_t nEltSize,
+                       GByte* pabyDst )
+{
+    const size_t nElts = nSize / nEltSize;
+    for( size_t iByte = 0; iByte < nEltSize; ++iByte )
+    {
+        const GByte* pabySrcByte = pabySrc + iByte * nElts;
+        for( size_t i = 0; i < nElts; ++i )
+        {
+            pabyDst[i * nEltSize + iByte] = pabySrcByte[i];
+        }
+    }
+    // Trailing bytes that do not make a whole element are left as they are.
+    const size_t nShuffled = nElts * nEltSize;
+    memcpy(pabyDst + nShuffled, pabySrc + nShuffled, nSize - nShuffled);
+}
+
+/************************************************************************/
+/*                            Fletcher32()                              */
+/************************************************************************/
+
+// Same algorithm as H5_checksum_fletcher32(), which is not part of the
+// public HDF5 API: data is processed as big-endian 16-bit words.
+static uint32_t Fletcher32( const GByte* pabyData, size_t nSize )
+{
+    uint32_t nSum1 = 0;
+    uint32_t nSum2 = 0;
+    size_t nWords = nSize / 2;
+    while( nWords )
+    {
+        // 360 words is the largest count that cannot overflow the sums
+        size_t nBlockWords = std::min<size_t>(nWords, 360);
+        nWords -= nBlockWords;
+        do
+        {
+            nSum1 += (static_cast<uint32_t>(pabyData[0]) << 8) | pabyData[1];
+            pabyData += 2;
+            nSum2 += nSum1;
+        } while( --nBlockWords );
+        nSum1 = (nSum1 & 0xffff) + (nSum1 >> 16);
+        nSum2 = (nSum2 & 0xffff) + (nSum2 >> 16);
+    }
+    if( nSize % 2 )
+    {
+        nSum1 += static_cast<uint32_t>(pabyData[0]) << 8;
+        nSum2 += nSum1;
+        nSum1 = (nSum1 & 0xffff) + (nSum1 >> 16);
+        nSum2 = (nSum2 & 0xffff) + (nSum2 >> 16);
+    }
+    nSum1 = (nSum1 & 0xffff) + (nSum1 >> 16);
+    nSum2 = (nSum2 & 0xffff) + (nSum2 >> 16);
+    return (nSum2 << 16) | nSum1;
+}
+
+} // namespace
+
+/************************************************************************/
+/*                     ~netCDFDirectChunkReader()                       */
+/************************************************************************/
+
+netCDFDirectChunkReader::~netCDFDirectChunkReader()
+{
+    H5ErrorSilencer oSilencer;
+    if( m_hDataset >= 0 )
+        H5Dclose(static_cast<hid_t>(m_hDataset));
+    if( m_hFile >= 0 )
+        H5Fclose(static_cast<hid_t>(m_hFile));
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+std::unique_ptr<netCDFDirectChunkReader> netCDFDirectChunkReader::Create(
+                                            const std::string& osFilename,
+                                            int nGroupId, int nVarId,
+                                            int nDTSize, bool bIsFloat )
+{
+#ifndef HAVE_H5DGET_CHUNK_INFO_BY_COORD
+    (void)osFilename;
+    (void)nGroupId;
+    (void)nVarId;
+    (void)nDTSize;
+    (void)bIsFloat;
+    return nullptr;
+#else
+    int nDims = 0;
+    if( nc_inq_varndims(nGroupId, nVarId, &nDims) != NC_NOERR ||
+        nDims < 2 || nDims > NC_MAX_VAR_DIMS )
+    {
+        return nullptr;
+    }
+
+    int nStorage = 0;
+    std::vector<size_t> anChunkDims(nDims);
+    if( nc_inq_var_chunking(nGroupId, nVarId, &nStorage,
+                            anChunkDims.data()) != NC_NOERR ||
+        nStorage != NC_CHUNKED )
+    {
+        return nullptr;
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Build the HDF5 path of the variable.                            */
+/* -------------------------------------------------------------------- */
+    size_t nGroupNameLen = 0;
+    if( nc_inq_grpname_full(nGroupId, &nGroupNameLen, nullptr) != NC_NOERR )
+        return nullptr;
+    std::string osPath;
+    osPath.resize(nGroupNameLen);
+    if( nc_inq_grpname_full(nGroupId, &nGroupNameLen, &osPath[0]) != NC_NOERR )
+        return nullptr;
+    char szVarName[NC_MAX_NAME + 1] = {};
+    if( nc_inq_varname(nGroupId, nVarId, szVarName) != NC_NOERR )
+        return nullptr;
+    if( osPath.empty() || osPath.back() != '/' )
+        osPath += '/';
+    osPath += szVarName;
+
+/* -------------------------------------------------------------------- */
+/*      Open the file and the dataset with HDF5. The netCDF library     */
+/*      uses a weak file close degree, and HDF5 requires the same one   */
+/*      when a file is opened several times.                            */
+/* -------------------------------------------------------------------- */
+    H5ErrorSilencer oSilencer;
+    std::unique_ptr<netCDFDirectChunkReader> poReader(
+                                            new netCDFDirectChunkReader());
+    poReader->m_osFilename = osFilename;
+    poReader->m_nDTSize = nDTSize;
+
+    const hid_t hFAPL = H5Pcreate(H5P_FILE_ACCESS);
+    if( hFAPL < 0 )
+        return nullptr;
+    H5Pset_fclose_degree(hFAPL, H5F_CLOSE_WEAK);
+    poReader->m_hFile = H5Fopen(osFilename.c_str(), H5F_ACC_RDONLY, hFAPL);
+    H5Pclose(hFAPL);
+    if( poReader->m_hFile < 0 )
+        return nullptr;
+
+    const hid_t hFile = static_cast<hid_t>(poReader->m_hFile);
+    poReader->m_hDataset = H5Dopen2(hFile, osPath.c_str(), H5P_DEFAULT);
+    if( poReader->m_hDataset < 0 )
+        return nullptr;
+    const hid_t hDataset = static_cast<hid_t>(poReader->m_hDataset);
+
+/* -------------------------------------------------------------------- */
+/*      Check that the chunks can be used as they are.                  */
+/* -------------------------------------------------------------------- */
+    bool bOK = false;
+    const hid_t hType = H5Dget_type(hDataset);
+    if( hType >= 0 )
+    {
+        const H5T_class_t eClass = H5Tget_class(hType);
+        const H5T_order_t eOrder = H5Tget_order(hType);
+        bOK = (eClass == (bIsFloat ? H5T_FLOAT : H5T_INTEGER)) &&
+              static_cast<int>(H5Tget_size(hType)) == nDTSize &&
+              (nDTSize == 1 ||
+               eOrder == (CPL_IS_LSB ? H5T_ORDER_LE : H5T_ORDER_BE));
+        H5Tclose(hType);
+    }
+    if( !bOK )
+        return nullptr;
+
+    const hid_t hDCPL = H5Dget_create_plist(hDataset);
+    if( hDCPL < 0 )
+        return nullptr;
+    std::vector<hsize_t> anH5ChunkDims(nDims);
+    bOK = H5Pget_layout(hDCPL) == H5D_CHUNKED &&
+          H5Pget_chunk(hDCPL, nDims, anH5ChunkDims.data()) == nDims;
+    for( int i = 0; bOK && i < nDims; ++i )
+    {
+        bOK = anH5ChunkDims[i] == anChunkDims[i];
+    }
+
+    const int nFilters = bOK ? H5Pget_nfilters(hDCPL) : 0;
+    for( int i = 0; bOK && i < nFilters; ++i )
+    {
+        Filter oFilter;
+        unsigned nFlags = 0;
+        unsigned anParams[16] = {};
+        size_t nParams = CPL_ARRAYSIZE(anParams);
+        const H5Z_filter_t nId = H5Pget_filter2(hDCPL, i, &nFlags, &nParams,
+                                                anParams, 0, nullptr, nullptr);
+        oFilter.nId = static_cast<unsigned>(nId);
+        oFilter.anParams.assign(anParams,
+                                anParams + std::min(nParams,
+                                                    CPL_ARRAYSIZE(anParams)));
+        if( nId == H5Z_FILTER_DEFLATE )
+            bOK = CPLGetDecompressor("zlib") != nullptr;
+        else if( oFilter.nId == NETCDF_H5Z_FILTER_ZSTD )
+            bOK = CPLGetDecompressor("zstd") != nullptr;
+        else
+            bOK = nId == H5Z_FILTER_SHUFFLE || nId == H5Z_FILTER_FLETCHER32;
+        if( !bOK )
+        {
+            CPLDebug("GDAL_netCDF",
+                     "Filter %d of %s not supported for direct chunk reading",
+                     static_cast<int>(nId), osPath.c_str());
+        }
+        poReader->m_aoFilters.emplace_back(std::move(oFilter));
+    }
+    H5Pclose(hDCPL);
+    if( !bOK )
+        return nullptr;
+
+    poReader->m_nChunkSize = static_cast<size_t>(nDTSize);
+    for( const size_t nChunkDim: anChunkDims )
+    {
+        if( nChunkDim > std::numeric_limits<size_t>::max() /
+                                                poReader->m_nChunkSize )
+            return nullptr;
+        poReader->m_nChunkSize *= nChunkDim;
+    }
+    poReader->m_anChunkDims = std::move(anChunkDims);
+
+    return poReader;
+#endif
+}
+
+/************************************************************************/
+/*                          GetChunkLocation()                          */
+/************************************************************************/
+
+bool netCDFDirectChunkReader::GetChunkLocation( const size_t* panStart,
+                                                ChunkLocation& sLocation ) const
+{
+#ifndef HAVE_H5DGET_CHUNK_INFO_BY_COORD
+    (void)panStart;
+    (void)sLocation;
+    return false;
+#else
+    std::vector<hsize_t> anOffset(panStart, panStart + m_anChunkDims.size());
+    unsigned nFilterMask = 0;
+    haddr_t nAddr = HADDR_UNDEF;
+    hsize_t nSize = 0;
+
+    H5ErrorSilencer oSilencer;
+    if( H5Dget_chunk_info_by_coord(static_cast<hid_t>(m_hDataset),
+                                   anOffset.data(),
+                                   &nFilterMask, &nAddr, &nSize) < 0 ||
+        nAddr == HADDR_UNDEF || nSize == 0 ||
+        nSize > std::numeric_limits<size_t>::max() )
+    {
+        return false;
+    }
+    sLocation.nOffset = static_cast<vsi_l_offset>(nAddr);
+    sLocation.nSize = static_cast<size_t>(nSize);
+    sLocation.nFilterMask = nFilterMask;
+    return true;
+#endif
+}
+
+/************************************************************************/
+/*                             ReadChunk()                              */
+/************************************************************************/
+
+bool netCDFDirectChunkReader::ReadChunk( const ChunkLocation& sLocation,
+                                         std::vector<GByte>& abyChunk ) const
+{
+    std::vector<GByte> abyIn;
+    try
+    {
+        abyIn.resize(sLocation.nSize);
+        abyChunk.resize(m_nChunkSize);
+    }
+    catch( const std::exception& )
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for netCDF chunk");
+        return false;
+    }
+
+    VSILFILE* fp = VSIFOpenL(m_osFilename.c_str(), "rb");
+    if( fp == nullptr )
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s",
+                 m_osFilename.c_str());
+        return false;
+    }
+    const bool bReadOK =
+        VSIFSeekL(fp, sLocation.nOffset, SEEK_SET) == 0 &&
+        VSIFReadL(abyIn.data(), 1, abyIn.size(), fp) == abyIn.size();
+    VSIFCloseL(fp);
+    if( !bReadOK )
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot read " CPL_FRMT_GUIB " bytes at offset " CPL_FRMT_GUIB
+                 " of %s",
+                 static_cast<GUIntBig>(sLocation.nSize),
+                 static_cast<GUIntBig>(sLocation.nOffset),
+                 m_osFilename.c_str());
+        return false;
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Undo the filters in reverse order of the pipeline, skipping     */
+/*      the ones that were not applied to this chunk.                   */
+/* -------------------------------------------------------------------- */
+    size_t nInSize = abyIn.size();
+    for( int i = static_cast<int>(m_aoFilters.size()) - 1; i >= 0; --i )
+    {
+        if( i < 32 && (sLocation.nFilterMask & (1U << i)) != 0 )
+            continue;
+
+        const Filter& oFilter = m_aoFilters[i];
+        if( oFilter.nId == H5Z_FILTER_FLETCHER32 )
+        {
+            // The 4-byte checksum is appended to the data, as a little-endian
+            // value. Like HDF5, also accept the checksum with the bytes of
+            // each 16-bit half swapped, as written by HDF5 < 1.6.3
+            if( nInSize < 4 )
+                return false;
+            nInSize -= 4;
+            const GByte* pabyStored = abyIn.data() + nInSize;
+            const uint32_t nStored =
+                static_cast<uint32_t>(pabyStored[0]) |
+                (static_cast<uint32_t>(pabyStored[1]) << 8) |
+                (static_cast<uint32_t>(pabyStored[2]) << 16) |
+                (static_cast<uint32_t>(pabyStored[3]) << 24);
+            const uint32_t nComputed = Fletcher32(abyIn.data(), nInSize);
+            const uint32_t nComputedSwapped =
+                ((nComputed & 0x00ff00ffU) << 8) |
+                ((nComputed >> 8) & 0x00ff00ffU);
+            if( nStored != nComputed && nStored != nComputedSwapped )
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Fletcher32 checksum mismatch for netCDF chunk at "
+                         "offset " CPL_FRMT_GUIB " of %s",
+                         static_cast<GUIntBig>(sLocation.nOffset),
+                         m_osFilename.c_str());
+                return false;
+            }
+        }
+        else if( oFilter.nId == H5Z_FILTER_SHUFFLE )
+        {
+            if( nInSize > abyChunk.size() )
+                return false;
+            const size_t nEltSize =
+                oFilter.anParams.empty() || oFilter.anParams[0] == 0 ?
+                    static_cast<size_t>(m_nDTSize) : oFilter.anParams[0];
+            Unshuffle(abyIn.data(), nInSize, nEltSize, abyChunk.data());
+            std::swap(abyIn, abyChunk);
+            abyChunk.resize(m_nChunkSize);
+        }
+        else
+        {
+            const auto psDecompressor = CPLGetDecompressor(
+                oFilter.nId == H5Z_FILTER_DEFLATE ? "zlib" : "zstd");
+            void* pOut = abyChunk.data();
+            size_t nOutSize = abyChunk.size();
+            if( psDecompressor == nullptr ||
+                !psDecompressor->pfnFunc(abyIn.data(), nInSize,
+                                         &pOut, &nOutSize,
+                                         nullptr, psDecompressor->user_data) )
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Decompression of netCDF chunk at offset "
+                         CPL_FRMT_GUIB " of %s failed",
+                         static_cast<GUIntBig>(sLocation.nOffset),
+                         m_osFilename.c_str());
+                return false;
+            }
+            std::swap(abyIn, abyChunk);
+            abyChunk.resize(m_nChunkSize);
+            nInSize = nOutSize;
+        }
+    }
+
+    if( nInSize != m_nChunkSize )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "netCDF chunk at offset " CPL_FRMT_GUIB " of %s has "
+                 "an unexpected size",
+                 static_cast<GUIntBig>(sLocation.nOffset),
+                 m_osFilename.c_str());
+        return false;
+    }
+    abyIn.resize(m_nChunkSize);
+    std::swap(abyIn, abyChunk);
+    return true;
+}
+
+#endif // NETCDF_HAS_DIRECT_CHUNK_READ
@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * Project:  netCDF read/write Driver
+ * Purpose:  Direct reading of netCDF-4 chunks through the HDF5 API.
+ *
+ ******************************************************************************
+ * Copyright (c) 2023, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef NETCDFDIRECTCHUNK_H_INCLUDED
+#define NETCDFDIRECTCHUNK_H_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(NETCDF_HAS_NC4) && defined(HAVE_HDF5)
+#define NETCDF_HAS_DIRECT_CHUNK_READ
+#endif
+
+#ifdef NETCDF_HAS_DIRECT_CHUNK_READ
+
+/************************************************************************/
+/*                       netCDFDirectChunkReader                        */
+/************************************************************************/
+
+/** Reads the raw chunks of a netCDF-4 variable through the HDF5 API, and
+ * decodes them without using the netCDF library.
+ *
+ * The HDF5 library is not thread-safe, so Create(), GetChunkLocation() and
+ * the destructor must be called with the netCDF global mutex held.
+ * ReadChunk() does not use HDF5 and can be called concurrently without it.
+ */
+class netCDFDirectChunkReader
+{
+  public:
+    struct ChunkLocation
+    {
+        vsi_l_offset nOffset = 0;
+        size_t       nSize = 0;
+        unsigned     nFilterMask = 0;
+    };
+
+    ~netCDFDirectChunkReader();
+
+    static std::unique_ptr<netCDFDirectChunkReader> Create(
+                                            const std::string& osFilename,
+                                            int nGroupId, int nVarId,
+                                            int nDTSize, bool bIsFloat );
+
+    /** Returns the chunk sizes, in the dimension order of the variable. */
+    const std::vector<size_t>& GetChunkDims() const { return m_anChunkDims; }
+
+    /** Returns the size in bytes of a decoded chunk. */
+    size_t GetChunkSize() const { return m_nChunkSize; }
+
+    /** Locates the chunk starting at panStart. Returns false if it is not
+     * allocated in the file, in which case the netCDF API must be used to
+     * get the fill value. */
+    bool GetChunkLocation( const size_t* panStart,
+                           ChunkLocation& sLocation ) const;
+
+    /** Reads and decodes a chunk. */
+    bool ReadChunk( const ChunkLocation& sLocation,
+                    std::vector<GByte>& abyChunk ) const;
+
+  private:
+    struct Filter
+    {
+        unsigned nId = 0;
+        std::vector<unsigned> anParams{};
+    };
+
+    std::string m_osFilename{};
+    int64_t m_hFile = -1;
+    int64_t m_hDataset = -1;
+    int m_nDTSize = 0;
+    std::vector<size_t> m_anChunkDims{};
+    size_t m_nChunkSize = 0;
+    std::vector<Filter> m_aoFilters{};
+
+    netCDFDirectChunkReader() = default;
+    netCDFDirectChunkReader(const netCDFDirectChunkReader&) = delete;
+    netCDFDirectChunkReader& operator=(const netCDFDirectChunkReader&) = delete;
+};
+
+#endif // NETCDF_HAS_DIRECT_CHUNK_READ
+
+#endif // NETCDFDIRECTCHUNK_H_INCLUDED
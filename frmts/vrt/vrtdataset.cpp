@@ -1876,15 +1876,56 @@ CPLErr VRTDataset::IRasterIO( GDALRWFlag eRWFlag,
         // they don't necessary instantiate all underlying rasterbands.
         VRTSourcedRasterBand* poBand = static_cast<VRTSourcedRasterBand *>(
             papoBands[nBands - 1] );
-        for( int iSource = 0;
-             eErr == CE_None && iSource < poBand->nSources;
-             iSource++ )
+
+        std::vector<int> anSourceIdx;
+        bool bUseSourceIdx;
+        if( psExtraArg->bFloatingPointWindowValidity )
+        {
+            bUseSourceIdx = poBand->GetSourcesIntersectingWindow(
+                psExtraArg->dfXOff, psExtraArg->dfYOff,
+                psExtraArg->dfXSize, psExtraArg->dfYSize, anSourceIdx);
+        }
+        else
+        {
+            bUseSourceIdx = poBand->GetSourcesIntersectingWindow(
+                nXOff, nYOff, nXSize, nYSize, anSourceIdx);
+        }
+        const int nIterSources = bUseSourceIdx ?
+            static_cast<int>(anSourceIdx.size()) : poBand->nSources;
+
+        const auto ReadSource = [poBand, nXOff, nYOff, nXSize, nYSize,
+                                 pData, nBufXSize, nBufYSize, eBufType,
+                                 nBandCount, panBandMap,
+                                 nPixelSpace, nLineSpace, nBandSpace]
+            (VRTSimpleSource* poSource, GDALRasterIOExtraArg* psSourceExtraArg)
+        {
+            return poSource->DatasetRasterIO( poBand->GetRasterDataType(),
+                                              nXOff, nYOff, nXSize, nYSize,
+                                              pData, nBufXSize, nBufYSize,
+                                              eBufType,
+                                              nBandCount, panBandMap,
+                                              nPixelSpace, nLineSpace,
+                                              nBandSpace,
+                                              psSourceExtraArg );
+        };
+        if( poBand->ReadSourcesInParallel( nXOff, nYOff, nXSize, nYSize,
+                                           nBufXSize, nBufYSize,
+                                           bUseSourceIdx ? &anSourceIdx : nullptr,
+                                           psExtraArg, ReadSource, eErr ) )
+        {
+            return eErr;
+        }
+
+        for( int iIter = 0;
+             eErr == CE_None && iIter < nIterSources;
+             iIter++ )
         {
+            const int iSource = bUseSourceIdx ? anSourceIdx[iIter] : iIter;
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData =
                 GDALCreateScaledProgress(
-                    1.0 * iSource / poBand->nSources,
-                    1.0 * (iSource + 1) / poBand->nSources,
+                    1.0 * iIter / nIterSources,
+                    1.0 * (iIter + 1) / nIterSources,
                     pfnProgressGlobal,
                     pProgressDataGlobal );
 
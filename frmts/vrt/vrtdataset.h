@@ -35,6 +35,7 @@
 
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
+#include "cpl_quad_tree.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "gdal_rat.h"
@@ -580,6 +581,11 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL: public VRTRasterBand
     char         **m_papszSourceList = nullptr;
     int            m_nSkipBufferInitialization = -1;
 
+    // Spatial index of the destination windows of the sources, lazily
+    // built on first read of a band with many sources.
+    CPLQuadTree   *m_hSourceIndex = nullptr;
+    int            m_nSourceIndexSourceCount = 0;
+
     bool           CanUseSourcesMinMaxImplementations();
 
     bool           IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(bool bAllowMaxValAdjustment) const;
@@ -588,11 +594,26 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL: public VRTRasterBand
 
   protected:
     bool           SkipBufferInitialization();
+    void           InvalidateSourceIndex();
 
   public:
     int            nSources = 0;
     VRTSource    **papoSources = nullptr;
 
+    bool           GetSourcesIntersectingWindow( double dfXOff, double dfYOff,
+                                                 double dfXSize, double dfYSize,
+                                                 std::vector<int>& anSourceIdx );
+
+    bool           ReadSourcesInParallel( int nXOff, int nYOff,
+                                          int nXSize, int nYSize,
+                                          int nBufXSize, int nBufYSize,
+                                          const std::vector<int>* panSourceIdx,
+                                          GDALRasterIOExtraArg* psExtraArg,
+                                          const std::function<CPLErr(
+                                              VRTSimpleSource*,
+                                              GDALRasterIOExtraArg*)>& fnReadSource,
+                                          CPLErr& eErr );
+
                    VRTSourcedRasterBand( GDALDataset *poDS, int nBand );
                    VRTSourcedRasterBand( GDALDataType eType,
                                          int nXSize, int nYSize );
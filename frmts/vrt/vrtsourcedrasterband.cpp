@@ -41,6 +41,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -132,6 +133,365 @@ VRTSourcedRasterBand::~VRTSourcedRasterBand()
     CSLDestroy(m_papszSourceList);
 }
 
+/************************************************************************/
+/*                        InvalidateSourceIndex()                       */
+/************************************************************************/
+
+void VRTSourcedRasterBand::InvalidateSourceIndex()
+{
+    if( m_hSourceIndex )
+        CPLQuadTreeDestroy(m_hSourceIndex);
+    m_hSourceIndex = nullptr;
+    m_nSourceIndexSourceCount = 0;
+}
+
+/************************************************************************/
+/*                    GetSourcesIntersectingWindow()                    */
+/************************************************************************/
+
+/** Return, in source priority order, the indices of the sources whose
+ * destination window may intersect the passed window.
+ *
+ * The first call builds a spatial index of the destination windows of the
+ * sources. Sources that are not simple sources, or without an explicit
+ * destination window, are considered as covering the whole band.
+ *
+ * @return false if the band has too few sources for the index to be
+ * worthwhile, in which case anSourceIdx is not filled and all sources should
+ * be considered.
+ */
+bool VRTSourcedRasterBand::GetSourcesIntersectingWindow(
+                                        double dfXOff, double dfYOff,
+                                        double dfXSize, double dfYSize,
+                                        std::vector<int>& anSourceIdx )
+{
+    // Below that number of sources, a linear scan is cheap enough.
+    constexpr int MIN_SOURCES_FOR_INDEX = 32;
+    if( nSources < MIN_SOURCES_FOR_INDEX )
+        return false;
+
+    if( m_hSourceIndex && m_nSourceIndexSourceCount != nSources )
+        InvalidateSourceIndex();
+
+    if( m_hSourceIndex == nullptr )
+    {
+        CPLRectObj sGlobalBounds;
+        sGlobalBounds.minx = 0;
+        sGlobalBounds.miny = 0;
+        sGlobalBounds.maxx = nRasterXSize;
+        sGlobalBounds.maxy = nRasterYSize;
+        m_hSourceIndex = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+        m_nSourceIndexSourceCount = nSources;
+
+        for( int i = 0; i < nSources; i++ )
+        {
+            CPLRectObj sRect = sGlobalBounds;
+            if( papoSources[i]->IsSimpleSource() )
+            {
+                VRTSimpleSource* poSS =
+                    cpl::down_cast<VRTSimpleSource*>(papoSources[i]);
+                if( poSS->m_dfDstXSize == 0 || poSS->m_dfDstYSize == 0 )
+                    continue;
+                const bool bDstWinSet = poSS->m_dfDstXOff != -1 ||
+                                        poSS->m_dfDstXSize != -1 ||
+                                        poSS->m_dfDstYOff != -1 ||
+                                        poSS->m_dfDstYSize != -1;
+                if( bDstWinSet )
+                {
+                    sRect.minx = std::max(0.0, poSS->m_dfDstXOff);
+                    sRect.miny = std::max(0.0, poSS->m_dfDstYOff);
+                    sRect.maxx = std::min(double(nRasterXSize),
+                                    poSS->m_dfDstXOff + poSS->m_dfDstXSize);
+                    sRect.maxy = std::min(double(nRasterYSize),
+                                    poSS->m_dfDstYOff + poSS->m_dfDstYSize);
+                    // Source entirely outside of the band.
+                    if( !(sRect.minx < sRect.maxx && sRect.miny < sRect.maxy) )
+                        continue;
+                }
+            }
+            CPLQuadTreeInsertWithBounds(
+                m_hSourceIndex,
+                reinterpret_cast<void*>(static_cast<uintptr_t>(i)), &sRect);
+        }
+    }
+
+    CPLRectObj sAOI;
+    sAOI.minx = dfXOff;
+    sAOI.miny = dfYOff;
+    sAOI.maxx = dfXOff + dfXSize;
+    sAOI.maxy = dfYOff + dfYSize;
+    int nFeatureCount = 0;
+    void** pahFeatures = CPLQuadTreeSearch(m_hSourceIndex, &sAOI,
+                                           &nFeatureCount);
+    anSourceIdx.resize(nFeatureCount);
+    for( int i = 0; i < nFeatureCount; ++i )
+    {
+        anSourceIdx[i] = static_cast<int>(
+            reinterpret_cast<uintptr_t>(pahFeatures[i]));
+    }
+    CPLFree(pahFeatures);
+
+    // Preserve source priority order: later sources are painted over
+    // earlier ones.
+    std::sort(anSourceIdx.begin(), anSourceIdx.end());
+    return true;
+}
+
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+static int GetNumThreads()
+{
+    return CPLGetNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", nullptr),
+                            1024);
+}
+
+/************************************************************************/
+/*                   SourcesReferToDistinctDatasets()                   */
+/************************************************************************/
+
+// Check that all sources refer to different datasets before allowing
+// multithreaded access.
+// If the datasets belong to the MEM driver, check GDALDataset*
+// pointer values. Otherwise use dataset name.
+static bool SourcesReferToDistinctDatasets(
+                            const std::vector<VRTSimpleSource*>& apoSources )
+{
+    std::set<std::string> oSetDatasetNames;
+    std::set<GDALDataset*> oSetDatasetPointers;
+    for( auto poSimpleSource: apoSources )
+    {
+        auto poSimpleSourceBand = poSimpleSource->GetRasterBand();
+        if( poSimpleSourceBand == nullptr )
+            return false;
+        auto poSourceDataset = poSimpleSourceBand->GetDataset();
+        if( poSourceDataset == nullptr )
+            return false;
+        auto poDriver = poSourceDataset->GetDriver();
+        if( poDriver && EQUAL(poDriver->GetDescription(), "MEM") )
+        {
+            if( !oSetDatasetPointers.insert(poSourceDataset).second )
+                return false;
+        }
+        else
+        {
+            if( !oSetDatasetNames.insert(
+                        poSourceDataset->GetDescription()).second )
+                return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        ReadSourcesInParallel()                       */
+/************************************************************************/
+
+/** Read sources concurrently on the global thread pool.
+ *
+ * This is attempted only if the GDAL_NUM_THREADS configuration option is
+ * set to a value greater than 1, if all sources are simple sources referring
+ * to distinct datasets, and if the regions of the output buffer they write
+ * to do not overlap (in which case the result does not depend on the order
+ * in which sources are read).
+ *
+ * @param panSourceIdx Indices of the sources to consider, in priority order,
+ *                     or nullptr to consider all sources.
+ * @param fnReadSource Function reading a source in the output buffer.
+ * @param eErr Set to the error status of the reads, when true is returned.
+ * @return false if the conditions are not met, in which case nothing has
+ * been read and the caller must read the sources in serial order.
+ */
+bool VRTSourcedRasterBand::ReadSourcesInParallel(
+    int nXOff, int nYOff, int nXSize, int nYSize,
+    int nBufXSize, int nBufYSize,
+    const std::vector<int>* panSourceIdx,
+    GDALRasterIOExtraArg* psExtraArg,
+    const std::function<CPLErr(VRTSimpleSource*,
+                               GDALRasterIOExtraArg*)>& fnReadSource,
+    CPLErr& eErr )
+{
+    const int nIterSources = panSourceIdx ?
+        static_cast<int>(panSourceIdx->size()) : nSources;
+    if( nIterSources < 2 )
+        return false;
+    const int nThreads = GetNumThreads();
+    if( nThreads <= 1 )
+        return false;
+
+    // Nested VRTs, or VRTs read from another job of the global thread pool,
+    // are read serially, so as not to wait on the pool we are running on.
+    CPLWorkerThreadPool* poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if( poThreadPool == nullptr || poThreadPool->IsCurrentThreadWorker() )
+        return false;
+
+    double dfXOff = nXOff;
+    double dfYOff = nYOff;
+    double dfXSize = nXSize;
+    double dfYSize = nYSize;
+    if( psExtraArg->bFloatingPointWindowValidity )
+    {
+        dfXOff = psExtraArg->dfXOff;
+        dfYOff = psExtraArg->dfYOff;
+        dfXSize = psExtraArg->dfXSize;
+        dfYSize = psExtraArg->dfYSize;
+    }
+
+    // Collect the sources that actually contribute to the request, and
+    // check that their target windows in the output buffer are disjoint.
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = 0;
+    sGlobalBounds.miny = 0;
+    sGlobalBounds.maxx = nBufXSize;
+    sGlobalBounds.maxy = nBufYSize;
+    CPLQuadTree* hOutWindows = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    std::vector<CPLRectObj> asOutWindows;
+    std::vector<VRTSimpleSource*> apoSources;
+    bool bOK = true;
+    for( int iIter = 0; bOK && iIter < nIterSources; iIter++ )
+    {
+        const int iSource = panSourceIdx ? (*panSourceIdx)[iIter] : iIter;
+        if( !papoSources[iSource]->IsSimpleSource() )
+        {
+            bOK = false;
+            break;
+        }
+        VRTSimpleSource* poSS =
+            cpl::down_cast<VRTSimpleSource*>(papoSources[iSource]);
+
+        double dfReqXOff = 0.0;
+        double dfReqYOff = 0.0;
+        double dfReqXSize = 0.0;
+        double dfReqYSize = 0.0;
+        int nReqXOff = 0;
+        int nReqYOff = 0;
+        int nReqXSize = 0;
+        int nReqYSize = 0;
+        int nOutXOff = 0;
+        int nOutYOff = 0;
+        int nOutXSize = 0;
+        int nOutYSize = 0;
+        bool bError = false;
+        if( !poSS->GetSrcDstWindow( dfXOff, dfYOff, dfXSize, dfYSize,
+                                    nBufXSize, nBufYSize,
+                                    &dfReqXOff, &dfReqYOff,
+                                    &dfReqXSize, &dfReqYSize,
+                                    &nReqXOff, &nReqYOff,
+                                    &nReqXSize, &nReqYSize,
+                                    &nOutXOff, &nOutYOff,
+                                    &nOutXSize, &nOutYSize,
+                                    bError ) )
+        {
+            if( bError )
+                bOK = false;
+            continue;
+        }
+
+        CPLRectObj sRect;
+        sRect.minx = nOutXOff;
+        sRect.miny = nOutYOff;
+        sRect.maxx = static_cast<double>(nOutXOff) + nOutXSize;
+        sRect.maxy = static_cast<double>(nOutYOff) + nOutYSize;
+        int nFeatureCount = 0;
+        void** pahFeatures = CPLQuadTreeSearch(hOutWindows, &sRect,
+                                               &nFeatureCount);
+        for( int i = 0; i < nFeatureCount; ++i )
+        {
+            const auto& sOther = asOutWindows[static_cast<size_t>(
+                reinterpret_cast<uintptr_t>(pahFeatures[i]))];
+            // Strict overlap. Touching windows are fine.
+            if( sRect.minx < sOther.maxx && sOther.minx < sRect.maxx &&
+                sRect.miny < sOther.maxy && sOther.miny < sRect.maxy )
+            {
+                bOK = false;
+                break;
+            }
+        }
+        CPLFree(pahFeatures);
+
+        CPLQuadTreeInsertWithBounds(hOutWindows,
+            reinterpret_cast<void*>(
+                static_cast<uintptr_t>(asOutWindows.size())), &sRect);
+        asOutWindows.push_back(sRect);
+        apoSources.push_back(poSS);
+    }
+    CPLQuadTreeDestroy(hOutWindows);
+
+    if( !bOK || apoSources.size() < 2 ||
+        !SourcesReferToDistinctDatasets(apoSources) )
+    {
+        return false;
+    }
+
+    struct Job
+    {
+        VRTSimpleSource* poSource = nullptr;
+        const std::function<CPLErr(VRTSimpleSource*,
+                                   GDALRasterIOExtraArg*)>* pfnReadSource =
+                                                                    nullptr;
+        GDALRasterIOExtraArg sExtraArg;
+        CPLErr eErr = CE_None;
+        std::string osErrorMsg{};
+        CPLErrorNum nErrorNum = CPLE_None;
+    };
+
+    const auto JobRunner = [](void* pData)
+    {
+        auto psJob = static_cast<Job*>(pData);
+        CPLErrorHandlerPusher oPusher(CPLQuietErrorHandler);
+        CPLErrorStateBackuper oErrorStateBackuper;
+        psJob->eErr = (*psJob->pfnReadSource)(psJob->poSource,
+                                              &psJob->sExtraArg);
+        if( psJob->eErr != CE_None )
+        {
+            psJob->osErrorMsg = CPLGetLastErrorMsg();
+            psJob->nErrorNum = CPLGetLastErrorNo();
+        }
+    };
+
+    CPLDebugOnly("VRT", "Reading %d sources with %d threads",
+                 static_cast<int>(apoSources.size()), nThreads);
+
+    std::vector<Job> asJobs(apoSources.size());
+    auto poQueue = poThreadPool->CreateJobQueue();
+    eErr = CE_None;
+    for( size_t i = 0; i < apoSources.size(); ++i )
+    {
+        asJobs[i].poSource = apoSources[i];
+        asJobs[i].pfnReadSource = &fnReadSource;
+        asJobs[i].sExtraArg = *psExtraArg;
+        // Progress callbacks are not thread-safe.
+        asJobs[i].sExtraArg.pfnProgress = nullptr;
+        asJobs[i].sExtraArg.pProgressData = nullptr;
+        if( !poQueue->SubmitJob(JobRunner, &asJobs[i]) )
+        {
+            // Run it in this thread
+            JobRunner(&asJobs[i]);
+        }
+    }
+    poQueue->WaitCompletion();
+
+    for( const auto& sJob: asJobs )
+    {
+        if( sJob.eErr != CE_None )
+        {
+            CPLError(sJob.eErr, sJob.nErrorNum, "%s", sJob.osErrorMsg.c_str());
+            eErr = CE_Failure;
+            break;
+        }
+    }
+
+    if( eErr == CE_None && psExtraArg->pfnProgress &&
+        !psExtraArg->pfnProgress(1.0, "", psExtraArg->pProgressData) )
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        eErr = CE_Failure;
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -326,15 +686,58 @@ CPLErr VRTSourcedRasterBand::IRasterIO( GDALRWFlag eRWFlag,
     void * const pProgressDataGlobal = psExtraArg->pProgressData;
 
 /* -------------------------------------------------------------------- */
-/*      Overlay each source in turn over top this.                      */
+/*      Restrict to the sources intersecting the request window, if     */
+/*      there are many of them.                                         */
+/* -------------------------------------------------------------------- */
+    std::vector<int> anSourceIdx;
+    bool bUseSourceIdx;
+    if( psExtraArg->bFloatingPointWindowValidity )
+    {
+        bUseSourceIdx = GetSourcesIntersectingWindow(
+            psExtraArg->dfXOff, psExtraArg->dfYOff,
+            psExtraArg->dfXSize, psExtraArg->dfYSize, anSourceIdx);
+    }
+    else
+    {
+        bUseSourceIdx = GetSourcesIntersectingWindow(
+            nXOff, nYOff, nXSize, nYSize, anSourceIdx);
+    }
+    const int nIterSources = bUseSourceIdx ?
+        static_cast<int>(anSourceIdx.size()) : nSources;
+
+/* -------------------------------------------------------------------- */
+/*      Read non-overlapping sources concurrently if possible.          */
 /* -------------------------------------------------------------------- */
     CPLErr eErr = CE_None;
-    for( int iSource = 0; eErr == CE_None && iSource < nSources; iSource++ )
+    const auto ReadSource = [this, nXOff, nYOff, nXSize, nYSize,
+                             pData, nBufXSize, nBufYSize,
+                             eBufType, nPixelSpace, nLineSpace]
+        (VRTSimpleSource* poSource, GDALRasterIOExtraArg* psSourceExtraArg)
+    {
+        return poSource->RasterIO( eDataType,
+                                   nXOff, nYOff, nXSize, nYSize,
+                                   pData, nBufXSize, nBufYSize,
+                                   eBufType, nPixelSpace, nLineSpace,
+                                   psSourceExtraArg );
+    };
+    if( ReadSourcesInParallel( nXOff, nYOff, nXSize, nYSize,
+                               nBufXSize, nBufYSize,
+                               bUseSourceIdx ? &anSourceIdx : nullptr,
+                               psExtraArg, ReadSource, eErr ) )
     {
+        return eErr;
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Overlay each source in turn over top this.                      */
+/* -------------------------------------------------------------------- */
+    for( int iIter = 0; eErr == CE_None && iIter < nIterSources; iIter++ )
+    {
+        const int iSource = bUseSourceIdx ? anSourceIdx[iIter] : iIter;
         psExtraArg->pfnProgress = GDALScaledProgress;
         psExtraArg->pProgressData =
-            GDALCreateScaledProgress( 1.0 * iSource / nSources,
-                                      1.0 * (iSource + 1) / nSources,
+            GDALCreateScaledProgress( 1.0 * iIter / nIterSources,
+                                      1.0 * (iIter + 1) / nIterSources,
                                       pfnProgressGlobal,
                                       pProgressDataGlobal );
         if( psExtraArg->pProgressData == nullptr )
@@ -394,8 +797,15 @@ int  VRTSourcedRasterBand::IGetDataCoverageStatus( int nXOff,
     poLR->addPoint( nXOff, nYOff );
     poPolyNonCoveredBySources->addRingDirectly(poLR);
 
-    for( int iSource = 0; iSource < nSources; iSource++ )
+    std::vector<int> anSourceIdx;
+    const bool bUseSourceIdx = GetSourcesIntersectingWindow(
+        nXOff, nYOff, nXSize, nYSize, anSourceIdx);
+    const int nIterSources = bUseSourceIdx ?
+        static_cast<int>(anSourceIdx.size()) : nSources;
+
+    for( int iIter = 0; iIter < nIterSources; iIter++ )
     {
+        const int iSource = bUseSourceIdx ? anSourceIdx[iIter] : iIter;
         if( !papoSources[iSource]->IsSimpleSource() )
         {
             delete poPolyNonCoveredBySources;
@@ -1299,55 +1709,20 @@ VRTSourcedRasterBand::ComputeStatistics( int bApproxOK,
         };
 
         CPLWorkerThreadPool* poThreadPool = nullptr;
-        const char* pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
-        if( pszValue )
-        {
-            int nThreads =
-                EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
-            if( nThreads > 1024 )
-                nThreads = 1024; // to please Coverity
-            if( nThreads > 1 )
+        const int nThreads = GetNumThreads();
+        if( nThreads > 1 )
+        {
+            std::vector<VRTSimpleSource*> apoSimpleSources;
+            for( int i = 0; i < nSources; ++i )
             {
-                // Check that all sources refer to different datasets
-                // before allowing multithreaded access
-                // If the datasets belong to the MEM driver, check GDALDataset*
-                // pointer values. Otherwise use dataset name.
-                std::set<std::string> oSetDatasetNames;
-                std::set<GDALDataset*> oSetDatasetPointers;
-                for( int i = 0; i < nSources; ++i )
-                {
-                    auto poSimpleSource = cpl::down_cast<VRTSimpleSource*>(papoSources[i]);
-                    auto poSimpleSourceBand = poSimpleSource->GetRasterBand();
-                    auto poSourceDataset = poSimpleSourceBand->GetDataset();
-                    if( poSourceDataset == nullptr )
-                    {
-                        nThreads = 0;
-                        break;
-                    }
-                    auto poDriver = poSourceDataset->GetDriver();
-                    if( poDriver && EQUAL(poDriver->GetDescription(), "MEM") )
-                    {
-                        if( oSetDatasetPointers.find(poSourceDataset) != oSetDatasetPointers.end() )
-                        {
-                            nThreads = 0;
-                            break;
-                        }
-                        oSetDatasetPointers.insert(poSourceDataset);
-                    }
-                    else
-                    {
-                        if( oSetDatasetNames.find(poSourceDataset->GetDescription()) != oSetDatasetNames.end() )
-                        {
-                            nThreads = 0;
-                            break;
-                        }
-                        oSetDatasetNames.insert(poSourceDataset->GetDescription());
-                    }
-                }
-                if( nThreads > 1 )
-                {
-                    poThreadPool = GDALGetGlobalThreadPool(nThreads);
-                }
+                apoSimpleSources.push_back(
+                    cpl::down_cast<VRTSimpleSource*>(papoSources[i]));
+            }
+            if( SourcesReferToDistinctDatasets(apoSimpleSources) )
+            {
+                poThreadPool = GDALGetGlobalThreadPool(nThreads);
+                if( poThreadPool && poThreadPool->IsCurrentThreadWorker() )
+                    poThreadPool = nullptr;
             }
         }
 
@@ -1531,11 +1906,23 @@ CPLErr VRTSourcedRasterBand::GetHistogram( double dfMin, double dfMax,
         }
     }
 
+    // Sources whose destination window is empty or outside of the band do
+    // not contribute to the histogram.
+    int iSingleSource = 0;
     if( nSources != 1 )
-        return VRTRasterBand::GetHistogram( dfMin, dfMax,
-                                             nBuckets, panHistogram,
-                                             bIncludeOutOfRange, bApproxOK,
-                                             pfnProgress, pProgressData );
+    {
+        std::vector<int> anSourceIdx;
+        if( !GetSourcesIntersectingWindow(0, 0, nRasterXSize, nRasterYSize,
+                                          anSourceIdx) ||
+            anSourceIdx.size() != 1 )
+        {
+            return VRTRasterBand::GetHistogram( dfMin, dfMax,
+                                                 nBuckets, panHistogram,
+                                                 bIncludeOutOfRange, bApproxOK,
+                                                 pfnProgress, pProgressData );
+        }
+        iSingleSource = anSourceIdx[0];
+    }
 
     if( pfnProgress == nullptr )
         pfnProgress = GDALDummyProgress;
@@ -1559,7 +1946,8 @@ CPLErr VRTSourcedRasterBand::GetHistogram( double dfMin, double dfMax,
 /*      Try with source bands.                                          */
 /* -------------------------------------------------------------------- */
     const CPLErr eErr =
-        papoSources[0]->GetHistogram( GetXSize(), GetYSize(), dfMin, dfMax,
+        papoSources[iSingleSource]->GetHistogram( GetXSize(), GetYSize(),
+                                      dfMin, dfMax,
                                       nBuckets,
                                       panHistogram,
                                       bIncludeOutOfRange, bApproxOK,
@@ -1586,6 +1974,8 @@ CPLErr VRTSourcedRasterBand::GetHistogram( double dfMin, double dfMax,
 CPLErr VRTSourcedRasterBand::AddSource( VRTSource *poNewSource )
 
 {
+    InvalidateSourceIndex();
+
     nSources++;
 
     papoSources = static_cast<VRTSource **>(
@@ -2424,6 +2814,7 @@ CPLErr VRTSourcedRasterBand::SetMetadataItem( const char *pszName,
         {
             delete papoSources[iSource];
             papoSources[iSource] = poSource;
+            InvalidateSourceIndex();
             static_cast<VRTDataset *>( poDS )->SetNeedsFlush();
             return CE_None;
         }
@@ -2455,6 +2846,7 @@ CPLErr VRTSourcedRasterBand::SetMetadata( char **papszNewMD, const char *pszDoma
             CPLFree( papoSources );
             papoSources = nullptr;
             nSources = 0;
+            InvalidateSourceIndex();
         }
 
         for( int i = 0; i < CSLCount(papszNewMD); i++ )
@@ -2510,6 +2902,8 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
 {
     int ret = VRTRasterBand::CloseDependentDatasets();
 
+    InvalidateSourceIndex();
+
     if( nSources == 0 )
         return ret;
 
@@ -2690,6 +3084,8 @@ void VRTSourcedRasterBand::RemoveCoveredSources(CSLConstList papszOptions)
         }
     }
 
+    InvalidateSourceIndex();
+
     // Compact the papoSources array
     int iDst = 0;
     for( int iSrc = 0; iSrc < nSources; iSrc++ )
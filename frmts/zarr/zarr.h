@@ -31,6 +31,7 @@
 
 #include "cpl_compressor.h"
 #include "cpl_json.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "memmultidim.h"
@@ -40,6 +41,9 @@
 #include <mutex>
 #include <set>
 
+#define ZARR_SHARDING_EXTENSION \
+            "https://purl.org/zarr/spec/storage_transformers/sharding/1.0"
+
 /************************************************************************/
 /*                            ZarrDataset                               */
 /************************************************************************/
@@ -461,6 +465,11 @@ class ZarrArray final: public GDALPamMDArray
     mutable ZarrAttributeGroup                        m_oAttrGroup;
     mutable std::shared_ptr<OGRSpatialReference>      m_poSRS{};
     mutable bool                                      m_bAllocateWorkingBuffersDone = false;
+    mutable int                                       m_nTileWriteThreads = -1;
+    mutable std::unique_ptr<CPLJobQueue>              m_poTileWriteJobQueue{};
+    mutable std::mutex                                m_oTileWriteMutex{};
+    mutable std::set<std::vector<uint64_t>>           m_oSetTileIndicesBeingWritten{};
+    mutable std::string                               m_osTileWriteErrorMsg{};
     mutable bool                                      m_bWorkingBuffersOK = false;
     std::string                                       m_osRootDirectoryName{};
     int                                               m_nVersion = 0;
@@ -487,6 +496,35 @@ class ZarrArray final: public GDALPamMDArray
     };
     mutable std::map<uint64_t, CachedTile>            m_oMapTileIndexToCachedTile{};
 
+    // Sharding storage transformer (Zarr V3)
+    std::vector<uint64_t>                             m_anChunksPerShard{};
+    uint64_t                                          m_nChunksPerShard = 0;
+    mutable std::mutex                                m_oShardMutex{};
+    // Map from shard indices to (offset, size) pairs of its inner chunks
+    mutable std::map<std::vector<uint64_t>, std::vector<uint64_t>> m_oMapShardIndex{};
+    // Map from tile indices to compressed inner chunk data, filled by IAdviseRead()
+    mutable std::map<std::vector<uint64_t>, std::vector<GByte>> m_oMapPrefetchedChunkData{};
+    struct ShardWriteBuffer
+    {
+        // Creation order, used to flush the oldest shard first
+        uint64_t nSeq = 0;
+        // Uncompressed size of the chunks written into the shard
+        size_t nRawBytes = 0;
+        // Number of elements written into the shard (may count overwrites)
+        uint64_t nWrittenElts = 0;
+        // Indices of the inner chunks written into the shard (main thread only)
+        std::set<uint64_t> oSetWrittenChunks{};
+        // Map from inner chunk index to its compressed data (empty if missing),
+        // filled under m_oTileWriteMutex
+        std::map<uint64_t, std::vector<GByte>> oMapChunkData{};
+    };
+    // Map from shard indices to the shards being assembled
+    mutable std::map<std::vector<uint64_t>, ShardWriteBuffer> m_oMapShardWriteBuffer{};
+    mutable uint64_t                                  m_nShardWriteBufferSeq = 0;
+    mutable size_t                                    m_nShardWriteBufferRawBytes = 0;
+    // Number of elements written by IWrite() into the cached tile
+    mutable uint64_t                                  m_nCachedTileWrittenElts = 0;
+
     ZarrArray(const std::shared_ptr<ZarrSharedResource>& poSharedResource,
               const std::string& osParentName,
               const std::string& osName,
@@ -529,6 +567,48 @@ class ZarrArray final: public GDALPamMDArray
 
     bool FlushDirtyTile() const;
 
+    struct TileEncodingOptions
+    {
+        std::vector<std::pair<const CPLCompressor*, CPLStringList>> aoFilters{};
+        CPLStringList aosCompressorOptions{};
+    };
+
+    TileEncodingOptions GetTileEncodingOptions() const;
+
+    bool CompressAndWriteTile(const std::vector<uint64_t>& anTileIndices,
+                              const std::string& osFilename,
+                              const TileEncodingOptions& oOptions,
+                              std::vector<GByte>& abyRawTileData,
+                              std::vector<GByte>& abyTmpRawTileData) const;
+
+    struct TileWriteJob;
+
+    static void TileWriteJobFunc(void* pData);
+
+    bool WaitPendingTileWrites() const;
+
+    bool WaitPendingTileWrite(const uint64_t* tileIndices) const;
+
+    std::string GetChunkFilename(const uint64_t* indices) const;
+
+    uint64_t GetShardIndices(const uint64_t* tileIndices,
+                             std::vector<uint64_t>& anShardIndices) const;
+
+    bool GetShardIndex(const std::vector<uint64_t>& anShardIndices,
+                       std::vector<uint64_t>& anIndex) const;
+
+    bool ReadShardedChunk(const uint64_t* tileIndices,
+                          std::vector<GByte>& abyChunkData,
+                          bool& bMissingChunkOut) const;
+
+    bool PrefetchShardedChunks(const std::vector<uint64_t>& anReqTilesIndices) const;
+
+    uint64_t GetEltCountInShard(const std::vector<uint64_t>& anShardIndices) const;
+
+    bool FlushShard(const std::vector<uint64_t>& anShardIndices) const;
+
+    bool FlushShards() const;
+
     std::shared_ptr<GDALMDArray> OpenTilePresenceCache(bool bCanCreate) const;
 
     // Disable copy constructor and assignment operator
@@ -626,6 +706,8 @@ public:
 
     void SetVersion(int nVersion) { m_nVersion = nVersion; }
 
+    bool SetChunksPerShard(const std::vector<uint64_t>& anChunksPerShard);
+
     std::shared_ptr<GDALAttribute> GetAttribute(const std::string& osName) const override
         { return m_oAttrGroup.GetAttribute(osName); }
 
@@ -206,6 +206,7 @@ ZarrArray::~ZarrArray()
 void ZarrArray::Flush()
 {
     FlushDirtyTile();
+    FlushShards();
     bool bSerializeV3 = false;
 
     if( m_bDefinitionModified  )
@@ -733,6 +734,24 @@ void ZarrArray::SerializeV3(const CPLJSONObject& oAttrs)
 
     oRoot.Add("extensions", CPLJSONArray());
 
+    if( !m_anChunksPerShard.empty() )
+    {
+        CPLJSONArray oStorageTransformers;
+        CPLJSONObject oSharding;
+        oSharding.Add("extension", ZARR_SHARDING_EXTENSION);
+        oSharding.Add("type", "indexed");
+        CPLJSONObject oConfiguration;
+        CPLJSONArray oChunksPerShard;
+        for( const auto nVal: m_anChunksPerShard )
+        {
+            oChunksPerShard.Add(static_cast<GInt64>(nVal));
+        }
+        oConfiguration.Add("chunks_per_shard", oChunksPerShard);
+        oSharding.Add("configuration", oConfiguration);
+        oStorageTransformers.Add(oSharding);
+        oRoot.Add("storage_transformers", oStorageTransformers);
+    }
+
     oRoot.Add("attributes", oAttrs);
 
     oDoc.Save(m_osFilename);
@@ -1150,6 +1169,581 @@ static void DecodeSourceElt(const std::vector<DtypeElt>& elts,
     }
 }
 
+/************************************************************************/
+/*                      ZarrArray::GetChunkFilename()                   */
+/************************************************************************/
+
+// Return the filename of a chunk, or of a shard when the sharding storage
+// transformer is used.
+std::string ZarrArray::GetChunkFilename(const uint64_t* indices) const
+{
+    std::string osFilename;
+    if( m_aoDims.empty() )
+    {
+        osFilename = "0";
+    }
+    else
+    {
+        for( size_t i = 0; i < m_aoDims.size(); ++i )
+        {
+            if( !osFilename.empty() )
+                osFilename += m_osDimSeparator;
+            osFilename += std::to_string(indices[i]);
+        }
+    }
+
+    if( m_nVersion == 2 )
+    {
+        osFilename = CPLFormFilename(
+            CPLGetDirname(m_osFilename.c_str()), osFilename.c_str(), nullptr);
+    }
+    else
+    {
+        std::string osTmp = m_osRootDirectoryName + "/data/root";
+        if( GetFullName() != "/" )
+            osTmp += GetFullName();
+        osFilename = osTmp + "/c" + osFilename;
+    }
+    return osFilename;
+}
+
+/************************************************************************/
+/*                     ZarrArray::SetChunksPerShard()                   */
+/************************************************************************/
+
+bool ZarrArray::SetChunksPerShard(const std::vector<uint64_t>& anChunksPerShard)
+{
+    if( anChunksPerShard.size() != m_aoDims.size() || m_aoDims.empty() )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid number of values in chunks_per_shard");
+        return false;
+    }
+    uint64_t nChunksPerShard = 1;
+    for( const auto nVal: anChunksPerShard )
+    {
+        if( nVal == 0 )
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Values in chunks_per_shard should be > 0");
+            return false;
+        }
+        // Limit the size of the shard index to 1 GB
+        if( nVal > (static_cast<uint64_t>(1) << 26) / nChunksPerShard )
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Too many chunks per shard");
+            return false;
+        }
+        nChunksPerShard *= nVal;
+    }
+    m_anChunksPerShard = anChunksPerShard;
+    m_nChunksPerShard = nChunksPerShard;
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrArray::GetShardIndices()                    */
+/************************************************************************/
+
+// Compute the indices of the shard that contains a chunk, and return the
+// index of the chunk within the shard (in C order).
+uint64_t ZarrArray::GetShardIndices(const uint64_t* tileIndices,
+                                    std::vector<uint64_t>& anShardIndices) const
+{
+    const size_t nDims = m_aoDims.size();
+    anShardIndices.resize(nDims);
+    uint64_t nChunkIdx = 0;
+    for( size_t i = 0; i < nDims; ++i )
+    {
+        anShardIndices[i] = tileIndices[i] / m_anChunksPerShard[i];
+        nChunkIdx = nChunkIdx * m_anChunksPerShard[i] +
+                    tileIndices[i] % m_anChunksPerShard[i];
+    }
+    return nChunkIdx;
+}
+
+/************************************************************************/
+/*                       ZarrArray::GetShardIndex()                     */
+/************************************************************************/
+
+// Return the (offset, size) pairs of the inner chunks of a shard. The
+// index is fetched once per shard and cached. This method may be called
+// concurrently from several threads.
+bool ZarrArray::GetShardIndex(const std::vector<uint64_t>& anShardIndices,
+                              std::vector<uint64_t>& anIndex) const
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oShardMutex);
+        auto oIter = m_oMapShardIndex.find(anShardIndices);
+        if( oIter != m_oMapShardIndex.end() )
+        {
+            anIndex = oIter->second;
+            return true;
+        }
+    }
+
+    // The index is read without holding the mutex, so that other threads
+    // are not blocked during the I/O. Concurrent readers of the same shard
+    // may read it several times, which is harmless.
+
+    const size_t nIndexSize = static_cast<size_t>(m_nChunksPerShard) * 2;
+    anIndex.clear();
+    anIndex.resize(nIndexSize, std::numeric_limits<uint64_t>::max());
+
+    const std::string osFilename = GetChunkFilename(anShardIndices.data());
+    VSILFILE* fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if( fp != nullptr )
+    {
+        const vsi_l_offset nIndexBytes = nIndexSize * sizeof(uint64_t);
+        VSIFSeekL(fp, 0, SEEK_END);
+        const auto nFileSize = VSIFTellL(fp);
+        bool bOK = nFileSize >= nIndexBytes &&
+                   VSIFSeekL(fp, nFileSize - nIndexBytes, SEEK_SET) == 0 &&
+                   VSIFReadL(anIndex.data(), sizeof(uint64_t), nIndexSize, fp) ==
+                                                                    nIndexSize;
+        VSIFCloseL(fp);
+        for( size_t i = 0; bOK && i < nIndexSize; i += 2 )
+        {
+            CPL_LSBPTR64(&anIndex[i]);
+            CPL_LSBPTR64(&anIndex[i+1]);
+            if( anIndex[i] != std::numeric_limits<uint64_t>::max() &&
+                (anIndex[i] > nFileSize - nIndexBytes ||
+                 anIndex[i+1] > nFileSize - nIndexBytes - anIndex[i]) )
+            {
+                bOK = false;
+            }
+        }
+        if( !bOK )
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid shard index in %s", osFilename.c_str());
+            return false;
+        }
+    }
+    std::lock_guard<std::mutex> oLock(m_oShardMutex);
+    m_oMapShardIndex[anShardIndices] = anIndex;
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrArray::ReadShardedChunk()                    */
+/************************************************************************/
+
+// Read the (compressed) data of an inner chunk of a shard. This method may
+// be called concurrently from several threads.
+bool ZarrArray::ReadShardedChunk(const uint64_t* tileIndices,
+                                 std::vector<GByte>& abyChunkData,
+                                 bool& bMissingChunkOut) const
+{
+    bMissingChunkOut = false;
+
+    std::vector<uint64_t> anShardIndices;
+    const uint64_t nChunkIdx = GetShardIndices(tileIndices, anShardIndices);
+
+    // Chunks of a shard being assembled are served from its write buffer
+    {
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        auto oIter = m_oMapShardWriteBuffer.find(anShardIndices);
+        if( oIter != m_oMapShardWriteBuffer.end() )
+        {
+            auto oIterChunk = oIter->second.oMapChunkData.find(nChunkIdx);
+            if( oIterChunk != oIter->second.oMapChunkData.end() )
+            {
+                if( oIterChunk->second.empty() )
+                    bMissingChunkOut = true;
+                else
+                    abyChunkData = oIterChunk->second;
+                return true;
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oShardMutex);
+        auto oIter = m_oMapPrefetchedChunkData.find(
+            std::vector<uint64_t>(tileIndices, tileIndices + m_aoDims.size()));
+        if( oIter != m_oMapPrefetchedChunkData.end() )
+        {
+            abyChunkData = std::move(oIter->second);
+            m_oMapPrefetchedChunkData.erase(oIter);
+            return true;
+        }
+    }
+
+    std::vector<uint64_t> anIndex;
+    if( !GetShardIndex(anShardIndices, anIndex) )
+        return false;
+    const uint64_t nOffset = anIndex[2 * nChunkIdx];
+    const uint64_t nSize = anIndex[2 * nChunkIdx + 1];
+    if( nOffset == std::numeric_limits<uint64_t>::max() )
+    {
+        bMissingChunkOut = true;
+        return true;
+    }
+
+    const std::string osFilename = GetChunkFilename(anShardIndices.data());
+    if( nSize > static_cast<uint64_t>(std::numeric_limits<int>::max()) )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Too large chunk in %s",
+                 osFilename.c_str());
+        return false;
+    }
+    try
+    {
+        abyChunkData.resize(static_cast<size_t>(nSize));
+    }
+    catch( const std::exception& )
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for chunk of %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    VSILFILE* fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if( fp == nullptr )
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s", osFilename.c_str());
+        return false;
+    }
+    const bool bOK = VSIFSeekL(fp, nOffset, SEEK_SET) == 0 &&
+                     VSIFReadL(abyChunkData.data(), 1, abyChunkData.size(), fp) ==
+                                                        abyChunkData.size();
+    VSIFCloseL(fp);
+    if( !bOK )
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Could not read chunk of %s correctly",
+                 osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                   ZarrArray::PrefetchShardedChunks()                 */
+/************************************************************************/
+
+// Fetch the data of the requested inner chunks with one multi-range
+// request per shard. The data is then consumed by ReadShardedChunk().
+bool ZarrArray::PrefetchShardedChunks(const std::vector<uint64_t>& anReqTilesIndices) const
+{
+    const size_t nDims = m_aoDims.size();
+    const size_t nReqTiles = anReqTilesIndices.size() / nDims;
+
+    // Group requested chunks per shard
+    std::map<std::vector<uint64_t>, std::vector<std::pair<uint64_t, size_t>>> oMapShardToChunks;
+    std::vector<uint64_t> anShardIndices;
+    for( size_t iReq = 0; iReq < nReqTiles; ++iReq )
+    {
+        const uint64_t nChunkIdx = GetShardIndices(
+            anReqTilesIndices.data() + iReq * nDims, anShardIndices);
+        oMapShardToChunks[anShardIndices].emplace_back(nChunkIdx, iReq);
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oShardMutex);
+        m_oMapPrefetchedChunkData.clear();
+    }
+
+    std::vector<uint64_t> anIndex;
+    for( auto& oIter: oMapShardToChunks )
+    {
+        if( !GetShardIndex(oIter.first, anIndex) )
+            return false;
+
+        // Sort chunks by increasing offset in the shard
+        auto& aoChunks = oIter.second;
+        aoChunks.erase(std::remove_if(aoChunks.begin(), aoChunks.end(),
+            [&anIndex](const std::pair<uint64_t, size_t>& oChunk)
+            {
+                return anIndex[2 * oChunk.first] ==
+                                    std::numeric_limits<uint64_t>::max() ||
+                       anIndex[2 * oChunk.first + 1] == 0 ||
+                       anIndex[2 * oChunk.first + 1] >
+                            static_cast<uint64_t>(std::numeric_limits<int>::max());
+            }), aoChunks.end());
+        if( aoChunks.empty() )
+            continue;
+        std::sort(aoChunks.begin(), aoChunks.end(),
+            [&anIndex](const std::pair<uint64_t, size_t>& a,
+                       const std::pair<uint64_t, size_t>& b)
+            {
+                return anIndex[2 * a.first] < anIndex[2 * b.first];
+            });
+
+        std::vector<std::vector<GByte>> aabyData(aoChunks.size());
+        std::vector<void*> apData(aoChunks.size());
+        std::vector<vsi_l_offset> anOffsets(aoChunks.size());
+        std::vector<size_t> anSizes(aoChunks.size());
+        try
+        {
+            for( size_t i = 0; i < aoChunks.size(); ++i )
+            {
+                anOffsets[i] = anIndex[2 * aoChunks[i].first];
+                anSizes[i] = static_cast<size_t>(anIndex[2 * aoChunks[i].first + 1]);
+                aabyData[i].resize(anSizes[i]);
+                apData[i] = aabyData[i].data();
+            }
+        }
+        catch( const std::exception& )
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for chunks of shard");
+            return false;
+        }
+
+        const std::string osFilename = GetChunkFilename(oIter.first.data());
+        VSILFILE* fp = VSIFOpenL(osFilename.c_str(), "rb");
+        if( fp == nullptr )
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s", osFilename.c_str());
+            return false;
+        }
+        const int nRet = VSIFReadMultiRangeL(static_cast<int>(apData.size()),
+                                             apData.data(), anOffsets.data(),
+                                             anSizes.data(), fp);
+        VSIFCloseL(fp);
+        if( nRet != 0 )
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Could not read chunks of %s correctly",
+                     osFilename.c_str());
+            return false;
+        }
+
+        std::lock_guard<std::mutex> oLock(m_oShardMutex);
+        for( size_t i = 0; i < aoChunks.size(); ++i )
+        {
+            const uint64_t* tileIndices =
+                anReqTilesIndices.data() + aoChunks[i].second * nDims;
+            m_oMapPrefetchedChunkData[std::vector<uint64_t>(
+                tileIndices, tileIndices + nDims)] = std::move(aabyData[i]);
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         ZarrArray::FlushShard()                      */
+/************************************************************************/
+
+// Write a shard being assembled in m_oMapShardWriteBuffer, merging it with
+// the chunks of an existing shard that have not been rewritten.
+// anShardIndices must not be a reference to a key of m_oMapShardWriteBuffer.
+bool ZarrArray::FlushShard(const std::vector<uint64_t>& anShardIndices) const
+{
+    // Wait for worker threads to have compressed the pending chunks.
+    if( !WaitPendingTileWrites() )
+        return false;
+
+    std::map<uint64_t, std::vector<GByte>> oMapChunkData;
+    {
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        auto oIter = m_oMapShardWriteBuffer.find(anShardIndices);
+        if( oIter == m_oMapShardWriteBuffer.end() )
+            return true;
+        oMapChunkData = std::move(oIter->second.oMapChunkData);
+        m_nShardWriteBufferRawBytes -= oIter->second.nRawBytes;
+        m_oMapShardWriteBuffer.erase(oIter);
+    }
+    if( oMapChunkData.empty() )
+        return true;
+
+    const std::string osFilename = GetChunkFilename(anShardIndices.data());
+
+    // Retrieve the chunks of the existing shard that have not been rewritten
+    if( oMapChunkData.size() < m_nChunksPerShard )
+    {
+        std::vector<uint64_t> anIndex;
+        if( !GetShardIndex(anShardIndices, anIndex) )
+            return false;
+        VSILFILE* fp = nullptr;
+        for( uint64_t i = 0; i < m_nChunksPerShard; ++i )
+        {
+            if( anIndex[2 * i] == std::numeric_limits<uint64_t>::max() ||
+                oMapChunkData.find(i) != oMapChunkData.end() )
+            {
+                continue;
+            }
+            if( fp == nullptr )
+            {
+                fp = VSIFOpenL(osFilename.c_str(), "rb");
+                if( fp == nullptr )
+                {
+                    CPLError(CE_Failure, CPLE_FileIO,
+                             "Cannot open %s", osFilename.c_str());
+                    return false;
+                }
+            }
+            // The index has been checked against the file size by
+            // GetShardIndex(), but the size may still not fit in memory.
+            const uint64_t nChunkSize = anIndex[2 * i + 1];
+            if( nChunkSize > static_cast<uint64_t>(std::numeric_limits<int>::max()) )
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "Too large chunk in %s",
+                         osFilename.c_str());
+                VSIFCloseL(fp);
+                return false;
+            }
+            auto& abyChunkData = oMapChunkData[i];
+            try
+            {
+                abyChunkData.resize(static_cast<size_t>(nChunkSize));
+            }
+            catch( const std::exception& )
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate memory for chunk of %s",
+                         osFilename.c_str());
+                VSIFCloseL(fp);
+                return false;
+            }
+            if( VSIFSeekL(fp, anIndex[2 * i], SEEK_SET) != 0 ||
+                VSIFReadL(abyChunkData.data(), 1, abyChunkData.size(), fp) !=
+                                                        abyChunkData.size() )
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Could not read chunk of %s correctly",
+                         osFilename.c_str());
+                VSIFCloseL(fp);
+                return false;
+            }
+        }
+        if( fp )
+            VSIFCloseL(fp);
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oShardMutex);
+        m_oMapShardIndex.erase(anShardIndices);
+        m_oMapPrefetchedChunkData.clear();
+    }
+
+    bool bEmptyShard = true;
+    for( const auto& oIter: oMapChunkData )
+    {
+        if( !oIter.second.empty() )
+        {
+            bEmptyShard = false;
+            break;
+        }
+    }
+    if( bEmptyShard )
+    {
+        VSIStatBufL sStat;
+        if( VSIStatL(osFilename.c_str(), &sStat) == 0 )
+        {
+            CPLDebugOnly(ZARR_DEBUG_KEY, "Deleting shard %s that has now empty content",
+                         osFilename.c_str());
+            return VSIUnlink(osFilename.c_str()) == 0;
+        }
+        return true;
+    }
+
+    if( m_osDimSeparator == "/" )
+    {
+        std::string osDir = CPLGetDirname(osFilename.c_str());
+        VSIStatBufL sStat;
+        if( VSIStatL(osDir.c_str(), &sStat) != 0 )
+        {
+            if( VSIMkdirRecursive(osDir.c_str(), 0755) != 0 )
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot create directory %s", osDir.c_str());
+                return false;
+            }
+        }
+    }
+
+    CPLDebug(ZARR_DEBUG_KEY, "Writing shard %s", osFilename.c_str());
+    VSILFILE* fp = VSIFOpenL(osFilename.c_str(), "wb");
+    if( fp == nullptr )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot create shard %s", osFilename.c_str());
+        return false;
+    }
+
+    // Chunks are written in C order, followed by the index made of
+    // (offset, size) pairs of little-endian uint64 values.
+    std::vector<uint64_t> anIndex(static_cast<size_t>(m_nChunksPerShard) * 2,
+                                  std::numeric_limits<uint64_t>::max());
+    bool bRet = true;
+    uint64_t nOffset = 0;
+    for( const auto& oIter: oMapChunkData )
+    {
+        const auto& abyChunkData = oIter.second;
+        if( abyChunkData.empty() )
+            continue;
+        if( VSIFWriteL(abyChunkData.data(), 1, abyChunkData.size(), fp) !=
+                                                        abyChunkData.size() )
+        {
+            bRet = false;
+            break;
+        }
+        anIndex[2 * oIter.first] = nOffset;
+        anIndex[2 * oIter.first + 1] = abyChunkData.size();
+        nOffset += abyChunkData.size();
+    }
+    if( bRet )
+    {
+        for( auto& nVal: anIndex )
+            CPL_LSBPTR64(&nVal);
+        bRet = VSIFWriteL(anIndex.data(), sizeof(uint64_t), anIndex.size(), fp) ==
+                                                                anIndex.size();
+    }
+    if( VSIFCloseL(fp) != 0 )
+        bRet = false;
+    if( !bRet )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not write shard %s correctly",
+                 osFilename.c_str());
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                         ZarrArray::FlushShards()                     */
+/************************************************************************/
+
+// Write all the shards being assembled.
+bool ZarrArray::FlushShards() const
+{
+    if( !WaitPendingTileWrites() )
+        return false;
+
+    bool bRet = true;
+    while( !m_oMapShardWriteBuffer.empty() )
+    {
+        const auto anShardIndices = m_oMapShardWriteBuffer.begin()->first;
+        if( !FlushShard(anShardIndices) )
+            bRet = false;
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                    ZarrArray::GetEltCountInShard()                   */
+/************************************************************************/
+
+// Return the number of array elements covered by a shard. This is less than
+// the shard size for shards at the right/bottom edges.
+uint64_t ZarrArray::GetEltCountInShard(
+                        const std::vector<uint64_t>& anShardIndices) const
+{
+    uint64_t nCount = 1;
+    for( size_t i = 0; i < m_aoDims.size(); ++i )
+    {
+        const uint64_t nDimSize = m_aoDims[i]->GetSize();
+        const uint64_t nShardSize = m_anChunksPerShard[i] * m_anBlockSize[i];
+        const uint64_t nStart = anShardIndices[i] * nShardSize;
+        nCount *= nStart < nDimSize ?
+            std::min(nShardSize, nDimSize - nStart) : 0;
+    }
+    return nCount;
+}
+
 /************************************************************************/
 /*                        ZarrArray::LoadTileData()                     */
 /************************************************************************/
@@ -1157,6 +1751,9 @@ static void DecodeSourceElt(const std::vector<DtypeElt>& elts,
 bool ZarrArray::LoadTileData(const uint64_t* tileIndices,
                              bool& bMissingTileOut) const
 {
+    if( !WaitPendingTileWrite(tileIndices) )
+        return false;
+
     return LoadTileData(tileIndices,
                         false, // use mutex
                         m_psDecompressor,
@@ -1185,33 +1782,7 @@ bool ZarrArray::LoadTileData(const uint64_t* tileIndices,
 
     bMissingTileOut = false;
 
-    std::string osFilename;
-    if( m_aoDims.empty() )
-    {
-        osFilename = "0";
-    }
-    else
-    {
-        for( size_t i = 0; i < m_aoDims.size(); ++i )
-        {
-            if( !osFilename.empty() )
-                osFilename += m_osDimSeparator;
-            osFilename += std::to_string(tileIndices[i]);
-        }
-    }
-
-    if( m_nVersion == 2 )
-    {
-        osFilename = CPLFormFilename(
-            CPLGetDirname(m_osFilename.c_str()), osFilename.c_str(), nullptr);
-    }
-    else
-    {
-        std::string osTmp = m_osRootDirectoryName + "/data/root";
-        if( GetFullName() != "/" )
-            osTmp += GetFullName();
-        osFilename = osTmp + "/c" + osFilename;
-    }
+    std::string osFilename = GetChunkFilename(tileIndices);
 
     // For network file systems, get the streaming version of the filename,
     // as we don't need arbitrary seeking in the file
@@ -1251,94 +1822,127 @@ bool ZarrArray::LoadTileData(const uint64_t* tileIndices,
     if( bUseMutex )
         m_oMutex.unlock();
 
-    VSILFILE* fp = nullptr;
-    // This is the number of files returned in a S3 directory listing operation
-    constexpr uint64_t MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING = 1000;
-    if( (m_osDimSeparator == "/" &&
-            m_anBlockSize.back() > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING) ||
-        (m_osDimSeparator != "/" &&
-            m_nTotalTileCount > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING) )
-    {
-        // Avoid issuing ReadDir() when a lot of files are expected
-        CPLConfigOptionSetter optionSetter("GDAL_DISABLE_READDIR_ON_OPEN", "YES", true);
-        fp = VSIFOpenL(osFilename.c_str(), "rb");
-    }
-    else
-    {
-        fp = VSIFOpenL(osFilename.c_str(), "rb");
-    }
-    if( fp == nullptr )
-    {
-        // Missing files are OK and indicate nodata_value
-        CPLDebugOnly(ZARR_DEBUG_KEY, "Tile %s missing (=nodata)", osFilename.c_str());
-        bMissingTileOut = true;
-        return true;
-    }
-
-    bMissingTileOut = false;
     bool bRet = true;
     size_t nRawDataSize = abyRawTileData.size();
-    if( psDecompressor == nullptr )
-    {
-        nRawDataSize = VSIFReadL(&abyRawTileData[0], 1, nRawDataSize, fp);
-    }
-    else
+    if( !m_anChunksPerShard.empty() )
     {
-        VSIFSeekL(fp, 0, SEEK_END);
-        const auto nSize = VSIFTellL(fp);
-        VSIFSeekL(fp, 0, SEEK_SET);
-        if( nSize > static_cast<vsi_l_offset>(std::numeric_limits<int>::max()) )
+        std::vector<GByte> abyChunkData;
+        if( !ReadShardedChunk(tileIndices, abyChunkData, bMissingTileOut) )
+            return false;
+        if( bMissingTileOut )
         {
-            CPLError(CE_Failure, CPLE_AppDefined, "Too large tile %s",
-                     osFilename.c_str());
-            bRet = false;
+            CPLDebugOnly(ZARR_DEBUG_KEY, "Chunk %s missing (=nodata)", osFilename.c_str());
+            return true;
+        }
+        if( psDecompressor == nullptr )
+        {
+            nRawDataSize = std::min(nRawDataSize, abyChunkData.size());
+            memcpy(&abyRawTileData[0], abyChunkData.data(), nRawDataSize);
         }
         else
         {
-            std::vector<GByte> abyCompressedData;
-            try
+            void* out_buffer = &abyRawTileData[0];
+            if( !psDecompressor->pfnFunc(abyChunkData.data(),
+                                         abyChunkData.size(),
+                                         &out_buffer, &nRawDataSize,
+                                         nullptr,
+                                         psDecompressor->user_data ))
             {
-                abyCompressedData.resize(static_cast<size_t>(nSize));
-
-            }
-            catch( const std::exception& )
-            {
-                CPLError(CE_Failure, CPLE_OutOfMemory,
-                         "Cannot allocate memory for tile %s",
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Decompression of chunk %s failed",
                          osFilename.c_str());
-                bRet = false;
+                return false;
             }
+        }
+    }
+    else
+    {
+        VSILFILE* fp = nullptr;
+        // This is the number of files returned in a S3 directory listing operation
+        constexpr uint64_t MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING = 1000;
+        if( (m_osDimSeparator == "/" &&
+                m_anBlockSize.back() > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING) ||
+            (m_osDimSeparator != "/" &&
+                m_nTotalTileCount > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING) )
+        {
+            // Avoid issuing ReadDir() when a lot of files are expected
+            CPLConfigOptionSetter optionSetter("GDAL_DISABLE_READDIR_ON_OPEN", "YES", true);
+            fp = VSIFOpenL(osFilename.c_str(), "rb");
+        }
+        else
+        {
+            fp = VSIFOpenL(osFilename.c_str(), "rb");
+        }
+        if( fp == nullptr )
+        {
+            // Missing files are OK and indicate nodata_value
+            CPLDebugOnly(ZARR_DEBUG_KEY, "Tile %s missing (=nodata)", osFilename.c_str());
+            bMissingTileOut = true;
+            return true;
+        }
 
-            if( bRet &&
-                (abyCompressedData.empty() ||
-                 VSIFReadL(&abyCompressedData[0], 1, abyCompressedData.size(),
-                          fp) != abyCompressedData.size()) )
+        if( psDecompressor == nullptr )
+        {
+            nRawDataSize = VSIFReadL(&abyRawTileData[0], 1, nRawDataSize, fp);
+        }
+        else
+        {
+            VSIFSeekL(fp, 0, SEEK_END);
+            const auto nSize = VSIFTellL(fp);
+            VSIFSeekL(fp, 0, SEEK_SET);
+            if( nSize > static_cast<vsi_l_offset>(std::numeric_limits<int>::max()) )
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Could not read tile %s correctly",
+                CPLError(CE_Failure, CPLE_AppDefined, "Too large tile %s",
                          osFilename.c_str());
                 bRet = false;
             }
             else
             {
-                void* out_buffer = &abyRawTileData[0];
-                if( !psDecompressor->pfnFunc(abyCompressedData.data(),
-                                             abyCompressedData.size(),
-                                             &out_buffer, &nRawDataSize,
-                                             nullptr,
-                                             psDecompressor->user_data ))
+                std::vector<GByte> abyCompressedData;
+                try
+                {
+                    abyCompressedData.resize(static_cast<size_t>(nSize));
+
+                }
+                catch( const std::exception& )
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate memory for tile %s",
+                             osFilename.c_str());
+                    bRet = false;
+                }
+
+                if( bRet &&
+                    (abyCompressedData.empty() ||
+                     VSIFReadL(&abyCompressedData[0], 1, abyCompressedData.size(),
+                              fp) != abyCompressedData.size()) )
                 {
                     CPLError(CE_Failure, CPLE_AppDefined,
-                             "Decompression of tile %s failed",
+                             "Could not read tile %s correctly",
                              osFilename.c_str());
                     bRet = false;
                 }
+                else
+                {
+                    void* out_buffer = &abyRawTileData[0];
+                    if( !psDecompressor->pfnFunc(abyCompressedData.data(),
+                                                 abyCompressedData.size(),
+                                                 &out_buffer, &nRawDataSize,
+                                                 nullptr,
+                                                 psDecompressor->user_data ))
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Decompression of tile %s failed",
+                                 osFilename.c_str());
+                        bRet = false;
+                    }
+                }
             }
         }
-    }
-    VSIFCloseL(fp);
-    if( !bRet )
-        return false;
+        VSIFCloseL(fp);
+        if( !bRet )
+            return false;
+    }
 
     for( int i = m_oFiltersArray.Size(); i > 0; )
     {
@@ -1416,6 +2020,9 @@ bool ZarrArray::IAdviseRead(const GUInt64* arrayStartIdx,
                             const size_t* count,
                             CSLConstList papszOptions) const
 {
+    if( !FlushShards() )
+        return false;
+
     const size_t nDims = m_aoDims.size();
     std::vector<uint64_t> anIndicesCur(nDims);
     std::vector<uint64_t> anIndicesMin(nDims);
@@ -1556,6 +2163,10 @@ lbl_return_to_caller:
         goto lbl_return_to_caller;
     assert( nTileIter == nReqTiles );
 
+    // Fetch the inner chunks of shards with one multi-range request per shard
+    if( !m_anChunksPerShard.empty() && !PrefetchShardedChunks(anReqTilesIndices) )
+        return false;
+
     CPLWorkerThreadPool* wtp = GDALGetGlobalThreadPool(nThreadsMax);
     if( wtp == nullptr )
         return false;
@@ -2154,6 +2765,20 @@ lbl_return_to_caller:
     return true;
 }
 
+/************************************************************************/
+/*                        ZarrArray::TileWriteJob                       */
+/************************************************************************/
+
+struct ZarrArray::TileWriteJob
+{
+    const ZarrArray*      poArray = nullptr;
+    std::string           osFilename{};
+    std::vector<uint64_t> anTileIndices{};
+    TileEncodingOptions   oOptions{};
+    std::vector<GByte>    abyRawTileData{};
+    std::vector<GByte>    abyTmpRawTileData{};
+};
+
 /************************************************************************/
 /*                    ZarrArray::FlushDirtyTile()                       */
 /************************************************************************/
@@ -2163,35 +2788,73 @@ bool ZarrArray::FlushDirtyTile() const
     if( !m_bDirtyTile )
         return true;
     m_bDirtyTile = false;
+    const uint64_t nWrittenElts = m_nCachedTileWrittenElts;
+    m_nCachedTileWrittenElts = 0;
 
-    std::string osFilename;
-    if( m_anCachedTiledIndices.empty() )
-    {
-        osFilename = "0";
-    }
-    else
+    // Make sure that a previous version of this tile is no longer being
+    // written by a worker thread before overwriting or deleting it.
+    if( !WaitPendingTileWrite(m_anCachedTiledIndices.data()) )
+        return false;
+
+    // With the sharding storage transformer, chunks are accumulated in a
+    // per-shard write buffer. A shard is written once as many elements as it
+    // covers have been written into it, or when the buffered data exceeds the
+    // block cache size, in which case the oldest shards are written first.
+    std::vector<uint64_t> anShardIndices;
+    uint64_t nChunkIdxInShard = 0;
+    if( !m_anChunksPerShard.empty() )
     {
-        for( const auto index: m_anCachedTiledIndices )
+        nChunkIdxInShard = GetShardIndices(m_anCachedTiledIndices.data(),
+                                           anShardIndices);
+
+        std::vector<std::vector<uint64_t>> aanShardsToFlush;
+        for( const auto& oIter: m_oMapShardWriteBuffer )
         {
-            if( !osFilename.empty() )
-                osFilename += m_osDimSeparator;
-            osFilename += std::to_string(index);
+            if( oIter.second.nWrittenElts >= GetEltCountInShard(oIter.first) )
+            {
+                aanShardsToFlush.push_back(oIter.first);
+            }
+        }
+        for( const auto& anShardIndicesToFlush: aanShardsToFlush )
+        {
+            if( !FlushShard(anShardIndicesToFlush) )
+                return false;
         }
-    }
 
-    if( m_nVersion == 2 )
-    {
-        osFilename = CPLFormFilename(
-            CPLGetDirname(m_osFilename.c_str()), osFilename.c_str(), nullptr);
-    }
-    else
-    {
-        std::string osTmp = m_osRootDirectoryName + "/data/root";
-        if( GetFullName() != "/" )
-            osTmp += GetFullName();
-        osFilename = osTmp + "/c" + osFilename;
+        const GIntBig nCacheMax = GDALGetCacheMax64();
+        while( !m_oMapShardWriteBuffer.empty() &&
+               static_cast<GIntBig>(m_nShardWriteBufferRawBytes) > nCacheMax )
+        {
+            auto oIterOldest = m_oMapShardWriteBuffer.begin();
+            for( auto oIter = m_oMapShardWriteBuffer.begin();
+                 oIter != m_oMapShardWriteBuffer.end(); ++oIter )
+            {
+                if( oIter->second.nSeq < oIterOldest->second.nSeq )
+                    oIterOldest = oIter;
+            }
+            const auto anShardIndicesToFlush = oIterOldest->first;
+            if( !FlushShard(anShardIndicesToFlush) )
+                return false;
+        }
+
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        auto oIter = m_oMapShardWriteBuffer.find(anShardIndices);
+        if( oIter == m_oMapShardWriteBuffer.end() )
+        {
+            oIter = m_oMapShardWriteBuffer.insert(
+                std::make_pair(anShardIndices, ShardWriteBuffer())).first;
+            oIter->second.nSeq = m_nShardWriteBufferSeq++;
+        }
+        oIter->second.nWrittenElts += nWrittenElts;
+        if( oIter->second.oSetWrittenChunks.insert(nChunkIdxInShard).second )
+        {
+            oIter->second.nRawBytes += m_abyRawTileData.size();
+            m_nShardWriteBufferRawBytes += m_abyRawTileData.size();
+        }
     }
 
+    std::string osFilename = GetChunkFilename(m_anCachedTiledIndices.data());
+
     const size_t nSourceSize = m_aoDtypeElts.back().nativeOffset +
                                m_aoDtypeElts.back().nativeSize;
     auto& abyTile = m_abyDecodedTileData.empty() ?
@@ -2249,6 +2912,13 @@ bool ZarrArray::FlushDirtyTile() const
     {
         m_bCachedTiledEmpty = true;
 
+        if( !m_anChunksPerShard.empty() )
+        {
+            std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+            m_oMapShardWriteBuffer[anShardIndices].oMapChunkData[nChunkIdxInShard].clear();
+            return true;
+        }
+
         VSIStatBufL sStat;
         if( VSIStatL(osFilename.c_str(), &sStat) == 0 )
         {
@@ -2277,7 +2947,111 @@ bool ZarrArray::FlushDirtyTile() const
         std::swap(m_abyRawTileData, m_abyTmpRawTileData);
     }
 
-    size_t nRawDataSize = m_abyRawTileData.size();
+    if( m_osDimSeparator == "/" && m_anChunksPerShard.empty() )
+    {
+        std::string osDir = CPLGetDirname(osFilename.c_str());
+        VSIStatBufL sStat;
+        if( VSIStatL(osDir.c_str(), &sStat) != 0 )
+        {
+            if( VSIMkdirRecursive(osDir.c_str(), 0755) != 0 )
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot create directory %s", osDir.c_str());
+                return false;
+            }
+        }
+    }
+
+    if( m_nTileWriteThreads < 0 )
+    {
+        m_nTileWriteThreads = CPLGetNumThreads(
+            CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 1024);
+    }
+
+    if( m_nTileWriteThreads <= 1 )
+    {
+        return CompressAndWriteTile(m_anCachedTiledIndices, osFilename,
+                                    GetTileEncodingOptions(),
+                                    m_abyRawTileData, m_abyTmpRawTileData);
+    }
+
+    // Write-behind: compress and write the tile in a worker thread. The
+    // number of tiles in flight is bounded to limit memory usage.
+    if( m_poTileWriteJobQueue == nullptr )
+    {
+        CPLDebug(ZARR_DEBUG_KEY,
+                 "Using up to %d threads to compress and write tiles",
+                 m_nTileWriteThreads);
+        CPLWorkerThreadPool* wtp = GDALGetGlobalThreadPool(m_nTileWriteThreads);
+        if( wtp == nullptr )
+            return false;
+        m_poTileWriteJobQueue = wtp->CreateJobQueue();
+    }
+    m_poTileWriteJobQueue->WaitCompletion(2 * m_nTileWriteThreads - 1);
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        if( !m_osTileWriteErrorMsg.empty() )
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     m_osTileWriteErrorMsg.c_str());
+            m_osTileWriteErrorMsg.clear();
+            return false;
+        }
+        m_oSetTileIndicesBeingWritten.insert(m_anCachedTiledIndices);
+    }
+
+    auto psJob = new TileWriteJob();
+    psJob->poArray = this;
+    psJob->osFilename = std::move(osFilename);
+    psJob->anTileIndices = m_anCachedTiledIndices;
+    psJob->oOptions = GetTileEncodingOptions();
+    psJob->abyRawTileData = std::move(m_abyRawTileData);
+    psJob->abyTmpRawTileData.resize(m_abyTmpRawTileData.size());
+
+    // The raw tile buffer has been handed over to the job. Re-allocate it and
+    // invalidate the cached tile, so that it gets reloaded if needed.
+    m_abyRawTileData.resize(psJob->abyRawTileData.size());
+    m_anCachedTiledIndices.clear();
+    m_bCachedTiledValid = false;
+
+    if( !m_poTileWriteJobQueue->SubmitJob(TileWriteJobFunc, psJob) )
+    {
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        m_oSetTileIndicesBeingWritten.erase(psJob->anTileIndices);
+        delete psJob;
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  ZarrArray::WaitPendingTileWrite()                   */
+/************************************************************************/
+
+bool ZarrArray::WaitPendingTileWrite(const uint64_t* tileIndices) const
+{
+    if( m_poTileWriteJobQueue == nullptr )
+        return true;
+    {
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        if( m_oSetTileIndicesBeingWritten.find(
+                std::vector<uint64_t>(tileIndices, tileIndices + m_aoDims.size())) ==
+                                        m_oSetTileIndicesBeingWritten.end() )
+        {
+            return true;
+        }
+    }
+    return WaitPendingTileWrites();
+}
+
+/************************************************************************/
+/*                 ZarrArray::GetTileEncodingOptions()                  */
+/************************************************************************/
+
+ZarrArray::TileEncodingOptions ZarrArray::GetTileEncodingOptions() const
+{
+    TileEncodingOptions oOptions;
     for( const auto& oFilter: m_oFiltersArray )
     {
         const auto osFilterId = oFilter["id"].ToString();
@@ -2290,62 +3064,73 @@ bool ZarrArray::FlushDirtyTile() const
             aosOptions.SetNameValue(obj.GetName().c_str(),
                                     obj.ToString().c_str());
         }
-        void* out_buffer = &m_abyTmpRawTileData[0];
-        size_t nOutSize = m_abyTmpRawTileData.size();
-        if( !psFilterCompressor->pfnFunc(m_abyRawTileData.data(),
-                                         nRawDataSize,
-                                         &out_buffer,
-                                         &nOutSize,
-                                         aosOptions.List(),
-                                         psFilterCompressor->user_data ) )
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Filter %s for tile %s failed",
-                     osFilterId.c_str(), osFilename.c_str());
-            return false;
-        }
-
-        nRawDataSize = nOutSize;
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
+        oOptions.aoFilters.emplace_back(psFilterCompressor, aosOptions);
     }
 
-    if( m_osDimSeparator == "/" )
+    if( m_psCompressor )
     {
-        std::string osDir = CPLGetDirname(osFilename.c_str());
-        VSIStatBufL sStat;
-        if( VSIStatL(osDir.c_str(), &sStat) != 0 )
+        const auto compressorConfig = m_nVersion == 2 ?
+            m_oCompressorJSonV2 : m_oCompressorJSonV3["configuration"];
+        for( const auto& obj: compressorConfig.GetChildren() )
         {
-            if( VSIMkdirRecursive(osDir.c_str(), 0755) != 0 )
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot create directory %s", osDir.c_str());
-                return false;
-            }
+            oOptions.aosCompressorOptions.SetNameValue(obj.GetName().c_str(),
+                                                       obj.ToString().c_str());
+        }
+        if( EQUAL(m_psCompressor->pszId, "blosc") &&
+            m_oType.GetClass() == GEDTC_NUMERIC )
+        {
+            oOptions.aosCompressorOptions.SetNameValue("TYPESIZE",
+                CPLSPrintf("%d",
+                   GDALGetDataTypeSizeBytes(
+                       GDALGetNonComplexDataType(
+                           m_oType.GetNumericDataType()))));
         }
     }
+    return oOptions;
+}
 
-    VSILFILE* fp = VSIFOpenL(osFilename.c_str(), "wb");
-    if( fp == nullptr )
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Cannot create tile %s", osFilename.c_str());
-        return false;
-    }
+/************************************************************************/
+/*                  ZarrArray::CompressAndWriteTile()                   */
+/************************************************************************/
 
-    bool bRet = true;
-    if( m_psCompressor == nullptr )
+bool ZarrArray::CompressAndWriteTile(const std::vector<uint64_t>& anTileIndices,
+                                     const std::string& osFilename,
+                                     const TileEncodingOptions& oOptions,
+                                     std::vector<GByte>& abyRawTileData,
+                                     std::vector<GByte>& abyTmpRawTileData) const
+{
+    // This method should NOT modify any ZarrArray member (except
+    // m_oMapShardWriteBuffer under m_oTileWriteMutex), as it may be called
+    // concurrently from several threads.
+
+    size_t nRawDataSize = abyRawTileData.size();
+    for( const auto& oFilter: oOptions.aoFilters )
     {
-        if( VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) != nRawDataSize )
+        const auto psFilterCompressor = oFilter.first;
+        void* out_buffer = &abyTmpRawTileData[0];
+        size_t nOutSize = abyTmpRawTileData.size();
+        if( !psFilterCompressor->pfnFunc(abyRawTileData.data(),
+                                         nRawDataSize,
+                                         &out_buffer,
+                                         &nOutSize,
+                                         oFilter.second.List(),
+                                         psFilterCompressor->user_data ) )
         {
             CPLError(CE_Failure, CPLE_AppDefined,
-                     "Could not write tile %s correctly",
-                     osFilename.c_str());
-            bRet = false;
+                     "Filter %s for tile %s failed",
+                     psFilterCompressor->pszId, osFilename.c_str());
+            return false;
         }
+
+        nRawDataSize = nOutSize;
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
-    else
+
+    const GByte* pabyData = abyRawTileData.data();
+    size_t nDataSize = nRawDataSize;
+    std::vector<GByte> abyCompressedData;
+    if( m_psCompressor != nullptr )
     {
-        std::vector<GByte> abyCompressedData;
         try
         {
             constexpr size_t MIN_BUF_SIZE = 64; // somewhat arbitrary
@@ -2360,60 +3145,120 @@ bool ZarrArray::FlushDirtyTile() const
             CPLError(CE_Failure, CPLE_OutOfMemory,
                      "Cannot allocate memory for tile %s",
                      osFilename.c_str());
-            bRet = false;
-        }
-
-        if( bRet )
-        {
-            void* out_buffer = &abyCompressedData[0];
-            size_t out_size = abyCompressedData.size();
-            CPLStringList aosOptions;
-            const auto compressorConfig = m_nVersion == 2 ?
-                m_oCompressorJSonV2 : m_oCompressorJSonV3["configuration"];
-            for( const auto& obj: compressorConfig.GetChildren() )
-            {
-                aosOptions.SetNameValue(obj.GetName().c_str(),
-                                        obj.ToString().c_str());
-            }
-            if( EQUAL(m_psCompressor->pszId, "blosc") &&
-                m_oType.GetClass() == GEDTC_NUMERIC )
-            {
-                aosOptions.SetNameValue("TYPESIZE",
-                    CPLSPrintf("%d",
-                       GDALGetDataTypeSizeBytes(
-                           GDALGetNonComplexDataType(
-                               m_oType.GetNumericDataType()))));
-            }
-
-            if( !m_psCompressor->pfnFunc(m_abyRawTileData.data(),
-                                         nRawDataSize,
-                                         &out_buffer, &out_size,
-                                         aosOptions.List(),
-                                         m_psCompressor->user_data ) )
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Compression of tile %s failed",
-                         osFilename.c_str());
-                bRet = false;
-            }
-            abyCompressedData.resize(out_size);
+            return false;
         }
 
-        if( bRet &&
-            VSIFWriteL(abyCompressedData.data(), 1, abyCompressedData.size(),
-                       fp) != abyCompressedData.size() )
+        void* out_buffer = &abyCompressedData[0];
+        size_t out_size = abyCompressedData.size();
+        if( !m_psCompressor->pfnFunc(abyRawTileData.data(),
+                                     nRawDataSize,
+                                     &out_buffer, &out_size,
+                                     oOptions.aosCompressorOptions.List(),
+                                     m_psCompressor->user_data ) )
         {
             CPLError(CE_Failure, CPLE_AppDefined,
-                     "Could not write tile %s correctly",
+                     "Compression of tile %s failed",
                      osFilename.c_str());
-            bRet = false;
+            return false;
         }
+        abyCompressedData.resize(out_size);
+        pabyData = abyCompressedData.data();
+        nDataSize = out_size;
+    }
+
+    if( !m_anChunksPerShard.empty() )
+    {
+        std::vector<uint64_t> anShardIndices;
+        const uint64_t nChunkIdx = GetShardIndices(anTileIndices.data(),
+                                                   anShardIndices);
+        std::vector<GByte> abyChunkData(pabyData, pabyData + nDataSize);
+        std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+        // The shard buffer has been created by FlushDirtyTile(), and cannot be
+        // flushed while chunks of it are pending.
+        auto oIter = m_oMapShardWriteBuffer.find(anShardIndices);
+        CPLAssert(oIter != m_oMapShardWriteBuffer.end());
+        if( oIter == m_oMapShardWriteBuffer.end() )
+            return false;
+        oIter->second.oMapChunkData[nChunkIdx] = std::move(abyChunkData);
+        return true;
+    }
+
+    VSILFILE* fp = VSIFOpenL(osFilename.c_str(), "wb");
+    if( fp == nullptr )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot create tile %s", osFilename.c_str());
+        return false;
+    }
+
+    bool bRet = true;
+    if( VSIFWriteL(pabyData, 1, nDataSize, fp) != nDataSize )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not write tile %s correctly",
+                 osFilename.c_str());
+        bRet = false;
     }
     VSIFCloseL(fp);
 
     return bRet;
 }
 
+/************************************************************************/
+/*                    ZarrArray::TileWriteJobFunc()                     */
+/************************************************************************/
+
+void ZarrArray::TileWriteJobFunc(void* pData)
+{
+    auto psJob = static_cast<TileWriteJob*>(pData);
+    const ZarrArray* poArray = psJob->poArray;
+
+    // Errors are collected and re-emitted by the thread that waits for the
+    // completion of the job.
+    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+    CPLErrorReset();
+    const bool bRet = poArray->CompressAndWriteTile(psJob->anTileIndices,
+                                                    psJob->osFilename,
+                                                    psJob->oOptions,
+                                                    psJob->abyRawTileData,
+                                                    psJob->abyTmpRawTileData);
+
+    {
+        std::lock_guard<std::mutex> oLock(poArray->m_oTileWriteMutex);
+        if( !bRet && poArray->m_osTileWriteErrorMsg.empty() )
+        {
+            poArray->m_osTileWriteErrorMsg = CPLGetLastErrorMsg();
+            if( poArray->m_osTileWriteErrorMsg.empty() )
+                poArray->m_osTileWriteErrorMsg = "Writing of tile " +
+                    psJob->osFilename + " failed";
+        }
+        poArray->m_oSetTileIndicesBeingWritten.erase(psJob->anTileIndices);
+    }
+
+    delete psJob;
+}
+
+/************************************************************************/
+/*                  ZarrArray::WaitPendingTileWrites()                  */
+/************************************************************************/
+
+bool ZarrArray::WaitPendingTileWrites() const
+{
+    if( m_poTileWriteJobQueue == nullptr )
+        return true;
+    m_poTileWriteJobQueue->WaitCompletion();
+
+    std::lock_guard<std::mutex> oLock(m_oTileWriteMutex);
+    if( !m_osTileWriteErrorMsg.empty() )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                 m_osTileWriteErrorMsg.c_str());
+        m_osTileWriteErrorMsg.clear();
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                           ZarrArray::IRead()                         */
 /************************************************************************/
@@ -2559,6 +3404,7 @@ lbl_next_depth:
 
             m_anCachedTiledIndices = tileIndices;
             m_bCachedTiledValid = true;
+            m_nCachedTileWrittenElts = 0;
 
             if( bWriteWholeTile )
             {
@@ -2616,6 +3462,13 @@ lbl_next_depth:
         }
         m_bDirtyTile = true;
         m_bCachedTiledEmpty = false;
+        if( !m_anChunksPerShard.empty() )
+        {
+            uint64_t nWrittenElts = 1;
+            for( size_t i = 0; i < nDims; ++i )
+                nWrittenElts *= countInnerLoopInit[i];
+            m_nCachedTileWrittenElts += nWrittenElts;
+        }
 
         GByte* pabyTile = &abyTile[0];
 
@@ -3918,6 +4771,45 @@ std::shared_ptr<ZarrArray> ZarrGroupBase::LoadArray(const std::string& osArrayNa
         }
     }
 
+    std::vector<uint64_t> anChunksPerShard;
+    if( !isZarrV2 )
+    {
+        const auto oStorageTransformers = oRoot["storage_transformers"];
+        if( oStorageTransformers.GetType() == CPLJSONObject::Type::Array )
+        {
+            for( const auto& oTransformer: oStorageTransformers.ToArray() )
+            {
+                if( oTransformer["extension"].ToString() != ZARR_SHARDING_EXTENSION )
+                {
+                    CPLError(CE_Failure, CPLE_NotSupported,
+                             "Unsupported storage transformer: %s",
+                             oTransformer.ToString().c_str());
+                    return nullptr;
+                }
+                const auto oChunksPerShard =
+                    oTransformer["configuration/chunks_per_shard"].ToArray();
+                for( const auto& oVal: oChunksPerShard )
+                {
+                    if( oVal.GetType() != CPLJSONObject::Type::Integer &&
+                        oVal.GetType() != CPLJSONObject::Type::Long )
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Invalid content for chunks_per_shard");
+                        return nullptr;
+                    }
+                    anChunksPerShard.push_back(
+                        static_cast<uint64_t>(std::max<GInt64>(0, oVal.ToLong())));
+                }
+                if( anChunksPerShard.empty() )
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Missing chunks_per_shard");
+                    return nullptr;
+                }
+            }
+        }
+    }
+
     auto poArray = ZarrArray::Create(m_poSharedResource,
                                      GetFullName(),
                                      osArrayName,
@@ -3925,6 +4817,11 @@ std::shared_ptr<ZarrArray> ZarrGroupBase::LoadArray(const std::string& osArrayNa
                                      bFortranOrder);
     if( !poArray )
         return nullptr;
+    if( !anChunksPerShard.empty() &&
+        !poArray->SetChunksPerShard(anChunksPerShard) )
+    {
+        return nullptr;
+    }
     poArray->SetUpdatable(m_bUpdatable); // must be set before SetAttributes()
     poArray->SetFilename(osZarrayFilename);
     poArray->SetDimSeparator(osDimSeparator);
@@ -4088,6 +4985,16 @@ bool ZarrArray::CacheTilePresence()
     if( m_nTotalTileCount == 1 )
         return true;
 
+    if( !m_anChunksPerShard.empty() )
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "CACHE_TILE_PRESENCE is not supported for sharded arrays");
+        return false;
+    }
+
+    if( !WaitPendingTileWrites() )
+        return false;
+
     const std::string osDirectoryName = [this]()
     {
         if( m_nVersion == 2 )
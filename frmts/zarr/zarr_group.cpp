@@ -1109,6 +1109,11 @@ std::shared_ptr<GDALMDArray> ZarrGroupV2::CreateMDArray(
                  "Invalid array name");
         return nullptr;
     }
+    if( CSLFetchNameValue(papszOptions, "CHUNKS_PER_SHARD") )
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "CHUNKS_PER_SHARD ignored for Zarr V2");
+    }
 
     std::vector<DtypeElt> aoDtypeElts;
     constexpr bool bZarrV2 = true;
@@ -1767,6 +1772,22 @@ std::shared_ptr<GDALMDArray> ZarrGroupV3::CreateMDArray(
 
     if( !poArray )
         return nullptr;
+
+    const char* pszChunksPerShard = CSLFetchNameValue(papszOptions,
+                                                      "CHUNKS_PER_SHARD");
+    if( pszChunksPerShard )
+    {
+        const CPLStringList aosTokens(CSLTokenizeString2(pszChunksPerShard, ",", 0));
+        std::vector<uint64_t> anChunksPerShard;
+        for( int i = 0; i < aosTokens.size(); ++i )
+        {
+            anChunksPerShard.push_back(static_cast<uint64_t>(
+                std::max<GIntBig>(0, CPLAtoGIntBig(aosTokens[i]))));
+        }
+        if( !poArray->SetChunksPerShard(anChunksPerShard) )
+            return nullptr;
+    }
+
     poArray->SetNew(true);
     poArray->SetFilename(osFilename);
     poArray->SetRootDirectoryName(m_osDirectoryName);
@@ -657,6 +657,13 @@ void ZarrDriver::InitMetadata()
         CPLAddXMLAttributeAndValue(psBlockSizeNode, "description",
             "Comma separated list of chunk size along each dimension");
 
+        auto psChunksPerShardNode = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psChunksPerShardNode, "name", "CHUNKS_PER_SHARD");
+        CPLAddXMLAttributeAndValue(psChunksPerShardNode, "type", "string");
+        CPLAddXMLAttributeAndValue(psChunksPerShardNode, "description",
+            "Comma separated list of the number of chunks per shard along each "
+            "dimension (only for ZARR_V3)");
+
         auto psChunkMemoryLayout = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
         CPLAddXMLAttributeAndValue(psChunkMemoryLayout, "name", "CHUNK_MEMORY_LAYOUT");
         CPLAddXMLAttributeAndValue(psChunkMemoryLayout, "type", "string-select");
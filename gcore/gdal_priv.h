@@ -1020,6 +1020,9 @@ class CPL_DLL GDALRasterBlock
     static void EnterDisableDirtyBlockFlush();
     static void LeaveDisableDirtyBlockFlush();
 
+    static GIntBig GetLockContentionCount();
+    static GIntBig GetLockAcquisitionCount();
+
 #ifdef notdef
     static void CheckNonOrphanedBlocks(GDALRasterBand* poBand);
     void        DumpBlock();
@@ -0,0 +1,435 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  SIMD kernels for raster band statistics
+ *
+ ******************************************************************************
+ * Copyright (c) 2023, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef GDAL_STATS_SIMD_HPP_INCLUDED
+#define GDAL_STATS_SIMD_HPP_INCLUDED
+
+//! @cond Doxygen_Suppress
+
+#include "cpl_port.h"
+#include "gdal.h"
+
+/** Statistics of the valid samples of a block. */
+struct GDALBlockStatistics
+{
+    GUIntBig nValidCount;
+    double dfMin;
+    double dfMax;
+    double dfMean;
+    double dfM2; // sum of the squared differences to the mean
+};
+
+#if defined(__x86_64) || defined(_M_X64)
+
+#define HAVE_GDAL_BLOCK_STATISTICS_SIMD
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME)
+bool GDALComputeBlockStatistics_AVX2(GDALDataType eDataType,
+                                     const void* pData,
+                                     int nXCheck, int nYCheck,
+                                     int nLineStride,
+                                     bool bHasNoData, double dfNoDataValue,
+                                     bool bComputeOtherStats,
+                                     GDALBlockStatistics& sStats);
+#endif
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <emmintrin.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Everything below has internal linkage, since this file is compiled both
+// with and without AVX2 flags, and the linker must not pick the AVX2 version
+// of a function for callers in the baseline code.
+namespace {
+
+/************************************************************************/
+/*                       GDALStatsVecSSE2                               */
+/************************************************************************/
+
+struct GDALStatsVecSSE2
+{
+    typedef __m128d Vec;
+    enum { N = 2 };
+
+    static inline Vec Set1(double x) { return _mm_set1_pd(x); }
+    static inline Vec Add(Vec a, Vec b) { return _mm_add_pd(a, b); }
+    static inline Vec Sub(Vec a, Vec b) { return _mm_sub_pd(a, b); }
+    static inline Vec Mul(Vec a, Vec b) { return _mm_mul_pd(a, b); }
+    // Returns b if a < b is false, as std::min(b, a)
+    static inline Vec Min(Vec a, Vec b) { return _mm_min_pd(a, b); }
+    static inline Vec Max(Vec a, Vec b) { return _mm_max_pd(a, b); }
+    static inline Vec And(Vec a, Vec b) { return _mm_and_pd(a, b); }
+    static inline Vec AndNot(Vec a, Vec b) { return _mm_andnot_pd(a, b); }
+    static inline Vec Or(Vec a, Vec b) { return _mm_or_pd(a, b); }
+    static inline Vec Blend(Vec mask, Vec a, Vec b)
+        { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+    static inline Vec CmpEq(Vec a, Vec b) { return _mm_cmpeq_pd(a, b); }
+    static inline Vec CmpLt(Vec a, Vec b) { return _mm_cmplt_pd(a, b); }
+    static inline Vec NotNan(Vec a) { return _mm_cmpord_pd(a, a); }
+    static inline Vec Abs(Vec a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static inline Vec RoundToFloat(Vec a)
+        { return _mm_cvtps_pd(_mm_cvtpd_ps(a)); }
+    static inline void Store(double* p, Vec a) { _mm_storeu_pd(p, a); }
+
+    static inline Vec Load(const double* p) { return _mm_loadu_pd(p); }
+    static inline Vec Load(const float* p)
+    {
+        return _mm_cvtps_pd(_mm_castsi128_ps(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+    }
+    static inline Vec Load(const GInt32* p)
+    {
+        return _mm_cvtepi32_pd(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    }
+    static inline Vec Load(const GInt16* p)
+    {
+        int nTwoValues;
+        memcpy(&nTwoValues, p, sizeof(nTwoValues));
+        __m128i xmm = _mm_cvtsi32_si128(nTwoValues);
+        // Sign extension to 32 bit
+        xmm = _mm_srai_epi32(_mm_unpacklo_epi16(xmm, xmm), 16);
+        return _mm_cvtepi32_pd(xmm);
+    }
+};
+
+#ifdef __AVX2__
+
+/************************************************************************/
+/*                       GDALStatsVecAVX2                               */
+/************************************************************************/
+
+struct GDALStatsVecAVX2
+{
+    typedef __m256d Vec;
+    enum { N = 4 };
+
+    static inline Vec Set1(double x) { return _mm256_set1_pd(x); }
+    static inline Vec Add(Vec a, Vec b) { return _mm256_add_pd(a, b); }
+    static inline Vec Sub(Vec a, Vec b) { return _mm256_sub_pd(a, b); }
+    static inline Vec Mul(Vec a, Vec b) { return _mm256_mul_pd(a, b); }
+    static inline Vec Min(Vec a, Vec b) { return _mm256_min_pd(a, b); }
+    static inline Vec Max(Vec a, Vec b) { return _mm256_max_pd(a, b); }
+    static inline Vec And(Vec a, Vec b) { return _mm256_and_pd(a, b); }
+    static inline Vec AndNot(Vec a, Vec b) { return _mm256_andnot_pd(a, b); }
+    static inline Vec Or(Vec a, Vec b) { return _mm256_or_pd(a, b); }
+    static inline Vec Blend(Vec mask, Vec a, Vec b)
+        { return _mm256_blendv_pd(b, a, mask); }
+    static inline Vec CmpEq(Vec a, Vec b)
+        { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static inline Vec CmpLt(Vec a, Vec b)
+        { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static inline Vec NotNan(Vec a) { return _mm256_cmp_pd(a, a, _CMP_ORD_Q); }
+    static inline Vec Abs(Vec a)
+        { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static inline Vec RoundToFloat(Vec a)
+        { return _mm256_cvtps_pd(_mm256_cvtpd_ps(a)); }
+    static inline void Store(double* p, Vec a) { _mm256_storeu_pd(p, a); }
+
+    static inline Vec Load(const double* p) { return _mm256_loadu_pd(p); }
+    static inline Vec Load(const float* p)
+        { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+    static inline Vec Load(const GInt32* p)
+    {
+        return _mm256_cvtepi32_pd(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+    static inline Vec Load(const GInt16* p)
+    {
+        return _mm256_cvtepi32_pd(_mm_cvtepi16_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+    }
+};
+
+#endif // __AVX2__
+
+/************************************************************************/
+/*                       GDALStatsIsValid()                             */
+/************************************************************************/
+
+// Same semantics as GetPixelValue() in gdalrasterband.cpp: NaN are invalid,
+// and values are compared to the nodata value with ARE_REAL_EQUAL(), in
+// single precision for Float32 and in double precision otherwise.
+template<class T, bool HAS_NODATA>
+inline bool GDALStatsIsValid(T value, double dfNoDataValue)
+{
+    typedef typename std::conditional<std::is_same<T, float>::value,
+                                      float, double>::type CompareType;
+    const CompareType v = static_cast<CompareType>(value);
+    if( std::is_floating_point<T>::value && CPLIsNan(v) )
+        return false;
+    if( HAS_NODATA )
+    {
+        const CompareType nd = static_cast<CompareType>(dfNoDataValue);
+        if( v == nd ||
+            std::fabs(v - nd) < std::numeric_limits<float>::epsilon() *
+                                    std::fabs(v + nd) * 2 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class V, class T, bool HAS_NODATA>
+inline typename V::Vec GDALStatsValidMask(typename V::Vec v,
+                                          typename V::Vec vNoData)
+{
+    typedef typename V::Vec Vec;
+    Vec mask = std::is_floating_point<T>::value ? V::NotNan(v) :
+                                                  V::CmpEq(v, v);
+    if( HAS_NODATA )
+    {
+        Vec vDiff = V::Sub(v, vNoData);
+        Vec vSum = V::Add(v, vNoData);
+        Vec vThreshold;
+        const Vec vEps = V::Set1(std::numeric_limits<float>::epsilon());
+        if( std::is_same<T, float>::value )
+        {
+            // Emulate single precision arithmetics. Rounding the exact
+            // double result of an operation on floats to float gives the
+            // same result as the operation in single precision.
+            vDiff = V::RoundToFloat(vDiff);
+            vSum = V::RoundToFloat(vSum);
+            vThreshold = V::RoundToFloat(V::Mul(
+                V::RoundToFloat(V::Mul(vEps, V::Abs(vSum))), V::Set1(2.0)));
+        }
+        else
+        {
+            vThreshold = V::Mul(V::Mul(vEps, V::Abs(vSum)), V::Set1(2.0));
+        }
+        const Vec vIsNoData = V::Or(V::CmpEq(v, vNoData),
+                                    V::CmpLt(V::Abs(vDiff), vThreshold));
+        mask = V::AndNot(vIsNoData, mask);
+    }
+    return mask;
+}
+
+/************************************************************************/
+/*                   GDALComputeBlockStatisticsT()                      */
+/************************************************************************/
+
+// Two passes are done on the block: the first one computes the number of
+// valid samples, minimum, maximum and sum, and the second one the sum of
+// the squared differences to the mean.
+template<class V, class T, bool HAS_NODATA, bool COMPUTE_OTHER_STATS>
+void GDALComputeBlockStatisticsT(const T* pData,
+                                 int nXCheck, int nYCheck,
+                                 int nLineStride,
+                                 double dfNoDataValue,
+                                 GDALBlockStatistics& sStats)
+{
+    typedef typename V::Vec Vec;
+    constexpr int N = V::N;
+    const Vec vNoData = V::Set1(dfNoDataValue);
+    const Vec vOne = V::Set1(1.0);
+
+    Vec vMin = V::Set1(std::numeric_limits<double>::max());
+    Vec vMax = V::Set1(-std::numeric_limits<double>::max());
+    Vec vSum = V::Set1(0.0);
+    Vec vCount = V::Set1(0.0);
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
+    double dfSum = 0;
+    GUIntBig nValidCount = 0;
+
+    for( int iY = 0; iY < nYCheck; iY++ )
+    {
+        const T* const pLine =
+            pData + static_cast<GPtrDiff_t>(iY) * nLineStride;
+        int iX = 0;
+        for( ; iX + N <= nXCheck; iX += N )
+        {
+            const Vec v = V::Load(pLine + iX);
+            const Vec mask = GDALStatsValidMask<V, T, HAS_NODATA>(v, vNoData);
+            vMin = V::Blend(mask, V::Min(v, vMin), vMin);
+            vMax = V::Blend(mask, V::Max(v, vMax), vMax);
+            if( COMPUTE_OTHER_STATS )
+            {
+                vSum = V::Add(vSum, V::And(mask, v));
+                vCount = V::Add(vCount, V::And(mask, vOne));
+            }
+        }
+        for( ; iX < nXCheck; iX++ )
+        {
+            const T value = pLine[iX];
+            if( !GDALStatsIsValid<T, HAS_NODATA>(value, dfNoDataValue) )
+                continue;
+            const double dfValue = static_cast<double>(value);
+            dfMin = dfValue < dfMin ? dfValue : dfMin;
+            dfMax = dfValue > dfMax ? dfValue : dfMax;
+            if( COMPUTE_OTHER_STATS )
+            {
+                dfSum += dfValue;
+                nValidCount++;
+            }
+        }
+    }
+
+    double adfMin[N], adfMax[N], adfSum[N], adfCount[N];
+    V::Store(adfMin, vMin);
+    V::Store(adfMax, vMax);
+    V::Store(adfSum, vSum);
+    V::Store(adfCount, vCount);
+    for( int i = 0; i < N; ++i )
+    {
+        dfMin = adfMin[i] < dfMin ? adfMin[i] : dfMin;
+        dfMax = adfMax[i] > dfMax ? adfMax[i] : dfMax;
+        dfSum += adfSum[i];
+        nValidCount += static_cast<GUIntBig>(adfCount[i]);
+    }
+
+    sStats.dfMin = dfMin;
+    sStats.dfMax = dfMax;
+    sStats.nValidCount = nValidCount;
+    sStats.dfMean = 0;
+    sStats.dfM2 = 0;
+    if( !COMPUTE_OTHER_STATS || nValidCount == 0 )
+        return;
+
+    const double dfMean = dfSum / static_cast<double>(nValidCount);
+    const Vec vMean = V::Set1(dfMean);
+    Vec vM2 = V::Set1(0.0);
+    double dfM2 = 0;
+    for( int iY = 0; iY < nYCheck; iY++ )
+    {
+        const T* const pLine =
+            pData + static_cast<GPtrDiff_t>(iY) * nLineStride;
+        int iX = 0;
+        for( ; iX + N <= nXCheck; iX += N )
+        {
+            const Vec v = V::Load(pLine + iX);
+            const Vec mask = GDALStatsValidMask<V, T, HAS_NODATA>(v, vNoData);
+            const Vec vDelta = V::And(mask, V::Sub(v, vMean));
+            vM2 = V::Add(vM2, V::Mul(vDelta, vDelta));
+        }
+        for( ; iX < nXCheck; iX++ )
+        {
+            const T value = pLine[iX];
+            if( !GDALStatsIsValid<T, HAS_NODATA>(value, dfNoDataValue) )
+                continue;
+            const double dfDelta = static_cast<double>(value) - dfMean;
+            dfM2 += dfDelta * dfDelta;
+        }
+    }
+
+    double adfM2[N];
+    V::Store(adfM2, vM2);
+    for( int i = 0; i < N; ++i )
+        dfM2 += adfM2[i];
+
+    sStats.dfMean = dfMean;
+    sStats.dfM2 = dfM2;
+}
+
+template<class V, class T>
+void GDALComputeBlockStatisticsT(const void* pData,
+                                 int nXCheck, int nYCheck,
+                                 int nLineStride,
+                                 bool bHasNoData, double dfNoDataValue,
+                                 bool bComputeOtherStats,
+                                 GDALBlockStatistics& sStats)
+{
+    const T* const pTypedData = static_cast<const T*>(pData);
+    if( bHasNoData )
+    {
+        if( bComputeOtherStats )
+            GDALComputeBlockStatisticsT<V, T, true, true>(
+                pTypedData, nXCheck, nYCheck, nLineStride, dfNoDataValue, sStats);
+        else
+            GDALComputeBlockStatisticsT<V, T, true, false>(
+                pTypedData, nXCheck, nYCheck, nLineStride, dfNoDataValue, sStats);
+    }
+    else
+    {
+        if( bComputeOtherStats )
+            GDALComputeBlockStatisticsT<V, T, false, true>(
+                pTypedData, nXCheck, nYCheck, nLineStride, 0, sStats);
+        else
+            GDALComputeBlockStatisticsT<V, T, false, false>(
+                pTypedData, nXCheck, nYCheck, nLineStride, 0, sStats);
+    }
+}
+
+/************************************************************************/
+/*                    GDALComputeBlockStatisticsSIMD()                  */
+/************************************************************************/
+
+// Computes the statistics of the valid samples of a block of type
+// Int16, Int32, Float32 or Float64. For Float32, dfNoDataValue must be
+// the nodata value as a float (see ComputeFloatNoDataValue()).
+// Returns false if the data type is not handled.
+template<class V>
+bool GDALComputeBlockStatisticsSIMD(GDALDataType eDataType,
+                                    const void* pData,
+                                    int nXCheck, int nYCheck,
+                                    int nLineStride,
+                                    bool bHasNoData, double dfNoDataValue,
+                                    bool bComputeOtherStats,
+                                    GDALBlockStatistics& sStats)
+{
+    switch( eDataType )
+    {
+        case GDT_Int16:
+            GDALComputeBlockStatisticsT<V, GInt16>(
+                pData, nXCheck, nYCheck, nLineStride,
+                bHasNoData, dfNoDataValue, bComputeOtherStats, sStats);
+            return true;
+        case GDT_Int32:
+            GDALComputeBlockStatisticsT<V, GInt32>(
+                pData, nXCheck, nYCheck, nLineStride,
+                bHasNoData, dfNoDataValue, bComputeOtherStats, sStats);
+            return true;
+        case GDT_Float32:
+            GDALComputeBlockStatisticsT<V, float>(
+                pData, nXCheck, nYCheck, nLineStride,
+                bHasNoData, dfNoDataValue, bComputeOtherStats, sStats);
+            return true;
+        case GDT_Float64:
+            GDALComputeBlockStatisticsT<V, double>(
+                pData, nXCheck, nYCheck, nLineStride,
+                bHasNoData, dfNoDataValue, bComputeOtherStats, sStats);
+            return true;
+        default:
+            break;
+    }
+    return false;
+}
+
+} // namespace
+
+#endif // defined(__x86_64) || defined(_M_X64)
+
+//! @endcond
+
+#endif // GDAL_STATS_SIMD_HPP_INCLUDED
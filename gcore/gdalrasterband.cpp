@@ -41,10 +41,14 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <new>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
@@ -52,6 +56,8 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_rat.h"
+#include "gdal_stats_simd.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_priv_templates.hpp"
 
 
@@ -3239,6 +3245,365 @@ static inline void ComputeFloatNoDataValue( GDALDataType eDataType,
     }
 }
 
+/************************************************************************/
+/*                     GetNumThreadsForBlockScan()                      */
+/************************************************************************/
+
+// Number of threads to use to process nBlocks blocks in GetHistogram(),
+// ComputeStatistics() and ComputeRasterMinMax(), from GDAL_NUM_THREADS.
+static int GetNumThreadsForBlockScan(int nBlocks)
+{
+    const int nThreads =
+        CPLGetNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", "1"), 1024);
+    return std::max(1, std::min(nThreads, nBlocks));
+}
+
+/************************************************************************/
+/*                       GDALBlockScanDatasetPool                       */
+/************************************************************************/
+
+namespace {
+
+// Read-only handles on the dataset of a band, opened on demand by the jobs
+// of ScanBlocksInParallel() so that blocks can be decoded concurrently,
+// since a same dataset object cannot be used from several threads.
+// This is opt-in through the GDAL_STATS_REOPEN_DATASET configuration option,
+// and restricted to read-only datasets backed by a local file, as reopening
+// has a cost and would not see in-memory state of the original dataset.
+class GDALBlockScanDatasetPool
+{
+    GDALRasterBand* m_poBand = nullptr;
+    std::string m_osFilename{};
+    std::string m_osDriverName{};
+    CPLStringList m_aosOpenOptions{};
+    CPLStringList m_aosThreadLocalConfigOptions{};
+    std::mutex m_oMutex{};
+    std::vector<GDALDataset*> m_apoFree{};
+    std::vector<GDALDataset*> m_apoAll{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALBlockScanDatasetPool)
+
+    GDALDataset* Open();
+
+  public:
+    explicit GDALBlockScanDatasetPool( GDALRasterBand* poBand ):
+        m_poBand(poBand) {}
+    ~GDALBlockScanDatasetPool();
+
+    bool Init();
+    GDALRasterBand* Acquire();
+    void Release( GDALRasterBand* poBand );
+
+    // Thread-local configuration options of the thread that created the pool
+    CSLConstList GetThreadLocalConfigOptions() const
+        { return m_aosThreadLocalConfigOptions.List(); }
+};
+
+// Installs thread-local configuration options for the lifetime of the object,
+// and restores the previous ones afterwards.
+class GDALThreadLocalConfigOptionsSetter
+{
+    char** m_papszOldOptions = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadLocalConfigOptionsSetter)
+
+  public:
+    explicit GDALThreadLocalConfigOptionsSetter( CSLConstList papszOptions ):
+        m_papszOldOptions(CPLGetThreadLocalConfigOptions())
+    {
+        CPLSetThreadLocalConfigOptions(papszOptions);
+    }
+
+    ~GDALThreadLocalConfigOptionsSetter()
+    {
+        CPLSetThreadLocalConfigOptions(m_papszOldOptions);
+        CSLDestroy(m_papszOldOptions);
+    }
+};
+
+GDALBlockScanDatasetPool::~GDALBlockScanDatasetPool()
+{
+    for( auto poDS: m_apoAll )
+        GDALClose( GDALDataset::ToHandle(poDS) );
+}
+
+// Check that reopening is allowed, that the band belongs to a read-only
+// dataset backed by a local file, and open a first handle.
+bool GDALBlockScanDatasetPool::Init()
+{
+    if( !CPLTestBool(CPLGetConfigOption("GDAL_STATS_REOPEN_DATASET", "NO")) )
+        return false;
+
+    GDALDataset* poDS = m_poBand->GetDataset();
+    const int nBand = m_poBand->GetBand();
+    if( poDS == nullptr || nBand <= 0 ||
+        poDS->GetRasterBand(nBand) != m_poBand ||
+        poDS->GetAccess() != GA_ReadOnly ||
+        poDS->GetDescription()[0] == '\0' ||
+        poDS->GetDriver() == nullptr ||
+        EQUAL(poDS->GetDriver()->GetDescription(), "MEM") ||
+        EQUAL(poDS->GetDriver()->GetDescription(), "VRT") ||
+        STARTS_WITH(poDS->GetDescription(), "/vsimem/") ||
+        !VSIIsLocal(poDS->GetDescription()) )
+    {
+        return false;
+    }
+    VSIStatBufL sStat;
+    if( VSIStatExL(poDS->GetDescription(), &sStat,
+                   VSI_STAT_EXISTS_FLAG | VSI_STAT_NATURE_FLAG) != 0 ||
+        !VSI_ISREG(sStat.st_mode) )
+    {
+        return false;
+    }
+    m_osFilename = poDS->GetDescription();
+    m_osDriverName = poDS->GetDriver()->GetDescription();
+    m_aosOpenOptions.Assign(CSLDuplicate(poDS->GetOpenOptions()), true);
+    m_aosThreadLocalConfigOptions.Assign(CPLGetThreadLocalConfigOptions(), true);
+
+    GDALDataset* poNewDS = Open();
+    if( poNewDS == nullptr )
+        return false;
+    m_apoFree.push_back(poNewDS);
+    return true;
+}
+
+GDALDataset* GDALBlockScanDatasetPool::Open()
+{
+    const char* const apszAllowedDrivers[] = { m_osDriverName.c_str(),
+                                               nullptr };
+    GDALDataset* poDS;
+    {
+        CPLErrorHandlerPusher oPusher(CPLQuietErrorHandler);
+        CPLErrorStateBackuper oErrorStateBackuper;
+        poDS = GDALDataset::Open(m_osFilename.c_str(),
+                                 GDAL_OF_RASTER | GDAL_OF_READONLY,
+                                 apszAllowedDrivers,
+                                 m_aosOpenOptions.List());
+    }
+    if( poDS == nullptr )
+        return nullptr;
+
+    // Make sure that we got the same raster
+    const int nBand = m_poBand->GetBand();
+    GDALRasterBand* poNewBand =
+        nBand <= poDS->GetRasterCount() ? poDS->GetRasterBand(nBand) : nullptr;
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    int nNewBlockXSize = 0;
+    int nNewBlockYSize = 0;
+    m_poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    if( poNewBand )
+        poNewBand->GetBlockSize(&nNewBlockXSize, &nNewBlockYSize);
+    if( poNewBand == nullptr ||
+        poNewBand->GetXSize() != m_poBand->GetXSize() ||
+        poNewBand->GetYSize() != m_poBand->GetYSize() ||
+        poNewBand->GetRasterDataType() != m_poBand->GetRasterDataType() ||
+        nNewBlockXSize != nBlockXSize ||
+        nNewBlockYSize != nBlockYSize )
+    {
+        GDALClose( GDALDataset::ToHandle(poDS) );
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_apoAll.push_back(poDS);
+    return poDS;
+}
+
+// Returns a band of a dataset handle that is not used by another thread.
+GDALRasterBand* GDALBlockScanDatasetPool::Acquire()
+{
+    GDALDataset* poDS = nullptr;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if( !m_apoFree.empty() )
+        {
+            poDS = m_apoFree.back();
+            m_apoFree.pop_back();
+        }
+    }
+    if( poDS == nullptr )
+        poDS = Open();
+    return poDS ? poDS->GetRasterBand(m_poBand->GetBand()) : nullptr;
+}
+
+void GDALBlockScanDatasetPool::Release( GDALRasterBand* poBand )
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_apoFree.push_back(poBand->GetDataset());
+}
+
+} // namespace
+
+/************************************************************************/
+/*                        ScanBlocksInParallel()                        */
+/************************************************************************/
+
+// Process the blocks 0, nSampleRate, 2 * nSampleRate, ... of poBand.
+// When GDAL_STATS_REOPEN_DATASET=YES and the dataset of poBand can be
+// reopened, blocks are fetched and decoded by the jobs themselves on the
+// global thread pool, from per-thread read-only dataset handles. Otherwise, and for any block a job could not fetch, they
+// are fetched from the calling thread. fnCompute(pData, nXCheck, nYCheck,
+// oAccum) is run against a per-block accumulator initialized from oInitAccum.
+// fnMerge(oAccum, iSampleBlock) is then called from the calling thread, in
+// block order so that results do not depend on scheduling. It may return
+// false to stop the iteration.
+// When called from a worker thread of the global thread pool, blocks are
+// processed serially, so as not to wait on the pool we are running on.
+// Returns false if a block could not be read.
+template<class Accumulator, class ComputeFunc, class MergeFunc>
+static bool ScanBlocksInParallel(GDALRasterBand* poBand, int nThreads,
+                                 int nTotalBlocks, int nSampleRate,
+                                 int nBlocksPerRow,
+                                 const Accumulator& oInitAccum,
+                                 const ComputeFunc& fnCompute,
+                                 const MergeFunc& fnMerge)
+{
+    struct Job
+    {
+        const ComputeFunc* pfnCompute;
+        GDALBlockScanDatasetPool* poDatasetPool;
+        GDALRasterBlock* poBlock;
+        int iXBlock;
+        int iYBlock;
+        int iSampleBlock;
+        int nXCheck;
+        int nYCheck;
+        bool bDone;
+        Accumulator oAccum;
+
+        static void Run(void* pData)
+        {
+            Job* psJob = static_cast<Job*>(pData);
+            if( psJob->poBlock == nullptr )
+            {
+                // Errors are reported when the calling thread retries.
+                CPLErrorHandlerPusher oPusher(CPLQuietErrorHandler);
+                CPLErrorStateBackuper oErrorStateBackuper;
+                // Open and decode with the configuration options of the
+                // calling thread.
+                GDALThreadLocalConfigOptionsSetter oConfigOptionsSetter(
+                    psJob->poDatasetPool->GetThreadLocalConfigOptions());
+                GDALRasterBand* poJobBand = psJob->poDatasetPool->Acquire();
+                if( poJobBand == nullptr )
+                    return;
+                GDALRasterBlock* poBlock = poJobBand->GetLockedBlockRef(
+                    psJob->iXBlock, psJob->iYBlock );
+                if( poBlock )
+                {
+                    (*psJob->pfnCompute)(poBlock->GetDataRef(),
+                                         psJob->nXCheck, psJob->nYCheck,
+                                         psJob->oAccum);
+                    poBlock->DropLock();
+                    psJob->bDone = true;
+                }
+                psJob->poDatasetPool->Release(poJobBand);
+                return;
+            }
+            (*psJob->pfnCompute)(psJob->poBlock->GetDataRef(),
+                                 psJob->nXCheck, psJob->nYCheck,
+                                 psJob->oAccum);
+            psJob->bDone = true;
+        }
+    };
+
+    CPLWorkerThreadPool* poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if( poThreadPool && poThreadPool->IsCurrentThreadWorker() )
+        poThreadPool = nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    std::unique_ptr<GDALBlockScanDatasetPool> poDatasetPool;
+    if( poQueue )
+    {
+        poDatasetPool.reset(new GDALBlockScanDatasetPool(poBand));
+        if( poDatasetPool->Init() )
+            CPLDebug("GDAL", "Decoding blocks of %s from %d threads",
+                     poBand->GetDataset()->GetDescription(), nThreads);
+        else
+            poDatasetPool.reset();
+    }
+
+    // Keep a few blocks per thread in flight, so that the next blocks can
+    // be read while the previous ones are being processed.
+    const int nMaxJobs = 2 * nThreads;
+    std::vector<Job> asJobs(nMaxJobs);
+    bool bRet = true;
+    bool bStop = false;
+    int iSampleBlock = 0;
+
+    // Fetch the block of a job from the calling thread and process it.
+    const auto RunFromCallingThread = [poBand, &bRet, &bStop](Job& sJob)
+    {
+        sJob.poBlock = poBand->GetLockedBlockRef( sJob.iXBlock, sJob.iYBlock );
+        if( sJob.poBlock == nullptr )
+        {
+            bRet = false;
+            bStop = true;
+            return;
+        }
+        Job::Run(&sJob);
+    };
+
+    while( !bStop && iSampleBlock < nTotalBlocks )
+    {
+        int nJobs = 0;
+        for( ; nJobs < nMaxJobs && iSampleBlock < nTotalBlocks;
+             iSampleBlock += nSampleRate )
+        {
+            Job& sJob = asJobs[nJobs];
+            sJob.pfnCompute = &fnCompute;
+            sJob.poDatasetPool = poDatasetPool.get();
+            sJob.poBlock = nullptr;
+            sJob.iYBlock = iSampleBlock / nBlocksPerRow;
+            sJob.iXBlock = iSampleBlock - nBlocksPerRow * sJob.iYBlock;
+            sJob.iSampleBlock = iSampleBlock;
+            sJob.bDone = false;
+            poBand->GetActualBlockSize(sJob.iXBlock, sJob.iYBlock,
+                                       &sJob.nXCheck, &sJob.nYCheck);
+            sJob.oAccum = oInitAccum;
+
+            if( poDatasetPool == nullptr )
+            {
+                sJob.poBlock = poBand->GetLockedBlockRef( sJob.iXBlock,
+                                                          sJob.iYBlock );
+                if( sJob.poBlock == nullptr )
+                {
+                    bRet = false;
+                    bStop = true;
+                    break;
+                }
+            }
+            ++nJobs;
+            if( !(poQueue && poQueue->SubmitJob(Job::Run, &sJob)) )
+            {
+                if( sJob.poBlock )
+                    Job::Run(&sJob);
+                else
+                    RunFromCallingThread(sJob);
+            }
+            if( bStop )
+                break;
+        }
+
+        if( poQueue )
+            poQueue->WaitCompletion();
+
+        for( int i = 0; i < nJobs; ++i )
+        {
+            if( !bStop && !asJobs[i].bDone )
+                RunFromCallingThread(asJobs[i]);
+            if( !bStop && asJobs[i].bDone &&
+                !fnMerge(asJobs[i].oAccum, asJobs[i].iSampleBlock) )
+            {
+                bStop = true;
+            }
+            if( asJobs[i].poBlock )
+                asJobs[i].poBlock->DropLock();
+        }
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                            GetHistogram()                            */
 /************************************************************************/
@@ -3265,6 +3630,10 @@ static inline void ComputeFloatNoDataValue( GDALDataType eDataType,
  * in generating histogram based luts for instance.  Generally bApproxOK is
  * much faster than an exactly computed histogram.
  *
+ * Starting with GDAL 3.7, the GDAL_NUM_THREADS configuration option can be set
+ * to "ALL_CPUS" or a integer value to specify the number of threads to use to
+ * process blocks.
+ *
  * This method is the same as the C functions GDALGetRasterHistogram() and
  * GDALGetRasterHistogramEx().
  *
@@ -3559,28 +3928,10 @@ CPLErr GDALRasterBand::GetHistogram( double dfMin, double dfMax,
 /* -------------------------------------------------------------------- */
 /*      Read the blocks, and add to histogram.                          */
 /* -------------------------------------------------------------------- */
-        for( int iSampleBlock = 0;
-             iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-             iSampleBlock += nSampleRate )
+        const auto ComputeHistogramForBlock = [&](const void* pData,
+                                                  int nXCheck, int nYCheck,
+                                                  GUIntBig* panCounts)
         {
-            if( !pfnProgress(
-                    iSampleBlock /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Histogram", pProgressData ) )
-                return CE_Failure;
-
-            const int iYBlock = iSampleBlock / nBlocksPerRow;
-            const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-            GDALRasterBlock *poBlock = GetLockedBlockRef( iXBlock, iYBlock );
-            if( poBlock == nullptr )
-                return CE_Failure;
-
-            void *pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
             // this is a special case for a common situation.
             if( eDataType == GDT_Byte && !bSignedByte
                 && dfScale == 1.0 && (dfMin >= -0.5 && dfMin <= 0.5)
@@ -3588,17 +3939,16 @@ CPLErr GDALRasterBand::GetHistogram( double dfMin, double dfMax,
                 && nBuckets == 256 )
             {
                 const GPtrDiff_t nPixels = static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
-                GByte *pabyData = static_cast<GByte *>(pData);
+                const GByte *pabyData = static_cast<const GByte *>(pData);
 
                 for( GPtrDiff_t i = 0; i < nPixels; i++ )
                     if( ! (bGotNoDataValue &&
                            (pabyData[i] == static_cast<GByte>(dfNoDataValue))))
                     {
-                        panHistogram[pabyData[i]]++;
+                        panCounts[pabyData[i]]++;
                     }
 
-                poBlock->DropLock();
-                continue;  // To next sample block.
+                return;
             }
 
             // This isn't the fastest way to do this, but is easier for now.
@@ -3615,35 +3965,35 @@ CPLErr GDALRasterBand::GetHistogram( double dfMin, double dfMax,
                       {
                         if( bSignedByte )
                             dfValue =
-                                static_cast<signed char *>(pData)[iOffset];
+                                static_cast<const signed char *>(pData)[iOffset];
                         else
-                            dfValue = static_cast<GByte *>(pData)[iOffset];
+                            dfValue = static_cast<const GByte *>(pData)[iOffset];
                         break;
                       }
                       case GDT_Int8:
-                        dfValue = static_cast<GInt8 *>(pData)[iOffset];
+                        dfValue = static_cast<const GInt8 *>(pData)[iOffset];
                         break;
                       case GDT_UInt16:
-                        dfValue = static_cast<GUInt16 *>(pData)[iOffset];
+                        dfValue = static_cast<const GUInt16 *>(pData)[iOffset];
                         break;
                       case GDT_Int16:
-                        dfValue = static_cast<GInt16 *>(pData)[iOffset];
+                        dfValue = static_cast<const GInt16 *>(pData)[iOffset];
                         break;
                       case GDT_UInt32:
-                        dfValue = static_cast<GUInt32 *>(pData)[iOffset];
+                        dfValue = static_cast<const GUInt32 *>(pData)[iOffset];
                         break;
                       case GDT_Int32:
-                        dfValue = static_cast<GInt32 *>(pData)[iOffset];
+                        dfValue = static_cast<const GInt32 *>(pData)[iOffset];
                         break;
                       case GDT_UInt64:
-                        dfValue = static_cast<double>(static_cast<GUInt64 *>(pData)[iOffset]);
+                        dfValue = static_cast<double>(static_cast<const GUInt64 *>(pData)[iOffset]);
                         break;
                       case GDT_Int64:
-                        dfValue = static_cast<double>(static_cast<GInt64 *>(pData)[iOffset]);
+                        dfValue = static_cast<double>(static_cast<const GInt64 *>(pData)[iOffset]);
                         break;
                       case GDT_Float32:
                       {
-                        const float fValue = static_cast<float *>(pData)[iOffset];
+                        const float fValue = static_cast<const float *>(pData)[iOffset];
                         if( CPLIsNan(fValue) ||
                             (bGotFloatNoDataValue && ARE_REAL_EQUAL(fValue, fNoDataValue)) )
                             continue;
@@ -3651,34 +4001,34 @@ CPLErr GDALRasterBand::GetHistogram( double dfMin, double dfMax,
                         break;
                       }
                       case GDT_Float64:
-                        dfValue = static_cast<double *>(pData)[iOffset];
+                        dfValue = static_cast<const double *>(pData)[iOffset];
                         if( CPLIsNan(dfValue) )
                             continue;
                         break;
                       case GDT_CInt16:
                         {
                             double  dfReal =
-                                static_cast<GInt16 *>(pData)[iOffset*2];
+                                static_cast<const GInt16 *>(pData)[iOffset*2];
                             double  dfImag =
-                                static_cast<GInt16 *>(pData)[iOffset*2+1];
+                                static_cast<const GInt16 *>(pData)[iOffset*2+1];
                             dfValue = sqrt( dfReal * dfReal + dfImag * dfImag );
                         }
                         break;
                       case GDT_CInt32:
                         {
                             double  dfReal =
-                                static_cast<GInt32 *>(pData)[iOffset*2];
+                                static_cast<const GInt32 *>(pData)[iOffset*2];
                             double  dfImag =
-                                static_cast<GInt32 *>(pData)[iOffset*2+1];
+                                static_cast<const GInt32 *>(pData)[iOffset*2+1];
                             dfValue = sqrt( dfReal * dfReal + dfImag * dfImag );
                         }
                         break;
                       case GDT_CFloat32:
                         {
                             double  dfReal =
-                                static_cast<float *>(pData)[iOffset*2];
+                                static_cast<const float *>(pData)[iOffset*2];
                             double  dfImag =
-                                static_cast<float *>(pData)[iOffset*2+1];
+                                static_cast<const float *>(pData)[iOffset*2+1];
                             if ( CPLIsNan(dfReal) || CPLIsNan(dfImag) )
                                 continue;
                             dfValue = sqrt( dfReal * dfReal + dfImag * dfImag );
@@ -3687,9 +4037,9 @@ CPLErr GDALRasterBand::GetHistogram( double dfMin, double dfMax,
                       case GDT_CFloat64:
                         {
                             double  dfReal =
-                                static_cast<double *>(pData)[iOffset*2];
+                                static_cast<const double *>(pData)[iOffset*2];
                             double  dfImag =
-                                static_cast<double *>(pData)[iOffset*2+1];
+                                static_cast<const double *>(pData)[iOffset*2+1];
                             if ( CPLIsNan(dfReal) || CPLIsNan(dfImag) )
                                 continue;
                             dfValue = sqrt( dfReal * dfReal + dfImag * dfImag );
@@ -3698,7 +4048,7 @@ CPLErr GDALRasterBand::GetHistogram( double dfMin, double dfMax,
                       case GDT_Unknown:
                       case GDT_TypeCount:
                         CPLAssert( false );
-                        return CE_Failure;
+                        return;
                     }
 
                     if( eDataType != GDT_Float32 && bGotNoDataValue &&
@@ -3712,21 +4062,80 @@ CPLErr GDALRasterBand::GetHistogram( double dfMin, double dfMax,
                     if( dfIndex < 0 )
                     {
                         if( bIncludeOutOfRange )
-                            panHistogram[0]++;
+                            panCounts[0]++;
                     }
                     else if( dfIndex >= nBuckets )
                     {
                         if( bIncludeOutOfRange )
-                            ++panHistogram[nBuckets-1];
+                            ++panCounts[nBuckets-1];
                     }
                     else
                     {
-                        ++panHistogram[static_cast<int>(dfIndex)];
+                        ++panCounts[static_cast<int>(dfIndex)];
                     }
                 }
             }
+        };
 
-            poBlock->DropLock();
+        const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
+        const int nThreads = GetNumThreadsForBlockScan(
+            DIV_ROUND_UP(nTotalBlocks, nSampleRate));
+        if( nThreads > 1 )
+        {
+            bool bInterrupted = false;
+            const std::vector<GUIntBig> anInitCounts(nBuckets);
+            if( !ScanBlocksInParallel(this, nThreads, nTotalBlocks,
+                    nSampleRate, nBlocksPerRow, anInitCounts,
+                    [&ComputeHistogramForBlock](const void* pData,
+                                                int nXCheck, int nYCheck,
+                                                std::vector<GUIntBig>& anCounts)
+                    {
+                        ComputeHistogramForBlock(pData, nXCheck, nYCheck,
+                                                 anCounts.data());
+                    },
+                    [&](const std::vector<GUIntBig>& anCounts, int iSampleBlock)
+                    {
+                        for( int i = 0; i < nBuckets; ++i )
+                            panHistogram[i] += anCounts[i];
+                        if( !pfnProgress(
+                                iSampleBlock / static_cast<double>(nTotalBlocks),
+                                "Compute Histogram", pProgressData ) )
+                        {
+                            bInterrupted = true;
+                            return false;
+                        }
+                        return true;
+                    }) || bInterrupted )
+            {
+                return CE_Failure;
+            }
+        }
+        else
+        {
+            for( int iSampleBlock = 0;
+                 iSampleBlock < nTotalBlocks;
+                 iSampleBlock += nSampleRate )
+            {
+                if( !pfnProgress(
+                        iSampleBlock / static_cast<double>(nTotalBlocks),
+                        "Compute Histogram", pProgressData ) )
+                    return CE_Failure;
+
+                const int iYBlock = iSampleBlock / nBlocksPerRow;
+                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+
+                GDALRasterBlock *poBlock = GetLockedBlockRef( iXBlock, iYBlock );
+                if( poBlock == nullptr )
+                    return CE_Failure;
+
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+                ComputeHistogramForBlock(poBlock->GetDataRef(),
+                                         nXCheck, nYCheck, panHistogram);
+
+                poBlock->DropLock();
+            }
         }
     }
 
@@ -5352,6 +5761,84 @@ inline double GetPixelValue( GDALDataType eDataType,
     return dfValue;
 }
 
+/************************************************************************/
+/*                         GDALWelfordStats                             */
+/************************************************************************/
+
+namespace {
+// Running min, max, mean and sum of squared differences to the mean.
+struct GDALWelfordStats
+{
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;
+    GUIntBig nValidCount = 0;
+    GUIntBig nSampleCount = 0;
+
+    // Welford update, see ComputeStatistics()
+    inline void Insert(double dfValue)
+    {
+        dfMin = std::min(dfMin, dfValue);
+        dfMax = std::max(dfMax, dfValue);
+
+        nValidCount++;
+        const double dfDelta = dfValue - dfMean;
+        dfMean += dfDelta / nValidCount;
+        dfM2 += dfDelta * (dfValue - dfMean);
+    }
+
+    // Combine with statistics computed on another set of samples, using
+    // the pairwise formula of Chan et al.
+    void Merge(const GDALWelfordStats& other)
+    {
+        nSampleCount += other.nSampleCount;
+        if( other.nValidCount == 0 )
+            return;
+        dfMin = std::min(dfMin, other.dfMin);
+        dfMax = std::max(dfMax, other.dfMax);
+        const double dfN1 = static_cast<double>(nValidCount);
+        const double dfN2 = static_cast<double>(other.nValidCount);
+        const double dfN = dfN1 + dfN2;
+        const double dfDelta = other.dfMean - dfMean;
+        dfMean += dfDelta * (dfN2 / dfN);
+        dfM2 += other.dfM2 + dfDelta * dfDelta * (dfN1 * dfN2 / dfN);
+        nValidCount += other.nValidCount;
+    }
+};
+} // namespace
+
+/************************************************************************/
+/*                       ComputeBlockStatistics()                       */
+/************************************************************************/
+
+#ifdef HAVE_GDAL_BLOCK_STATISTICS_SIMD
+// Vectorized computation of the statistics of a block of Int16, Int32,
+// Float32 or Float64 data, using AVX2 when available at runtime, or SSE2.
+// For Float32, the nodata value must be the one computed by
+// ComputeFloatNoDataValue(). Returns false for other data types.
+static bool ComputeBlockStatistics( GDALDataType eDataType,
+                                    const void* pData,
+                                    int nXCheck, int nYCheck,
+                                    int nLineStride,
+                                    bool bHasNoData, double dfNoDataValue,
+                                    bool bComputeOtherStats,
+                                    GDALBlockStatistics& sStats )
+{
+#ifdef HAVE_AVX2_AT_COMPILE_TIME
+    if( CPLHaveRuntimeAVX2() )
+    {
+        return GDALComputeBlockStatistics_AVX2(
+            eDataType, pData, nXCheck, nYCheck, nLineStride,
+            bHasNoData, dfNoDataValue, bComputeOtherStats, sStats);
+    }
+#endif
+    return GDALComputeBlockStatisticsSIMD<GDALStatsVecSSE2>(
+        eDataType, pData, nXCheck, nYCheck, nLineStride,
+        bHasNoData, dfNoDataValue, bComputeOtherStats, sStats);
+}
+#endif
+
 /************************************************************************/
 /*                         SetValidPercent()                            */
 /************************************************************************/
@@ -5417,6 +5904,11 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount, GUIntBig nValidCount
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.7, the GDAL_NUM_THREADS configuration option can be set
+ * to "ALL_CPUS" or a integer value to specify the number of threads to use to
+ * process blocks in the generic implementation. Blocks are still read from
+ * the calling thread.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -5640,10 +6132,6 @@ GDALRasterBand::ComputeStatistics( int bApproxOK,
                         (static_cast<GUInt64>(nBlockXSize) * static_cast<GUInt64>(nBlockYSize))) )
         {
             const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
-            GUInt32 nMin = nMaxValueType;
-            GUInt32 nMax = 0;
-            GUIntBig nSum = 0;
-            GUIntBig nSumSquare = 0;
             // If no valid nodata, map to invalid value (256 for Byte)
             const GUInt32 nNoDataValue =
                 (bGotNoDataValue && dfNoDataValue >= 0 &&
@@ -5653,23 +6141,23 @@ GDALRasterBand::ComputeStatistics( int bApproxOK,
                             static_cast<GUInt32>(dfNoDataValue + 1e-10) :
                             nMaxValueType+1;
 
-            for( int iSampleBlock = 0;
-                iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-                iSampleBlock += nSampleRate )
+            struct IntegerStats
+            {
+                GUInt32 nMin;
+                GUInt32 nMax;
+                GUIntBig nSum;
+                GUIntBig nSumSquare;
+                GUIntBig nSampleCount;
+                GUIntBig nValidCount;
+            };
+            const IntegerStats sInitStats = { nMaxValueType, 0, 0, 0, 0, 0 };
+            IntegerStats sStats = sInitStats;
+
+            const auto ComputeStatsForBlock = [this, nNoDataValue,
+                                               nMaxValueType](
+                const void* pData, int nXCheck, int nYCheck,
+                IntegerStats& sBlockStats)
             {
-                const int iYBlock = iSampleBlock / nBlocksPerRow;
-                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-                GDALRasterBlock * const poBlock =
-                    GetLockedBlockRef( iXBlock, iYBlock );
-                if( poBlock == nullptr )
-                    return CE_Failure;
-
-                void* const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
                 if( eDataType == GDT_Byte )
                 {
                     ComputeStatisticsInternal<GByte, /* COMPUTE_OTHER_STATS = */ true>::f(
@@ -5679,10 +6167,12 @@ GDALRasterBand::ComputeStatistics( int bApproxOK,
                                                static_cast<const GByte*>(pData),
                                                nNoDataValue <= nMaxValueType,
                                                nNoDataValue,
-                                               nMin, nMax, nSum,
-                                               nSumSquare,
-                                               nSampleCount,
-                                               nValidCount );
+                                               sBlockStats.nMin,
+                                               sBlockStats.nMax,
+                                               sBlockStats.nSum,
+                                               sBlockStats.nSumSquare,
+                                               sBlockStats.nSampleCount,
+                                               sBlockStats.nValidCount );
                 }
                 else
                 {
@@ -5693,23 +6183,90 @@ GDALRasterBand::ComputeStatistics( int bApproxOK,
                                                static_cast<const GUInt16*>(pData),
                                                nNoDataValue <= nMaxValueType,
                                                nNoDataValue,
-                                               nMin, nMax, nSum,
-                                               nSumSquare,
-                                               nSampleCount,
-                                               nValidCount );
+                                               sBlockStats.nMin,
+                                               sBlockStats.nMax,
+                                               sBlockStats.nSum,
+                                               sBlockStats.nSumSquare,
+                                               sBlockStats.nSampleCount,
+                                               sBlockStats.nValidCount );
                 }
+            };
 
-                poBlock->DropLock();
-
-                if ( !pfnProgress( iSampleBlock
-                        / static_cast<double>(nBlocksPerRow*nBlocksPerColumn),
-                        "Compute Statistics", pProgressData) )
+            const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
+            const int nThreads = GetNumThreadsForBlockScan(
+                DIV_ROUND_UP(nTotalBlocks, nSampleRate));
+            if( nThreads > 1 )
+            {
+                bool bInterrupted = false;
+                if( !ScanBlocksInParallel(this, nThreads, nTotalBlocks,
+                        nSampleRate, nBlocksPerRow, sInitStats,
+                        ComputeStatsForBlock,
+                        [&](const IntegerStats& sBlockStats, int iSampleBlock)
+                        {
+                            sStats.nMin = std::min(sStats.nMin, sBlockStats.nMin);
+                            sStats.nMax = std::max(sStats.nMax, sBlockStats.nMax);
+                            sStats.nSum += sBlockStats.nSum;
+                            sStats.nSumSquare += sBlockStats.nSumSquare;
+                            sStats.nSampleCount += sBlockStats.nSampleCount;
+                            sStats.nValidCount += sBlockStats.nValidCount;
+                            if ( !pfnProgress( iSampleBlock
+                                    / static_cast<double>(nTotalBlocks),
+                                    "Compute Statistics", pProgressData) )
+                            {
+                                bInterrupted = true;
+                                return false;
+                            }
+                            return true;
+                        }) )
+                {
+                    return CE_Failure;
+                }
+                if( bInterrupted )
                 {
                     ReportError( CE_Failure, CPLE_UserInterrupt,
                                  "User terminated" );
                     return CE_Failure;
                 }
             }
+            else
+            {
+                for( int iSampleBlock = 0;
+                    iSampleBlock < nTotalBlocks;
+                    iSampleBlock += nSampleRate )
+                {
+                    const int iYBlock = iSampleBlock / nBlocksPerRow;
+                    const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+
+                    GDALRasterBlock * const poBlock =
+                        GetLockedBlockRef( iXBlock, iYBlock );
+                    if( poBlock == nullptr )
+                        return CE_Failure;
+
+                    int nXCheck = 0, nYCheck = 0;
+                    GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+                    ComputeStatsForBlock(poBlock->GetDataRef(),
+                                         nXCheck, nYCheck, sStats);
+
+                    poBlock->DropLock();
+
+                    if ( !pfnProgress( iSampleBlock
+                            / static_cast<double>(nTotalBlocks),
+                            "Compute Statistics", pProgressData) )
+                    {
+                        ReportError( CE_Failure, CPLE_UserInterrupt,
+                                     "User terminated" );
+                        return CE_Failure;
+                    }
+                }
+            }
+
+            const GUInt32 nMin = sStats.nMin;
+            const GUInt32 nMax = sStats.nMax;
+            const GUIntBig nSum = sStats.nSum;
+            const GUIntBig nSumSquare = sStats.nSumSquare;
+            nSampleCount = sStats.nSampleCount;
+            nValidCount = sStats.nValidCount;
 
             if( !pfnProgress( 1.0, "Compute Statistics", pProgressData ) )
             {
@@ -5774,21 +6331,30 @@ GDALRasterBand::ComputeStatistics( int bApproxOK,
         }
 #endif
 
-        for( int iSampleBlock = 0;
-             iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-             iSampleBlock += nSampleRate )
+        const auto ComputeStatsForBlock = [&](const void* pData,
+                                              int nXCheck, int nYCheck,
+                                              GDALWelfordStats& sBlockStats)
         {
-            const int iYBlock = iSampleBlock / nBlocksPerRow;
-            const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-            GDALRasterBlock * const poBlock = GetLockedBlockRef( iXBlock, iYBlock );
-            if( poBlock == nullptr )
-                return CE_Failure;
-
-            void* const pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+#ifdef HAVE_GDAL_BLOCK_STATISTICS_SIMD
+            GDALBlockStatistics sSIMDStats;
+            if( ComputeBlockStatistics(
+                    eDataType, pData, nXCheck, nYCheck, nBlockXSize,
+                    eDataType == GDT_Float32 ? bGotFloatNoDataValue :
+                                               CPL_TO_BOOL(bGotNoDataValue),
+                    eDataType == GDT_Float32 ? fNoDataValue : dfNoDataValue,
+                    /* bComputeOtherStats = */ true, sSIMDStats) )
+            {
+                GDALWelfordStats sOther;
+                sOther.dfMin = sSIMDStats.dfMin;
+                sOther.dfMax = sSIMDStats.dfMax;
+                sOther.dfMean = sSIMDStats.dfMean;
+                sOther.dfM2 = sSIMDStats.dfM2;
+                sOther.nValidCount = sSIMDStats.nValidCount;
+                sOther.nSampleCount = static_cast<GUIntBig>(nXCheck) * nYCheck;
+                sBlockStats.Merge(sOther);
+                return;
+            }
+#endif
 
             // This isn't the fastest way to do this, but is easier for now.
             for( int iY = 0; iY < nYCheck; iY++ )
@@ -5810,29 +6376,83 @@ GDALRasterBand::ComputeStatistics( int bApproxOK,
                     if( !bValid )
                         continue;
 
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
-
-                    nValidCount++;
-                    const double dfDelta = dfValue - dfMean;
-                    dfMean += dfDelta / nValidCount;
-                    dfM2 += dfDelta * (dfValue - dfMean);
+                    sBlockStats.Insert(dfValue);
                 }
             }
 
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-
-            poBlock->DropLock();
+            sBlockStats.nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+        };
 
-            if ( !pfnProgress(
-                     iSampleBlock
-                         / static_cast<double>(nBlocksPerRow*nBlocksPerColumn),
-                     "Compute Statistics", pProgressData) )
+        GDALWelfordStats sStats;
+        const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
+        const int nThreads = GetNumThreadsForBlockScan(
+            DIV_ROUND_UP(nTotalBlocks, nSampleRate));
+        if( nThreads > 1 )
+        {
+            // Each block is accumulated separately, and the partial results
+            // are combined in block order.
+            bool bInterrupted = false;
+            if( !ScanBlocksInParallel(this, nThreads, nTotalBlocks,
+                    nSampleRate, nBlocksPerRow, GDALWelfordStats(),
+                    ComputeStatsForBlock,
+                    [&](const GDALWelfordStats& sBlockStats, int iSampleBlock)
+                    {
+                        sStats.Merge(sBlockStats);
+                        if ( !pfnProgress( iSampleBlock
+                                / static_cast<double>(nTotalBlocks),
+                                "Compute Statistics", pProgressData) )
+                        {
+                            bInterrupted = true;
+                            return false;
+                        }
+                        return true;
+                    }) )
+            {
+                return CE_Failure;
+            }
+            if( bInterrupted )
             {
                 ReportError( CE_Failure, CPLE_UserInterrupt, "User terminated" );
                 return CE_Failure;
             }
         }
+        else
+        {
+            for( int iSampleBlock = 0;
+                 iSampleBlock < nTotalBlocks;
+                 iSampleBlock += nSampleRate )
+            {
+                const int iYBlock = iSampleBlock / nBlocksPerRow;
+                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+
+                GDALRasterBlock * const poBlock = GetLockedBlockRef( iXBlock, iYBlock );
+                if( poBlock == nullptr )
+                    return CE_Failure;
+
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+                ComputeStatsForBlock(poBlock->GetDataRef(),
+                                     nXCheck, nYCheck, sStats);
+
+                poBlock->DropLock();
+
+                if ( !pfnProgress(
+                         iSampleBlock / static_cast<double>(nTotalBlocks),
+                         "Compute Statistics", pProgressData) )
+                {
+                    ReportError( CE_Failure, CPLE_UserInterrupt, "User terminated" );
+                    return CE_Failure;
+                }
+            }
+        }
+
+        dfMin = sStats.dfMin;
+        dfMax = sStats.dfMax;
+        dfMean = sStats.dfMean;
+        dfM2 = sStats.dfM2;
+        nValidCount = sStats.nValidCount;
+        nSampleCount = sStats.nSampleCount;
     }
 
     if( !pfnProgress( 1.0, "Compute Statistics", pProgressData ) )
@@ -6080,6 +6700,20 @@ static void ComputeMinMaxGeneric(const void* pData,
                                  float fNoDataValue,
                                  double &dfMin, double& dfMax)
 {
+#ifdef HAVE_GDAL_BLOCK_STATISTICS_SIMD
+    GDALBlockStatistics sStats;
+    if( ComputeBlockStatistics(
+            eDataType, pData, nXCheck, nYCheck, nBlockXSize,
+            eDataType == GDT_Float32 ? bGotFloatNoDataValue : bGotNoDataValue,
+            eDataType == GDT_Float32 ? fNoDataValue : dfNoDataValue,
+            /* bComputeOtherStats = */ false, sStats) )
+    {
+        dfMin = std::min(dfMin, sStats.dfMin);
+        dfMax = std::max(dfMax, sStats.dfMax);
+        return;
+    }
+#endif
+
     switch( eDataType)
     {
         case GDT_Unknown:
@@ -6214,6 +6848,10 @@ ComputeMinMaxGenericIterBlocks(GDALRasterBand* poBand,
  * If bApprox is FALSE, then all pixels will be read and used to compute
  * an exact range.
  *
+ * Starting with GDAL 3.7, the GDAL_NUM_THREADS configuration option can be set
+ * to "ALL_CPUS" or a integer value to specify the number of threads to use to
+ * process blocks.
+ *
  * This method is the same as the C function GDALComputeRasterMinMax().
  *
  * @param bApproxOK TRUE if an approximate (faster) answer is OK, otherwise
@@ -6283,21 +6921,32 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
 
-    GUInt32 nMin = (eDataType == GDT_Byte) ? 255 : 65535; // used for GByte & GUInt16 cases
-    GUInt32 nMax = 0;// used for GByte & GUInt16 cases
-    GInt16 nMinInt16 = std::numeric_limits<GInt16>::max(); // used for GInt16 case
-    GInt16 nMaxInt16 = std::numeric_limits<GInt16>::lowest(); // used for GInt16 case
-    double dfMin = std::numeric_limits<double>::max(); // used for generic code path
-    double dfMax = -std::numeric_limits<double>::max(); // used for generic code path
+    struct MinMax
+    {
+        GUInt32 nMin; // used for GByte & GUInt16 cases
+        GUInt32 nMax; // used for GByte & GUInt16 cases
+        GInt16 nMinInt16; // used for GInt16 case
+        GInt16 nMaxInt16; // used for GInt16 case
+        double dfMin; // used for generic code path
+        double dfMax; // used for generic code path
+    };
+    const MinMax sInitMinMax = {
+        static_cast<GUInt32>((eDataType == GDT_Byte) ? 255 : 65535),
+        0,
+        std::numeric_limits<GInt16>::max(),
+        std::numeric_limits<GInt16>::lowest(),
+        std::numeric_limits<double>::max(),
+        -std::numeric_limits<double>::max() };
+    MinMax sMinMax = sInitMinMax;
     const bool bUseOptimizedPath = ( eDataType == GDT_Byte && !bSignedByte ) ||
                                      eDataType == GDT_Int16 ||
                                      eDataType == GDT_UInt16;
 
     const auto ComputeMinMaxForBlock = [
         this, bSignedByte,
-        bGotNoDataValue, dfNoDataValue,
-        &nMin, &nMax, &nMinInt16, &nMaxInt16]
-        (const void* pData, int nXCheck, int nBufferWidth, int nYCheck)
+        bGotNoDataValue, dfNoDataValue]
+        (const void* pData, int nXCheck, int nBufferWidth, int nYCheck,
+         MinMax& sBlockMinMax)
     {
         if( eDataType == GDT_Byte && !bSignedByte )
         {
@@ -6312,8 +6961,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
                 static_cast<const GByte*>(pData),
                 bHasNoData,
                 nNoDataValue,
-                nMin,
-                nMax,
+                sBlockMinMax.nMin,
+                sBlockMinMax.nMax,
                 nSum, nSumSquare, nSampleCount, nValidCount);
         }
         else if( eDataType == GDT_UInt16 )
@@ -6329,8 +6978,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
                 static_cast<const GUInt16*>(pData),
                 bHasNoData,
                 nNoDataValue,
-                nMin,
-                nMax,
+                sBlockMinMax.nMin,
+                sBlockMinMax.nMax,
                 nSum, nSumSquare, nSampleCount, nValidCount);
         }
         else if( eDataType == GDT_Int16 )
@@ -6348,8 +6997,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
                         static_cast<const int16_t*>(pData) + static_cast<size_t>(iY) * nBufferWidth,
                         nXCheck,
                         nNoDataValue,
-                        &nMinInt16,
-                        &nMaxInt16);
+                        &sBlockMinMax.nMinInt16,
+                        &sBlockMinMax.nMaxInt16);
                 }
             }
             else
@@ -6360,8 +7009,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
                         static_cast<const int16_t*>(pData) + static_cast<size_t>(iY) * nBufferWidth,
                         nXCheck,
                         0,
-                        &nMinInt16,
-                        &nMaxInt16);
+                        &sBlockMinMax.nMinInt16,
+                        &sBlockMinMax.nMaxInt16);
                 }
             }
         }
@@ -6406,7 +7055,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
 
         if( bUseOptimizedPath )
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced,
+                                  sMinMax);
         }
         else
         {
@@ -6416,7 +7066,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
                                  dfNoDataValue,
                                  bGotFloatNoDataValue,
                                  fNoDataValue,
-                                 dfMin, dfMax);
+                                 sMinMax.dfMin, sMinMax.dfMax);
         }
 
 
@@ -6447,10 +7097,57 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
               nSampleRate += 1;
         }
 
-        if( bUseOptimizedPath )
+        const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
+        const int nThreads = GetNumThreadsForBlockScan(
+            DIV_ROUND_UP(nTotalBlocks, nSampleRate));
+        if( nThreads > 1 )
+        {
+            const auto ComputeBlockMinMax = [&](const void* pData,
+                                                int nXCheck, int nYCheck,
+                                                MinMax& sBlockMinMax)
+            {
+                if( bUseOptimizedPath )
+                {
+                    ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck,
+                                          sBlockMinMax);
+                }
+                else
+                {
+                    ComputeMinMaxGeneric(pData, eDataType, bSignedByte,
+                                         nXCheck, nYCheck, nBlockXSize,
+                                         CPL_TO_BOOL(bGotNoDataValue),
+                                         dfNoDataValue,
+                                         bGotFloatNoDataValue,
+                                         fNoDataValue,
+                                         sBlockMinMax.dfMin,
+                                         sBlockMinMax.dfMax);
+                }
+            };
+
+            if( !ScanBlocksInParallel(this, nThreads, nTotalBlocks,
+                    nSampleRate, nBlocksPerRow, sInitMinMax,
+                    ComputeBlockMinMax,
+                    [&](const MinMax& sBlockMinMax, int /* iSampleBlock */)
+                    {
+                        sMinMax.nMin = std::min(sMinMax.nMin, sBlockMinMax.nMin);
+                        sMinMax.nMax = std::max(sMinMax.nMax, sBlockMinMax.nMax);
+                        sMinMax.nMinInt16 = std::min(sMinMax.nMinInt16,
+                                                     sBlockMinMax.nMinInt16);
+                        sMinMax.nMaxInt16 = std::max(sMinMax.nMaxInt16,
+                                                     sBlockMinMax.nMaxInt16);
+                        sMinMax.dfMin = std::min(sMinMax.dfMin, sBlockMinMax.dfMin);
+                        sMinMax.dfMax = std::max(sMinMax.dfMax, sBlockMinMax.dfMax);
+                        return !(eDataType == GDT_Byte && !bSignedByte &&
+                                 sMinMax.nMin == 0 && sMinMax.nMax == 255);
+                    }) )
+            {
+                return CE_Failure;
+            }
+        }
+        else if( bUseOptimizedPath )
         {
             for( int iSampleBlock = 0;
-                 iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
+                 iSampleBlock < nTotalBlocks;
                  iSampleBlock += nSampleRate )
             {
                 const int iYBlock = iSampleBlock / nBlocksPerRow;
@@ -6465,17 +7162,18 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
                 int nXCheck = 0, nYCheck = 0;
                 GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
+                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck,
+                                      sMinMax);
 
                 poBlock->DropLock();
 
-                if( eDataType == GDT_Byte && !bSignedByte && nMin == 0 && nMax == 255 )
+                if( eDataType == GDT_Byte && !bSignedByte &&
+                    sMinMax.nMin == 0 && sMinMax.nMax == 255 )
                     break;
             }
         }
         else
         {
-            const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
             if( !ComputeMinMaxGenericIterBlocks(this, eDataType,
                                                 bSignedByte,
                                                 nTotalBlocks,
@@ -6485,23 +7183,25 @@ CPLErr GDALRasterBand::ComputeRasterMinMax( int bApproxOK,
                                                 dfNoDataValue,
                                                 bGotFloatNoDataValue,
                                                 fNoDataValue,
-                                                dfMin,
-                                                dfMax) )
+                                                sMinMax.dfMin,
+                                                sMinMax.dfMax) )
             {
                 return CE_Failure;
             }
         }
     }
 
+    double dfMin = sMinMax.dfMin;
+    double dfMax = sMinMax.dfMax;
     if( (eDataType == GDT_Byte && !bSignedByte) || eDataType == GDT_UInt16 )
     {
-        dfMin = nMin;
-        dfMax = nMax;
+        dfMin = sMinMax.nMin;
+        dfMax = sMinMax.nMax;
     }
     else if( eDataType == GDT_Int16 )
     {
-        dfMin = nMinInt16;
-        dfMax = nMaxInt16;
+        dfMin = sMinMax.nMinInt16;
+        dfMax = sMinMax.nMaxInt16;
     }
 
     if( dfMin > dfMax )
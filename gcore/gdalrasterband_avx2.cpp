@@ -0,0 +1,57 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of raster band statistics
+ *
+ ******************************************************************************
+ * Copyright (c) 2023, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+// This file is compiled with AVX2 flags, and its code must only be called
+// after checking CPLHaveRuntimeAVX2().
+
+#include "cpl_port.h"
+#include "gdal_stats_simd.hpp"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && defined(HAVE_GDAL_BLOCK_STATISTICS_SIMD)
+
+#ifndef __AVX2__
+#error "This file must be compiled with AVX2 enabled"
+#endif
+
+/************************************************************************/
+/*                   GDALComputeBlockStatistics_AVX2()                  */
+/************************************************************************/
+
+bool GDALComputeBlockStatistics_AVX2(GDALDataType eDataType,
+                                     const void* pData,
+                                     int nXCheck, int nYCheck,
+                                     int nLineStride,
+                                     bool bHasNoData, double dfNoDataValue,
+                                     bool bComputeOtherStats,
+                                     GDALBlockStatistics& sStats)
+{
+    return GDALComputeBlockStatisticsSIMD<GDALStatsVecAVX2>(
+        eDataType, pData, nXCheck, nYCheck, nLineStride,
+        bHasNoData, dfNoDataValue, bComputeOtherStats, sStats);
+}
+
+#endif
@@ -33,7 +33,10 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 
 #include "cpl_atomic_ops.h"
@@ -47,21 +50,38 @@
 static bool bCacheMaxInitialized = false;
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD( &hRBLock )
-#define TAKE_LOCK       CPLMutexHolderOptionalLockD( hRBLock )
-#define DESTROY_LOCK    CPLDestroyMutex( hRBLock )
-#else
+/* -------------------------------------------------------------------- */
+/*      The global block cache is made of one or several partitions     */
+/*      ("shards"), each one with its own LRU list, lock and share of   */
+/*      GDAL_CACHEMAX. A block is assigned to a shard from a hash of    */
+/*      its band and block coordinates. By default there is a single    */
+/*      shard, which is the historical behavior.                        */
+/* -------------------------------------------------------------------- */
+
+constexpr int MAX_SHARDS = 64;
+
+namespace {
+struct GDALRasterBlockCacheShard
+{
+    CPLLock         *hLock = nullptr;
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    // Atomic so that GDALGetCacheUsed64() can sum it without the lock
+    std::atomic<GIntBig> nCacheUsed{0};
+
+    // Only maintained when GDAL_RB_LOCK_DEBUG_CONTENTION=YES
+    std::atomic<int>     nHolders{0};
+    std::atomic<GIntBig> nAcquisitions{0};
+    std::atomic<GIntBig> nContentions{0};
+};
+} // namespace
+
+static GDALRasterBlockCacheShard asShards[MAX_SHARDS];
+static std::atomic<unsigned> nFlushShardCounter{0};
 
-static CPLLock* hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 static CPLLockType GetLockType()
@@ -91,12 +111,114 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK         CPLLockHolderD( &hRBLock, GetLockType() ); \
-                                CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK               CPLLockHolderOptionalLockD( hRBLock )
-#define DESTROY_LOCK            CPLDestroyLock( hRBLock )
+/************************************************************************/
+/*                           GetShardCount()                            */
+/************************************************************************/
 
-#endif
+// The number of shards is determined once for the lifetime of the process,
+// since blocks are assigned to shards from a hash modulo that number.
+static int GetShardCount()
+{
+    static const int nShards = []()
+    {
+        const char* pszShards =
+            CPLGetConfigOption("GDAL_RB_CACHE_SHARDS", "1");
+        int nVal = EQUAL(pszShards, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                : atoi(pszShards);
+        if( nVal < 1 )
+            nVal = 1;
+        else if( nVal > MAX_SHARDS )
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "GDAL_RB_CACHE_SHARDS limited to %d", MAX_SHARDS);
+            nVal = MAX_SHARDS;
+        }
+        if( nVal > 1 )
+            CPLDebug("GDAL", "Using %d block cache shards", nVal);
+        return nVal;
+    }();
+    return nShards;
+}
+
+/************************************************************************/
+/*                              GetShard()                              */
+/************************************************************************/
+
+static GDALRasterBlockCacheShard& GetShard( GDALRasterBlock* poBlock )
+{
+    const int nShards = GetShardCount();
+    if( nShards == 1 )
+        return asShards[0];
+    // Mix band pointer and block coordinates so that blocks of a same band
+    // are spread over all shards.
+    GUIntBig nHash = static_cast<GUIntBig>(
+        reinterpret_cast<std::uintptr_t>(poBlock->GetBand()) >> 4);
+    nHash = nHash * 31 + static_cast<unsigned>(poBlock->GetXOff());
+    nHash = nHash * 31 + static_cast<unsigned>(poBlock->GetYOff());
+    nHash ^= nHash >> 33;
+    nHash *= 0xff51afd7ed558ccdULL;
+    nHash ^= nHash >> 33;
+    return asShards[nHash % static_cast<unsigned>(nShards)];
+}
+
+/************************************************************************/
+/*                          InitializeLocks()                           */
+/************************************************************************/
+
+static void InitializeLocks()
+{
+    const int nShards = GetShardCount();
+    for( int i = 0; i < nShards; ++i )
+    {
+        CPLLockHolderD( &asShards[i].hLock, GetLockType() );
+        CPLLockSetDebugPerf(asShards[i].hLock, bDebugContention);
+    }
+}
+
+/************************************************************************/
+/*                        GDALRBShardLockHolder                         */
+/************************************************************************/
+
+namespace {
+class GDALRBShardLockHolder
+{
+    GDALRasterBlockCacheShard& m_oShard;
+    bool m_bCountContention = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRBShardLockHolder)
+
+  public:
+    GDALRBShardLockHolder(GDALRasterBlockCacheShard& oShard,
+                          bool bCreateIfNeeded):
+        m_oShard(oShard)
+    {
+        if( bDebugContention )
+        {
+            m_bCountContention = true;
+            ++m_oShard.nAcquisitions;
+            if( m_oShard.nHolders++ > 0 )
+                ++m_oShard.nContentions;
+        }
+        if( bCreateIfNeeded )
+            CPLCreateOrAcquireLock(&m_oShard.hLock, GetLockType());
+        else if( m_oShard.hLock )
+            CPLAcquireLock(m_oShard.hLock);
+    }
+
+    ~GDALRBShardLockHolder()
+    {
+        if( m_oShard.hLock )
+            CPLReleaseLock(m_oShard.hLock);
+        if( m_bCountContention )
+            --m_oShard.nHolders;
+    }
+};
+} // namespace
+
+#define INITIALIZE_LOCK         InitializeLocks()
+#define TAKE_OR_INITIALIZE_LOCK(oShard) \
+                                GDALRBShardLockHolder oHolder(oShard, true)
+#define TAKE_LOCK(oShard)       GDALRBShardLockHolder oHolder(oShard, false)
 
 //#define ENABLE_DEBUG
 
@@ -137,6 +259,12 @@ void CPL_STDCALL GDALSetCacheMax( int nNewSizeInBytes )
  * capabilities. This function will not make any attempt to check the
  * consistency of the passed value with the effective capabilities of the OS.
  *
+ * When the cache is partitioned with the GDAL_RB_CACHE_SHARDS configuration
+ * option, each of the N shards gets a budget of nNewSizeInBytes / N bytes,
+ * and blocks are only evicted from the shard that exceeds its budget. The
+ * total cache size is thus kept below nNewSizeInBytes, but eviction may start
+ * before it is reached when blocks are unevenly distributed among shards.
+ *
  * @param nNewSizeInBytes the maximum number of bytes for caching.
  *
  * @since GDAL 1.8.0
@@ -163,12 +291,14 @@ void CPL_STDCALL GDALSetCacheMax64( GIntBig nNewSizeInBytes )
 /*      Flush blocks till we are under the new limit or till we         */
 /*      can't seem to flush anymore.                                    */
 /* -------------------------------------------------------------------- */
+    GIntBig nCacheUsed = GDALGetCacheUsed64();
     while( nCacheUsed > nCacheMax )
     {
         const GIntBig nOldCacheUsed = nCacheUsed;
 
         GDALFlushCacheBlock();
 
+        nCacheUsed = GDALGetCacheUsed64();
         if( nCacheUsed == nOldCacheUsed )
             break;
     }
@@ -323,6 +453,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
+    const GIntBig nCacheUsed = GDALGetCacheUsed64();
     if (nCacheUsed > INT_MAX)
     {
         static bool bHasWarned = false;
@@ -351,7 +482,14 @@ int CPL_STDCALL GDALGetCacheUsed()
  * @since GDAL 1.8.0
  */
 
-GIntBig CPL_STDCALL GDALGetCacheUsed64() { return nCacheUsed; }
+GIntBig CPL_STDCALL GDALGetCacheUsed64()
+{
+    GIntBig nCacheUsed = 0;
+    const int nShards = GetShardCount();
+    for( int i = 0; i < nShards; ++i )
+        nCacheUsed += asShards[i].nCacheUsed;
+    return nCacheUsed;
+}
 
 /************************************************************************/
 /*                        GDALFlushCacheBlock()                         */
@@ -402,6 +540,13 @@ int CPL_STDCALL GDALFlushCacheBlock()
  * Some driver classes are implemented in a fashion that completely avoids
  * use of the GDAL raster cache (and GDALRasterBlock) though this is not very
  * common.
+ *
+ * Starting with GDAL 3.7, the GDAL_RB_CACHE_SHARDS configuration option can
+ * be set to a number of partitions (up to 64, or ALL_CPUS) to split the
+ * global cache into independent LRU lists, each one with its own lock and
+ * an equal share of the cache size. This reduces lock contention when many
+ * threads access the block cache concurrently. It must be set before the
+ * first use of the block cache.
  */
 
 /************************************************************************/
@@ -430,11 +575,19 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock( int bDirtyBlocksOnly )
 
 {
-    GDALRasterBlock *poTarget;
-
+    GDALRasterBlock *poTarget = nullptr;
+
+    // Start from a different shard at each call, so that repeated calls
+    // (e.g. from GDALSetCacheMax64()) evict evenly from all shards.
+    const int nShards = GetShardCount();
+    const int nFirstShard = nShards == 1 ? 0 :
+        static_cast<int>(nFlushShardCounter++ % static_cast<unsigned>(nShards));
+    for( int iShard = 0; poTarget == nullptr && iShard < nShards; ++iShard )
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        GDALRasterBlockCacheShard& oShard =
+            asShards[(nFirstShard + iShard) % nShards];
+        TAKE_OR_INITIALIZE_LOCK(oShard);
+        poTarget = oShard.poOldest;
 
         while( poTarget != nullptr )
         {
@@ -449,7 +602,7 @@ int GDALRasterBlock::FlushCacheBlock( int bDirtyBlocksOnly )
         }
 
         if( poTarget == nullptr )
-            return FALSE;
+            continue;
         if( bSleepsForBockCacheDebug )
         {
             // coverity[tainted_data]
@@ -464,6 +617,9 @@ int GDALRasterBlock::FlushCacheBlock( int bDirtyBlocksOnly )
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
 
+    if( poTarget == nullptr )
+        return FALSE;
+
     if( bSleepsForBockCacheDebug )
     {
         // coverity[tainted_data]
@@ -716,19 +872,21 @@ void GDALRasterBlock::Detach()
 {
     if( bMustDetach )
     {
-        TAKE_LOCK;
+        TAKE_LOCK(GetShard(this));
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if( poOldest == this )
-        poOldest = poPrevious;
+    GDALRasterBlockCacheShard& oShard = GetShard(this);
 
-    if( poNewest == this )
+    if( oShard.poOldest == this )
+        oShard.poOldest = poPrevious;
+
+    if( oShard.poNewest == this )
     {
-        poNewest = poNext;
+        oShard.poNewest = poNext;
     }
 
     if( poPrevious != nullptr )
@@ -742,7 +900,7 @@ void GDALRasterBlock::Detach_unlocked()
     bMustDetach = false;
 
     if( pData )
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+        oShard.nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -754,7 +912,7 @@ void GDALRasterBlock::Detach_unlocked()
 /************************************************************************/
 
 /**
- * Confirms (via assertions) that the block cache linked list is in a
+ * Confirms (via assertions) that the block cache linked lists are in a
  * consistent state.
  */
 
@@ -762,27 +920,33 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert( (poNewest == nullptr && poOldest == nullptr)
-               || (poNewest != nullptr && poOldest != nullptr) );
-
-    if( poNewest != nullptr )
+    const int nShards = GetShardCount();
+    for( int iShard = 0; iShard < nShards; ++iShard )
     {
-        CPLAssert( poNewest->poPrevious == nullptr );
-        CPLAssert( poOldest->poNext == nullptr );
+        GDALRasterBlockCacheShard& oShard = asShards[iShard];
+        TAKE_LOCK(oShard);
 
-        GDALRasterBlock* poLast = nullptr;
-        for( GDALRasterBlock *poBlock = poNewest;
-             poBlock != nullptr;
-             poBlock = poBlock->poNext )
+        CPLAssert( (oShard.poNewest == nullptr && oShard.poOldest == nullptr)
+                   || (oShard.poNewest != nullptr && oShard.poOldest != nullptr) );
+
+        if( oShard.poNewest != nullptr )
         {
-            CPLAssert( poBlock->poPrevious == poLast );
+            CPLAssert( oShard.poNewest->poPrevious == nullptr );
+            CPLAssert( oShard.poOldest->poNext == nullptr );
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock* poLast = nullptr;
+            for( GDALRasterBlock *poBlock = oShard.poNewest;
+                 poBlock != nullptr;
+                 poBlock = poBlock->poNext )
+            {
+                CPLAssert( poBlock->poPrevious == poLast );
+                CPLAssert( &GetShard(poBlock) == &oShard );
 
-        CPLAssert( poOldest == poLast );
+                poLast = poBlock;
+            }
+
+            CPLAssert( oShard.poOldest == poLast );
+        }
     }
 }
 
@@ -793,25 +957,29 @@ void GDALRasterBlock::Verify() {}
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks( GDALRasterBand* poBand )
 {
-    TAKE_LOCK;
-    for( GDALRasterBlock *poBlock = poNewest;
-                          poBlock != nullptr;
-                          poBlock = poBlock->poNext )
+    const int nShards = GetShardCount();
+    for( int iShard = 0; iShard < nShards; ++iShard )
     {
-        if ( poBlock->GetBand() == poBand )
+        TAKE_LOCK(asShards[iShard]);
+        for( GDALRasterBlock *poBlock = asShards[iShard].poNewest;
+                              poBlock != nullptr;
+                              poBlock = poBlock->poNext )
         {
-            printf("Cache has still blocks of band %p\n", poBand);/*ok*/
-            printf("Band : %d\n", poBand->GetBand());/*ok*/
-            printf("nRasterXSize = %d\n", poBand->GetXSize());/*ok*/
-            printf("nRasterYSize = %d\n", poBand->GetYSize());/*ok*/
-            int nBlockXSize, nBlockYSize;
-            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-            printf("nBlockXSize = %d\n", nBlockXSize);/*ok*/
-            printf("nBlockYSize = %d\n", nBlockYSize);/*ok*/
-            printf("Dataset : %p\n", poBand->GetDataset());/*ok*/
-            if( poBand->GetDataset() )
-                printf("Dataset : %s\n",/*ok*/
-                       poBand->GetDataset()->GetDescription());
+            if ( poBlock->GetBand() == poBand )
+            {
+                printf("Cache has still blocks of band %p\n", poBand);/*ok*/
+                printf("Band : %d\n", poBand->GetBand());/*ok*/
+                printf("nRasterXSize = %d\n", poBand->GetXSize());/*ok*/
+                printf("nRasterYSize = %d\n", poBand->GetYSize());/*ok*/
+                int nBlockXSize, nBlockYSize;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                printf("nBlockXSize = %d\n", nBlockXSize);/*ok*/
+                printf("nBlockYSize = %d\n", nBlockYSize);/*ok*/
+                printf("Dataset : %p\n", poBand->GetDataset());/*ok*/
+                if( poBand->GetDataset() )
+                    printf("Dataset : %s\n",/*ok*/
+                           poBand->GetDataset()->GetDescription());
+            }
         }
     }
 }
@@ -867,11 +1035,13 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    GDALRasterBlockCacheShard& oShard = GetShard(this);
+
     // Can be safely tested outside the lock
-    if( poNewest == this )
+    if( oShard.poNewest == this )
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(oShard);
     Touch_unlocked();
 }
 
@@ -884,15 +1054,16 @@ void GDALRasterBlock::Touch_unlocked()
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if( poNewest == this )
+    GDALRasterBlockCacheShard& oShard = GetShard(this);
+    if( oShard.poNewest == this )
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if( poOldest == this )
-        poOldest = this->poPrevious;
+    if( oShard.poOldest == this )
+        oShard.poOldest = this->poPrevious;
 
     if( poPrevious != nullptr )
         poPrevious->poNext = poNext;
@@ -901,19 +1072,19 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = oShard.poNewest;
 
-    if( poNewest != nullptr )
+    if( oShard.poNewest != nullptr )
     {
-        CPLAssert( poNewest->poPrevious == nullptr );
-        poNewest->poPrevious = this;
+        CPLAssert( oShard.poNewest->poPrevious == nullptr );
+        oShard.poNewest->poPrevious = this;
     }
-    poNewest = this;
+    oShard.poNewest = this;
 
-    if( poOldest == nullptr )
+    if( oShard.poOldest == nullptr )
     {
         CPLAssert( poPrevious == nullptr && poNext == nullptr );
-        poOldest = this;
+        oShard.poOldest = this;
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -932,6 +1103,11 @@ void GDALRasterBlock::Touch_unlocked()
  * The newly allocated block is touched and will be considered most recently
  * used in the LRU list.
  *
+ * When the block cache is partitioned in several shards (see the
+ * GDAL_RB_CACHE_SHARDS configuration option), only blocks of the shard of
+ * this block are candidates for eviction, and the limit considered is the
+ * share of the shard in the total cache size.
+ *
  * @return CE_None on success or CE_Failure if memory allocation fails.
  */
 
@@ -942,9 +1118,10 @@ CPLErr GDALRasterBlock::Internalize()
 
     void        *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard locks. Other call places can
     // only be called if we have go through there.
-    const GIntBig nCurCacheMax = GDALGetCacheMax64();
+    const GIntBig nCurCacheMax = GDALGetCacheMax64() / GetShardCount();
+    GDALRasterBlockCacheShard& oShard = GetShard(this);
 
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
@@ -961,12 +1138,12 @@ CPLErr GDALRasterBlock::Internalize()
         GDALRasterBlock* apoBlocksToFree[64] = { nullptr };
         int nBlocksToFree = 0;
         {
-            TAKE_LOCK;
+            TAKE_LOCK(oShard);
 
             if( bFirstIter )
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while( nCacheUsed > nCurCacheMax )
+                oShard.nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
+            GDALRasterBlock *poTarget = oShard.poOldest;
+            while( oShard.nCacheUsed > nCurCacheMax )
             {
                 GDALRasterBlock* poDirtyBlockOtherDataset = nullptr;
                 // In this first pass, only discard dirty blocks of this
@@ -1011,7 +1188,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = oShard.poOldest;
                         while( poTarget != nullptr )
                         {
                             if( CPLAtomicCompareAndExchange(
@@ -1049,12 +1226,12 @@ CPLErr GDALRasterBlock::Internalize()
                         // Only free one dirty block at a time so that
                         // other dirty blocks of other bands with the same
                         // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
+                        bLoopAgain = oShard.nCacheUsed > nCurCacheMax;
                         break;
                     }
                     if( nBlocksToFree == 64 )
                     {
-                        bLoopAgain = ( nCacheUsed > nCurCacheMax );
+                        bLoopAgain = ( oShard.nCacheUsed > nCurCacheMax );
                         break;
                     }
 
@@ -1180,12 +1357,65 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if( hRBLock != nullptr )
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    if( bDebugContention )
+    {
+        CPLDebug("LOCK",
+                 "Block cache lock contention: " CPL_FRMT_GIB
+                 " contended acquisitions out of " CPL_FRMT_GIB,
+                 GetLockContentionCount(), GetLockAcquisitionCount());
+    }
+    for( int i = 0; i < MAX_SHARDS; ++i )
+    {
+        if( asShards[i].hLock != nullptr )
+            CPLDestroyLock(asShards[i].hLock);
+        asShards[i].hLock = nullptr;
+    }
 }
 /*! @endcond */
 
+/************************************************************************/
+/*                       GetLockContentionCount()                       */
+/************************************************************************/
+
+/**
+ * Return the number of times a block cache lock was requested while
+ * another thread was holding or waiting for it.
+ *
+ * Only counted when the GDAL_RB_LOCK_DEBUG_CONTENTION configuration option
+ * is set to YES (otherwise 0 is returned). Summed over all shards.
+ *
+ * @since GDAL 3.7
+ */
+
+GIntBig GDALRasterBlock::GetLockContentionCount()
+{
+    GIntBig nCount = 0;
+    for( int i = 0; i < MAX_SHARDS; ++i )
+        nCount += asShards[i].nContentions;
+    return nCount;
+}
+
+/************************************************************************/
+/*                      GetLockAcquisitionCount()                       */
+/************************************************************************/
+
+/**
+ * Return the number of times a block cache lock was requested.
+ *
+ * Only counted when the GDAL_RB_LOCK_DEBUG_CONTENTION configuration option
+ * is set to YES (otherwise 0 is returned). Summed over all shards.
+ *
+ * @since GDAL 3.7
+ */
+
+GIntBig GDALRasterBlock::GetLockAcquisitionCount()
+{
+    GIntBig nCount = 0;
+    for( int i = 0; i < MAX_SHARDS; ++i )
+        nCount += asShards[i].nAcquisitions;
+    return nCount;
+}
+
 /************************************************************************/
 /*                              TakeLock()                              */
 /************************************************************************/
@@ -1261,7 +1491,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(GetShard(this));
 
     return FALSE;
 }
@@ -1270,14 +1500,19 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    const int nShards = GetShardCount();
+    for( int iShard = 0; iShard < nShards; ++iShard )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        TAKE_LOCK(asShards[iShard]);
+        for( GDALRasterBlock *poBlock = asShards[iShard].poNewest;
+             poBlock != nullptr;
+             poBlock = poBlock->poNext )
+        {
+            printf("Block %d\n", iBlock);/*ok*/
+            poBlock->DumpBlock();
+            printf("\n");/*ok*/
+            iBlock++;
+        }
     }
 }
 
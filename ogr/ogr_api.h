@@ -635,6 +635,7 @@ void     CPL_DLL OGR_L_SetSpatialFilterRectEx( OGRLayerH, int iGeomField,
 OGRErr CPL_DLL OGR_L_SetAttributeFilter( OGRLayerH, const char * );
 void   CPL_DLL OGR_L_ResetReading( OGRLayerH );
 OGRFeatureH CPL_DLL OGR_L_GetNextFeature( OGRLayerH ) CPL_WARN_UNUSED_RESULT;
+bool CPL_DLL OGR_L_GetNextFeatureInto( OGRLayerH, OGRFeatureH );
 
 /** Conveniency macro to iterate over features of a layer.
  *
@@ -687,6 +688,17 @@ bool CPL_DLL OGR_L_GetArrowStream(OGRLayerH hLayer,
                                   struct ArrowArrayStream* out_stream,
                                   char** papszOptions);
 
+/** Data type for a Arrow C schema. Include ogr_recordbatch.h to get the definition. */
+struct ArrowSchema;
+
+/** Data type for a Arrow C array. Include ogr_recordbatch.h to get the definition. */
+struct ArrowArray;
+
+bool CPL_DLL OGR_L_WriteArrowBatch(OGRLayerH hLayer,
+                                   const struct ArrowSchema* schema,
+                                   struct ArrowArray* array,
+                                   char** papszOptions);
+
 OGRErr CPL_DLL OGR_L_SetNextByIndex( OGRLayerH, GIntBig );
 OGRFeatureH CPL_DLL OGR_L_GetFeature( OGRLayerH, GIntBig )  CPL_WARN_UNUSED_RESULT;
 OGRErr CPL_DLL OGR_L_SetFeature( OGRLayerH, OGRFeatureH ) CPL_WARN_UNUSED_RESULT;
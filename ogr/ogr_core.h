@@ -891,6 +891,7 @@ int CPL_DLL OGRParseDate( const char *pszInput, OGRField *psOutput,
 #define OLCZGeometries         "ZGeometries"        /**< Layer capability for geometry with Z dimension support. Since GDAL 3.6. */
 #define OLCRename              "Rename"             /**< Layer capability for a layer that supports Rename() */
 #define OLCFastGetArrowStream  "FastGetArrowStream" /**< Layer capability for fast GetArrowStream() implementation */
+#define OLCFastWriteArrowBatch "FastWriteArrowBatch" /**< Layer capability for fast WriteArrowBatch() implementation */
 
 #define ODsCCreateLayer        "CreateLayer"        /**< Dataset capability for layer creation */
 #define ODsCDeleteLayer        "DeleteLayer"        /**< Dataset capability for layer deletion */
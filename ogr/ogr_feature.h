@@ -484,8 +484,15 @@ class CPL_DLL OGRFeature
     OGRField            *pauFields;
     char                *m_pszNativeData;
     char                *m_pszNativeMediaType;
+    // WKB of geometries not instantiated yet (see SetGeomFieldFromWkb()).
+    // Instantiation happens from const methods, which are thus not
+    // thread-safe while such WKB is pending.
+    GByte              **m_papabyLazyWkb;
+    size_t              *m_panLazyWkbSize;
 
     bool                SetFieldInternal( int i, const OGRField * puValue );
+    void                MaterializeGeomField( int iField ) const;
+    void                DiscardLazyGeomField( int iField );
 
   protected:
 //! @cond Doxygen_Suppress
@@ -699,6 +706,7 @@ class CPL_DLL OGRFeature
 
 //! @cond Doxygen_Suppress
     void                SetFDefnUnsafe( OGRFeatureDefn* poNewFDefn );
+    void                SwapContent( OGRFeature& oOther );
 //! @endcond
 
     OGRErr              SetGeometryDirectly( OGRGeometry * );
@@ -724,6 +732,15 @@ class CPL_DLL OGRFeature
     OGRErr              SetGeomFieldDirectly( int iField, OGRGeometry * );
     OGRErr              SetGeomField( int iField, const OGRGeometry * );
 
+    OGRErr              SetGeomFieldFromWkb( int iField, const GByte* pabyWkb,
+                                             size_t nWkbSize );
+    OGRErr              SetGeomFieldFromWkbDirectly( int iField, GByte* pabyWkb,
+                                                     size_t nWkbSize );
+    const GByte*        GetGeomFieldRawWkb( int iField, size_t& nWkbSize ) const;
+    OGRErr              GetGeomFieldEnvelope( int iField,
+                                              OGREnvelope& sEnvelope ) const;
+    OGRwkbGeometryType  GetGeomFieldGeometryType( int iField ) const;
+
     void                Reset();
 
     OGRFeature         *Clone() const CPL_WARN_UNUSED_RESULT;
@@ -27,6 +27,7 @@
 #include "cpl_string.h"
 #include "ogr_core.h"
 
+#include <limits>
 #include <vector>
 #include <set>
 
@@ -312,8 +313,8 @@ public:
     std::vector<CPLString>          oVectorDistinctValues{};
     std::set<CPLString, Comparator> oSetDistinctValues{};
     double      sum = 0.0;
-    double      min = 0.0;
-    double      max = 0.0;
+    double      min = std::numeric_limits<double>::infinity();
+    double      max = -std::numeric_limits<double>::infinity();
     CPLString   osMin{};
     CPLString   osMax{};
 };
@@ -326,6 +327,13 @@ typedef struct {
     int   ascending_flag;
 } swq_order_def;
 
+typedef struct {
+    char *table_name;
+    char *field_name;
+    int   table_index;
+    int   field_index;
+} swq_group_def;
+
 typedef struct {
     int        secondary_table;
     swq_expr_node  *poExpr;
@@ -381,6 +389,12 @@ public:
 
     swq_expr_node *where_expr = nullptr;
 
+    void        PushGroupBy( const char* pszTableName, const char *pszFieldName );
+    int         group_specs = 0;
+    swq_group_def *group_defs = nullptr;
+    int         FindGroupBy( const swq_expr_node* poExpr, int table_index,
+                             int field_index ) const;
+
     void        PushOrderBy( const char* pszTableName, const char *pszFieldName, int bAscending );
     int         order_specs = 0;
     swq_order_def *order_defs = nullptr;
@@ -413,6 +427,10 @@ const char CPL_UNSTABLE_API *swq_select_summarize( swq_select *select_info,
                                                    int dest_column,
                                                    const char *value );
 
+const char CPL_UNSTABLE_API *swq_summarize_value( const swq_col_def *def,
+                                                  swq_summary &summary,
+                                                  const char *value );
+
 int CPL_UNSTABLE_API swq_is_reserved_keyword(const char* pszStr);
 
 char CPL_UNSTABLE_API *OGRHStoreGetValue(const char* pszHStore,
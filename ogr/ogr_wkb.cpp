@@ -209,6 +209,159 @@ bool OGRWKBMultiPolygonGetArea(const GByte*& pabyWkb, size_t& nWKBSize, double&
     return false;
 }
 
+/************************************************************************/
+/*                    OGRWKBReadPointSequenceBBox()                     */
+/************************************************************************/
+
+static bool OGRWKBReadPointSequenceBBox(const GByte*& pabyWkb, size_t& nWKBSize,
+                                        int nDim, bool bNeedSwap,
+                                        OGREnvelope& sEnvelope)
+{
+    if( nWKBSize < sizeof(uint32_t) )
+        return false;
+    const uint32_t nPoints = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+    pabyWkb += sizeof(uint32_t);
+    nWKBSize -= sizeof(uint32_t);
+    if( nWKBSize / (nDim * sizeof(double)) < nPoints )
+        return false;
+    for( uint32_t i = 0; i < nPoints; ++i )
+    {
+        const double x = OGRWKBReadFloat64(pabyWkb, bNeedSwap);
+        const double y = OGRWKBReadFloat64(pabyWkb + sizeof(double), bNeedSwap);
+        pabyWkb += nDim * sizeof(double);
+        sEnvelope.Merge(x, y);
+    }
+    nWKBSize -= static_cast<size_t>(nPoints) * nDim * sizeof(double);
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRWKBGetBoundingBox()                         */
+/************************************************************************/
+
+static bool OGRWKBGetBoundingBox(const GByte*& pabyWkb, size_t& nWKBSize,
+                                 OGREnvelope& sEnvelope, int nRec)
+{
+    // Arbitrary value, consistent with OGRGeometryFactory::createFromWkb()
+    if( nRec == 32 )
+        return false;
+
+    bool bNeedSwap = false;
+    uint32_t nType = 0;
+    if( (pabyWkb[0] != wkbNDR && pabyWkb[0] != wkbXDR) ||
+        !OGRWKBGetGeomType(pabyWkb, nWKBSize, bNeedSwap, nType) )
+        return false;
+    pabyWkb += 5;
+    nWKBSize -= 5;
+
+    int nDim = 2;
+    if( nType & 0x80000000U )
+    {
+        // Old-style 2.5D geometry
+        nType &= 0xff;
+        nDim = 3;
+    }
+    else if( nType > 3000 )
+    {
+        nType -= 3000;
+        nDim = 4;
+    }
+    else if( nType > 2000 )
+    {
+        nType -= 2000;
+        nDim = 3;
+    }
+    else if( nType > 1000 )
+    {
+        nType -= 1000;
+        nDim = 3;
+    }
+
+    switch( nType )
+    {
+        case wkbPoint:
+        {
+            if( nWKBSize < nDim * sizeof(double) )
+                return false;
+            const double x = OGRWKBReadFloat64(pabyWkb, bNeedSwap);
+            const double y = OGRWKBReadFloat64(pabyWkb + sizeof(double), bNeedSwap);
+            pabyWkb += nDim * sizeof(double);
+            nWKBSize -= nDim * sizeof(double);
+            // POINT EMPTY is encoded with NaN coordinates
+            if( !std::isnan(x) )
+                sEnvelope.Merge(x, y);
+            return true;
+        }
+
+        case wkbLineString:
+            return OGRWKBReadPointSequenceBBox(pabyWkb, nWKBSize, nDim,
+                                               bNeedSwap, sEnvelope);
+
+        case wkbPolygon:
+        case wkbTriangle:
+        {
+            if( nWKBSize < sizeof(uint32_t) )
+                return false;
+            const uint32_t nRings = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+            pabyWkb += sizeof(uint32_t);
+            nWKBSize -= sizeof(uint32_t);
+            if( nRings > nWKBSize / sizeof(uint32_t) )
+                return false;
+            for( uint32_t i = 0; i < nRings; ++i )
+            {
+                if( !OGRWKBReadPointSequenceBBox(pabyWkb, nWKBSize, nDim,
+                                                 bNeedSwap, sEnvelope) )
+                    return false;
+            }
+            return true;
+        }
+
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        case wkbGeometryCollection:
+        case wkbPolyhedralSurface:
+        case wkbTIN:
+        {
+            if( nWKBSize < sizeof(uint32_t) )
+                return false;
+            const uint32_t nParts = OGRWKBReadUInt32(pabyWkb, bNeedSwap);
+            pabyWkb += sizeof(uint32_t);
+            nWKBSize -= sizeof(uint32_t);
+            if( nParts > nWKBSize / 5 )
+                return false;
+            for( uint32_t i = 0; i < nParts; ++i )
+            {
+                if( nWKBSize < 5 ||
+                    !OGRWKBGetBoundingBox(pabyWkb, nWKBSize, sEnvelope,
+                                          nRec + 1) )
+                    return false;
+            }
+            return true;
+        }
+
+        default:
+            // Curve geometries may extend beyond their control points:
+            // let the caller instantiate the geometry.
+            return false;
+    }
+}
+
+/** Compute the 2D bounding box of a WKB geometry, without instantiating it.
+ *
+ * Curve geometries (and collections containing them) as well as empty
+ * geometries are not handled, and false is returned for them.
+ */
+bool OGRWKBGetBoundingBox(const GByte* pabyWkb, size_t nWKBSize,
+                          OGREnvelope& sEnvelope)
+{
+    sEnvelope = OGREnvelope();
+    if( nWKBSize < 5 )
+        return false;
+    return OGRWKBGetBoundingBox(pabyWkb, nWKBSize, sEnvelope, 0) &&
+           sEnvelope.IsInit();
+}
+
 /************************************************************************/
 /*                            WKBFromEWKB()                             */
 /************************************************************************/
@@ -54,6 +54,7 @@
 #include "ogr_featurestyle.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_wkb.h"
 #include "ogrgeojsonreader.h"
 
 #include "cpl_json_header.h"
@@ -84,6 +85,8 @@ OGRFeature::OGRFeature( OGRFeatureDefn * poDefnIn ) :
     pauFields(nullptr),
     m_pszNativeData(nullptr),
     m_pszNativeMediaType(nullptr),
+    m_papabyLazyWkb(nullptr),
+    m_panLazyWkbSize(nullptr),
     m_pszStyleString(nullptr),
     m_poStyleTable(nullptr),
     m_pszTmpFieldValue(nullptr)
@@ -194,11 +197,23 @@ OGRFeature::~OGRFeature()
         }
     }
 
+    if( m_papabyLazyWkb != nullptr )
+    {
+        const int nGeomFieldCount = poDefn->GetGeomFieldCount();
+
+        for( int i = 0; i < nGeomFieldCount; i++ )
+        {
+            CPLFree(m_papabyLazyWkb[i]);
+        }
+    }
+
     if( poDefn )
         poDefn->Release();
 
     CPLFree(pauFields);
     CPLFree(papoGeometries);
+    CPLFree(m_papabyLazyWkb);
+    CPLFree(m_panLazyWkbSize);
     CPLFree(m_pszStyleString);
     CPLFree(m_pszTmpFieldValue);
     CPLFree(m_pszNativeData);
@@ -357,6 +372,14 @@ void OGRFeature::Reset()
         }
     }
 
+    if( m_papabyLazyWkb != nullptr )
+    {
+        const int nGeomFieldCount = poDefn->GetGeomFieldCount();
+
+        for( int i = 0; i < nGeomFieldCount; i++ )
+            DiscardLazyGeomField(i);
+    }
+
     if( m_pszStyleString )
     {
         CPLFree(m_pszStyleString);
@@ -604,6 +627,7 @@ OGRGeometry *OGRFeature::StealGeometry()
 {
     if( GetGeomFieldCount() > 0 )
     {
+        MaterializeGeomField(0);
         OGRGeometry *poReturn = papoGeometries[0];
         papoGeometries[0] = nullptr;
         return poReturn;
@@ -632,6 +656,7 @@ OGRGeometry *OGRFeature::StealGeometry( int iGeomField )
 {
     if( iGeomField >= 0 && iGeomField < GetGeomFieldCount() )
     {
+        MaterializeGeomField(iGeomField);
         OGRGeometry *poReturn = papoGeometries[iGeomField];
         papoGeometries[iGeomField] = nullptr;
         return poReturn;
@@ -803,8 +828,9 @@ OGRGeometry *OGRFeature::GetGeomFieldRef( int iField )
 {
     if( iField < 0 || iField >= GetGeomFieldCount() )
         return nullptr;
-    else
-        return papoGeometries[iField];
+
+    MaterializeGeomField(iField);
+    return papoGeometries[iField];
 }
 
 /**
@@ -823,8 +849,9 @@ const OGRGeometry *OGRFeature::GetGeomFieldRef( int iField ) const
 {
     if( iField < 0 || iField >= GetGeomFieldCount() )
         return nullptr;
-    else
-        return papoGeometries[iField];
+
+    MaterializeGeomField(iField);
+    return papoGeometries[iField];
 }
 
 /************************************************************************/
@@ -848,7 +875,7 @@ OGRGeometry *OGRFeature::GetGeomFieldRef( const char* pszFName )
     if( iField < 0 )
         return nullptr;
 
-    return papoGeometries[iField];
+    return GetGeomFieldRef(iField);
 }
 
 /**
@@ -867,7 +894,7 @@ const OGRGeometry *OGRFeature::GetGeomFieldRef( const char* pszFName ) const
     if( iField < 0 )
         return nullptr;
 
-    return papoGeometries[iField];
+    return GetGeomFieldRef(iField);
 }
 
 /************************************************************************/
@@ -943,6 +970,8 @@ OGRErr OGRFeature::SetGeomFieldDirectly( int iField, OGRGeometry * poGeomIn )
         return OGRERR_FAILURE;
     }
 
+    DiscardLazyGeomField(iField);
+
     if( papoGeometries[iField] != poGeomIn )
     {
         delete papoGeometries[iField];
@@ -1018,6 +1047,8 @@ OGRErr OGRFeature::SetGeomField( int iField, const OGRGeometry * poGeomIn )
     if( iField < 0 || iField >= GetGeomFieldCount() )
         return OGRERR_FAILURE;
 
+    DiscardLazyGeomField(iField);
+
     if( papoGeometries[iField] != poGeomIn )
     {
         delete papoGeometries[iField];
@@ -1064,6 +1095,317 @@ OGRErr OGR_F_SetGeomField( OGRFeatureH hFeat, int iField, OGRGeometryH hGeom )
         SetGeomField(iField, OGRGeometry::FromHandle(hGeom));
 }
 
+/************************************************************************/
+/*                     SetGeomFieldFromWkbDirectly()                    */
+/************************************************************************/
+
+/**
+ * \brief Set feature geometry of a specified geometry field from WKB,
+ * assuming ownership of the buffer.
+ *
+ * The geometry object is not instantiated by this method, but only when
+ * it is first requested with GetGeomFieldRef() (or any other method that
+ * needs it). Until then, GetGeomFieldEnvelope(), GetGeomFieldGeometryType()
+ * and GetGeomFieldRawWkb() are directly served from the WKB buffer. This
+ * is intended for drivers that read geometries as WKB, to avoid
+ * the instantiation cost when the caller does not need the geometry object.
+ *
+ * The buffer is only superficially checked by this method. If it turns out
+ * to be invalid when the geometry is instantiated, an error is emitted and
+ * the geometry field is set to NULL.
+ *
+ * As the geometry is instantiated on first access, even through const
+ * methods such as the const version of GetGeomFieldRef(), concurrent
+ * read-only access to such a feature from several threads is not safe
+ * until the geometry has been instantiated.
+ *
+ * @param iField geometry field to set.
+ * @param pabyWkb WKB buffer allocated with CPLMalloc(). Ownership is
+ * transferred to the feature (even in case of failure of this method).
+ * May be NULL to unset the geometry.
+ * @param nWkbSize size of pabyWkb in bytes.
+ *
+ * @return OGRERR_NONE if successful, or OGRERR_FAILURE if the index is invalid
+ * or the WKB buffer is obviously corrupted.
+ *
+ * @since GDAL 3.7
+ */
+
+OGRErr OGRFeature::SetGeomFieldFromWkbDirectly( int iField, GByte* pabyWkb,
+                                                size_t nWkbSize )
+
+{
+    if( iField < 0 || iField >= GetGeomFieldCount() )
+    {
+        CPLFree(pabyWkb);
+        return OGRERR_FAILURE;
+    }
+
+    if( pabyWkb == nullptr )
+        return SetGeomFieldDirectly(iField, nullptr);
+
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    if( nWkbSize < 5 ||
+        OGRReadWKBGeometryType(pabyWkb, wkbVariantOldOgc,
+                               &eGeomType) != OGRERR_NONE )
+    {
+        CPLFree(pabyWkb);
+        return OGRERR_FAILURE;
+    }
+
+    if( m_papabyLazyWkb == nullptr )
+    {
+        m_papabyLazyWkb = static_cast<GByte**>(
+            VSI_CALLOC_VERBOSE(GetGeomFieldCount(), sizeof(GByte*)));
+        m_panLazyWkbSize = static_cast<size_t*>(
+            VSI_CALLOC_VERBOSE(GetGeomFieldCount(), sizeof(size_t)));
+        if( m_papabyLazyWkb == nullptr || m_panLazyWkbSize == nullptr )
+        {
+            CPLFree(m_papabyLazyWkb);
+            m_papabyLazyWkb = nullptr;
+            CPLFree(m_panLazyWkbSize);
+            m_panLazyWkbSize = nullptr;
+            CPLFree(pabyWkb);
+            return OGRERR_NOT_ENOUGH_MEMORY;
+        }
+    }
+
+    delete papoGeometries[iField];
+    papoGeometries[iField] = nullptr;
+    CPLFree(m_papabyLazyWkb[iField]);
+    m_papabyLazyWkb[iField] = pabyWkb;
+    m_panLazyWkbSize[iField] = nWkbSize;
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                         SetGeomFieldFromWkb()                        */
+/************************************************************************/
+
+/**
+ * \brief Set feature geometry of a specified geometry field from WKB.
+ *
+ * This method operates exactly as SetGeomFieldFromWkbDirectly(), except that
+ * it makes a copy of the passed buffer. Callers that own a CPLMalloc()'ed
+ * buffer should use SetGeomFieldFromWkbDirectly() to avoid that copy, and
+ * callers that know the geometry will be requested anyway should rather
+ * instantiate it directly.
+ *
+ * @param iField geometry field to set.
+ * @param pabyWkb WKB buffer, or NULL to unset the geometry.
+ * @param nWkbSize size of pabyWkb in bytes.
+ *
+ * @return OGRERR_NONE if successful, or OGRERR_FAILURE if the index is invalid
+ * or the WKB buffer is obviously corrupted.
+ *
+ * @since GDAL 3.7
+ */
+
+OGRErr OGRFeature::SetGeomFieldFromWkb( int iField, const GByte* pabyWkb,
+                                        size_t nWkbSize )
+
+{
+    if( iField < 0 || iField >= GetGeomFieldCount() )
+        return OGRERR_FAILURE;
+
+    if( pabyWkb == nullptr )
+        return SetGeomFieldDirectly(iField, nullptr);
+
+    GByte* pabyCopy = static_cast<GByte*>(VSI_MALLOC_VERBOSE(nWkbSize));
+    if( pabyCopy == nullptr )
+        return OGRERR_NOT_ENOUGH_MEMORY;
+    memcpy(pabyCopy, pabyWkb, nWkbSize);
+
+    return SetGeomFieldFromWkbDirectly(iField, pabyCopy, nWkbSize);
+}
+
+/************************************************************************/
+/*                         GetGeomFieldRawWkb()                         */
+/************************************************************************/
+
+/**
+ * \brief Return the WKB of a geometry field, if it has not been instantiated
+ * as a geometry object yet.
+ *
+ * This allows passing through the WKB provided by the driver with
+ * SetGeomFieldFromWkb() or SetGeomFieldFromWkbDirectly() without
+ * instantiating the geometry. The bytes are returned as they were set,
+ * without any normalization of byte order or WKB variant.
+ *
+ * @param iField geometry field.
+ * @param[out] nWkbSize size of the returned buffer in bytes.
+ *
+ * @return a pointer to the WKB, owned by the feature and valid until the
+ * geometry field is modified or instantiated, or NULL if there is no such
+ * pending WKB (in which case GetGeomFieldRef() must be used).
+ *
+ * @since GDAL 3.7
+ */
+
+const GByte* OGRFeature::GetGeomFieldRawWkb( int iField,
+                                             size_t& nWkbSize ) const
+
+{
+    nWkbSize = 0;
+    if( iField < 0 || iField >= GetGeomFieldCount() ||
+        m_papabyLazyWkb == nullptr || m_papabyLazyWkb[iField] == nullptr )
+        return nullptr;
+
+    nWkbSize = m_panLazyWkbSize[iField];
+    return m_papabyLazyWkb[iField];
+}
+
+/************************************************************************/
+/*                        GetGeomFieldEnvelope()                        */
+/************************************************************************/
+
+/**
+ * \brief Return the 2D envelope of a geometry field.
+ *
+ * If the geometry is still in WKB form, its envelope is computed from the
+ * WKB buffer whenever possible, without instantiating the geometry object.
+ *
+ * @param iField geometry field.
+ * @param[out] sEnvelope envelope.
+ *
+ * @return OGRERR_NONE if successful, or OGRERR_FAILURE if the index is invalid
+ * or the geometry field is NULL.
+ *
+ * @since GDAL 3.7
+ */
+
+OGRErr OGRFeature::GetGeomFieldEnvelope( int iField,
+                                         OGREnvelope& sEnvelope ) const
+
+{
+    size_t nWkbSize = 0;
+    const GByte* pabyWkb = GetGeomFieldRawWkb(iField, nWkbSize);
+    if( pabyWkb != nullptr &&
+        OGRWKBGetBoundingBox(pabyWkb, nWkbSize, sEnvelope) )
+    {
+        return OGRERR_NONE;
+    }
+
+    const OGRGeometry* poGeom = GetGeomFieldRef(iField);
+    if( poGeom == nullptr )
+        return OGRERR_FAILURE;
+    poGeom->getEnvelope(&sEnvelope);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                      GetGeomFieldGeometryType()                      */
+/************************************************************************/
+
+/**
+ * \brief Return the type of the geometry of a geometry field.
+ *
+ * If the geometry is still in WKB form, its type is read from the WKB buffer,
+ * without instantiating the geometry object.
+ *
+ * @param iField geometry field.
+ *
+ * @return the geometry type, or wkbNone if the index is invalid or the
+ * geometry field is NULL.
+ *
+ * @since GDAL 3.7
+ */
+
+OGRwkbGeometryType OGRFeature::GetGeomFieldGeometryType( int iField ) const
+
+{
+    size_t nWkbSize = 0;
+    const GByte* pabyWkb = GetGeomFieldRawWkb(iField, nWkbSize);
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    if( pabyWkb != nullptr &&
+        OGRReadWKBGeometryType(pabyWkb, wkbVariantOldOgc,
+                               &eGeomType) == OGRERR_NONE )
+    {
+        return eGeomType;
+    }
+
+    const OGRGeometry* poGeom = GetGeomFieldRef(iField);
+    if( poGeom == nullptr )
+        return wkbNone;
+    return poGeom->getGeometryType();
+}
+
+/************************************************************************/
+/*                        MaterializeGeomField()                        */
+/*                                                                      */
+/*      Instantiate the geometry object of a geometry field set with    */
+/*      SetGeomFieldFromWkb(). Although const, this modifies the        */
+/*      feature: const accessors of a feature with pending WKB must     */
+/*      not be called concurrently from several threads.                */
+/************************************************************************/
+
+void OGRFeature::MaterializeGeomField( int iField ) const
+
+{
+    if( m_papabyLazyWkb == nullptr || m_papabyLazyWkb[iField] == nullptr )
+        return;
+
+    GByte* pabyWkb = m_papabyLazyWkb[iField];
+    m_papabyLazyWkb[iField] = nullptr;
+
+    OGRGeometry* poGeom = nullptr;
+    if( OGRGeometryFactory::createFromWkb(
+            pabyWkb, nullptr, &poGeom,
+            m_panLazyWkbSize[iField]) != OGRERR_NONE )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Unable to read geometry");
+        poGeom = nullptr;
+    }
+    else
+    {
+        poGeom->assignSpatialReference(
+            poDefn->GetGeomFieldDefn(iField)->GetSpatialRef());
+    }
+    CPLFree(pabyWkb);
+
+    papoGeometries[iField] = poGeom;
+}
+
+/************************************************************************/
+/*                        DiscardLazyGeomField()                        */
+/************************************************************************/
+
+void OGRFeature::DiscardLazyGeomField( int iField )
+
+{
+    if( m_papabyLazyWkb != nullptr )
+    {
+        CPLFree(m_papabyLazyWkb[iField]);
+        m_papabyLazyWkb[iField] = nullptr;
+    }
+}
+
+/************************************************************************/
+/*                             SwapContent()                            */
+/*                                                                      */
+/*      Exchange the definition, FID, fields, geometries, style and     */
+/*      native data of two features. Members of derived classes are     */
+/*      not exchanged.                                                  */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+void OGRFeature::SwapContent( OGRFeature& oOther )
+{
+    std::swap(nFID, oOther.nFID);
+    std::swap(poDefn, oOther.poDefn);
+    std::swap(papoGeometries, oOther.papoGeometries);
+    std::swap(pauFields, oOther.pauFields);
+    std::swap(m_pszNativeData, oOther.m_pszNativeData);
+    std::swap(m_pszNativeMediaType, oOther.m_pszNativeMediaType);
+    std::swap(m_papabyLazyWkb, oOther.m_papabyLazyWkb);
+    std::swap(m_panLazyWkbSize, oOther.m_panLazyWkbSize);
+    std::swap(m_pszStyleString, oOther.m_pszStyleString);
+    std::swap(m_poStyleTable, oOther.m_poStyleTable);
+    std::swap(m_pszTmpFieldValue, oOther.m_pszTmpFieldValue);
+}
+//! @endcond
+
 /************************************************************************/
 /*                               Clone()                                */
 /************************************************************************/
@@ -1156,6 +1498,16 @@ bool OGRFeature::CopySelfTo( OGRFeature* poNew ) const
                     return false;
                 }
             }
+            else if( m_papabyLazyWkb != nullptr &&
+                     m_papabyLazyWkb[i] != nullptr )
+            {
+                if( poNew->SetGeomFieldFromWkb(i, m_papabyLazyWkb[i],
+                                               m_panLazyWkbSize[i])
+                                                        != OGRERR_NONE )
+                {
+                    return false;
+                }
+            }
         }
     }
 
@@ -1504,6 +1856,7 @@ int OGRFeature::IsFieldSet( int iField ) const
     const int iSpecialField = iField - poDefn->GetFieldCount();
     if( iSpecialField >= 0 )
     {
+        MaterializeGeomField(0);
         // Special field value accessors.
         switch( iSpecialField )
         {
@@ -1996,6 +2349,7 @@ int OGRFeature::GetFieldAsInteger( int iField ) const
     int iSpecialField = iField - poDefn->GetFieldCount();
     if( iSpecialField >= 0 )
     {
+        MaterializeGeomField(0);
         // Special field value accessors.
         switch( iSpecialField )
         {
@@ -2135,6 +2489,7 @@ GIntBig OGRFeature::GetFieldAsInteger64( int iField ) const
     const int iSpecialField = iField - poDefn->GetFieldCount();
     if( iSpecialField >= 0 )
     {
+        MaterializeGeomField(0);
         // Special field value accessors.
         switch( iSpecialField )
         {
@@ -2253,6 +2608,7 @@ double OGRFeature::GetFieldAsDouble( int iField ) const
     const int iSpecialField = iField - poDefn->GetFieldCount();
     if( iSpecialField >= 0 )
     {
+        MaterializeGeomField(0);
         // Special field value accessors.
         switch( iSpecialField )
         {
@@ -2438,6 +2794,7 @@ const char *OGRFeature::GetFieldAsString( int iField ) const
     const int iSpecialField = iField - poDefn->GetFieldCount();
     if( iSpecialField >= 0 )
     {
+        MaterializeGeomField(0);
         // Special field value accessors.
         switch( iSpecialField )
         {
@@ -5498,6 +5855,7 @@ std::string OGRFeature::DumpReadableAsString( CSLConstList papszOptions ) const
             {
                 OGRGeomFieldDefn *poFDefn = poDefn->GetGeomFieldDefn(iField);
 
+                MaterializeGeomField(iField);
                 if( papoGeometries[iField] != nullptr )
                 {
                     osRet += "  ";
@@ -6570,6 +6928,16 @@ OGRErr OGRFeature::RemapGeomFields( OGRFeatureDefn *poNewDefn,
     if( poNewDefn == nullptr )
         poNewDefn = poDefn;
 
+    if( m_papabyLazyWkb != nullptr )
+    {
+        for( int i = 0; i < poDefn->GetGeomFieldCount(); i++ )
+            MaterializeGeomField(i);
+        CPLFree(m_papabyLazyWkb);
+        m_papabyLazyWkb = nullptr;
+        CPLFree(m_panLazyWkbSize);
+        m_panLazyWkbSize = nullptr;
+    }
+
     OGRGeometry** papoNewGeomFields = static_cast<OGRGeometry **>(
         CPLCalloc( poNewDefn->GetGeomFieldCount(), sizeof(OGRGeometry*) ) );
 
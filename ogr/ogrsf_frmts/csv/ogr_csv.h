@@ -94,6 +94,7 @@ class OGRCSVLayer final: public OGRLayer
     bool                bHasFieldNames;
 
     OGRFeature         *GetNextUnfilteredFeature();
+    bool                GetNextUnfilteredFeatureInto( OGRFeature& oFeature );
 
     bool                bNew;
     bool                bInWriteMode;
@@ -174,6 +175,7 @@ class OGRCSVLayer final: public OGRLayer
 
     void                ResetReading() override;
     OGRFeature         *GetNextFeature() override;
+    bool                GetNextFeatureInto( OGRFeature& oFeature ) override;
     virtual OGRFeature *GetFeature( GIntBig nFID ) override;
 
     OGRFeatureDefn     *GetLayerDefn() override { return poFeatureDefn; }
@@ -1378,13 +1378,30 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if( fpCSV == nullptr )
         return nullptr;
 
+    auto poFeature = cpl::make_unique<OGRFeature>(poFeatureDefn);
+    if( !GetNextUnfilteredFeatureInto(*poFeature) )
+        return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                    GetNextUnfilteredFeatureInto()                    */
+/************************************************************************/
+
+bool OGRCSVLayer::GetNextUnfilteredFeatureInto( OGRFeature& oFeature )
+
+{
+    if( fpCSV == nullptr )
+        return false;
+
     // Read the CSV record.
     char **papszTokens = GetNextLineTokens();
     if( papszTokens == nullptr )
-        return nullptr;
+        return false;
 
-    // Create the OGR feature.
-    OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
+    // Recycle the OGR feature.
+    oFeature.Reset();
+    OGRFeature *poFeature = &oFeature;
 
     // Set attributes for any indicated attribute records.
     int iOGRField = 0;
@@ -1720,7 +1737,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
     m_nFeaturesRead++;
 
-    return poFeature;
+    return true;
 }
 
 /************************************************************************/
@@ -1730,6 +1747,22 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 OGRFeature *OGRCSVLayer::GetNextFeature()
 
 {
+    auto poFeature = cpl::make_unique<OGRFeature>(poFeatureDefn);
+    if( !OGRCSVLayer::GetNextFeatureInto(*poFeature) )
+        return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRCSVLayer::GetNextFeatureInto( OGRFeature& oFeature )
+
+{
+    if( oFeature.GetDefnRef() != poFeatureDefn )
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
     if( bNeedRewindBeforeRead )
         ResetReading();
 
@@ -1737,16 +1770,13 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     // spatial criteria.
     while( true )
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
-        if( poFeature == nullptr )
-            return nullptr;
+        if( !GetNextUnfilteredFeatureInto(oFeature) )
+            return false;
 
         if( (m_poFilterGeom == nullptr ||
-             FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
-            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)) )
-            return poFeature;
-
-        delete poFeature;
+             FilterGeometry(oFeature.GetGeomFieldRef(m_iGeomFieldFilter))) &&
+            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(&oFeature)) )
+            return true;
     }
 }
 
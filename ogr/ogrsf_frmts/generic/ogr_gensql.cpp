@@ -34,6 +34,9 @@
 #include "ogr_api.h"
 #include "cpl_time.h"
 #include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -639,6 +642,10 @@ void OGRGenSQLResultsLayer::ResetReading()
 
     nNextIndexFID = psSelectInfo->offset;
     nIteratedFeatures = -1;
+
+    // The secondary layers may have changed since the hash joins were built
+    m_apoHashJoins.clear();
+    m_bHashJoinsInitialized = false;
 }
 
 /************************************************************************/
@@ -731,6 +738,14 @@ GIntBig OGRGenSQLResultsLayer::GetFeatureCount( int bForce )
 
         nRet = psSelectInfo->column_summary[0].count;
     }
+    else if( psSelectInfo->query_mode == SWQM_SUMMARY_RECORD &&
+             psSelectInfo->group_specs > 0 )
+    {
+        if( !PrepareSummary() )
+            return 0;
+
+        nRet = static_cast<GIntBig>(m_apoGroupByFeatures.size());
+    }
     else if( psSelectInfo->query_mode != SWQM_RECORDSET )
         return 1;
     else if( m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL() )
@@ -815,6 +830,102 @@ int OGRGenSQLResultsLayer::ContainGeomSpecialField(swq_expr_node* expr)
     return FALSE;
 }
 
+/************************************************************************/
+/*                          GetSummaryValue()                           */
+/*                                                                      */
+/*      Fetch the value of a source feature to accumulate in the        */
+/*      summary of a column.  Returns false if the feature must not be  */
+/*      accumulated for that column.                                    */
+/************************************************************************/
+
+static bool GetSummaryValue( OGRFeature* poSrcFeature,
+                             const swq_col_def* psColDef,
+                             const char*& pszVal )
+{
+    OGRFeatureDefn* poSrcDefn = poSrcFeature->GetDefnRef();
+
+    pszVal = nullptr;
+    if (psColDef->col_func == SWQCF_COUNT)
+    {
+        /* psColDef->field_index can be -1 in the case of a COUNT(*) */
+        if (psColDef->field_index < 0)
+        {
+            pszVal = "";
+            return true;
+        }
+        if (IS_GEOM_FIELD_INDEX(poSrcDefn, psColDef->field_index) )
+        {
+            const int iSrcGeomField = ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(
+                    poSrcDefn, psColDef->field_index);
+            if( poSrcFeature->GetGeomFieldRef(iSrcGeomField) == nullptr )
+                return false;
+            pszVal = "";
+            return true;
+        }
+        if (!poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
+            return false;
+        pszVal = poSrcFeature->GetFieldAsString( psColDef->field_index );
+        return true;
+    }
+
+    if (poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
+        pszVal = poSrcFeature->GetFieldAsString( psColDef->field_index );
+    return true;
+}
+
+/************************************************************************/
+/*                        SetFieldFromSummary()                         */
+/************************************************************************/
+
+static void SetFieldFromSummary( OGRFeature* poFeature, int iField,
+                                 const swq_col_def* psColDef,
+                                 const swq_summary& oSummary )
+{
+    if( psColDef->col_func == SWQCF_AVG && oSummary.count > 0 )
+    {
+        if( psColDef->field_type == SWQ_DATE ||
+            psColDef->field_type == SWQ_TIME ||
+            psColDef->field_type == SWQ_TIMESTAMP)
+        {
+            struct tm brokendowntime;
+            double dfAvg = oSummary.sum / oSummary.count;
+            CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg), &brokendowntime);
+            poFeature->SetField( iField,
+                                 brokendowntime.tm_year + 1900,
+                                 brokendowntime.tm_mon + 1,
+                                 brokendowntime.tm_mday,
+                                 brokendowntime.tm_hour,
+                                 brokendowntime.tm_min,
+                                 static_cast<float>(brokendowntime.tm_sec + fmod(dfAvg, 1)),
+                                 0);
+        }
+        else
+            poFeature->SetField( iField, oSummary.sum / oSummary.count );
+    }
+    else if( psColDef->col_func == SWQCF_MIN && oSummary.count > 0 )
+    {
+        if( psColDef->field_type == SWQ_DATE ||
+            psColDef->field_type == SWQ_TIME ||
+            psColDef->field_type == SWQ_TIMESTAMP)
+            poFeature->SetField( iField, oSummary.osMin.c_str() );
+        else
+            poFeature->SetField( iField, oSummary.min );
+    }
+    else if( psColDef->col_func == SWQCF_MAX && oSummary.count > 0 )
+    {
+        if( psColDef->field_type == SWQ_DATE ||
+            psColDef->field_type == SWQ_TIME ||
+            psColDef->field_type == SWQ_TIMESTAMP)
+            poFeature->SetField( iField, oSummary.osMax.c_str() );
+        else
+            poFeature->SetField( iField, oSummary.max );
+    }
+    else if( psColDef->col_func == SWQCF_COUNT )
+        poFeature->SetField( iField, oSummary.count );
+    else if( psColDef->col_func == SWQCF_SUM && oSummary.count > 0 )
+        poFeature->SetField( iField, oSummary.sum );
+}
+
 /************************************************************************/
 /*                           PrepareSummary()                           */
 /************************************************************************/
@@ -824,11 +935,14 @@ int OGRGenSQLResultsLayer::PrepareSummary()
 {
     swq_select *psSelectInfo = static_cast<swq_select*>(pSelectInfo);
 
-    if( poSummaryFeature != nullptr )
+    if( poSummaryFeature != nullptr || m_bGroupByPrepared )
         return TRUE;
 
-    poSummaryFeature = new OGRFeature( poDefn );
-    poSummaryFeature->SetFID( 0 );
+    if( psSelectInfo->group_specs == 0 )
+    {
+        poSummaryFeature = new OGRFeature( poDefn );
+        poSummaryFeature->SetFID( 0 );
+    }
 
 /* -------------------------------------------------------------------- */
 /*      Ensure our query parameters are in place on the source          */
@@ -878,6 +992,19 @@ int OGRGenSQLResultsLayer::PrepareSummary()
             poSrcLayer->GetLayerDefn()->SetGeometryIgnored(TRUE);
     }
 
+/* -------------------------------------------------------------------- */
+/*      With GROUP BY, accumulate one summary per group.                */
+/* -------------------------------------------------------------------- */
+    if( psSelectInfo->group_specs > 0 )
+    {
+        const int bRet = PrepareGroupBy();
+
+        poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
+        ClearFilters();
+
+        return bRet;
+    }
+
 /* -------------------------------------------------------------------- */
 /*      We treat COUNT(*) as a special case, and fill with              */
 /*      GetFeatureCount().                                            */
@@ -916,35 +1043,11 @@ int OGRGenSQLResultsLayer::PrepareSummary()
         {
             swq_col_def *psColDef = psSelectInfo->column_defs + iField;
 
-            if (psColDef->col_func == SWQCF_COUNT)
-            {
-                /* psColDef->field_index can be -1 in the case of a COUNT(*) */
-                if (psColDef->field_index < 0)
-                    pszError = swq_select_summarize( psSelectInfo, iField, "" );
-                else if (IS_GEOM_FIELD_INDEX(poSrcLayer->GetLayerDefn(), psColDef->field_index) )
-                {
-                    int iSrcGeomField = ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(
-                            poSrcLayer->GetLayerDefn(), psColDef->field_index);
-                    OGRGeometry* poGeom = poSrcFeature->GetGeomFieldRef(iSrcGeomField);
-                    if( poGeom != nullptr )
-                        pszError = swq_select_summarize( psSelectInfo, iField, "" );
-                    else
-                        pszError = nullptr;
-                }
-                else if (poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
-                    pszError = swq_select_summarize( psSelectInfo, iField, poSrcFeature->GetFieldAsString(
-                                                psColDef->field_index ) );
-                else
-                    pszError = nullptr;
-            }
-            else
-            {
-                const char* pszVal = nullptr;
-                if (poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
-                    pszVal = poSrcFeature->GetFieldAsString(
-                                                psColDef->field_index );
+            const char* pszVal = nullptr;
+            if( GetSummaryValue( poSrcFeature, psColDef, pszVal ) )
                 pszError = swq_select_summarize( psSelectInfo, iField, pszVal );
-            }
+            else
+                pszError = nullptr;
 
             if( pszError != nullptr )
             {
@@ -1005,58 +1108,288 @@ int OGRGenSQLResultsLayer::PrepareSummary()
             swq_col_def *psColDef = psSelectInfo->column_defs + iField;
             if (!psSelectInfo->column_summary.empty() )
             {
-                swq_summary& oSummary = psSelectInfo->column_summary[iField];
+                SetFieldFromSummary( poSummaryFeature, iField, psColDef,
+                                     psSelectInfo->column_summary[iField] );
+            }
+            else if ( psColDef->col_func == SWQCF_COUNT )
+                poSummaryFeature->SetField( iField, 0 );
+        }
+    }
 
-                if( psColDef->col_func == SWQCF_AVG && oSummary.count > 0 )
-                {
-                    if( psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP)
-                    {
-                        struct tm brokendowntime;
-                        double dfAvg = oSummary.sum / oSummary.count;
-                        CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg), &brokendowntime);
-                        poSummaryFeature->SetField( iField,
-                                                    brokendowntime.tm_year + 1900,
-                                                    brokendowntime.tm_mon + 1,
-                                                    brokendowntime.tm_mday,
-                                                    brokendowntime.tm_hour,
-                                                    brokendowntime.tm_min,
-                                                    static_cast<float>(brokendowntime.tm_sec + fmod(dfAvg, 1)),
-                                                    0);
-                    }
-                    else
-                        poSummaryFeature->SetField( iField,
-                                                    oSummary.sum / oSummary.count );
-                }
-                else if( psColDef->col_func == SWQCF_MIN && oSummary.count > 0 )
+    return TRUE;
+}
+
+/************************************************************************/
+/*                           GetGroupByKey()                            */
+/*                                                                      */
+/*      Serialize the values of the GROUP BY fields of a source         */
+/*      feature into a key suitable for hashing.                        */
+/************************************************************************/
+
+static void GetGroupByKey( OGRFeature* poSrcFeature,
+                           const swq_select* psSelectInfo,
+                           std::string& osKey )
+{
+    osKey.clear();
+    for( int i = 0; i < psSelectInfo->group_specs; i++ )
+    {
+        const int iField = psSelectInfo->group_defs[i].field_index;
+        if( !poSrcFeature->IsFieldSetAndNotNull(iField) )
+        {
+            // All NULL values fall in the same group.
+            osKey += '\0';
+            continue;
+        }
+        osKey += '\1';
+
+        const OGRField* psField = poSrcFeature->GetRawFieldRef(iField);
+        const char* pszVal = nullptr;
+        switch( poSrcFeature->GetFieldDefnRef(iField)->GetType() )
+        {
+            case OFTInteger:
+                osKey.append(reinterpret_cast<const char*>(&psField->Integer),
+                             sizeof(psField->Integer));
+                break;
+
+            case OFTInteger64:
+                osKey.append(reinterpret_cast<const char*>(&psField->Integer64),
+                             sizeof(psField->Integer64));
+                break;
+
+            case OFTReal:
+            {
+                // Normalize -0 to 0
+                const double dfVal = psField->Real == 0 ? 0.0 : psField->Real;
+                osKey.append(reinterpret_cast<const char*>(&dfVal),
+                             sizeof(dfVal));
+                break;
+            }
+
+            case OFTString:
+                pszVal = psField->String;
+                break;
+
+            default:
+                pszVal = poSrcFeature->GetFieldAsString(iField);
+                break;
+        }
+
+        if( pszVal != nullptr )
+        {
+            const size_t nLen = strlen(pszVal);
+            osKey.append(reinterpret_cast<const char*>(&nLen), sizeof(nLen));
+            osKey.append(pszVal, nLen);
+        }
+    }
+}
+
+/************************************************************************/
+/*                           PrepareGroupBy()                           */
+/*                                                                      */
+/*      Stream the source features once, accumulating the aggregates   */
+/*      of each group in a hash table keyed by the GROUP BY values,     */
+/*      and build one result feature per group.                         */
+/************************************************************************/
+
+int OGRGenSQLResultsLayer::PrepareGroupBy()
+
+{
+    swq_select *psSelectInfo = static_cast<swq_select*>(pSelectInfo);
+    OGRFeatureDefn *poSrcDefn = poSrcLayer->GetLayerDefn();
+
+/* -------------------------------------------------------------------- */
+/*      The values of the GROUP BY fields of each group are kept in a   */
+/*      feature with only those fields.                                 */
+/* -------------------------------------------------------------------- */
+    OGRFeatureDefn oKeyDefn("GROUP_BY");
+    oKeyDefn.SetGeomType(wkbNone);
+    for( int i = 0; i < psSelectInfo->group_specs; i++ )
+    {
+        const swq_group_def *psGroupDef = psSelectInfo->group_defs + i;
+        if( psGroupDef->field_index >= poSrcDefn->GetFieldCount() )
+        {
+            CPLError( CE_Failure, CPLE_NotSupported,
+                      "GROUP BY on special field %s not supported.",
+                      psGroupDef->field_name );
+            return FALSE;
+        }
+        oKeyDefn.AddFieldDefn(
+            poSrcDefn->GetFieldDefn(psGroupDef->field_index) );
+    }
+
+    struct Group
+    {
+        OGRFeatureUniquePtr      poKeyFeature{};
+        std::vector<swq_summary> aoSummaries{};
+    };
+    std::vector<Group> aoGroups;
+    std::unordered_map<std::string, size_t> oMapKeyToGroup;
+    std::string osKey;
+
+    try
+    {
+        while( true )
+        {
+            OGRFeatureUniquePtr poSrcFeature(poSrcLayer->GetNextFeature());
+            if( poSrcFeature == nullptr )
+                break;
+
+            GetGroupByKey( poSrcFeature.get(), psSelectInfo, osKey );
+
+            Group* poGroup = nullptr;
+            const auto oIter = oMapKeyToGroup.find(osKey);
+            if( oIter == oMapKeyToGroup.end() )
+            {
+                oMapKeyToGroup[osKey] = aoGroups.size();
+                aoGroups.emplace_back();
+                poGroup = &aoGroups.back();
+
+                poGroup->poKeyFeature.reset(new OGRFeature(&oKeyDefn));
+                for( int i = 0; i < psSelectInfo->group_specs; i++ )
                 {
-                    if( psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP)
-                        poSummaryFeature->SetField( iField, oSummary.osMin.c_str() );
+                    const int iSrcField =
+                        psSelectInfo->group_defs[i].field_index;
+                    if( poSrcFeature->IsFieldSetAndNotNull(iSrcField) )
+                        poGroup->poKeyFeature->SetField(
+                            i, poSrcFeature->GetRawFieldRef(iSrcField) );
                     else
-                        poSummaryFeature->SetField( iField, oSummary.min );
+                        poGroup->poKeyFeature->SetFieldNull(i);
                 }
-                else if( psColDef->col_func == SWQCF_MAX && oSummary.count > 0 )
+                poGroup->aoSummaries.resize(psSelectInfo->result_columns);
+            }
+            else
+            {
+                poGroup = &aoGroups[oIter->second];
+            }
+
+            for( int iField = 0; iField < psSelectInfo->result_columns; iField++ )
+            {
+                const swq_col_def *psColDef = psSelectInfo->column_defs + iField;
+                if( psColDef->col_func == SWQCF_NONE )
+                    continue;
+
+                const char* pszVal = nullptr;
+                if( !GetSummaryValue( poSrcFeature.get(), psColDef, pszVal ) )
+                    continue;
+
+                const char* pszError = swq_summarize_value(
+                    psColDef, poGroup->aoSummaries[iField], pszVal );
+                if( pszError != nullptr )
                 {
-                    if( psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP)
-                        poSummaryFeature->SetField( iField, oSummary.osMax.c_str() );
-                    else
-                        poSummaryFeature->SetField( iField, oSummary.max );
+                    CPLError( CE_Failure, CPLE_AppDefined, "%s", pszError );
+                    return FALSE;
                 }
-                else if( psColDef->col_func == SWQCF_COUNT )
-                    poSummaryFeature->SetField( iField, oSummary.count );
-                else if( psColDef->col_func == SWQCF_SUM && oSummary.count > 0 )
-                    poSummaryFeature->SetField( iField, oSummary.sum );
             }
-            else if ( psColDef->col_func == SWQCF_COUNT )
-                poSummaryFeature->SetField( iField, 0 );
         }
     }
+    catch( const std::bad_alloc& )
+    {
+        CPLError( CE_Failure, CPLE_OutOfMemory,
+                  "Out of memory while computing GROUP BY" );
+        return FALSE;
+    }
 
+    CPLDebug( "GenSQL", "GROUP BY on layer %s: %d groups",
+              poSrcLayer->GetName(), static_cast<int>(aoGroups.size()) );
+
+/* -------------------------------------------------------------------- */
+/*      Downcast COUNT() columns to OFTInteger if possible, as done     */
+/*      for a single summary record.                                    */
+/* -------------------------------------------------------------------- */
+    for( int iField = 0; iField < psSelectInfo->result_columns; iField++ )
+    {
+        const swq_col_def *psColDef = psSelectInfo->column_defs + iField;
+        if( psColDef->col_func != SWQCF_COUNT )
+            continue;
+
+        bool bFitsOnInt32 = true;
+        for( const auto& oGroup: aoGroups )
+        {
+            if( !CPL_INT64_FITS_ON_INT32(oGroup.aoSummaries[iField].count) )
+            {
+                bFitsOnInt32 = false;
+                break;
+            }
+        }
+        if( bFitsOnInt32 )
+            poDefn->GetFieldDefn(iField)->SetType(OFTInteger);
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Sort the groups according to the ORDER BY specs, which are      */
+/*      all GROUP BY fields.  Otherwise groups are returned in the      */
+/*      order they were first encountered.                              */
+/* -------------------------------------------------------------------- */
+    std::vector<size_t> anGroupOrder(aoGroups.size());
+    std::iota(anGroupOrder.begin(), anGroupOrder.end(), 0);
+
+    const int nOrderItems = psSelectInfo->order_specs;
+    if( nOrderItems > 0 )
+    {
+        std::vector<OGRField> asOrderFields(aoGroups.size() * nOrderItems);
+        for( size_t iGroup = 0; iGroup < aoGroups.size(); iGroup++ )
+        {
+            for( int iKey = 0; iKey < nOrderItems; iKey++ )
+            {
+                const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+                const int iGroupField = psSelectInfo->FindGroupBy(
+                    nullptr, psKeyDef->table_index, psKeyDef->field_index );
+                CPLAssert( iGroupField >= 0 );
+                asOrderFields[iGroup * nOrderItems + iKey] =
+                    *(aoGroups[iGroup].poKeyFeature->GetRawFieldRef(iGroupField));
+            }
+        }
+
+        std::stable_sort(anGroupOrder.begin(), anGroupOrder.end(),
+            [this, &asOrderFields, nOrderItems](size_t a, size_t b)
+            {
+                return Compare( &asOrderFields[a * nOrderItems],
+                                &asOrderFields[b * nOrderItems] ) < 0;
+            });
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Build the result features.                                      */
+/* -------------------------------------------------------------------- */
+    m_apoGroupByFeatures.clear();
+    m_apoGroupByFeatures.reserve(aoGroups.size());
+    for( size_t iGroup: anGroupOrder )
+    {
+        Group& oGroup = aoGroups[iGroup];
+        OGRFeatureUniquePtr poFeature(new OGRFeature(poDefn));
+        poFeature->SetFID( static_cast<GIntBig>(m_apoGroupByFeatures.size()) );
+
+        for( int iField = 0; iField < psSelectInfo->result_columns; iField++ )
+        {
+            const swq_col_def *psColDef = psSelectInfo->column_defs + iField;
+            if( psColDef->col_func == SWQCF_NONE )
+            {
+                const int iGroupField = psSelectInfo->FindGroupBy(
+                    psColDef->expr, psColDef->table_index,
+                    psColDef->field_index );
+                CPLAssert( iGroupField >= 0 );
+                if( oGroup.poKeyFeature->IsFieldSetAndNotNull(iGroupField) )
+                    poFeature->SetField( iField,
+                        oGroup.poKeyFeature->GetRawFieldRef(iGroupField) );
+                else
+                    poFeature->SetFieldNull( iField );
+            }
+            else
+            {
+                SetFieldFromSummary( poFeature.get(), iField, psColDef,
+                                     oGroup.aoSummaries[iField] );
+            }
+        }
+
+        // Release the accumulators as we go to limit peak memory usage.
+        oGroup.poKeyFeature.reset();
+        oGroup.aoSummaries.clear();
+        oGroup.aoSummaries.shrink_to_fit();
+
+        m_apoGroupByFeatures.push_back(std::move(poFeature));
+    }
+
+    m_bGroupByPrepared = true;
     return TRUE;
 }
 
@@ -1269,6 +1602,373 @@ static CPLString GetFilterForJoin(swq_expr_node* poExpr, OGRFeature* poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                              HashJoin                                */
+/************************************************************************/
+
+// Hash table of the features of the secondary layer of a JOIN whose
+// expression is an equality (or a AND of equalities) between fields of the
+// primary and secondary layers. Saves running an attribute query on the
+// secondary layer for each primary feature.
+struct OGRGenSQLHashJoin
+{
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    struct KeyPart
+    {
+        int     iPrimaryField = -1;
+        int     iSecondaryField = -1;
+        KeyType eType = KeyType::INTEGER;
+    };
+
+    std::vector<KeyPart> aoKeyParts{};
+    bool                 bBuilt = false;
+    // Set when the hash table could not be built. The generic
+    // attribute-filter based join is then used.
+    bool                 bDisabled = false;
+    // Features are kept in memory until they exceed the memory limit.
+    // Beyond that, only their FID is kept and they are fetched with
+    // GetFeature().
+    bool                 bFeaturesInMemory = true;
+    std::unordered_map<std::string, OGRFeatureUniquePtr> oMapFeatures{};
+    std::unordered_map<std::string, GIntBig> oMapFIDs{};
+};
+
+/************************************************************************/
+/*                      CollectHashJoinKeyParts()                       */
+/************************************************************************/
+
+static bool CollectHashJoinKeyParts(
+    const swq_expr_node* poExpr, int secondary_table,
+    OGRFeatureDefn* poPrimaryDefn, OGRFeatureDefn* poSecondaryDefn,
+    std::vector<OGRGenSQLHashJoin::KeyPart>& aoKeyParts)
+{
+    using KeyType = OGRGenSQLHashJoin::KeyType;
+
+    if( poExpr->eNodeType != SNT_OPERATION )
+        return false;
+
+    if( poExpr->nOperation == SWQ_AND && poExpr->nSubExprCount == 2 )
+    {
+        return CollectHashJoinKeyParts(poExpr->papoSubExpr[0], secondary_table,
+                                       poPrimaryDefn, poSecondaryDefn,
+                                       aoKeyParts) &&
+               CollectHashJoinKeyParts(poExpr->papoSubExpr[1], secondary_table,
+                                       poPrimaryDefn, poSecondaryDefn,
+                                       aoKeyParts);
+    }
+
+    if( poExpr->nOperation != SWQ_EQ || poExpr->nSubExprCount != 2 )
+        return false;
+    const swq_expr_node* poLeft = poExpr->papoSubExpr[0];
+    const swq_expr_node* poRight = poExpr->papoSubExpr[1];
+    if( poLeft->eNodeType != SNT_COLUMN || poRight->eNodeType != SNT_COLUMN )
+        return false;
+    if( poLeft->table_index == secondary_table && poRight->table_index == 0 )
+        std::swap(poLeft, poRight);
+    if( poLeft->table_index != 0 || poRight->table_index != secondary_table )
+        return false;
+
+    // Only regular fields: no special fields nor geometries
+    if( poLeft->field_index < 0 ||
+        poLeft->field_index >= poPrimaryDefn->GetFieldCount() ||
+        poRight->field_index < 0 ||
+        poRight->field_index >= poSecondaryDefn->GetFieldCount() )
+        return false;
+
+    OGRGenSQLHashJoin::KeyPart oPart;
+    oPart.iPrimaryField = poLeft->field_index;
+    oPart.iSecondaryField = poRight->field_index;
+    const OGRFieldType ePrimaryType =
+        poPrimaryDefn->GetFieldDefn(poLeft->field_index)->GetType();
+    const OGRFieldType eSecondaryType =
+        poSecondaryDefn->GetFieldDefn(poRight->field_index)->GetType();
+    const auto IsInteger = [](OGRFieldType eType)
+        { return eType == OFTInteger || eType == OFTInteger64; };
+    if( IsInteger(ePrimaryType) && IsInteger(eSecondaryType) )
+        oPart.eType = KeyType::INTEGER;
+    else if( (IsInteger(ePrimaryType) || ePrimaryType == OFTReal) &&
+             (IsInteger(eSecondaryType) || eSecondaryType == OFTReal) )
+        oPart.eType = KeyType::REAL;
+    else if( ePrimaryType == OFTString && eSecondaryType == OFTString )
+        oPart.eType = KeyType::STRING;
+    else
+        return false;
+    aoKeyParts.push_back(oPart);
+    return true;
+}
+
+/************************************************************************/
+/*                          GetHashJoinKey()                            */
+/************************************************************************/
+
+// Returns false if one of the key fields is null, in which case the feature
+// cannot participate in the join.
+static bool GetHashJoinKey(
+    OGRFeature* poFeature,
+    const std::vector<OGRGenSQLHashJoin::KeyPart>& aoKeyParts,
+    bool bPrimary, std::string& osKey)
+{
+    using KeyType = OGRGenSQLHashJoin::KeyType;
+
+    osKey.clear();
+    for( const auto& oPart: aoKeyParts )
+    {
+        const int iField = bPrimary ? oPart.iPrimaryField : oPart.iSecondaryField;
+        if( !poFeature->IsFieldSetAndNotNull(iField) )
+            return false;
+        switch( oPart.eType )
+        {
+            case KeyType::INTEGER:
+            {
+                const GIntBig nVal = poFeature->GetFieldAsInteger64(iField);
+                osKey.append(reinterpret_cast<const char*>(&nVal), sizeof(nVal));
+                break;
+            }
+            case KeyType::REAL:
+            {
+                double dfVal = poFeature->GetFieldAsDouble(iField);
+                if( dfVal == 0 )
+                    dfVal = 0; // normalize -0
+                osKey.append(reinterpret_cast<const char*>(&dfVal), sizeof(dfVal));
+                break;
+            }
+            case KeyType::STRING:
+            {
+                // Exact values: the comparison is case sensitive, as with
+                // drivers evaluating the join filter natively, and as
+                // GROUP BY.
+                const char* pszVal = poFeature->GetFieldAsString(iField);
+                const size_t nLen = strlen(pszVal);
+                const GUInt32 nLen32 = static_cast<GUInt32>(nLen);
+                osKey.append(reinterpret_cast<const char*>(&nLen32), sizeof(nLen32));
+                osKey.append(pszVal, nLen);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     EstimateFeatureMemoryUsage()                     */
+/************************************************************************/
+
+static size_t EstimateFeatureMemoryUsage(OGRFeature* poFeature)
+{
+    size_t nSize = sizeof(OGRFeature) +
+        static_cast<size_t>(poFeature->GetFieldCount()) * sizeof(OGRField);
+    for( int i = 0; i < poFeature->GetFieldCount(); ++i )
+    {
+        if( !poFeature->IsFieldSetAndNotNull(i) )
+            continue;
+        switch( poFeature->GetFieldDefnRef(i)->GetType() )
+        {
+            case OFTString:
+                nSize += strlen(poFeature->GetRawFieldRef(i)->String) + 1;
+                break;
+            case OFTBinary:
+                nSize += poFeature->GetRawFieldRef(i)->Binary.nCount;
+                break;
+            case OFTIntegerList:
+            case OFTInteger64List:
+            case OFTRealList:
+                nSize += 8 * poFeature->GetRawFieldRef(i)->IntegerList.nCount;
+                break;
+            case OFTStringList:
+            {
+                char** papszList = poFeature->GetRawFieldRef(i)->StringList.paList;
+                for( int j = 0; papszList && papszList[j]; ++j )
+                    nSize += sizeof(char*) + strlen(papszList[j]) + 1;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    for( int i = 0; i < poFeature->GetGeomFieldCount(); ++i )
+    {
+        const OGRGeometry* poGeom = poFeature->GetGeomFieldRef(i);
+        if( poGeom )
+            nSize += poGeom->WkbSize();
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                           InitHashJoins()                            */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::InitHashJoins()
+{
+    if( m_bHashJoinsInitialized )
+        return;
+    m_bHashJoinsInitialized = true;
+
+    swq_select *psSelectInfo = static_cast<swq_select*>(pSelectInfo);
+    m_apoHashJoins.resize(psSelectInfo->join_count);
+    if( !CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES")) )
+        return;
+
+    for( int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++ )
+    {
+        swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        OGRLayer *poJoinLayer = papoTableLayers[psJoinInfo->secondary_table];
+        // Building the hash table would mess up with the reading of the
+        // primary layer
+        if( poJoinLayer == poSrcLayer )
+            continue;
+
+        std::unique_ptr<OGRGenSQLHashJoin> poHashJoin(new OGRGenSQLHashJoin());
+        if( CollectHashJoinKeyParts(psJoinInfo->poExpr,
+                                    psJoinInfo->secondary_table,
+                                    poSrcLayer->GetLayerDefn(),
+                                    poJoinLayer->GetLayerDefn(),
+                                    poHashJoin->aoKeyParts) )
+        {
+            m_apoHashJoins[iJoin] = std::move(poHashJoin);
+        }
+    }
+}
+
+/************************************************************************/
+/*                           BuildHashJoin()                            */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::BuildHashJoin( int iJoin )
+{
+    swq_select *psSelectInfo = static_cast<swq_select*>(pSelectInfo);
+    swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+    OGRLayer *poJoinLayer = papoTableLayers[psJoinInfo->secondary_table];
+    OGRGenSQLHashJoin* poHashJoin = m_apoHashJoins[iJoin].get();
+    poHashJoin->bBuilt = true;
+
+    const GIntBig nMaxMemory = CPLAtoGIntBig(
+        CPLGetConfigOption("OGR_SQL_HASH_JOIN_MAX_MEMORY", "104857600"));
+    const bool bCanFetchByFID =
+        CPL_TO_BOOL(poJoinLayer->TestCapability(OLCRandomRead));
+
+    poJoinLayer->SetAttributeFilter( nullptr );
+    poJoinLayer->ResetReading();
+
+    GIntBig nMemoryUsage = 0;
+    bool bFailed = false;
+    std::string osKey;
+    for( auto&& poFeature: *poJoinLayer )
+    {
+        if( !GetHashJoinKey(poFeature.get(), poHashJoin->aoKeyParts, false,
+                            osKey) )
+            continue;
+        // Only the first matching feature is used, consistently with the
+        // attribute-filter based join.
+        if( poHashJoin->oMapFIDs.find(osKey) != poHashJoin->oMapFIDs.end() )
+            continue;
+        const GIntBig nFID = poFeature->GetFID();
+        if( nFID == OGRNullFID && !poHashJoin->bFeaturesInMemory )
+        {
+            bFailed = true;
+            break;
+        }
+        poHashJoin->oMapFIDs[osKey] = nFID;
+        nMemoryUsage += static_cast<GIntBig>(osKey.size() + sizeof(GIntBig));
+
+        if( poHashJoin->bFeaturesInMemory )
+        {
+            nMemoryUsage += static_cast<GIntBig>(
+                EstimateFeatureMemoryUsage(poFeature.get()));
+            poHashJoin->oMapFeatures[osKey] = std::move(poFeature);
+            if( nMemoryUsage > nMaxMemory )
+            {
+                // Switch to keeping only FIDs, if possible
+                bool bHasNullFID = false;
+                nMemoryUsage = 0;
+                for( const auto& oIter: poHashJoin->oMapFIDs )
+                {
+                    bHasNullFID |= (oIter.second == OGRNullFID);
+                    nMemoryUsage += static_cast<GIntBig>(
+                        oIter.first.size() + sizeof(GIntBig));
+                }
+                if( !bCanFetchByFID || bHasNullFID )
+                {
+                    bFailed = true;
+                    break;
+                }
+                CPLDebug("GenSQL",
+                         "Hash join on layer %s: memory limit reached. "
+                         "Keeping only FIDs",
+                         poJoinLayer->GetName());
+                poHashJoin->bFeaturesInMemory = false;
+                poHashJoin->oMapFeatures.clear();
+            }
+        }
+        if( nMemoryUsage > nMaxMemory )
+        {
+            bFailed = true;
+            break;
+        }
+    }
+    poJoinLayer->ResetReading();
+
+    if( bFailed )
+    {
+        CPLDebug("GenSQL",
+                 "Hash join on layer %s cannot be used: memory limit reached",
+                 poJoinLayer->GetName());
+        poHashJoin->bDisabled = true;
+        poHashJoin->oMapFeatures.clear();
+        poHashJoin->oMapFIDs.clear();
+        return false;
+    }
+
+    CPLDebug("GenSQL", "Hash join on layer %s: %d distinct keys",
+             poJoinLayer->GetName(),
+             static_cast<int>(poHashJoin->oMapFIDs.size()));
+    return true;
+}
+
+/************************************************************************/
+/*                       GetJoinFeatureFromHash()                       */
+/************************************************************************/
+
+OGRFeature* OGRGenSQLResultsLayer::GetJoinFeatureFromHash( int iJoin,
+                                                           OGRFeature* poSrcFeat,
+                                                           bool& bHashUsed )
+{
+    bHashUsed = false;
+    InitHashJoins();
+    OGRGenSQLHashJoin* poHashJoin = m_apoHashJoins[iJoin].get();
+    if( poHashJoin == nullptr || poHashJoin->bDisabled )
+        return nullptr;
+    if( !poHashJoin->bBuilt && !BuildHashJoin(iJoin) )
+        return nullptr;
+    bHashUsed = true;
+
+    std::string osKey;
+    if( !GetHashJoinKey(poSrcFeat, poHashJoin->aoKeyParts, true, osKey) )
+        return nullptr;
+
+    if( poHashJoin->bFeaturesInMemory )
+    {
+        auto oIter = poHashJoin->oMapFeatures.find(osKey);
+        if( oIter == poHashJoin->oMapFeatures.end() )
+            return nullptr;
+        return oIter->second->Clone();
+    }
+
+    auto oIter = poHashJoin->oMapFIDs.find(osKey);
+    if( oIter == poHashJoin->oMapFIDs.end() )
+        return nullptr;
+    swq_select *psSelectInfo = static_cast<swq_select*>(pSelectInfo);
+    OGRLayer *poJoinLayer =
+        papoTableLayers[psSelectInfo->join_defs[iJoin].secondary_table];
+    return poJoinLayer->GetFeature(oIter->second);
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1300,6 +2000,16 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature( OGRFeature *poSrcFeat )
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        // Use a hash table of the secondary layer for equality joins
+        bool bHashUsed = false;
+        OGRFeature* poHashJoinFeature =
+            GetJoinFeatureFromHash(iJoin, poSrcFeat, bHashUsed);
+        if( bHashUsed )
+        {
+            apoFeatures.push_back( poHashJoinFeature );
+            continue;
+        }
+
         OGRLayer *poJoinLayer = papoTableLayers[psJoinInfo->secondary_table];
 
         osFilter = GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
@@ -1638,6 +2348,15 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature( GIntBig nFID )
 /* -------------------------------------------------------------------- */
 /*      Handle request for summary record.                              */
 /* -------------------------------------------------------------------- */
+    if( psSelectInfo->query_mode == SWQM_SUMMARY_RECORD &&
+        psSelectInfo->group_specs > 0 )
+    {
+        if( !PrepareSummary() || nFID < 0 ||
+            nFID >= static_cast<GIntBig>(m_apoGroupByFeatures.size()) )
+            return nullptr;
+        return m_apoGroupByFeatures[static_cast<size_t>(nFID)]->Clone();
+    }
+
     if( psSelectInfo->query_mode == SWQM_SUMMARY_RECORD )
     {
         if( !PrepareSummary() || nFID != 0 || poSummaryFeature == nullptr )
@@ -1743,7 +2462,7 @@ OGRFeatureDefn *OGRGenSQLResultsLayer::GetLayerDefn()
 {
     swq_select *psSelectInfo = static_cast<swq_select*>(pSelectInfo);
     if( psSelectInfo->query_mode == SWQM_SUMMARY_RECORD &&
-        poSummaryFeature == nullptr )
+        poSummaryFeature == nullptr && !m_bGroupByPrepared )
     {
         // Run PrepareSummary() is we have a COUNT column so as to be
         // able to downcast it from OFTInteger64 to OFTInteger
@@ -2359,6 +3078,12 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
         AddFieldDefnToSet(psOrderDef->table_index, psOrderDef->field_index, hSet);
     }
 
+    for( int iGroup = 0; iGroup < psSelectInfo->group_specs; iGroup++ )
+    {
+        swq_group_def *psGroupDef = psSelectInfo->group_defs + iGroup;
+        AddFieldDefnToSet(psGroupDef->table_index, psGroupDef->field_index, hSet);
+    }
+
 /* -------------------------------------------------------------------- */
 /*      2nd phase : now, we can exclude the unused fields               */
 /* -------------------------------------------------------------------- */
@@ -36,6 +36,7 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -50,6 +51,8 @@
 #define ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(poFDefn, idx) \
     ((idx) - ((poFDefn)->GetFieldCount() + SPECIAL_FIELD_COUNT))
 
+struct OGRGenSQLHashJoin;
+
 /************************************************************************/
 /*                        OGRGenSQLResultsLayer                         */
 /************************************************************************/
@@ -84,7 +87,23 @@ class OGRGenSQLResultsLayer final: public OGRLayer
     GIntBig     nIteratedFeatures;
     std::vector<CPLString> m_oDistinctList;
 
+    // Hash tables of the secondary layers of equality JOINs, indexed by
+    // join number. Built lazily at the first lookup, and kept for the
+    // lifetime of the layer.
+    std::vector<std::unique_ptr<OGRGenSQLHashJoin>> m_apoHashJoins{};
+    bool        m_bHashJoinsInitialized = false;
+
+    void        InitHashJoins();
+    bool        BuildHashJoin( int iJoin );
+    OGRFeature *GetJoinFeatureFromHash( int iJoin, OGRFeature* poSrcFeat,
+                                        bool& bHashUsed );
+
+    // Result features of a GROUP BY query, one per group.
+    std::vector<OGRFeatureUniquePtr> m_apoGroupByFeatures{};
+    bool        m_bGroupByPrepared = false;
+
     int         PrepareSummary();
+    int         PrepareGroupBy();
 
     OGRFeature *TranslateFeature( OGRFeature * );
     void        CreateOrderByIndex();
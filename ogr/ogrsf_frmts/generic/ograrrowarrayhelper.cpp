@@ -275,6 +275,35 @@ error:
     memset(out_array, 0, sizeof(*out_array));
 }
 
+/************************************************************************/
+/*                       GetArrowExtensionName()                        */
+/************************************************************************/
+
+/* static */
+std::string OGRArrowArrayHelper::GetArrowExtensionName(const char* pabyMetadata)
+{
+    if( pabyMetadata == nullptr )
+        return std::string();
+    int32_t nKV = 0;
+    memcpy(&nKV, pabyMetadata, sizeof(int32_t));
+    pabyMetadata += sizeof(int32_t);
+    for( int32_t iKV = 0; iKV < nKV; ++iKV )
+    {
+        int32_t nKeyLen = 0;
+        memcpy(&nKeyLen, pabyMetadata, sizeof(int32_t));
+        pabyMetadata += sizeof(int32_t);
+        const std::string osKey(pabyMetadata, nKeyLen);
+        pabyMetadata += nKeyLen;
+        int32_t nValueLen = 0;
+        memcpy(&nValueLen, pabyMetadata, sizeof(int32_t));
+        pabyMetadata += sizeof(int32_t);
+        if( osKey == "ARROW:extension:name" )
+            return std::string(pabyMetadata, nValueLen);
+        pabyMetadata += nValueLen;
+    }
+    return std::string();
+}
+
 /************************************************************************/
 /*                             FillDict()                               */
 /************************************************************************/
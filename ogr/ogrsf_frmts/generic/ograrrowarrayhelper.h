@@ -91,7 +91,7 @@ public:
     inline static void SetBoolOn(struct ArrowArray* psArray, int iFeat)
     {
         static_cast<uint8_t*>(const_cast<void*>(
-            psArray->buffers[1]))[iFeat / 8] |= static_cast<uint8_t>(1 << (iFeat / 8));
+            psArray->buffers[1]))[iFeat / 8] |= static_cast<uint8_t>(1 << (iFeat % 8));
     }
 
     inline static void SetInt8(struct ArrowArray* psArray, int iFeat, int8_t nVal)
@@ -235,6 +235,52 @@ public:
     static bool FillDict(struct ArrowArray* psChild,
                          const OGRCodedFieldDomain* poCodedDomain);
 
+    // Accessors to the content of input arrays, as passed to WriteArrowBatch()
+
+    static std::string GetArrowExtensionName(const char* pabyMetadata);
+
+    inline static bool IsArrowValueNull(const struct ArrowArray* psArray,
+                                        size_t iIdx)
+    {
+        if( psArray->null_count == 0 || psArray->buffers[0] == nullptr )
+            return false;
+        const uint8_t* pabyValidity =
+            static_cast<const uint8_t*>(psArray->buffers[0]);
+        return (pabyValidity[iIdx / 8] & (1 << (iIdx % 8))) == 0;
+    }
+
+    template<class T> inline static T GetArrowValue(const struct ArrowArray* psArray,
+                                                    size_t iIdx)
+    {
+        return static_cast<const T*>(psArray->buffers[1])[iIdx];
+    }
+
+    inline static bool GetArrowBool(const struct ArrowArray* psArray, size_t iIdx)
+    {
+        return (static_cast<const uint8_t*>(psArray->buffers[1])[iIdx / 8] &
+                (1 << (iIdx % 8))) != 0;
+    }
+
+    // For variable width strings or binaries, with 32 or 64 bit offsets
+    inline static const GByte* GetArrowStringOrBinary(
+                                        const struct ArrowArray* psArray,
+                                        bool bLargeOffsets,
+                                        size_t iIdx,
+                                        size_t& nLen)
+    {
+        const GByte* pabyData = static_cast<const GByte*>(psArray->buffers[2]);
+        if( bLargeOffsets )
+        {
+            const int64_t nStart = GetArrowValue<int64_t>(psArray, iIdx);
+            nLen = static_cast<size_t>(
+                GetArrowValue<int64_t>(psArray, iIdx + 1) - nStart);
+            return pabyData ? pabyData + nStart : nullptr;
+        }
+        const int32_t nStart = GetArrowValue<int32_t>(psArray, iIdx);
+        nLen = static_cast<size_t>(
+            GetArrowValue<int32_t>(psArray, iIdx + 1) - nStart);
+        return pabyData ? pabyData + nStart : nullptr;
+    }
 };
 
 //! @endcond
@@ -563,6 +563,87 @@ OGRFeatureH OGR_L_GetNextFeature( OGRLayerH hLayer )
                 OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+/**
+ * \brief Fetch the next available feature from this layer into an existing
+ * feature object.
+ *
+ * This is semantically equivalent to GetNextFeature(), except that the
+ * content of oFeature (FID, fields, geometries, style and native data) is
+ * replaced by the one of the next feature, instead of a new feature being
+ * returned. When called repeatedly with the same object in a read loop, this
+ * allows drivers that have a specialized implementation to decode records
+ * into recycled storage, instead of allocating a new OGRFeature, field array
+ * and geometry array for each record.
+ *
+ * oFeature should be a OGRFeature instance (not an instance of a derived
+ * class) created with the layer definition returned by GetLayerDefn().
+ *
+ * The default implementation calls GetNextFeature() and transfers the
+ * content of the returned feature into oFeature, and thus brings no
+ * performance benefit. Drivers with a specialized implementation are
+ * currently Shapefile, CSV and GeoPackage.
+ *
+ * This method is the same as the C function OGR_L_GetNextFeatureInto().
+ *
+ * @param oFeature feature into which to read the next feature.
+ * @return true if a feature was read, false when no more features are
+ * available (or in case of error). In that latter case, the content of
+ * oFeature is unspecified.
+ * @since GDAL 3.7
+ */
+
+bool OGRLayer::GetNextFeatureInto( OGRFeature& oFeature )
+
+{
+    OGRFeature* poFeature = GetNextFeature();
+    if( poFeature == nullptr )
+        return false;
+    oFeature.SwapContent(*poFeature);
+    delete poFeature;
+    return true;
+}
+
+/************************************************************************/
+/*                      OGR_L_GetNextFeatureInto()                      */
+/************************************************************************/
+
+/**
+ * \brief Fetch the next available feature from this layer into an existing
+ * feature object.
+ *
+ * See OGRLayer::GetNextFeatureInto() for more details.
+ *
+ * A typical read loop is:
+ * \code{.c}
+ *   OGRFeatureH hFeature = OGR_F_Create(OGR_L_GetLayerDefn(hLayer));
+ *   while( OGR_L_GetNextFeatureInto(hLayer, hFeature) )
+ *   {
+ *       // do something with hFeature
+ *   }
+ *   OGR_F_Destroy(hFeature);
+ * \endcode
+ *
+ * @param hLayer handle to the layer from which feature are read.
+ * @param hFeature handle to the feature into which to read the next feature.
+ * @return true if a feature was read, false when no more features are
+ * available (or in case of error).
+ * @since GDAL 3.7
+ */
+
+bool OGR_L_GetNextFeatureInto( OGRLayerH hLayer, OGRFeatureH hFeature )
+
+{
+    VALIDATE_POINTER1( hLayer, "OGR_L_GetNextFeatureInto", false );
+    VALIDATE_POINTER1( hFeature, "OGR_L_GetNextFeatureInto", false );
+
+    return OGRLayer::FromHandle(hLayer)->GetNextFeatureInto(
+                                        *OGRFeature::FromHandle(hFeature));
+}
+
 /************************************************************************/
 /*                       ConvertGeomsIfNecessary()                      */
 /************************************************************************/
@@ -6382,6 +6463,710 @@ bool OGR_L_GetArrowStream(OGRLayerH hLayer,
     return OGRLayer::FromHandle(hLayer)->GetArrowStream(out_stream, papszOptions);
 }
 
+/************************************************************************/
+/*                     OGRArrowWriteColumn                              */
+/************************************************************************/
+
+namespace {
+
+enum class OGRArrowWriteType
+{
+    BOOL,
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    INT64,
+    UINT64,
+    FLOAT32,
+    FLOAT64,
+    STRING,
+    LARGE_STRING,
+    BINARY,
+    LARGE_BINARY,
+    FIXED_BINARY,
+    DATE32,
+    DATE64,
+    TIME32,
+    TIME64,
+    TIMESTAMP,
+    LIST,
+    LARGE_LIST
+};
+
+struct OGRArrowWriteColumn
+{
+    const struct ArrowSchema* psSchema = nullptr;
+    const struct ArrowArray* psArray = nullptr;
+    OGRArrowWriteType eType = OGRArrowWriteType::INT32;
+    // Item type for LIST and LARGE_LIST
+    OGRArrowWriteType eItemType = OGRArrowWriteType::INT32;
+    // Width for FIXED_BINARY
+    int nWidth = 0;
+    // Number of units per second for TIME32, TIME64 and TIMESTAMP
+    int64_t nUnitsPerSec = 1;
+    // TZFlag for TIMESTAMP (0=unknown, 100=UTC, ...)
+    int nTZFlag = 0;
+    int iField = -1;
+    int iGeomField = -1;
+    bool bIsFID = false;
+};
+
+} // namespace
+
+/************************************************************************/
+/*                       ParseArrowWriteType()                          */
+/************************************************************************/
+
+static bool ParseArrowWriteType(const char* pszFormat,
+                                OGRArrowWriteColumn& oCol,
+                                bool bIsItem)
+{
+    OGRArrowWriteType& eType = bIsItem ? oCol.eItemType : oCol.eType;
+    const char chFirst = pszFormat[0];
+    if( chFirst != '\0' && pszFormat[1] == '\0' )
+    {
+        switch( chFirst )
+        {
+            case 'b': eType = OGRArrowWriteType::BOOL; return true;
+            case 'c': eType = OGRArrowWriteType::INT8; return true;
+            case 'C': eType = OGRArrowWriteType::UINT8; return true;
+            case 's': eType = OGRArrowWriteType::INT16; return true;
+            case 'S': eType = OGRArrowWriteType::UINT16; return true;
+            case 'i': eType = OGRArrowWriteType::INT32; return true;
+            case 'I': eType = OGRArrowWriteType::UINT32; return true;
+            case 'l': eType = OGRArrowWriteType::INT64; return true;
+            case 'L': eType = OGRArrowWriteType::UINT64; return true;
+            case 'f': eType = OGRArrowWriteType::FLOAT32; return true;
+            case 'g': eType = OGRArrowWriteType::FLOAT64; return true;
+            case 'u': eType = OGRArrowWriteType::STRING; return true;
+            case 'U': eType = OGRArrowWriteType::LARGE_STRING; return true;
+            case 'z': if( bIsItem ) return false;
+                      eType = OGRArrowWriteType::BINARY; return true;
+            case 'Z': if( bIsItem ) return false;
+                      eType = OGRArrowWriteType::LARGE_BINARY; return true;
+            default: return false;
+        }
+    }
+    if( bIsItem )
+        return false;
+
+    if( STARTS_WITH(pszFormat, "w:") )
+    {
+        eType = OGRArrowWriteType::FIXED_BINARY;
+        oCol.nWidth = atoi(pszFormat + 2);
+        return oCol.nWidth > 0;
+    }
+    if( strcmp(pszFormat, "tdD") == 0 )
+    {
+        eType = OGRArrowWriteType::DATE32;
+        return true;
+    }
+    if( strcmp(pszFormat, "tdm") == 0 )
+    {
+        eType = OGRArrowWriteType::DATE64;
+        return true;
+    }
+    if( strlen(pszFormat) == 3 && STARTS_WITH(pszFormat, "tt") )
+    {
+        switch( pszFormat[2] )
+        {
+            case 's': eType = OGRArrowWriteType::TIME32; oCol.nUnitsPerSec = 1; return true;
+            case 'm': eType = OGRArrowWriteType::TIME32; oCol.nUnitsPerSec = 1000; return true;
+            case 'u': eType = OGRArrowWriteType::TIME64; oCol.nUnitsPerSec = 1000 * 1000; return true;
+            case 'n': eType = OGRArrowWriteType::TIME64; oCol.nUnitsPerSec = 1000 * 1000 * 1000; return true;
+            default: return false;
+        }
+    }
+    if( strlen(pszFormat) >= 4 && STARTS_WITH(pszFormat, "ts") &&
+        pszFormat[3] == ':' )
+    {
+        eType = OGRArrowWriteType::TIMESTAMP;
+        switch( pszFormat[2] )
+        {
+            case 's': oCol.nUnitsPerSec = 1; break;
+            case 'm': oCol.nUnitsPerSec = 1000; break;
+            case 'u': oCol.nUnitsPerSec = 1000 * 1000; break;
+            case 'n': oCol.nUnitsPerSec = 1000 * 1000 * 1000; break;
+            default: return false;
+        }
+        const char* pszTZ = pszFormat + 4;
+        if( pszTZ[0] == '\0' )
+        {
+            oCol.nTZFlag = 0;
+        }
+        else if( EQUAL(pszTZ, "UTC") || EQUAL(pszTZ, "Etc/UTC") ||
+                 EQUAL(pszTZ, "Z") )
+        {
+            oCol.nTZFlag = 100;
+        }
+        else if( (pszTZ[0] == '+' || pszTZ[0] == '-') &&
+                 strlen(pszTZ) == 6 && pszTZ[3] == ':' )
+        {
+            const int nMinutes = atoi(pszTZ + 1) * 60 + atoi(pszTZ + 4);
+            oCol.nTZFlag = 100 + (pszTZ[0] == '+' ? 1 : -1) * nMinutes / 15;
+        }
+        else
+        {
+            // Named time zones are not supported: write the UTC value
+            oCol.nTZFlag = 100;
+        }
+        return true;
+    }
+    if( strcmp(pszFormat, "+l") == 0 )
+    {
+        eType = OGRArrowWriteType::LIST;
+        return true;
+    }
+    if( strcmp(pszFormat, "+L") == 0 )
+    {
+        eType = OGRArrowWriteType::LARGE_LIST;
+        return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                      GetArrowStringOrBinary()                        */
+/************************************************************************/
+
+static const GByte* GetArrowStringOrBinary(const struct ArrowArray* psArray,
+                                           OGRArrowWriteType eType,
+                                           int nWidth,
+                                           size_t iIdx,
+                                           size_t& nLen)
+{
+    if( eType == OGRArrowWriteType::FIXED_BINARY )
+    {
+        nLen = static_cast<size_t>(nWidth);
+        return static_cast<const GByte*>(psArray->buffers[1]) + iIdx * nLen;
+    }
+    return OGRArrowArrayHelper::GetArrowStringOrBinary(
+        psArray,
+        eType == OGRArrowWriteType::LARGE_STRING ||
+        eType == OGRArrowWriteType::LARGE_BINARY,
+        iIdx, nLen);
+}
+
+/************************************************************************/
+/*                        GetArrowNumericValue()                        */
+/************************************************************************/
+
+static double GetArrowNumericValue(const struct ArrowArray* psArray,
+                                   OGRArrowWriteType eType,
+                                   size_t iIdx,
+                                   GIntBig& nIntValue,
+                                   bool& bIsInteger)
+{
+    bIsInteger = true;
+    switch( eType )
+    {
+        case OGRArrowWriteType::BOOL:
+            nIntValue = OGRArrowArrayHelper::GetArrowBool(psArray, iIdx) ? 1 : 0; break;
+        case OGRArrowWriteType::INT8:
+            nIntValue = OGRArrowArrayHelper::GetArrowValue<int8_t>(psArray, iIdx); break;
+        case OGRArrowWriteType::UINT8:
+            nIntValue = OGRArrowArrayHelper::GetArrowValue<uint8_t>(psArray, iIdx); break;
+        case OGRArrowWriteType::INT16:
+            nIntValue = OGRArrowArrayHelper::GetArrowValue<int16_t>(psArray, iIdx); break;
+        case OGRArrowWriteType::UINT16:
+            nIntValue = OGRArrowArrayHelper::GetArrowValue<uint16_t>(psArray, iIdx); break;
+        case OGRArrowWriteType::INT32:
+            nIntValue = OGRArrowArrayHelper::GetArrowValue<int32_t>(psArray, iIdx); break;
+        case OGRArrowWriteType::UINT32:
+            nIntValue = OGRArrowArrayHelper::GetArrowValue<uint32_t>(psArray, iIdx); break;
+        case OGRArrowWriteType::INT64:
+            nIntValue = OGRArrowArrayHelper::GetArrowValue<int64_t>(psArray, iIdx); break;
+        case OGRArrowWriteType::UINT64:
+        {
+            const uint64_t nVal = OGRArrowArrayHelper::GetArrowValue<uint64_t>(psArray, iIdx);
+            if( nVal > static_cast<uint64_t>(std::numeric_limits<GIntBig>::max()) )
+            {
+                bIsInteger = false;
+                return static_cast<double>(nVal);
+            }
+            nIntValue = static_cast<GIntBig>(nVal);
+            break;
+        }
+        case OGRArrowWriteType::FLOAT32:
+            bIsInteger = false;
+            return OGRArrowArrayHelper::GetArrowValue<float>(psArray, iIdx);
+        case OGRArrowWriteType::FLOAT64:
+            bIsInteger = false;
+            return OGRArrowArrayHelper::GetArrowValue<double>(psArray, iIdx);
+        default:
+            CPLAssert(false);
+            nIntValue = 0;
+            break;
+    }
+    return static_cast<double>(nIntValue);
+}
+
+/************************************************************************/
+/*                        SetFieldFromArrow()                           */
+/************************************************************************/
+
+static bool SetFieldFromArrow(OGRFeature* poFeature,
+                              const OGRArrowWriteColumn& oCol,
+                              size_t iIdx)
+{
+    const int iField = oCol.iField;
+    const struct ArrowArray* psArray = oCol.psArray;
+    switch( oCol.eType )
+    {
+        case OGRArrowWriteType::BOOL:
+        case OGRArrowWriteType::INT8:
+        case OGRArrowWriteType::UINT8:
+        case OGRArrowWriteType::INT16:
+        case OGRArrowWriteType::UINT16:
+        case OGRArrowWriteType::INT32:
+        case OGRArrowWriteType::UINT32:
+        case OGRArrowWriteType::INT64:
+        case OGRArrowWriteType::UINT64:
+        case OGRArrowWriteType::FLOAT32:
+        case OGRArrowWriteType::FLOAT64:
+        {
+            GIntBig nVal = 0;
+            bool bIsInteger = false;
+            const double dfVal = GetArrowNumericValue(psArray, oCol.eType,
+                                                      iIdx, nVal, bIsInteger);
+            if( bIsInteger )
+                poFeature->SetField(iField, nVal);
+            else
+                poFeature->SetField(iField, dfVal);
+            break;
+        }
+
+        case OGRArrowWriteType::STRING:
+        case OGRArrowWriteType::LARGE_STRING:
+        {
+            size_t nLen = 0;
+            const GByte* pabyData = GetArrowStringOrBinary(
+                psArray, oCol.eType, 0, iIdx, nLen);
+            poFeature->SetField(iField,
+                std::string(reinterpret_cast<const char*>(pabyData), nLen).c_str());
+            break;
+        }
+
+        case OGRArrowWriteType::BINARY:
+        case OGRArrowWriteType::LARGE_BINARY:
+        case OGRArrowWriteType::FIXED_BINARY:
+        {
+            size_t nLen = 0;
+            const GByte* pabyData = GetArrowStringOrBinary(
+                psArray, oCol.eType, oCol.nWidth, iIdx, nLen);
+            if( nLen > static_cast<size_t>(INT_MAX) )
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Too large binary value for field %s",
+                         poFeature->GetFieldDefnRef(iField)->GetNameRef());
+                return false;
+            }
+            poFeature->SetField(iField, static_cast<int>(nLen), pabyData);
+            break;
+        }
+
+        case OGRArrowWriteType::DATE32:
+        case OGRArrowWriteType::DATE64:
+        {
+            const GIntBig nUnixTime =
+                oCol.eType == OGRArrowWriteType::DATE32 ?
+                    static_cast<GIntBig>(OGRArrowArrayHelper::GetArrowValue<int32_t>(psArray, iIdx)) * 86400 :
+                    OGRArrowArrayHelper::GetArrowValue<int64_t>(psArray, iIdx) / 1000;
+            struct tm brokenDown;
+            CPLUnixTimeToYMDHMS(nUnixTime, &brokenDown);
+            poFeature->SetField(iField, brokenDown.tm_year + 1900,
+                                brokenDown.tm_mon + 1, brokenDown.tm_mday,
+                                0, 0, 0.0f, 0);
+            break;
+        }
+
+        case OGRArrowWriteType::TIME32:
+        case OGRArrowWriteType::TIME64:
+        {
+            const int64_t nVal = oCol.eType == OGRArrowWriteType::TIME32 ?
+                OGRArrowArrayHelper::GetArrowValue<int32_t>(psArray, iIdx) :
+                OGRArrowArrayHelper::GetArrowValue<int64_t>(psArray, iIdx);
+            const int64_t nSecs = nVal / oCol.nUnitsPerSec;
+            const double dfFrac =
+                static_cast<double>(nVal % oCol.nUnitsPerSec) / oCol.nUnitsPerSec;
+            poFeature->SetField(iField, 0, 0, 0,
+                                static_cast<int>(nSecs / 3600),
+                                static_cast<int>((nSecs / 60) % 60),
+                                static_cast<float>((nSecs % 60) + dfFrac), 0);
+            break;
+        }
+
+        case OGRArrowWriteType::TIMESTAMP:
+        {
+            const int64_t nVal = OGRArrowArrayHelper::GetArrowValue<int64_t>(psArray, iIdx);
+            int64_t nSecs = nVal / oCol.nUnitsPerSec;
+            int64_t nRemainder = nVal % oCol.nUnitsPerSec;
+            if( nRemainder < 0 )
+            {
+                nSecs --;
+                nRemainder += oCol.nUnitsPerSec;
+            }
+            if( oCol.nTZFlag > 1 && oCol.nTZFlag != 100 )
+            {
+                // Convert from UTC to the local time of the time zone
+                nSecs += static_cast<int64_t>(oCol.nTZFlag - 100) * 15 * 60;
+            }
+            struct tm brokenDown;
+            CPLUnixTimeToYMDHMS(nSecs, &brokenDown);
+            poFeature->SetField(iField, brokenDown.tm_year + 1900,
+                                brokenDown.tm_mon + 1, brokenDown.tm_mday,
+                                brokenDown.tm_hour, brokenDown.tm_min,
+                                static_cast<float>(brokenDown.tm_sec +
+                                    static_cast<double>(nRemainder) / oCol.nUnitsPerSec),
+                                oCol.nTZFlag);
+            break;
+        }
+
+        case OGRArrowWriteType::LIST:
+        case OGRArrowWriteType::LARGE_LIST:
+        {
+            size_t nStart;
+            size_t nEnd;
+            if( oCol.eType == OGRArrowWriteType::LIST )
+            {
+                nStart = static_cast<size_t>(OGRArrowArrayHelper::GetArrowValue<int32_t>(psArray, iIdx));
+                nEnd = static_cast<size_t>(OGRArrowArrayHelper::GetArrowValue<int32_t>(psArray, iIdx + 1));
+            }
+            else
+            {
+                nStart = static_cast<size_t>(OGRArrowArrayHelper::GetArrowValue<int64_t>(psArray, iIdx));
+                nEnd = static_cast<size_t>(OGRArrowArrayHelper::GetArrowValue<int64_t>(psArray, iIdx + 1));
+            }
+            const struct ArrowArray* psItems = psArray->children[0];
+            const size_t nItemOffset = static_cast<size_t>(psItems->offset);
+            if( oCol.eItemType == OGRArrowWriteType::STRING ||
+                oCol.eItemType == OGRArrowWriteType::LARGE_STRING )
+            {
+                CPLStringList aosList;
+                for( size_t i = nStart; i < nEnd; ++i )
+                {
+                    size_t nLen = 0;
+                    const GByte* pabyData = GetArrowStringOrBinary(
+                        psItems, oCol.eItemType, 0, nItemOffset + i, nLen);
+                    aosList.AddString(
+                        std::string(reinterpret_cast<const char*>(pabyData), nLen).c_str());
+                }
+                poFeature->SetField(iField, aosList.List());
+            }
+            else if( oCol.eItemType == OGRArrowWriteType::FLOAT32 ||
+                     oCol.eItemType == OGRArrowWriteType::FLOAT64 ||
+                     oCol.eItemType == OGRArrowWriteType::UINT64 )
+            {
+                std::vector<double> adfList;
+                adfList.reserve(nEnd - nStart);
+                for( size_t i = nStart; i < nEnd; ++i )
+                {
+                    GIntBig nVal = 0;
+                    bool bIsInteger = false;
+                    adfList.push_back(GetArrowNumericValue(
+                        psItems, oCol.eItemType, nItemOffset + i, nVal, bIsInteger));
+                }
+                poFeature->SetField(iField, static_cast<int>(adfList.size()),
+                                    adfList.data());
+            }
+            else
+            {
+                std::vector<GIntBig> anList;
+                anList.reserve(nEnd - nStart);
+                for( size_t i = nStart; i < nEnd; ++i )
+                {
+                    GIntBig nVal = 0;
+                    bool bIsInteger = false;
+                    GetArrowNumericValue(psItems, oCol.eItemType,
+                                         nItemOffset + i, nVal, bIsInteger);
+                    anList.push_back(nVal);
+                }
+                poFeature->SetField(iField, static_cast<int>(anList.size()),
+                                    anList.data());
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+/** Write a batch of rows from an ArrowArray.
+ *
+ * This is semantically close to calling CreateFeature() with multiple
+ * features at once.
+ *
+ * The ArrowArray must be of type struct (format=+s), and its children
+ * generally map to a OGR attribute or geometry field (unless they are struct
+ * themselves, which is not supported by the default implementation).
+ * Fields are matched by name against the layer definition, which must have
+ * been created beforehand (with CreateField() / CreateGeomField()).
+ * Children whose schema has the "ARROW:extension:name" metadata set to
+ * "ogc.wkb" or "geoarrow.wkb", or whose name matches a geometry field, are
+ * interpreted as WKB geometries.
+ *
+ * The schema and array remain owned by the caller, who is responsible for
+ * releasing them after this call. Implementations that need to take a
+ * reference on the array must do so for the duration of the call only.
+ *
+ * The default implementation converts each row to a OGRFeature (a single
+ * instance is reused for the whole batch) and calls CreateFeature().
+ * Drivers that have a specialized implementation should advertise the
+ * OLCFastWriteArrowBatch capability.
+ *
+ * Options may be driver specific. The default implementation recognizes the
+ * following options:
+ * <ul>
+ * <li>FID=name. Name of the FID column in the array. If not specified, a
+ *     column named like GetFIDColumn() (or OGC_FID if GetFIDColumn() is
+ *     empty) is used as FID, if present. Set to empty to never use a column as
+ *     FID.</li>
+ * <li>GEOMETRY_NAME=name. Name of the geometry column in the array, when the
+ *     layer has a single geometry field whose name is different.</li>
+ * </ul>
+ *
+ * @param schema Schema of array. Must *not* be NULL.
+ * @param array Array of type struct. Must *not* be NULL.
+ * @param papszOptions NULL terminated list of key=value options.
+ * @return true in case of success.
+ * @since GDAL 3.7
+ */
+bool OGRLayer::WriteArrowBatch(const struct ArrowSchema* schema,
+                               struct ArrowArray* array,
+                               CSLConstList papszOptions)
+{
+    if( strcmp(schema->format, "+s") != 0 )
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "WriteArrowBatch(): schema format should be +s");
+        return false;
+    }
+    if( schema->n_children != array->n_children )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "WriteArrowBatch(): "
+                 "schema->n_children (%d) != array->n_children (%d)",
+                 static_cast<int>(schema->n_children),
+                 static_cast<int>(array->n_children));
+        return false;
+    }
+
+    OGRFeatureDefn* poLayerDefn = GetLayerDefn();
+    const char* pszLayerFIDColumn = GetFIDColumn();
+    const char* pszFIDName = CSLFetchNameValueDef(papszOptions, "FID",
+        (pszLayerFIDColumn && pszLayerFIDColumn[0]) ?
+            pszLayerFIDColumn : "OGC_FID");
+    const char* pszGeomName = CSLFetchNameValue(papszOptions, "GEOMETRY_NAME");
+
+/* -------------------------------------------------------------------- */
+/*      Map Arrow columns to OGR fields.                                */
+/* -------------------------------------------------------------------- */
+    std::vector<OGRArrowWriteColumn> aoColumns;
+    std::vector<bool> abGeomFieldMapped(poLayerDefn->GetGeomFieldCount());
+    for( int64_t iChild = 0; iChild < schema->n_children; ++iChild )
+    {
+        const struct ArrowSchema* psChildSchema = schema->children[iChild];
+        const char* pszName = psChildSchema->name ? psChildSchema->name : "";
+        OGRArrowWriteColumn oCol;
+        oCol.psSchema = psChildSchema;
+        oCol.psArray = array->children[iChild];
+        if( !ParseArrowWriteType(psChildSchema->format, oCol, false) )
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "WriteArrowBatch(): unsupported format %s for field %s",
+                     psChildSchema->format, pszName);
+            return false;
+        }
+        if( oCol.eType == OGRArrowWriteType::LIST ||
+            oCol.eType == OGRArrowWriteType::LARGE_LIST )
+        {
+            if( psChildSchema->n_children != 1 ||
+                !ParseArrowWriteType(psChildSchema->children[0]->format,
+                                     oCol, true) )
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "WriteArrowBatch(): unsupported list type for field %s",
+                         pszName);
+                return false;
+            }
+        }
+
+        const bool bIsBinary = oCol.eType == OGRArrowWriteType::BINARY ||
+                               oCol.eType == OGRArrowWriteType::LARGE_BINARY;
+        const bool bIsInteger = oCol.eType >= OGRArrowWriteType::INT8 &&
+                                oCol.eType <= OGRArrowWriteType::UINT64;
+        const std::string osExtensionName =
+            OGRArrowArrayHelper::GetArrowExtensionName(psChildSchema->metadata);
+        const bool bIsWKB = bIsBinary &&
+            (osExtensionName == "ogc.wkb" || osExtensionName == "geoarrow.wkb");
+
+        if( bIsInteger && pszFIDName[0] != '\0' && EQUAL(pszName, pszFIDName) )
+        {
+            oCol.bIsFID = true;
+        }
+        else if( bIsBinary &&
+                 (bIsWKB ||
+                  (pszGeomName && EQUAL(pszName, pszGeomName)) ||
+                  poLayerDefn->GetGeomFieldIndex(pszName) >= 0) &&
+                 poLayerDefn->GetFieldIndex(pszName) < 0 )
+        {
+            oCol.iGeomField = poLayerDefn->GetGeomFieldIndex(pszName);
+            if( oCol.iGeomField < 0 &&
+                poLayerDefn->GetGeomFieldCount() == 1 &&
+                !abGeomFieldMapped[0] )
+            {
+                oCol.iGeomField = 0;
+            }
+            if( oCol.iGeomField < 0 || abGeomFieldMapped[oCol.iGeomField] )
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "WriteArrowBatch(): cannot find OGR geometry field "
+                         "for Arrow column %s", pszName);
+                return false;
+            }
+            abGeomFieldMapped[oCol.iGeomField] = true;
+        }
+        else
+        {
+            oCol.iField = poLayerDefn->GetFieldIndex(pszName);
+            if( oCol.iField < 0 )
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "WriteArrowBatch(): cannot find OGR field "
+                         "for Arrow column %s", pszName);
+                return false;
+            }
+        }
+        aoColumns.push_back(oCol);
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Write rows, reusing the same OGRFeature.                        */
+/* -------------------------------------------------------------------- */
+    std::unique_ptr<OGRFeature> poFeature(new OGRFeature(poLayerDefn));
+    const size_t nLength = static_cast<size_t>(array->length);
+    const size_t nArrayOffset = static_cast<size_t>(array->offset);
+    for( size_t iRow = 0; iRow < nLength; ++iRow )
+    {
+        poFeature->Reset();
+        for( const auto& oCol: aoColumns )
+        {
+            const size_t iIdx = nArrayOffset +
+                static_cast<size_t>(oCol.psArray->offset) + iRow;
+            const bool bIsNull = OGRArrowArrayHelper::IsArrowValueNull(oCol.psArray, iIdx);
+            if( oCol.bIsFID )
+            {
+                if( !bIsNull )
+                {
+                    GIntBig nFID = OGRNullFID;
+                    bool bIsInteger = false;
+                    GetArrowNumericValue(oCol.psArray, oCol.eType, iIdx,
+                                         nFID, bIsInteger);
+                    poFeature->SetFID(nFID);
+                }
+            }
+            else if( oCol.iGeomField >= 0 )
+            {
+                if( !bIsNull )
+                {
+                    size_t nLen = 0;
+                    const GByte* pabyWKB = GetArrowStringOrBinary(
+                        oCol.psArray, oCol.eType, 0, iIdx, nLen);
+                    OGRGeometry* poGeom = nullptr;
+                    if( OGRGeometryFactory::createFromWkb(
+                            pabyWKB, nullptr, &poGeom, nLen,
+                            wkbVariantIso) != OGRERR_NONE )
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "WriteArrowBatch(): invalid WKB content "
+                                 "at row " CPL_FRMT_GUIB " of column %s",
+                                 static_cast<GUIntBig>(iRow),
+                                 oCol.psSchema->name);
+                        return false;
+                    }
+                    poGeom->assignSpatialReference(
+                        poLayerDefn->GetGeomFieldDefn(oCol.iGeomField)->GetSpatialRef());
+                    poFeature->SetGeomFieldDirectly(oCol.iGeomField, poGeom);
+                }
+            }
+            else if( bIsNull )
+            {
+                // Leave non-nullable fields unset, so that a default value
+                // may apply.
+                if( poLayerDefn->GetFieldDefn(oCol.iField)->IsNullable() )
+                    poFeature->SetFieldNull(oCol.iField);
+            }
+            else if( !SetFieldFromArrow(poFeature.get(), oCol, iIdx) )
+            {
+                return false;
+            }
+        }
+
+        if( CreateFeature(poFeature.get()) != OGRERR_NONE )
+            return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                       OGR_L_WriteArrowBatch()                        */
+/************************************************************************/
+
+/** Write a batch of rows from an ArrowArray.
+ *
+ * This is semantically close to calling OGR_L_CreateFeature() with multiple
+ * features at once.
+ *
+ * The ArrowArray must be of type struct (format=+s), and its children
+ * generally map to a OGR attribute or geometry field (unless they are struct
+ * themselves, which is not supported by the default implementation).
+ * Fields are matched by name against the layer definition, which must have
+ * been created beforehand.
+ *
+ * The schema and array remain owned by the caller, who is responsible for
+ * releasing them after this call.
+ *
+ * Drivers that have a specialized implementation should advertise the
+ * OLCFastWriteArrowBatch capability.
+ *
+ * Options may be driver specific. The default implementation recognizes the
+ * following options:
+ * <ul>
+ * <li>FID=name. Name of the FID column in the array. If not specified, a
+ *     column named like OGR_L_GetFIDColumn() (or OGC_FID if
+ *     OGR_L_GetFIDColumn() is empty) is used as FID, if present. Set to empty
+ *     to never use a column as FID.</li>
+ * <li>GEOMETRY_NAME=name. Name of the geometry column in the array, when the
+ *     layer has a single geometry field whose name is different.</li>
+ * </ul>
+ *
+ * @param hLayer Layer.
+ * @param schema Schema of array. Must *not* be NULL.
+ * @param array Array of type struct. Must *not* be NULL.
+ * @param papszOptions NULL terminated list of key=value options.
+ * @return true in case of success.
+ * @since GDAL 3.7
+ */
+bool OGR_L_WriteArrowBatch(OGRLayerH hLayer,
+                           const struct ArrowSchema* schema,
+                           struct ArrowArray* array,
+                           char** papszOptions)
+{
+    VALIDATE_POINTER1( hLayer, "OGR_L_WriteArrowBatch", false );
+    VALIDATE_POINTER1( schema, "OGR_L_WriteArrowBatch", false );
+    VALIDATE_POINTER1( array, "OGR_L_WriteArrowBatch", false );
+
+    return OGRLayer::FromHandle(hLayer)->WriteArrowBatch(schema, array,
+                                                         papszOptions);
+}
+
 /************************************************************************/
 /*                     OGRLayer::GetGeometryTypes()                     */
 /************************************************************************/
@@ -114,6 +114,14 @@ bool OGRLayerDecorator::GetArrowStream(struct ArrowArrayStream* out_stream,
     return m_poDecoratedLayer->GetArrowStream(out_stream, papszOptions);
 }
 
+bool OGRLayerDecorator::WriteArrowBatch(const struct ArrowSchema* schema,
+                                        struct ArrowArray* array,
+                                        CSLConstList papszOptions)
+{
+    if( !m_poDecoratedLayer ) return false;
+    return m_poDecoratedLayer->WriteArrowBatch(schema, array, papszOptions);
+}
+
 OGRErr      OGRLayerDecorator::SetNextByIndex( GIntBig nIndex )
 {
     if( !m_poDecoratedLayer ) return OGRERR_FAILURE;
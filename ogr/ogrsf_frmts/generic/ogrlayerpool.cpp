@@ -312,6 +312,19 @@ bool OGRProxiedLayer::GetArrowStream(struct ArrowArrayStream* out_stream,
     return poUnderlyingLayer->GetArrowStream(out_stream, papszOptions);
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+bool OGRProxiedLayer::WriteArrowBatch(const struct ArrowSchema* schema,
+                                      struct ArrowArray* array,
+                                      CSLConstList papszOptions)
+{
+    if( poUnderlyingLayer == nullptr && !OpenUnderlyingLayer() )
+        return false;
+    return poUnderlyingLayer->WriteArrowBatch(schema, array, papszOptions);
+}
+
 /************************************************************************/
 /*                           SetNextByIndex()                           */
 /************************************************************************/
@@ -136,6 +136,9 @@ class OGRProxiedLayer : public OGRAbstractProxiedLayer
     virtual GDALDataset* GetDataset() override;
     virtual bool         GetArrowStream(struct ArrowArrayStream* out_stream,
                                         CSLConstList papszOptions = nullptr) override;
+    virtual bool         WriteArrowBatch(const struct ArrowSchema* schema,
+                                         struct ArrowArray* array,
+                                         CSLConstList papszOptions = nullptr) override;
 
     virtual const char *GetName() override;
     virtual OGRwkbGeometryType GetGeomType() override;
@@ -105,6 +105,14 @@ bool OGRMutexedLayer::GetArrowStream(struct ArrowArrayStream* out_stream,
     return OGRLayerDecorator::GetArrowStream(out_stream, papszOptions);
 }
 
+bool OGRMutexedLayer::WriteArrowBatch(const struct ArrowSchema* schema,
+                                      struct ArrowArray* array,
+                                      CSLConstList papszOptions)
+{
+    CPLMutexHolderOptionalLockD(m_hMutex);
+    return OGRLayerDecorator::WriteArrowBatch(schema, array, papszOptions);
+}
+
 OGRErr      OGRMutexedLayer::SetNextByIndex( GIntBig nIndex )
 {
     CPLMutexHolderOptionalLockD(m_hMutex);
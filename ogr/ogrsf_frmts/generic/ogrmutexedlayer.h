@@ -81,6 +81,9 @@ class CPL_DLL OGRMutexedLayer : public OGRLayerDecorator
     virtual GDALDataset* GetDataset() override;
     virtual bool         GetArrowStream(struct ArrowArrayStream* out_stream,
                                         CSLConstList papszOptions = nullptr) override;
+    virtual bool         WriteArrowBatch(const struct ArrowSchema* schema,
+                                         struct ArrowArray* array,
+                                         CSLConstList papszOptions = nullptr) override;
 
     virtual const char *GetName() override;
     virtual OGRwkbGeometryType GetGeomType() override;
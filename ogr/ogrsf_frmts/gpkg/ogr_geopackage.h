@@ -477,6 +477,8 @@ class OGRGeoPackageLayer CPL_NON_FINAL: public OGRLayer, public IOGRSQLiteGetSpa
                                            sqlite3_stmt *hStmt );
 
     OGRFeature*         TranslateFeature(sqlite3_stmt* hStmt);
+    void                TranslateFeatureInto(sqlite3_stmt* hStmt,
+                                             OGRFeature* poFeature);
     bool                ParseDateField(const char* pszTxt,
                                        OGRField* psField,
                                        const OGRFieldDefn* poFieldDefn,
@@ -512,6 +514,7 @@ class OGRGeoPackageLayer CPL_NON_FINAL: public OGRLayer, public IOGRSQLiteGetSpa
     /* OGR API methods */
 
     OGRFeature*         GetNextFeature() override;
+    bool                GetNextFeatureInto( OGRFeature& oFeature ) override;
     const char*         GetFIDColumn() override;
     void                ResetReading() override;
     int                 TestCapability( const char * ) override;
@@ -641,6 +644,12 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
                             const char* pszOldName, const char* pszNewName);
 
     OGRErr              CreateOrUpsertFeature( OGRFeature *poFeature, bool bUpsert );
+    bool                UpdateSpatialIndexOnInsert( GIntBig nFID,
+                                                    const OGREnvelope& oEnv );
+    bool                WriteArrowBatchDirect(const struct ArrowSchema* schema,
+                                              const struct ArrowArray* array,
+                                              CSLConstList papszOptions,
+                                              bool& bFallback);
 
     GIntBig             GetTotalFeatureCount();
 
@@ -702,6 +711,9 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr              ISetFeature( OGRFeature *poFeature ) override;
     OGRErr              IUpsertFeature( OGRFeature* poFeature ) override;
     OGRErr              DeleteFeature(GIntBig nFID) override;
+    bool                WriteArrowBatch(const struct ArrowSchema* schema,
+                                        struct ArrowArray* array,
+                                        CSLConstList papszOptions = nullptr) override;
     virtual void        SetSpatialFilter( OGRGeometry * ) override;
     virtual void        SetSpatialFilter( int iGeomField, OGRGeometry *poGeom ) override
                 { OGRGeoPackageLayer::SetSpatialFilter(iGeomField, poGeom); }
@@ -709,6 +721,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr              SetAttributeFilter( const char *pszQuery ) override;
     OGRErr              SyncToDisk() override;
     OGRFeature*         GetNextFeature() override;
+    bool                GetNextFeatureInto( OGRFeature& oFeature ) override;
     OGRFeature*         GetFeature(GIntBig nFID) override;
     OGRErr              StartTransaction() override;
     OGRErr              CommitTransaction() override;
@@ -835,6 +848,10 @@ class OGRGeoPackageSelectLayer final : public OGRGeoPackageLayer, public IOGRSQL
     virtual void        ResetReading() override;
 
     virtual OGRFeature *GetNextFeature() override;
+    // The specialized implementation of OGRGeoPackageLayer would bypass
+    // poBehavior
+    virtual bool        GetNextFeatureInto( OGRFeature& oFeature ) override
+                { return OGRLayer::GetNextFeatureInto(oFeature); }
     virtual GIntBig     GetFeatureCount( int ) override;
 
     virtual void        SetSpatialFilter( OGRGeometry * poGeom ) override { SetSpatialFilter(0, poGeom); }
@@ -31,6 +31,7 @@
 #include "ogrgeopackageutility.h"
 #include "ogrsqliteutility.h"
 #include "ogr_p.h"
+#include "ogr_wkb.h"
 #include "ogr_recordbatch.h"
 #include "ograrrowarrayhelper.h"
 
@@ -103,14 +104,70 @@ void OGRGeoPackageLayer::ClearStatement()
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
 {
-    if( m_bEOF )
+    auto poFeature = cpl::make_unique<OGRFeature>(m_poFeatureDefn);
+    if( !OGRGeoPackageLayer::GetNextFeatureInto(*poFeature) )
         return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                     GPKGGeomIsOutsideEnvelope()                      */
+/*                                                                      */
+/*      Whether the geometry blob of the current row can be rejected    */
+/*      against the spatial filter envelope without instantiating it,   */
+/*      using the envelope of the GeoPackage geometry header, or the    */
+/*      WKB for geometries without one (typically points).              */
+/************************************************************************/
+
+static bool GPKGGeomIsOutsideEnvelope( sqlite3_stmt* hStmt, int iGeomCol,
+                                       const OGREnvelope& sFilterEnvelope )
+{
+    if( sqlite3_column_type(hStmt, iGeomCol) == SQLITE_NULL )
+        return true;
+
+    const int iGpkgSize = sqlite3_column_bytes(hStmt, iGeomCol);
+    // coverity[tainted_data_return]
+    const GByte *pabyGpkg = static_cast<const GByte *>(sqlite3_column_blob(hStmt, iGeomCol));
+    GPkgHeader oHeader;
+    if( iGpkgSize <= 0 ||
+        GPkgHeaderFromWKB(pabyGpkg, iGpkgSize, &oHeader) != OGRERR_NONE )
+        return false;
+
+    OGREnvelope sEnvelope;
+    if( oHeader.bExtentHasXY )
+    {
+        sEnvelope.MinX = oHeader.MinX;
+        sEnvelope.MinY = oHeader.MinY;
+        sEnvelope.MaxX = oHeader.MaxX;
+        sEnvelope.MaxY = oHeader.MaxY;
+    }
+    else if( !OGRWKBGetBoundingBox(pabyGpkg + oHeader.nHeaderLen,
+                                   iGpkgSize - oHeader.nHeaderLen,
+                                   sEnvelope) )
+    {
+        return false;
+    }
+    return !sFilterEnvelope.Intersects(sEnvelope);
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRGeoPackageLayer::GetNextFeatureInto( OGRFeature& oFeature )
+
+{
+    if( oFeature.GetDefnRef() != m_poFeatureDefn )
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    if( m_bEOF )
+        return false;
 
     if( m_poQueryStatement == nullptr )
     {
         ResetStatement();
         if (m_poQueryStatement == nullptr)
-            return nullptr;
+            return false;
     }
 
     for( ; true; )
@@ -134,7 +191,7 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
                 ClearStatement();
                 m_bEOF = true;
 
-                return nullptr;
+                return false;
             }
         }
         else
@@ -142,15 +199,25 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        // Quickly reject rows whose geometry envelope does not intersect
+        // the spatial filter, before translating them
+        if( m_poFilterGeom != nullptr && iGeomCol >= 0 &&
+            GPKGGeomIsOutsideEnvelope(m_poQueryStatement, iGeomCol,
+                                      m_sFilterEnvelope) )
+        {
+            iNextShapeId++;
+            m_nFeaturesRead++;
+            continue;
+        }
+
+        oFeature.Reset();
+        TranslateFeatureInto(m_poQueryStatement, &oFeature);
 
         if( (m_poFilterGeom == nullptr
-            || FilterGeometry( poFeature->GetGeomFieldRef(m_iGeomFieldFilter) ) )
+            || FilterGeometry( oFeature.GetGeomFieldRef(m_iGeomFieldFilter) ) )
             && (m_poAttrQuery == nullptr
-                || m_poAttrQuery->Evaluate( poFeature )) )
-            return poFeature;
-
-        delete poFeature;
+                || m_poAttrQuery->Evaluate( &oFeature )) )
+            return true;
     }
 }
 
@@ -362,6 +429,20 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature( sqlite3_stmt* hStmt )
 /*      Create a feature from the current result.                       */
 /* -------------------------------------------------------------------- */
     OGRFeature *poFeature = new OGRFeature( m_poFeatureDefn );
+    TranslateFeatureInto( hStmt, poFeature );
+    return poFeature;
+}
+
+/************************************************************************/
+/*                        TranslateFeatureInto()                        */
+/*                                                                      */
+/*      poFeature must be in its state after construction.              */
+/************************************************************************/
+
+void OGRGeoPackageLayer::TranslateFeatureInto( sqlite3_stmt* hStmt,
+                                               OGRFeature* poFeature )
+
+{
 
 /* -------------------------------------------------------------------- */
 /*      Set FID if we have a column to set it from.                     */
@@ -395,19 +476,34 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature( sqlite3_stmt* hStmt )
             int iGpkgSize = sqlite3_column_bytes(hStmt, iGeomCol);
             // coverity[tainted_data_return]
             const GByte *pabyGpkg = static_cast<const GByte *>(sqlite3_column_blob(hStmt, iGeomCol));
-            OGRGeometry *poGeom = GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
-            if ( poGeom == nullptr )
+            // Keep the WKB as it is: the geometry object will only be
+            // instantiated if it is actually requested. With a spatial
+            // filter, it is always needed, so parse it directly rather than
+            // copying the WKB first.
+            GPkgHeader oHeader;
+            if( m_poFilterGeom == nullptr && iGpkgSize > 0 &&
+                GPkgHeaderFromWKB(pabyGpkg, iGpkgSize, &oHeader) == OGRERR_NONE &&
+                poFeature->SetGeomFieldFromWkb(0, pabyGpkg + oHeader.nHeaderLen,
+                    iGpkgSize - oHeader.nHeaderLen) == OGRERR_NONE )
+            {
+                // do nothing
+            }
+            else
             {
-                // Try also spatialite geometry blobs
-                if( OGRSQLiteImportSpatiaLiteGeometry( pabyGpkg, iGpkgSize,
-                                                              &poGeom ) != OGRERR_NONE )
+                OGRGeometry *poGeom = GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
+                if ( poGeom == nullptr )
                 {
-                    CPLError( CE_Failure, CPLE_AppDefined, "Unable to read geometry");
+                    // Try also spatialite geometry blobs
+                    if( OGRSQLiteImportSpatiaLiteGeometry( pabyGpkg, iGpkgSize,
+                                                                  &poGeom ) != OGRERR_NONE )
+                    {
+                        CPLError( CE_Failure, CPLE_AppDefined, "Unable to read geometry");
+                    }
                 }
+                if( poGeom != nullptr )
+                    poGeom->assignSpatialReference(poSrs);
+                poFeature->SetGeometryDirectly( poGeom );
             }
-            if( poGeom != nullptr )
-                poGeom->assignSpatialReference(poSrs);
-            poFeature->SetGeometryDirectly( poGeom );
         }
     }
 
@@ -506,8 +602,6 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature( sqlite3_stmt* hStmt )
                 break;
         }
     }
-
-    return poFeature;
 }
 
 /************************************************************************/
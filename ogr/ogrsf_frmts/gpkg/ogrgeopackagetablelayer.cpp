@@ -33,6 +33,7 @@
 #include "cpl_md5.h"
 #include "cpl_time.h"
 #include "ogr_p.h"
+#include "ogr_wkb.h"
 
 #include <algorithm>
 #include <cassert>
@@ -2174,75 +2175,533 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature( OGRFeature *poFeature, bo
             poGeom->getEnvelope(&oEnv);
             UpdateExtent(&oEnv);
 
-            if( !bUpsert && !m_bDeferredSpatialIndexCreation && HasSpatialIndex() && m_poDS->IsInTransaction() )
+            if( !bUpsert && !UpdateSpatialIndexOnInsert(nFID, oEnv) )
+                return OGRERR_FAILURE;
+        }
+    }
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+    if( m_nTotalFeatureCount >= 0 )
+        m_nTotalFeatureCount++;
+#endif
+
+    m_bContentChanged = true;
+
+    /* All done! */
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                     UpdateSpatialIndexOnInsert()                     */
+/************************************************************************/
+
+// Record the envelope of a newly inserted feature for the spatial index,
+// either as a deferred RTree update or in the batches of the asynchronous
+// RTree thread.
+bool OGRGeoPackageTableLayer::UpdateSpatialIndexOnInsert( GIntBig nFID,
+                                                          const OGREnvelope& oEnv )
+{
+    if( !m_bDeferredSpatialIndexCreation && HasSpatialIndex() && m_poDS->IsInTransaction() )
+    {
+        m_nCountInsertInTransaction ++;
+        if( m_nCountInsertInTransactionThreshold < 0 )
+        {
+            m_nCountInsertInTransactionThreshold = atoi(
+                CPLGetConfigOption("OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
+        }
+        if( m_nCountInsertInTransaction == m_nCountInsertInTransactionThreshold )
+        {
+            StartDeferredSpatialIndexUpdate();
+        }
+        else if( !m_aoRTreeTriggersSQL.empty() )
+        {
+            if( m_aoRTreeEntries.size() == 1000 * 1000 )
             {
-                m_nCountInsertInTransaction ++;
-                if( m_nCountInsertInTransactionThreshold < 0 )
-                {
-                    m_nCountInsertInTransactionThreshold = atoi(
-                        CPLGetConfigOption("OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
-                }
-                if( m_nCountInsertInTransaction == m_nCountInsertInTransactionThreshold )
+                if( !FlushPendingSpatialIndexUpdate() )
+                    return false;
+            }
+            GPKGRTreeEntry sEntry;
+            sEntry.nId = nFID;
+            sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+            sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+            sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+            sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+            m_aoRTreeEntries.push_back(sEntry);
+        }
+    }
+    else if( m_bAllowedRTreeThread && !m_bErrorDuringRTreeThread )
+    {
+        GPKGRTreeEntry sEntry;
+#ifdef DEBUG_VERBOSE
+        if( m_aoRTreeEntries.empty() )
+            CPLDebug("GPKG", "Starting to fill m_aoRTreeEntries at FID " CPL_FRMT_GIB, nFID);
+#endif
+        sEntry.nId = nFID;
+        sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+        sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+        sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+        sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+        m_aoRTreeEntries.push_back(sEntry);
+        if( m_aoRTreeEntries.size() == m_nRTreeBatchSize )
+        {
+            m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
+            m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
+        }
+        if( !m_bThreadRTreeStarted &&
+            m_oQueueRTreeEntries.size() == m_nRTreeBatchesBeforeStart )
+        {
+            StartAsyncRTree();
+        }
+    }
+    return true;
+}
+
+OGRErr OGRGeoPackageTableLayer::ICreateFeature( OGRFeature *poFeature )
+{
+    return CreateOrUpsertFeature(poFeature, /* bUpsert=*/ false);
+}
+
+/************************************************************************/
+/*                      GPKGArrowWriteColumn                            */
+/************************************************************************/
+
+namespace {
+
+struct GPKGArrowWriteColumn
+{
+    const struct ArrowArray* psArray = nullptr;
+    // Arrow format: one of "bcCsSiIlfguUzZ"
+    char chFormat = 0;
+    int  iField = -1;
+    bool bIsFID = false;
+    bool bIsGeom = false;
+};
+
+} // namespace
+
+/************************************************************************/
+/*                      GPKGHasArrowLargeOffsets()                      */
+/************************************************************************/
+
+// Large string ('U') and large binary ('Z') arrays use 64 bit offsets
+static inline bool GPKGHasArrowLargeOffsets(char chFormat)
+{
+    return chFormat == 'U' || chFormat == 'Z';
+}
+
+/************************************************************************/
+/*                        GPKGGetArrowInteger()                         */
+/************************************************************************/
+
+static GIntBig GPKGGetArrowInteger(const struct ArrowArray* psArray,
+                                   char chFormat, size_t iIdx)
+{
+    switch( chFormat )
+    {
+        case 'b':
+            return OGRArrowArrayHelper::GetArrowBool(psArray, iIdx) ? 1 : 0;
+        case 'c': return OGRArrowArrayHelper::GetArrowValue<int8_t>(psArray, iIdx);
+        case 'C': return OGRArrowArrayHelper::GetArrowValue<uint8_t>(psArray, iIdx);
+        case 's': return OGRArrowArrayHelper::GetArrowValue<int16_t>(psArray, iIdx);
+        case 'S': return OGRArrowArrayHelper::GetArrowValue<uint16_t>(psArray, iIdx);
+        case 'i': return OGRArrowArrayHelper::GetArrowValue<int32_t>(psArray, iIdx);
+        case 'I': return OGRArrowArrayHelper::GetArrowValue<uint32_t>(psArray, iIdx);
+        default: break;
+    }
+    return OGRArrowArrayHelper::GetArrowValue<int64_t>(psArray, iIdx);
+}
+
+/************************************************************************/
+/*                       WriteArrowBatchDirect()                        */
+/************************************************************************/
+
+// Insert the rows of an Arrow batch with a prepared INSERT statement to
+// which the Arrow buffers are bound directly, and WKB geometries are only
+// prefixed with a GeoPackage header, without going through OGRFeature and
+// OGRGeometry objects.
+// bFallback is set (and nothing is written) if the batch uses a construct
+// that is only handled by the generic implementation: offsets, types that
+// need a conversion, default values, empty/curve/M geometries, geometry
+// types that would emit a warning, etc.
+bool OGRGeoPackageTableLayer::WriteArrowBatchDirect(
+                                    const struct ArrowSchema* schema,
+                                    const struct ArrowArray* array,
+                                    CSLConstList papszOptions,
+                                    bool& bFallback)
+{
+    bFallback = true;
+    if( strcmp(schema->format, "+s") != 0 ||
+        schema->n_children != array->n_children ||
+        array->offset != 0 || m_iFIDAsRegularColumnIndex >= 0 )
+    {
+        return true;
+    }
+
+    const char* pszFIDName = CSLFetchNameValueDef(papszOptions, "FID",
+                                                  GetFIDColumn());
+    const char* pszGeomName = CSLFetchNameValue(papszOptions, "GEOMETRY_NAME");
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+
+/* -------------------------------------------------------------------- */
+/*      Map Arrow columns to table columns.                             */
+/* -------------------------------------------------------------------- */
+    std::vector<GPKGArrowWriteColumn> aoColumns;
+    std::vector<bool> abFieldMapped(nFieldCount);
+    int iGeomColumn = -1;
+    for( int64_t iChild = 0; iChild < schema->n_children; ++iChild )
+    {
+        const struct ArrowSchema* psChildSchema = schema->children[iChild];
+        const struct ArrowArray* psChildArray = array->children[iChild];
+        const char* pszName = psChildSchema->name ? psChildSchema->name : "";
+        const char* pszFormat = psChildSchema->format;
+        if( pszFormat[0] == '\0' || pszFormat[1] != '\0' ||
+            strchr("bcCsSiIlfguUzZ", pszFormat[0]) == nullptr ||
+            psChildArray->offset != 0 )
+        {
+            return true;
+        }
+
+        GPKGArrowWriteColumn oCol;
+        oCol.psArray = psChildArray;
+        oCol.chFormat = pszFormat[0];
+        const bool bIsBinary = oCol.chFormat == 'z' || oCol.chFormat == 'Z';
+        if( strchr("cCsSiIl", oCol.chFormat) != nullptr &&
+            pszFIDName[0] != '\0' && EQUAL(pszName, pszFIDName) )
+        {
+            oCol.bIsFID = true;
+        }
+        else if( bIsBinary && m_poFeatureDefn->GetFieldIndex(pszName) < 0 )
+        {
+            const std::string osExtensionName =
+                OGRArrowArrayHelper::GetArrowExtensionName(psChildSchema->metadata);
+            if( m_poFeatureDefn->GetGeomFieldCount() == 0 ||
+                iGeomColumn >= 0 ||
+                !(osExtensionName == "ogc.wkb" ||
+                  osExtensionName == "geoarrow.wkb" ||
+                  (pszGeomName && EQUAL(pszName, pszGeomName)) ||
+                  EQUAL(pszName, GetGeometryColumn())) )
+            {
+                return true;
+            }
+            oCol.bIsGeom = true;
+            iGeomColumn = static_cast<int>(aoColumns.size());
+        }
+        else
+        {
+            oCol.iField = m_poFeatureDefn->GetFieldIndex(pszName);
+            if( oCol.iField < 0 || abFieldMapped[oCol.iField] ||
+                m_abGeneratedColumns[oCol.iField] )
+            {
+                return true;
+            }
+            const OGRFieldDefn* poFieldDefn =
+                m_poFeatureDefn->GetFieldDefn(oCol.iField);
+            const OGRFieldType eType = poFieldDefn->GetType();
+            const OGRFieldSubType eSubType = poFieldDefn->GetSubType();
+            bool bCompatible;
+            switch( oCol.chFormat )
+            {
+                case 'b':
+                    bCompatible = eType == OFTInteger &&
+                                  (eSubType == OFSTNone ||
+                                   eSubType == OFSTBoolean);
+                    break;
+                case 'c': case 'C': case 's': case 'S': case 'i':
+                    bCompatible = (eType == OFTInteger ||
+                                   eType == OFTInteger64) &&
+                                  eSubType == OFSTNone;
+                    break;
+                case 'I': case 'l':
+                    bCompatible = eType == OFTInteger64;
+                    break;
+                case 'f': case 'g':
+                    bCompatible = eType == OFTReal && eSubType == OFSTNone;
+                    break;
+                case 'u': case 'U':
+                    // No truncation or UTF-8 validation needed
+                    bCompatible = eType == OFTString &&
+                                  poFieldDefn->GetWidth() == 0;
+                    break;
+                default:
+                    bCompatible = eType == OFTBinary;
+                    break;
+            }
+            if( !bCompatible )
+                return true;
+            // The generic implementation leaves null values of not-nullable
+            // fields unset, so that their default value applies.
+            if( poFieldDefn->GetDefault() != nullptr &&
+                !poFieldDefn->IsNullable() && psChildArray->null_count != 0 )
+            {
+                return true;
+            }
+            abFieldMapped[oCol.iField] = true;
+        }
+        aoColumns.push_back(oCol);
+    }
+
+    // Fields absent from the batch must be set to their OGR default value,
+    // which may use a different syntax than the SQLite one.
+    for( int i = 0; i < nFieldCount; ++i )
+    {
+        if( !abFieldMapped[i] && !m_abGeneratedColumns[i] &&
+            m_poFeatureDefn->GetFieldDefn(i)->GetDefault() != nullptr )
+        {
+            return true;
+        }
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Check geometries and compute their envelopes.                   */
+/* -------------------------------------------------------------------- */
+    const size_t nLength = static_cast<size_t>(array->length);
+    std::vector<OGREnvelope> asEnvelopes;
+    if( iGeomColumn >= 0 )
+    {
+        const auto& oGeomCol = aoColumns[iGeomColumn];
+        const OGRwkbGeometryType eLayerGeomType = GetGeomType();
+        const bool bLayerMayHaveZ = wkbHasZ(eLayerGeomType) || m_nZFlag != 0;
+        asEnvelopes.resize(nLength);
+        for( size_t iRow = 0; iRow < nLength; ++iRow )
+        {
+            if( OGRArrowArrayHelper::IsArrowValueNull(oGeomCol.psArray, iRow) )
+                continue;
+            size_t nWKBSize = 0;
+            const GByte* pabyWKB = OGRArrowArrayHelper::GetArrowStringOrBinary(
+                oGeomCol.psArray, GPKGHasArrowLargeOffsets(oGeomCol.chFormat), iRow, nWKBSize);
+            bool bNeedSwap = false;
+            uint32_t nType = 0;
+            // Only non-empty linear XY and XYZ ISO WKB geometries
+            if( pabyWKB == nullptr ||
+                !OGRWKBGetGeomType(pabyWKB, nWKBSize, bNeedSwap, nType) ||
+                !((nType >= wkbPoint && nType <= wkbGeometryCollection) ||
+                  (bLayerMayHaveZ && nType >= wkbPoint + 1000 &&
+                   nType <= wkbGeometryCollection + 1000)) ||
+                !OGRWKBGetBoundingBox(pabyWKB, nWKBSize, asEnvelopes[iRow]) ||
+                std::isnan(asEnvelopes[iRow].MinX) ||
+                std::isnan(asEnvelopes[iRow].MinY) )
+            {
+                return true;
+            }
+            const auto eGeomType = static_cast<OGRwkbGeometryType>(nType % 1000);
+            if( wkbFlatten(eLayerGeomType) != wkbUnknown &&
+                !OGR_GT_IsSubClassOf(eGeomType, wkbFlatten(eLayerGeomType)) )
+            {
+                return true;
+            }
+        }
+    }
+
+    bFallback = false;
+
+    if( m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE )
+        return false;
+
+    CancelAsyncNextArrowArray();
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+    // To maximize performance of insertion, disable feature count triggers
+    if( m_bOGRFeatureCountTriggersEnabled )
+    {
+        DisableFeatureCountTriggers();
+    }
+#endif
+
+/* -------------------------------------------------------------------- */
+/*      Prepare the INSERT statement.                                   */
+/* -------------------------------------------------------------------- */
+    CPLString osSQL;
+    if( aoColumns.empty() )
+    {
+        osSQL.Printf("INSERT INTO \"%s\" DEFAULT VALUES",
+                     SQLEscapeName(m_pszTableName).c_str());
+    }
+    else
+    {
+        osSQL.Printf("INSERT INTO \"%s\" (",
+                     SQLEscapeName(m_pszTableName).c_str());
+        CPLString osValues(") VALUES (");
+        for( size_t i = 0; i < aoColumns.size(); ++i )
+        {
+            const auto& oCol = aoColumns[i];
+            const char* pszColName =
+                oCol.bIsFID ? GetFIDColumn() :
+                oCol.bIsGeom ? GetGeometryColumn() :
+                m_poFeatureDefn->GetFieldDefn(oCol.iField)->GetNameRef();
+            if( i > 0 )
+            {
+                osSQL += ", ";
+                osValues += ", ";
+            }
+            osSQL += "\"";
+            osSQL += SQLEscapeName(pszColName);
+            osSQL += "\"";
+            osValues += "?";
+        }
+        osSQL += osValues;
+        osSQL += ")";
+    }
+
+    sqlite3 *hDB = m_poDS->GetDB();
+    sqlite3_stmt *hStmt = nullptr;
+    if( sqlite3_prepare_v2(hDB, osSQL, -1, &hStmt, nullptr) != SQLITE_OK )
+    {
+        CPLError( CE_Failure, CPLE_AppDefined,
+                  "failed to prepare SQL: %s - %s", osSQL.c_str(),
+                  sqlite3_errmsg(hDB) );
+        return false;
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Insert rows.                                                    */
+/* -------------------------------------------------------------------- */
+    std::vector<GByte> abyGeom;
+    bool bRet = true;
+    for( size_t iRow = 0; iRow < nLength; ++iRow )
+    {
+        int err = SQLITE_OK;
+        for( int i = 0; err == SQLITE_OK &&
+                        i < static_cast<int>(aoColumns.size()); ++i )
+        {
+            const auto& oCol = aoColumns[i];
+            const int iParam = i + 1;
+            if( OGRArrowArrayHelper::IsArrowValueNull(oCol.psArray, iRow) )
+            {
+                err = sqlite3_bind_null(hStmt, iParam);
+                continue;
+            }
+            switch( oCol.chFormat )
+            {
+                case 'f':
+                    err = sqlite3_bind_double(hStmt, iParam,
+                        OGRArrowArrayHelper::GetArrowValue<float>(oCol.psArray, iRow));
+                    break;
+                case 'g':
+                    err = sqlite3_bind_double(hStmt, iParam,
+                        OGRArrowArrayHelper::GetArrowValue<double>(oCol.psArray, iRow));
+                    break;
+                case 'u': case 'U':
                 {
-                    StartDeferredSpatialIndexUpdate();
+                    size_t nLen = 0;
+                    const GByte* pabyStr = OGRArrowArrayHelper::GetArrowStringOrBinary(
+                        oCol.psArray, GPKGHasArrowLargeOffsets(oCol.chFormat), iRow, nLen);
+                    err = sqlite3_bind_text(hStmt, iParam,
+                        pabyStr ? reinterpret_cast<const char*>(pabyStr) : "",
+                        static_cast<int>(nLen), SQLITE_STATIC);
+                    break;
                 }
-                else if( !m_aoRTreeTriggersSQL.empty() )
+                case 'z': case 'Z':
                 {
-                    if( m_aoRTreeEntries.size() == 1000 * 1000 )
+                    size_t nLen = 0;
+                    const GByte* pabyData = OGRArrowArrayHelper::GetArrowStringOrBinary(
+                        oCol.psArray, GPKGHasArrowLargeOffsets(oCol.chFormat), iRow, nLen);
+                    if( oCol.bIsGeom )
+                    {
+                        // GeoPackage header, with a XY envelope except for
+                        // points, followed by the WKB geometry, which has
+                        // been validated above.
+                        bool bNeedSwap = false;
+                        uint32_t nType = 0;
+                        OGRWKBGetGeomType(pabyData, nLen, bNeedSwap, nType);
+                        const bool bPoint = (nType % 1000) == wkbPoint;
+                        const size_t nHeaderLen = bPoint ? 8 : 8 + 4 * 8;
+                        abyGeom.resize(nHeaderLen + nLen);
+                        abyGeom[0] = 0x47;
+                        abyGeom[1] = 0x50;
+                        abyGeom[2] = 0;
+                        abyGeom[3] = static_cast<GByte>(
+                            ((bPoint ? 0 : 1) << 1) | CPL_IS_LSB);
+                        memcpy(&abyGeom[4], &m_iSrs, 4);
+                        if( !bPoint )
+                        {
+                            const OGREnvelope& sEnv = asEnvelopes[iRow];
+                            const double adfEnv[4] = { sEnv.MinX, sEnv.MaxX,
+                                                       sEnv.MinY, sEnv.MaxY };
+                            memcpy(&abyGeom[8], adfEnv, sizeof(adfEnv));
+                        }
+                        memcpy(&abyGeom[nHeaderLen], pabyData, nLen);
+                        err = sqlite3_bind_blob(hStmt, iParam, abyGeom.data(),
+                                                static_cast<int>(abyGeom.size()),
+                                                SQLITE_STATIC);
+                    }
+                    else
                     {
-                        if( !FlushPendingSpatialIndexUpdate() )
-                            return OGRERR_FAILURE;
+                        err = sqlite3_bind_blob(hStmt, iParam,
+                            pabyData ? static_cast<const void*>(pabyData) : "",
+                            static_cast<int>(nLen), SQLITE_STATIC);
                     }
-                    GPKGRTreeEntry sEntry;
-                    sEntry.nId = nFID;
-                    sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                    sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                    sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                    sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                    m_aoRTreeEntries.push_back(sEntry);
+                    break;
                 }
+                default:
+                    err = sqlite3_bind_int64(hStmt, iParam,
+                        GPKGGetArrowInteger(oCol.psArray, oCol.chFormat, iRow));
+                    break;
             }
-            else if( !bUpsert && m_bAllowedRTreeThread && !m_bErrorDuringRTreeThread )
+        }
+        if( err == SQLITE_OK )
+            err = sqlite3_step(hStmt);
+        if( err != SQLITE_DONE )
+        {
+            CPLError( CE_Failure, CPLE_AppDefined,
+                      "failed to execute insert : %s",
+                      sqlite3_errmsg(hDB) ? sqlite3_errmsg(hDB) : "");
+            bRet = false;
+            break;
+        }
+        const GIntBig nFID = sqlite3_last_insert_rowid(hDB);
+        sqlite3_reset(hStmt);
+
+        if( iGeomColumn >= 0 && asEnvelopes[iRow].IsInit() )
+        {
+            UpdateExtent(&asEnvelopes[iRow]);
+            if( !UpdateSpatialIndexOnInsert(nFID, asEnvelopes[iRow]) )
             {
-                GPKGRTreeEntry sEntry;
-#ifdef DEBUG_VERBOSE
-                if( m_aoRTreeEntries.empty() )
-                    CPLDebug("GPKG", "Starting to fill m_aoRTreeEntries at FID " CPL_FRMT_GIB, nFID);
-#endif
-                sEntry.nId = nFID;
-                sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                m_aoRTreeEntries.push_back(sEntry);
-                if( m_aoRTreeEntries.size() == m_nRTreeBatchSize )
-                {
-                    m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
-                    m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
-                }
-                if( !m_bThreadRTreeStarted &&
-                    m_oQueueRTreeEntries.size() == m_nRTreeBatchesBeforeStart )
-                {
-                    StartAsyncRTree();
-                }
+                bRet = false;
+                break;
             }
         }
-    }
 
 #ifdef ENABLE_GPKG_OGR_CONTENTS
-    if( m_nTotalFeatureCount >= 0 )
-        m_nTotalFeatureCount++;
+        if( m_nTotalFeatureCount >= 0 )
+            m_nTotalFeatureCount++;
 #endif
+    }
+    sqlite3_finalize(hStmt);
 
     m_bContentChanged = true;
 
-    /* All done! */
-    return OGRERR_NONE;
+    return bRet;
 }
 
-OGRErr OGRGeoPackageTableLayer::ICreateFeature( OGRFeature *poFeature )
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::WriteArrowBatch(const struct ArrowSchema* schema,
+                                              struct ArrowArray* array,
+                                              CSLConstList papszOptions)
 {
-    return CreateOrUpsertFeature(poFeature, /* bUpsert=*/ false);
+    if( !m_bFeatureDefnCompleted )
+        GetLayerDefn();
+    if( !CheckUpdatableTable("WriteArrowBatch") )
+        return false;
+
+    // Run all the inserts of the batch within a single transaction, so that
+    // RTree updates can be deferred to a bulk insertion.
+    if( m_poDS->SoftStartTransaction() != OGRERR_NONE )
+        return false;
+
+    bool bFallback = false;
+    bool bRet = WriteArrowBatchDirect(schema, array, papszOptions, bFallback);
+    if( bRet && bFallback )
+        bRet = OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    if( !bRet )
+    {
+        m_poDS->SoftRollbackTransaction();
+        return false;
+    }
+
+    return m_poDS->SoftCommitTransaction() == OGRERR_NONE;
 }
 
 /************************************************************************/
@@ -2731,8 +3190,23 @@ OGRFeature* OGRGeoPackageTableLayer::GetNextFeature()
 {
     if( !m_bFeatureDefnCompleted )
         GetLayerDefn();
-    if( m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE )
+
+    auto poFeature = cpl::make_unique<OGRFeature>(m_poFeatureDefn);
+    if( !OGRGeoPackageTableLayer::GetNextFeatureInto(*poFeature) )
         return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::GetNextFeatureInto( OGRFeature& oFeature )
+{
+    if( !m_bFeatureDefnCompleted )
+        GetLayerDefn();
+    if( m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE )
+        return false;
 
     CancelAsyncNextArrowArray();
 
@@ -2741,15 +3215,16 @@ OGRFeature* OGRGeoPackageTableLayer::GetNextFeature()
         // Both are exclusive
         CreateSpatialIndexIfNecessary();
         if( !RunDeferredSpatialIndexUpdate() )
-            return nullptr;
+            return false;
     }
 
-    OGRFeature* poFeature = OGRGeoPackageLayer::GetNextFeature();
-    if( poFeature && m_iFIDAsRegularColumnIndex >= 0 )
+    if( !OGRGeoPackageLayer::GetNextFeatureInto(oFeature) )
+        return false;
+    if( m_iFIDAsRegularColumnIndex >= 0 )
     {
-        poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
+        oFeature.SetField(m_iFIDAsRegularColumnIndex, oFeature.GetFID());
     }
-    return poFeature;
+    return true;
 }
 
 /************************************************************************/
@@ -3455,6 +3930,8 @@ int OGRGeoPackageTableLayer::TestCapability ( const char * pszCap )
         return TRUE;
     else if( EQUAL(pszCap,OLCZGeometries) )
         return TRUE;
+    else if( EQUAL(pszCap,OLCFastWriteArrowBatch) )
+        return m_poDS->GetUpdate() && m_bIsTable;
     else
     {
         return OGRGeoPackageLayer::TestCapability(pszCap);
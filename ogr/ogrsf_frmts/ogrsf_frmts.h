@@ -172,12 +172,16 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void        ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    virtual bool        GetNextFeatureInto( OGRFeature& oFeature );
     virtual OGRErr      SetNextByIndex( GIntBig nIndex );
     virtual OGRFeature *GetFeature( GIntBig nFID )  CPL_WARN_UNUSED_RESULT;
 
     virtual GDALDataset* GetDataset();
     virtual bool         GetArrowStream(struct ArrowArrayStream* out_stream,
                                         CSLConstList papszOptions = nullptr);
+    virtual bool         WriteArrowBatch(const struct ArrowSchema* schema,
+                                         struct ArrowArray* array,
+                                         CSLConstList papszOptions = nullptr);
 
     OGRErr      SetFeature( OGRFeature *poFeature )  CPL_WARN_UNUSED_RESULT;
     OGRErr      CreateFeature( OGRFeature *poFeature ) CPL_WARN_UNUSED_RESULT;
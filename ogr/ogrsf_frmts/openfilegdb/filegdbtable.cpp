@@ -2608,6 +2608,12 @@ class FileGDBOGRGeometryConverterImpl final : public FileGDBOGRGeometryConverter
         int                          bUseOrganize;
 #endif
 
+        // Working buffers of GetAsISOWKB()
+        std::vector<double>          adfX{};
+        std::vector<double>          adfY{};
+        std::vector<double>          adfZ{};
+        std::vector<double>          adfM{};
+
         bool                        ReadPartDefs( GByte*& pabyCur,
                                                   GByte* pabyEnd,
                                                   GUInt32& nPoints,
@@ -2632,6 +2638,11 @@ class FileGDBOGRGeometryConverterImpl final : public FileGDBOGRGeometryConverter
                                                 GUInt32 nPoints,
                                                 GIntBig& dm);
 
+        bool         GetPartsAsISOWKB( GByte*& pabyCur, GByte* pabyEnd,
+                                       GUInt32 nGeomType, bool bIsPolygon,
+                                       bool bHasZ, bool bHasM,
+                                       std::vector<GByte>& abyWKB );
+
         OGRGeometry* CreateCurveGeometry(
                   GUInt32 nBaseShapeType,
                   GUInt32 nParts, GUInt32 nPoints, GUInt32 nCurves,
@@ -2644,6 +2655,8 @@ class FileGDBOGRGeometryConverterImpl final : public FileGDBOGRGeometryConverter
        virtual                         ~FileGDBOGRGeometryConverterImpl();
 
        virtual OGRGeometry*             GetAsGeometry(const OGRField* psField) override;
+       virtual bool                     GetAsISOWKB(const OGRField* psField,
+                                                    std::vector<GByte>& abyWKB) override;
 };
 
 /************************************************************************/
@@ -3727,6 +3740,304 @@ OGRGeometry* FileGDBOGRGeometryConverterImpl::GetAsGeometry(const OGRField* psFi
     return nullptr;
 }
 
+/************************************************************************/
+/*                           ISO WKB writers                            */
+/************************************************************************/
+
+static GByte* WKBWriteHeader(GByte* pabyOut, GUInt32 nWKBType,
+                             bool bHasZ, bool bHasM)
+{
+    pabyOut[0] = wkbNDR;
+    nWKBType += (bHasZ ? 1000 : 0) + (bHasM ? 2000 : 0);
+    CPL_LSBPTR32(&nWKBType);
+    memcpy(pabyOut + 1, &nWKBType, sizeof(GUInt32));
+    return pabyOut + 1 + sizeof(GUInt32);
+}
+
+static GByte* WKBWriteUInt32(GByte* pabyOut, GUInt32 nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    memcpy(pabyOut, &nVal, sizeof(GUInt32));
+    return pabyOut + sizeof(GUInt32);
+}
+
+static GByte* WKBWriteDouble(GByte* pabyOut, double dfVal)
+{
+    CPL_LSBPTR64(&dfVal);
+    memcpy(pabyOut, &dfVal, sizeof(double));
+    return pabyOut + sizeof(double);
+}
+
+/************************************************************************/
+/*                          GetPartsAsISOWKB()                          */
+/*                                                                      */
+/*      Polylines are written as multilinestrings, and single ring      */
+/*      polygons as multipolygons.                                      */
+/************************************************************************/
+
+bool FileGDBOGRGeometryConverterImpl::GetPartsAsISOWKB(GByte*& pabyCur,
+                                                       GByte* pabyEnd,
+                                                       GUInt32 nGeomType,
+                                                       bool bIsPolygon,
+                                                       bool bHasZ, bool bHasM,
+                                                       std::vector<GByte>& abyWKB)
+{
+    const bool errorRetValue = true;
+    GUInt32 i, nPoints, nParts, nCurves;
+    GIntBig dx = 0, dy = 0, dz = 0, dm = 0;
+
+    returnErrorIf(!ReadPartDefs(pabyCur, pabyEnd, nPoints, nParts, nCurves,
+                      (nGeomType & EXT_SHAPE_CURVE_FLAG) != 0,
+                      false) );
+
+    // Polygons with several rings need organizePolygons()
+    if( nPoints == 0 || nParts == 0 || nCurves != 0 ||
+        (bIsPolygon && nParts != 1) )
+    {
+        return false;
+    }
+
+    adfX.resize(nPoints);
+    adfY.resize(nPoints);
+    XYArraySetter arraySetter(adfX.data(), adfY.data());
+    returnErrorIf(!ReadXYArray<XYArraySetter>(arraySetter,
+                     pabyCur, pabyEnd, nPoints, dx, dy) );
+
+    if( bHasZ )
+    {
+        adfZ.resize(nPoints);
+        FileGDBArraySetter arrayzSetter(adfZ.data());
+        returnErrorIf(!ReadZArray<FileGDBArraySetter>(arrayzSetter,
+                        pabyCur, pabyEnd, nPoints, dz) );
+    }
+
+    if( bHasM )
+    {
+        // See GetAsGeometry() regarding the absence of M array.
+        // The check is done on a per-part basis.
+        adfM.resize(nPoints);
+        GUInt32 nOffset = 0;
+        for( i = 0; i < nParts; i++ )
+        {
+            if( pabyCur + panPointCount[i] > pabyEnd )
+            {
+                bHasM = false;
+                break;
+            }
+            FileGDBArraySetter arraymSetter(adfM.data() + nOffset);
+            returnErrorIf(!ReadMArray<FileGDBArraySetter>(arraymSetter,
+                            pabyCur, pabyEnd, panPointCount[i], dm) );
+            nOffset += panPointCount[i];
+        }
+    }
+
+    const size_t nCoordSize =
+        (2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0)) * sizeof(double);
+    size_t nWKBSize = 1 + 2 * sizeof(GUInt32) +
+                      nParts * (1 + 2 * sizeof(GUInt32)) +
+                      nPoints * nCoordSize;
+    if( bIsPolygon )
+        nWKBSize += sizeof(GUInt32);
+    abyWKB.resize(nWKBSize);
+
+    GByte* pabyOut = WKBWriteHeader(abyWKB.data(),
+        bIsPolygon ? wkbMultiPolygon : wkbMultiLineString, bHasZ, bHasM);
+    pabyOut = WKBWriteUInt32(pabyOut, nParts);
+    GUInt32 iPoint = 0;
+    for( i = 0; i < nParts; i++ )
+    {
+        if( bIsPolygon )
+        {
+            pabyOut = WKBWriteHeader(pabyOut, wkbPolygon, bHasZ, bHasM);
+            pabyOut = WKBWriteUInt32(pabyOut, 1);
+        }
+        else
+        {
+            pabyOut = WKBWriteHeader(pabyOut, wkbLineString, bHasZ, bHasM);
+        }
+        pabyOut = WKBWriteUInt32(pabyOut, panPointCount[i]);
+        for( GUInt32 j = 0; j < panPointCount[i]; j++, iPoint++ )
+        {
+            pabyOut = WKBWriteDouble(pabyOut, adfX[iPoint]);
+            pabyOut = WKBWriteDouble(pabyOut, adfY[iPoint]);
+            if( bHasZ )
+                pabyOut = WKBWriteDouble(pabyOut, adfZ[iPoint]);
+            if( bHasM )
+                pabyOut = WKBWriteDouble(pabyOut, adfM[iPoint]);
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            GetAsISOWKB()                             */
+/*                                                                      */
+/*      Decodes the same shapes as GetAsGeometry(), with the same       */
+/*      handling of missing M arrays, but directly into ISO WKB.        */
+/************************************************************************/
+
+bool FileGDBOGRGeometryConverterImpl::GetAsISOWKB(const OGRField* psField,
+                                                  std::vector<GByte>& abyWKB)
+{
+    const bool errorRetValue = true;
+    GByte* pabyCur = psField->Binary.paData;
+    GByte* pabyEnd = pabyCur + psField->Binary.nCount;
+    GUInt32 nGeomType, i, nPoints;
+    GIntBig dx = 0, dy = 0, dz = 0, dm = 0;
+
+    abyWKB.clear();
+
+    ReadVarUInt32NoCheck(pabyCur, nGeomType);
+
+    bool bHasZ = (nGeomType & EXT_SHAPE_Z_FLAG) != 0;
+    bool bHasM = (nGeomType & EXT_SHAPE_M_FLAG) != 0;
+    switch( (nGeomType & 0xff) )
+    {
+        case SHPT_NULL:
+            return true;
+
+        case SHPT_POINTZ:
+        case SHPT_POINTZM:
+            bHasZ = true; /* go on */
+            CPL_FALLTHROUGH
+        case SHPT_POINT:
+        case SHPT_POINTM:
+        case SHPT_GENERALPOINT:
+        {
+            if( nGeomType == SHPT_POINTM || nGeomType == SHPT_POINTZM )
+                bHasM = true;
+
+            GUIntBig x, y;
+            ReadVarUInt64NoCheck(pabyCur, x);
+            ReadVarUInt64NoCheck(pabyCur, y);
+
+            const double dfX =
+                CPLUnsanitizedAdd<GUIntBig>(x, -1) / poGeomField->GetXYScale() + poGeomField->GetXOrigin();
+            const double dfY =
+                CPLUnsanitizedAdd<GUIntBig>(y, -1) / poGeomField->GetXYScale() + poGeomField->GetYOrigin();
+            double dfZ = 0.0;
+            double dfM = 0.0;
+            if( bHasZ )
+            {
+                GUIntBig z = 0;
+                ReadVarUInt64NoCheck(pabyCur, z);
+                const double dfZScale = SanitizeScale(poGeomField->GetZScale());
+                dfZ = CPLUnsanitizedAdd<GUIntBig>(z, -1) / dfZScale + poGeomField->GetZOrigin();
+            }
+            if( bHasM )
+            {
+                GUIntBig m = 0;
+                ReadVarUInt64NoCheck(pabyCur, m);
+                const double dfMScale = SanitizeScale(poGeomField->GetMScale());
+                dfM = CPLUnsanitizedAdd<GUIntBig>(m, -1) / dfMScale + poGeomField->GetMOrigin();
+            }
+
+            abyWKB.resize(1 + sizeof(GUInt32) +
+                          (2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0)) * sizeof(double));
+            GByte* pabyOut = WKBWriteHeader(abyWKB.data(), wkbPoint, bHasZ, bHasM);
+            pabyOut = WKBWriteDouble(pabyOut, dfX);
+            pabyOut = WKBWriteDouble(pabyOut, dfY);
+            if( bHasZ )
+                pabyOut = WKBWriteDouble(pabyOut, dfZ);
+            if( bHasM )
+                WKBWriteDouble(pabyOut, dfM);
+            return true;
+        }
+
+        case SHPT_MULTIPOINTZM:
+        case SHPT_MULTIPOINTZ:
+            bHasZ = true; /* go on */
+            CPL_FALLTHROUGH
+        case SHPT_MULTIPOINT:
+        case SHPT_MULTIPOINTM:
+        {
+            if( nGeomType == SHPT_MULTIPOINTM || nGeomType == SHPT_MULTIPOINTZM )
+                bHasM = true;
+
+            returnErrorIf(!ReadVarUInt32(pabyCur, pabyEnd, nPoints) );
+            if( nPoints == 0 )
+                return false;
+
+            returnErrorIf(!SkipVarUInt(pabyCur, pabyEnd, 4) );
+            returnErrorIf(nPoints > (GUInt32)(pabyEnd - pabyCur) );
+
+            adfX.resize(nPoints);
+            adfY.resize(nPoints);
+            XYArraySetter arraySetter(adfX.data(), adfY.data());
+            returnErrorIf(!ReadXYArray<XYArraySetter>(arraySetter,
+                             pabyCur, pabyEnd, nPoints, dx, dy) );
+
+            if( bHasZ )
+            {
+                adfZ.resize(nPoints);
+                FileGDBArraySetter arrayzSetter(adfZ.data());
+                returnErrorIf(!ReadZArray<FileGDBArraySetter>(arrayzSetter,
+                                pabyCur, pabyEnd, nPoints, dz) );
+            }
+
+            // See GetAsGeometry() regarding the absence of M array
+            bHasM = bHasM && pabyCur + nPoints <= pabyEnd;
+            if( bHasM )
+            {
+                adfM.resize(nPoints);
+                FileGDBArraySetter arraymSetter(adfM.data());
+                returnErrorIf(!ReadMArray<FileGDBArraySetter>(arraymSetter,
+                                pabyCur, pabyEnd, nPoints, dm) );
+            }
+
+            const size_t nPointSize = 1 + sizeof(GUInt32) +
+                (2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0)) * sizeof(double);
+            abyWKB.resize(1 + 2 * sizeof(GUInt32) + nPoints * nPointSize);
+            GByte* pabyOut = WKBWriteHeader(abyWKB.data(), wkbMultiPoint, bHasZ, bHasM);
+            pabyOut = WKBWriteUInt32(pabyOut, nPoints);
+            for( i = 0; i < nPoints; i++ )
+            {
+                pabyOut = WKBWriteHeader(pabyOut, wkbPoint, bHasZ, bHasM);
+                pabyOut = WKBWriteDouble(pabyOut, adfX[i]);
+                pabyOut = WKBWriteDouble(pabyOut, adfY[i]);
+                if( bHasZ )
+                    pabyOut = WKBWriteDouble(pabyOut, adfZ[i]);
+                if( bHasM )
+                    pabyOut = WKBWriteDouble(pabyOut, adfM[i]);
+            }
+            return true;
+        }
+
+        case SHPT_ARCZ:
+        case SHPT_ARCZM:
+            bHasZ = true; /* go on */
+            CPL_FALLTHROUGH
+        case SHPT_ARC:
+        case SHPT_ARCM:
+        case SHPT_GENERALPOLYLINE:
+        {
+            if( nGeomType == SHPT_ARCM || nGeomType == SHPT_ARCZM )
+                bHasM = true;
+            return GetPartsAsISOWKB(pabyCur, pabyEnd, nGeomType, false,
+                                    bHasZ, bHasM, abyWKB);
+        }
+
+        case SHPT_POLYGONZ:
+        case SHPT_POLYGONZM:
+            bHasZ = true; /* go on */
+            CPL_FALLTHROUGH
+        case SHPT_POLYGON:
+        case SHPT_POLYGONM:
+        case SHPT_GENERALPOLYGON:
+        {
+            if( nGeomType == SHPT_POLYGONM || nGeomType == SHPT_POLYGONZM )
+                bHasM = true;
+            return GetPartsAsISOWKB(pabyCur, pabyEnd, nGeomType, true,
+                                    bHasZ, bHasM, abyWKB);
+        }
+
+        default:
+            // Multipatches and unhandled types
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                           BuildConverter()                           */
 /************************************************************************/
@@ -590,6 +590,14 @@ class FileGDBOGRGeometryConverter
 
        virtual OGRGeometry*                GetAsGeometry(const OGRField* psField) = 0;
 
+       /* Returns the geometry as NDR ISO WKB, with linestrings and polygons */
+       /* promoted to multi geometries, without building an OGRGeometry. */
+       /* An empty abyWKB means a null or corrupted geometry. Returns false */
+       /* for curves, multipatches, polygons with several rings and empty */
+       /* geometries, for which GetAsGeometry() must be used. */
+       virtual bool                        GetAsISOWKB(const OGRField* psField,
+                                                       std::vector<GByte>& abyWKB) = 0;
+
        static FileGDBOGRGeometryConverter* BuildConverter(const FileGDBGeomField* poGeomField);
        static OGRwkbGeometryType           GetGeometryTypeFromESRI(const char* pszESRIGeometryType);
 };
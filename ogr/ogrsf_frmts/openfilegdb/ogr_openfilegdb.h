@@ -130,6 +130,7 @@ class OGROpenFileGDBLayer final: public OGRLayer
     int               BuildLayerDefinition();
     int               BuildGeometryColumnGDBv10(const std::string& osParentDefinition);
     OGRFeature       *GetCurrentFeature();
+    bool              CanUseFastArrowStream();
 
     std::unique_ptr<FileGDBOGRGeometryConverter> m_poGeomConverter{};
 
@@ -227,6 +228,8 @@ public:
   virtual OGRFeature* GetNextFeature() override;
   virtual OGRFeature* GetFeature( GIntBig nFeatureId ) override;
   virtual OGRErr      SetNextByIndex( GIntBig nIndex ) override;
+  virtual int         GetNextArrowArray(struct ArrowArrayStream*,
+                                        struct ArrowArray* out_array) override;
 
   virtual GIntBig     GetFeatureCount( int bForce = TRUE ) override;
   virtual OGRErr      GetExtent(OGREnvelope *psExtent, int bForce = TRUE) override;
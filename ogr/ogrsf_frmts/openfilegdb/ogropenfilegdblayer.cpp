@@ -52,6 +52,7 @@
 #include "ogrsf_frmts.h"
 #include "filegdbtable.h"
 #include "ogr_swq.h"
+#include "ograrrowarrayhelper.h"
 
 
 /************************************************************************/
@@ -1619,6 +1620,34 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                          PromoteToMulti()                           */
+/*                                                                     */
+/*      Layer geometry types are multi types.                          */
+/***********************************************************************/
+
+static OGRGeometry* PromoteToMulti(OGRGeometry* poGeom)
+{
+    OGRwkbGeometryType eFlattenType = wkbFlatten(poGeom->getGeometryType());
+    if( eFlattenType == wkbPolygon )
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if( eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface* poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly( poGeom );
+        poGeom = poMS;
+    }
+    else if( eFlattenType == wkbLineString )
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve* poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly( poGeom );
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
@@ -1670,23 +1699,7 @@ OGRFeature* OGROpenFileGDBLayer::GetCurrentFeature()
                 OGRGeometry* poGeom = m_poGeomConverter->GetAsGeometry(psField);
                 if( poGeom != nullptr )
                 {
-                    OGRwkbGeometryType eFlattenType = wkbFlatten(poGeom->getGeometryType());
-                    if( eFlattenType == wkbPolygon )
-                        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if( eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface* poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly( poGeom );
-                        poGeom = poMS;
-                    }
-                    else if( eFlattenType == wkbLineString )
-                        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve* poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly( poGeom );
-                        poGeom = poMC;
-                    }
+                    poGeom = PromoteToMulti(poGeom);
 
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef() );
@@ -1844,6 +1857,368 @@ OGRFeature* OGROpenFileGDBLayer::GetNextFeature()
     }
 }
 
+/***********************************************************************/
+/*                       CanUseFastArrowStream()                       */
+/***********************************************************************/
+
+bool OGROpenFileGDBLayer::CanUseFastArrowStream()
+{
+    // Attribute filters that the indexes do not fully evaluate, and spatial
+    // filters without geometry to test, require OGRFeature.
+    if( m_poAttrQuery != nullptr &&
+        !(m_poAttributeIterator != nullptr &&
+          m_bIteratorSufficientToEvaluateFilter) )
+    {
+        return false;
+    }
+    if( m_poFilterGeom != nullptr &&
+        (m_iGeomFieldIdx < 0 ||
+         m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored()) )
+    {
+        return false;
+    }
+    return true;
+}
+
+/***********************************************************************/
+/*                         GetNextArrowArray()                         */
+/*                                                                     */
+/*      Decodes the rows straight into the Arrow buffers, without      */
+/*      going through OGRFeature. Rows are selected with the same      */
+/*      iterators as GetNextFeature().                                 */
+/***********************************************************************/
+
+int OGROpenFileGDBLayer::GetNextArrowArray( struct ArrowArrayStream* stream,
+                                            struct ArrowArray* out_array )
+{
+    if( !BuildLayerDefinition() )
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EIO;
+    }
+
+    if( !CanUseFastArrowStream() ||
+        CPLTestBool(CPLGetConfigOption("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "NO")) )
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    memset(out_array, 0, sizeof(*out_array));
+    if( m_bEOF )
+        return 0;
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if( out_array->release == nullptr )
+    {
+        return ENOMEM;
+    }
+
+    FileGDBIterator* poIterator =
+        m_poCombinedIterator ? m_poCombinedIterator:
+        m_poSpatialIndexIterator ? m_poSpatialIndexIterator:
+        m_poAttributeIterator;
+    const bool bSequential = m_nFilteredFeatureCount < 0 && poIterator == nullptr;
+
+    const int iGeomArrowField = sHelper.nGeomFieldCount > 0 ?
+                                sHelper.mapOGRGeomFieldToArrowField[0] : -1;
+    if( m_iGeomFieldIdx >= 0 && iGeomArrowField < 0 &&
+        m_eSpatialIndexState == SPI_IN_BUILDING )
+    {
+        m_eSpatialIndexState = SPI_INVALID;
+    }
+
+    std::vector<GByte> abyWKB;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int errorErrno = EIO;
+    int iFeat = 0;
+    while( iFeat < sHelper.nMaxBatchSize )
+    {
+/* -------------------------------------------------------------------- */
+/*      Select the next row.                                            */
+/* -------------------------------------------------------------------- */
+        int iRow = -1;
+        if( m_nFilteredFeatureCount >= 0 )
+        {
+            if( m_iCurFeat >= m_nFilteredFeatureCount )
+                break;
+            iRow = (int)(GUIntptr_t)m_pahFilteredFeatures[m_iCurFeat++];
+        }
+        else if( poIterator != nullptr )
+        {
+            iRow = poIterator->GetNextRowSortedByFID();
+            if( iRow < 0 )
+                break;
+        }
+        else
+        {
+            if( m_iCurFeat == m_poLyrTable->GetTotalRecordCount() )
+                break;
+            m_iCurFeat = m_poLyrTable->GetAndSelectNextNonEmptyRow(m_iCurFeat);
+            if( m_iCurFeat < 0 )
+            {
+                m_bEOF = TRUE;
+                break;
+            }
+            iRow = m_iCurFeat;
+            m_iCurFeat ++;
+        }
+
+        if( !bSequential && !m_poLyrTable->SelectRow(iRow) )
+        {
+            if( m_poLyrTable->HasGotError() )
+            {
+                m_bEOF = TRUE;
+                break;
+            }
+            continue;
+        }
+
+/* -------------------------------------------------------------------- */
+/*      Read the geometry and apply the spatial filter.                 */
+/* -------------------------------------------------------------------- */
+        const OGRField* psGeomField = nullptr;
+        bool bMatchesFilter = true;
+        if( iGeomArrowField >= 0 )
+        {
+            psGeomField = m_poLyrTable->GetFieldValue(m_iGeomFieldIdx);
+            if( psGeomField != nullptr &&
+                m_eSpatialIndexState == SPI_IN_BUILDING )
+            {
+                OGREnvelope sFeatureEnvelope;
+                if( m_poLyrTable->GetFeatureExtent(psGeomField,
+                                                   &sFeatureEnvelope) )
+                {
+                    CPLRectObj sBounds;
+                    sBounds.minx = sFeatureEnvelope.MinX;
+                    sBounds.miny = sFeatureEnvelope.MinY;
+                    sBounds.maxx = sFeatureEnvelope.MaxX;
+                    sBounds.maxy = sFeatureEnvelope.MaxY;
+                    CPLQuadTreeInsertWithBounds(m_pQuadTree,
+                                                reinterpret_cast<void*>(static_cast<uintptr_t>(iRow)),
+                                                &sBounds);
+                }
+            }
+
+            if( m_poFilterGeom != nullptr )
+            {
+                bMatchesFilter = psGeomField != nullptr &&
+                    (m_eSpatialIndexState == SPI_COMPLETED ||
+                     m_poLyrTable->DoesGeometryIntersectsFilterEnvelope(psGeomField));
+            }
+        }
+
+        if( bSequential && m_eSpatialIndexState == SPI_IN_BUILDING &&
+            m_iCurFeat == m_poLyrTable->GetTotalRecordCount() )
+        {
+            CPLDebug("OpenFileGDB", "SPI_COMPLETED");
+            m_eSpatialIndexState = SPI_COMPLETED;
+        }
+
+        if( !bMatchesFilter )
+            continue;
+
+        // Without spatial filter, most shapes can be converted to WKB
+        // without building an OGRGeometry.
+        std::unique_ptr<OGRGeometry> poGeom;
+        abyWKB.clear();
+        if( psGeomField != nullptr &&
+            (m_poFilterGeom != nullptr ||
+             !m_poGeomConverter->GetAsISOWKB(psGeomField, abyWKB)) )
+        {
+            OGRGeometry* poGeomRaw = m_poGeomConverter->GetAsGeometry(psGeomField);
+            if( poGeomRaw )
+                poGeom.reset(PromoteToMulti(poGeomRaw));
+        }
+
+        if( m_poFilterGeom != nullptr && !FilterGeometry( poGeom.get() ) )
+            continue;
+
+        if( iGeomArrowField >= 0 )
+        {
+            if( poGeom )
+            {
+                const size_t nWKBSize = poGeom->WkbSize();
+                GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if( outPtr == nullptr )
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            }
+            else if( !abyWKB.empty() )
+            {
+                GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, abyWKB.size());
+                if( outPtr == nullptr )
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                memcpy(outPtr, abyWKB.data(), abyWKB.size());
+            }
+            else if( !sHelper.SetNull(iGeomArrowField, iFeat) )
+            {
+                errorErrno = ENOMEM;
+                goto error;
+            }
+        }
+
+        if( sHelper.panFIDValues )
+            sHelper.panFIDValues[iFeat] = iRow + 1;
+
+/* -------------------------------------------------------------------- */
+/*      Decode attributes.                                              */
+/* -------------------------------------------------------------------- */
+        int iOGRIdx = 0;
+        for( int iGDBIdx = 0; iGDBIdx < m_poLyrTable->GetFieldCount();
+             iGDBIdx++ )
+        {
+            if( iGDBIdx == m_iGeomFieldIdx ||
+                iGDBIdx == m_poLyrTable->GetObjectIdFieldIdx() )
+            {
+                continue;
+            }
+            const int iOGRField = iOGRIdx ++;
+            const int iArrowField = sHelper.mapOGRFieldToArrowField[iOGRField];
+            if( iArrowField < 0 )
+                continue;
+
+            const OGRField* psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            if( psField == nullptr )
+            {
+                if( !sHelper.SetNull(iArrowField, iFeat) )
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                continue;
+            }
+
+            auto psArray = out_array->children[iArrowField];
+            const OGRFieldDefn* poFieldDefn =
+                m_poFeatureDefn->GetFieldDefn(iOGRField);
+            switch( poFieldDefn->GetType() )
+            {
+                case OFTInteger:
+                {
+                    if( poFieldDefn->GetSubType() == OFSTBoolean )
+                    {
+                        if( psField->Integer )
+                            sHelper.SetBoolOn(psArray, iFeat);
+                    }
+                    else if( poFieldDefn->GetSubType() == OFSTInt16 )
+                    {
+                        sHelper.SetInt16(psArray, iFeat,
+                                         static_cast<int16_t>(psField->Integer));
+                    }
+                    else
+                    {
+                        sHelper.SetInt32(psArray, iFeat, psField->Integer);
+                    }
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    if( poFieldDefn->GetSubType() == OFSTFloat32 )
+                    {
+                        sHelper.SetFloat(psArray, iFeat,
+                                         static_cast<float>(psField->Real));
+                    }
+                    else
+                    {
+                        sHelper.SetDouble(psArray, iFeat, psField->Real);
+                    }
+                    break;
+                }
+
+                case OFTString:
+                {
+                    const char* pszVal = iGDBIdx == m_iFieldToReadAsBinary ?
+                        reinterpret_cast<const char*>(psField->Binary.paData) :
+                        psField->String;
+                    const size_t nLen = strlen(pszVal);
+                    GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if( outPtr == nullptr )
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    memcpy(outPtr, pszVal, nLen);
+                    break;
+                }
+
+                case OFTBinary:
+                {
+                    const size_t nLen = psField->Binary.nCount;
+                    GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if( outPtr == nullptr )
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    if( nLen )
+                        memcpy(outPtr, psField->Binary.paData, nLen);
+                    break;
+                }
+
+                case OFTDateTime:
+                {
+                    OGRField sField = *psField;
+                    sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
+                    sHelper.SetDateTime(psArray, iFeat, brokenDown, sField);
+                    break;
+                }
+
+                default:
+                {
+                    CPLAssert(false);
+                    if( !sHelper.SetNull(iArrowField, iFeat) )
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    break;
+                }
+            }
+        }
+
+        if( m_poLyrTable->HasDeletedFeaturesListed() )
+        {
+            const int iArrowField = sHelper.mapOGRFieldToArrowField[
+                m_poFeatureDefn->GetFieldCount() - 1];
+            if( iArrowField >= 0 )
+            {
+                sHelper.SetInt32(out_array->children[iArrowField], iFeat,
+                                 m_poLyrTable->IsCurRowDeleted());
+            }
+        }
+
+        iFeat++;
+    }
+
+    if( iFeat == 0 )
+    {
+        // End of stream
+        sHelper.ClearArray();
+        return 0;
+    }
+
+    sHelper.Shrink(iFeat);
+    return 0;
+
+error:
+    sHelper.ClearArray();
+    return errorErrno;
+}
+
 /***********************************************************************/
 /*                          GetFeature()                               */
 /***********************************************************************/
@@ -2117,6 +2492,10 @@ int OGROpenFileGDBLayer::TestCapability( const char * pszCap )
     {
         return TRUE;
     }
+    else if( EQUAL(pszCap,OLCFastGetArrowStream) )
+    {
+        return CanUseFastArrowStream();
+    }
     else if( EQUAL(pszCap,OLCIgnoreFields) )
     {
         return TRUE;
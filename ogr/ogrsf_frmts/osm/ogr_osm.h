@@ -35,6 +35,7 @@
 
 #include "ogrsf_frmts.h"
 #include "cpl_string.h"
+#include "cpl_virtualmem.h"
 
 #include <array>
 #include <set>
@@ -367,6 +368,12 @@ class OGROSMDataSource final: public OGRDataSource
     bool                m_bCustomIndexing = true;
     bool                m_bCompressNodes = false;
 
+    // Flat node store: memory-mapped sparse file indexed by node id
+    bool                m_bFlatNodes = false;
+    CPLVirtualMem      *m_psFlatNodesMem = nullptr;
+    LonLat             *m_pasFlatNodes = nullptr;
+    GIntBig             m_nFlatNodesCapacity = 0;
+
     unsigned int        m_nUnsortedReqIds = 0;
     GIntBig            *m_panUnsortedReqIds = nullptr;
 
@@ -441,6 +448,9 @@ class OGROSMDataSource final: public OGRDataSource
     bool                FlushCurrentSectorCompressedCase();
     bool                FlushCurrentSectorNonCompressedCase();
     bool                IndexPointCustom( OSMNode* psNode );
+    bool                IndexPointFlat( OSMNode* psNode );
+    bool                GrowFlatNodes( GIntBig nID );
+    void                ResetFlatNodes();
 
     void                IndexWay(GIntBig nWayID, bool bIsArea,
                                  unsigned int nTags, IndexedKVP* pasTags,
@@ -460,6 +470,7 @@ class OGROSMDataSource final: public OGRDataSource
     void                LookupNodesCustom();
     void                LookupNodesCustomCompressedCase();
     void                LookupNodesCustomNonCompressedCase();
+    void                LookupNodesFlat();
 
     unsigned int        LookupWays( std::map< GIntBig, std::pair<int,void*> >& aoMapWays,
                                     OSMRelation* psRelation );
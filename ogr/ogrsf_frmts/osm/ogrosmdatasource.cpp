@@ -315,6 +315,8 @@ OGROSMDataSource::~OGROSMDataSource()
         }
     }
 
+    if( m_psFlatNodesMem )
+        CPLVirtualMemFree(m_psFlatNodesMem);
     if( m_fpNodes )
         VSIFCloseL(m_fpNodes);
     if( !m_osNodesFilename.empty() && m_bMustUnlinkNodesFile )
@@ -426,6 +428,9 @@ bool OGROSMDataSource::IndexPoint( OSMNode* psNode )
     if( !m_bIndexPoints )
         return true;
 
+    if( m_bFlatNodes )
+        return IndexPointFlat(psNode);
+
     if( m_bCustomIndexing)
         return IndexPointCustom(psNode);
 
@@ -730,6 +735,99 @@ bool OGROSMDataSource::IndexPointCustom(OSMNode* psNode)
     return true;
 }
 
+/************************************************************************/
+/*                           GrowFlatNodes()                            */
+/************************************************************************/
+
+// Node ids are used directly as indices in the flat node file, so its
+// maximum size is bounded by the maximum node id. The file is sparse, and
+// grown by remapping it with a larger size.
+constexpr GIntBig MAX_ID_FOR_FLAT_NODES =
+    (static_cast<GIntBig>(1) << 44) / static_cast<GIntBig>(sizeof(LonLat));
+
+bool OGROSMDataSource::GrowFlatNodes(GIntBig nID)
+{
+    // Grow by at least 64 M nodes (512 MB), and at least double the size.
+    constexpr GIntBig MIN_INCREMENT = static_cast<GIntBig>(64) * 1024 * 1024;
+    GIntBig nNewCapacity = std::max(nID + 1, 2 * m_nFlatNodesCapacity);
+    nNewCapacity = ((nNewCapacity + MIN_INCREMENT - 1) / MIN_INCREMENT) * MIN_INCREMENT;
+    nNewCapacity = std::min(nNewCapacity, MAX_ID_FOR_FLAT_NODES);
+
+    if( m_psFlatNodesMem )
+    {
+        CPLVirtualMemFree(m_psFlatNodesMem);
+        m_psFlatNodesMem = nullptr;
+        m_pasFlatNodes = nullptr;
+    }
+
+    m_psFlatNodesMem = CPLVirtualMemFileMapNew(
+        m_fpNodes, 0,
+        static_cast<vsi_l_offset>(nNewCapacity) * sizeof(LonLat),
+        VIRTUALMEM_READWRITE, nullptr, nullptr);
+    if( m_psFlatNodesMem == nullptr )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot map flat node file %s with a size of " CPL_FRMT_GIB
+                 " bytes. Use OSM_USE_FLAT_NODES=NO",
+                 m_osNodesFilename.c_str(),
+                 nNewCapacity * static_cast<GIntBig>(sizeof(LonLat)));
+        m_nFlatNodesCapacity = 0;
+        return false;
+    }
+    m_pasFlatNodes = static_cast<LonLat*>(CPLVirtualMemGetAddr(m_psFlatNodesMem));
+    m_nFlatNodesCapacity = nNewCapacity;
+    CPLDebug("OSM", "Flat node file mapped for " CPL_FRMT_GIB " nodes",
+             m_nFlatNodesCapacity);
+    return true;
+}
+
+/************************************************************************/
+/*                            ResetFlatNodes()                          */
+/************************************************************************/
+
+void OGROSMDataSource::ResetFlatNodes()
+{
+    if( m_psFlatNodesMem )
+    {
+        CPLVirtualMemFree(m_psFlatNodesMem);
+        m_psFlatNodesMem = nullptr;
+        m_pasFlatNodes = nullptr;
+    }
+    m_nFlatNodesCapacity = 0;
+    VSIFTruncateL(m_fpNodes, 0);
+    m_nNodesFileSize = 0;
+}
+
+/************************************************************************/
+/*                           IndexPointFlat()                           */
+/************************************************************************/
+
+bool OGROSMDataSource::IndexPointFlat(OSMNode* psNode)
+{
+    if( psNode->nID < 0 || psNode->nID >= MAX_ID_FOR_FLAT_NODES )
+    {
+        CPLError( CE_Failure, CPLE_AppDefined,
+                  "Unsupported node id value (" CPL_FRMT_GIB
+                  "). Use OSM_USE_FLAT_NODES=NO",
+                  psNode->nID);
+        m_bStopParsing = true;
+        return false;
+    }
+    if( psNode->nID >= m_nFlatNodesCapacity && !GrowFlatNodes(psNode->nID) )
+    {
+        m_bStopParsing = true;
+        return false;
+    }
+
+    // Like in the custom indexing, (0,0) means a missing node, which is
+    // what the holes of the sparse file read as.
+    LonLat* psLonLat = &m_pasFlatNodes[psNode->nID];
+    psLonLat->nLon = DBL_TO_INT(psNode->dfLon);
+    psLonLat->nLat = DBL_TO_INT(psNode->dfLat);
+
+    return true;
+}
+
 /************************************************************************/
 /*                             NotifyNodes()                            */
 /************************************************************************/
@@ -814,7 +912,9 @@ static void OGROSMNotifyNodes ( unsigned int nNodes,
 
 void OGROSMDataSource::LookupNodes( )
 {
-    if( m_bCustomIndexing )
+    if( m_bFlatNodes )
+        LookupNodesFlat();
+    else if( m_bCustomIndexing )
         LookupNodesCustom();
     else
         LookupNodesSQLite();
@@ -999,6 +1099,43 @@ static bool DecompressSector( const GByte* pabyIn, int nSectorSize,
     return nRead == nSectorSize;
 }
 
+/************************************************************************/
+/*                           LookupNodesFlat()                          */
+/************************************************************************/
+
+void OGROSMDataSource::LookupNodesFlat()
+{
+    CPLAssert(
+        m_nUnsortedReqIds <= static_cast<unsigned int>(MAX_ACCUMULATED_NODES));
+
+    m_nReqIds = 0;
+    for( unsigned int i = 0; i < m_nUnsortedReqIds; i++ )
+    {
+        const GIntBig id = m_panUnsortedReqIds[i];
+        if( id >= 0 && id < m_nFlatNodesCapacity )
+            m_panReqIds[m_nReqIds++] = id;
+    }
+
+    std::sort(m_panReqIds, m_panReqIds + m_nReqIds);
+
+    /* Remove duplicates and missing nodes */
+    unsigned int j = 0;
+    for( unsigned int i = 0; i < m_nReqIds; i++)
+    {
+        const GIntBig id = m_panReqIds[i];
+        if( i > 0 && id == m_panReqIds[i-1] )
+            continue;
+        const LonLat& sLonLat = m_pasFlatNodes[id];
+        if( sLonLat.nLon || sLonLat.nLat )
+        {
+            m_panReqIds[j] = id;
+            m_pasLonLatArray[j] = sLonLat;
+            j++;
+        }
+    }
+    m_nReqIds = j;
+}
+
 /************************************************************************/
 /*                           LookupNodesCustom()                        */
 /************************************************************************/
@@ -2793,6 +2930,21 @@ int OGROSMDataSource::Open( const char * pszFilename,
                         CPLGetConfigOption("OSM_COMPRESS_NODES", "NO")));
     if( m_bCompressNodes )
         CPLDebug("OSM", "Using compression for nodes DB");
+    m_bFlatNodes = CPLTestBool(CSLFetchNameValueDef(
+            papszOpenOptionsIn, "USE_FLAT_NODES",
+                        CPLGetConfigOption("OSM_USE_FLAT_NODES", "NO")));
+    if( m_bFlatNodes && !CPLIsVirtualMemFileMapAvailable() )
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "USE_FLAT_NODES=YES not supported on this platform. "
+                 "Using custom indexing instead");
+        m_bFlatNodes = false;
+    }
+    if( m_bFlatNodes )
+    {
+        CPLDebug("OSM", "Using memory-mapped flat file for nodes");
+        m_bCustomIndexing = false;
+    }
 
     m_nLayers = 5;
     m_papoLayers = static_cast<OGROSMLayer **>(
@@ -2878,6 +3030,29 @@ int OGROSMDataSource::Open( const char * pszFilename,
         nSize = static_cast<GIntBig>(m_nMaxSizeForInMemoryDBInMB) * 1024 * 1024;
     }
 
+    if( m_bFlatNodes )
+    {
+        // The flat node file must be a real file to be memory-mapped.
+        m_osNodesFilename = CPLGenerateTempFilename("osm_tmp_flat_nodes");
+        m_fpNodes = VSIFOpenL(m_osNodesFilename, "wb+");
+        if( m_fpNodes == nullptr )
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     m_osNodesFilename.c_str());
+            return FALSE;
+        }
+
+        /* On Unix filesystems, you can remove a file even if it */
+        /* opened */
+        const char* pszVal = CPLGetConfigOption("OSM_UNLINK_TMPFILE", "YES");
+        if( EQUAL(pszVal, "YES") )
+        {
+            CPLPushErrorHandler(CPLQuietErrorHandler);
+            m_bMustUnlinkNodesFile = VSIUnlink( m_osNodesFilename ) != 0;
+            CPLPopErrorHandler();
+        }
+    }
+
     if( m_bCustomIndexing )
     {
         m_pabySector = static_cast<GByte *>(VSI_CALLOC_VERBOSE(1, SECTOR_SIZE));
@@ -3757,7 +3932,7 @@ int OGROSMDataSource::MyResetReading()
 {
     if( m_hDB == nullptr )
         return FALSE;
-    if( m_bCustomIndexing && m_fpNodes == nullptr )
+    if( (m_bCustomIndexing || m_bFlatNodes) && m_fpNodes == nullptr )
         return FALSE;
 
     OSM_ResetReading(m_psParser);
@@ -3822,6 +3997,11 @@ int OGROSMDataSource::MyResetReading()
         m_aoMapIndexedKeys.clear();
     }
 
+    if( m_bFlatNodes )
+    {
+        ResetFlatNodes();
+    }
+
     if( m_bCustomIndexing )
     {
         m_nPrevNodeId = -1;
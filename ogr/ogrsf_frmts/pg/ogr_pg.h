@@ -110,6 +110,57 @@ typedef struct
     int   bNullable;
 } PGGeomColumnDesc;
 
+/************************************************************************/
+/*                        OGRPGBinaryCopyReader                         */
+/************************************************************************/
+
+/** Reads the output of a "COPY ... TO STDOUT (FORMAT binary)" request and
+ * splits it into tuples. Field values are exposed in the PostgreSQL binary
+ * (network byte order) representation, and remain valid until the next call
+ * to ReadTuple().
+ */
+class OGRPGBinaryCopyReader
+{
+    OGRPGBinaryCopyReader( const OGRPGBinaryCopyReader&) = delete;
+    OGRPGBinaryCopyReader& operator=( const OGRPGBinaryCopyReader&) = delete;
+
+    PGconn             *m_hPGConn = nullptr;
+    bool                m_bActive = false;
+    bool                m_bCopyDone = false;
+    bool                m_bSavePoint = false;
+    bool                m_bHeaderRead = false;
+
+    std::vector<GByte>  m_abyBuffer{};
+    size_t              m_nBufferOffset = 0;
+
+    std::vector<size_t> m_anFieldOffsets{};
+    std::vector<int>    m_anFieldLengths{};
+
+    bool                FillBuffer( size_t nSize );
+    bool                Finish( bool bReportErrors );
+    void                EndSavePoint();
+    int                 Fail( const char *pszMessage );
+
+  public:
+                        OGRPGBinaryCopyReader() = default;
+                        ~OGRPGBinaryCopyReader();
+
+    bool                Start( PGconn *hPGConn, const char *pszStatement );
+    int                 ReadTuple( int nExpectedFieldCount );
+    void                Abort();
+
+    bool                IsActive() const { return m_bActive; }
+
+    int                 GetFieldCount() const
+                            { return static_cast<int>(m_anFieldLengths.size()); }
+    bool                IsNull( int iField ) const
+                            { return m_anFieldLengths[iField] < 0; }
+    int                 GetLength( int iField ) const
+                            { return m_anFieldLengths[iField]; }
+    const GByte        *GetData( int iField ) const
+                            { return m_abyBuffer.data() + m_anFieldOffsets[iField]; }
+};
+
 /************************************************************************/
 /*                         OGRPGGeomFieldDefn                           */
 /************************************************************************/
@@ -332,6 +383,24 @@ class OGRPGTableLayer final: public OGRPGLayer
 
     std::string         m_osLCOGeomType{};
 
+    /* Column of the binary COPY output. A column may be both the FID and */
+    /* a regular field. */
+    struct BinaryCopyColumn
+    {
+        bool            bFID = false;
+        int             iField = -1;
+        int             iGeomField = -1;
+    };
+
+    OGRPGBinaryCopyReader m_oBinaryCopyReader{};
+    std::vector<BinaryCopyColumn> m_asBinaryCopyColumns{};
+    bool                m_bBinaryCopyInterrupted = false;
+
+    bool                CanUseBinaryCopy( bool bForArrow );
+    bool                StartBinaryCopy();
+    OGRFeature         *GetNextBinaryCopyFeature();
+    OGRFeature         *BinaryCopyTupleToFeature();
+
     virtual CPLString   GetFromClauseForGetExtent() override { return pszSqlTableName; }
 
     OGRErr              RunAddGeometryColumn( const OGRPGGeomFieldDefn *poGeomField );
@@ -381,6 +450,9 @@ public:
     virtual OGRErr      GetExtent( OGREnvelope *psExtent, int bForce ) override { return GetExtent(0, psExtent, bForce); }
     virtual OGRErr      GetExtent( int iGeomField, OGREnvelope *psExtent, int bForce ) override;
 
+    virtual int         GetNextArrowArray( struct ArrowArrayStream*,
+                                           struct ArrowArray* out_array ) override;
+
     const char*         GetTableName() { return pszTableName; }
     const char*         GetSchemaName() { return pszSchemaName; }
 
@@ -408,6 +480,8 @@ public:
     OGRErr              StartCopy();
     OGRErr              EndCopy();
 
+    void                AbortBinaryCopy();
+
     int                 ReadTableDefinition();
     int                 HasGeometryInformation() { return bGeometryInformationSet; }
     void                SetTableDefinition(const char* pszFIDColumnName,
@@ -520,6 +594,7 @@ class OGRPGDataSource final: public OGRDataSource
     OGRSpatialReference **papoSRS = nullptr;
 
     OGRPGTableLayer     *poLayerInCopyMode = nullptr;
+    OGRPGTableLayer     *m_poLayerInBinaryCopyRead = nullptr;
 
     static void                OGRPGDecodeVersionString(PGver* psVersion, const char* pszVer);
 
@@ -613,6 +688,10 @@ class OGRPGDataSource final: public OGRDataSource
     int                 UseCopy();
     void                StartCopy( OGRPGTableLayer *poPGLayer );
     OGRErr              EndCopy( );
+
+    void                StartBinaryCopyRead( OGRPGTableLayer *poPGLayer );
+    void                EndBinaryCopyRead( OGRPGTableLayer *poPGLayer );
+    void                AbortBinaryCopyRead();
 };
 
 #endif /* ndef OGR_PG_H_INCLUDED */
@@ -0,0 +1,1370 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Reading of PostgreSQL tables with COPY ... TO STDOUT (FORMAT binary)
+ *
+ ******************************************************************************
+ * Copyright (c) 2023, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogr_pg.h"
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "cpl_time.h"
+#include "ogr_p.h"
+#include "ograrrowarrayhelper.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define PQexec this_is_an_error
+
+/* Signature of the header of the binary COPY format */
+static const char achPGCopySignature[] = { 'P', 'G', 'C', 'O', 'P', 'Y', '\n',
+                                           '\377', '\r', '\n', '\0' };
+
+/* Number of days between 1970-01-01 and 2000-01-01, the PostgreSQL epoch */
+constexpr int POSTGRES_EPOCH_UNIX_DAYS = 10957;
+
+/************************************************************************/
+/*                         Big endian readers                           */
+/************************************************************************/
+
+static inline GInt16 OGRPGReadInt16( const GByte *pabyData )
+{
+    GInt16 nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_MSBPTR16(&nVal);
+    return nVal;
+}
+
+static inline GInt32 OGRPGReadInt32( const GByte *pabyData )
+{
+    GInt32 nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_MSBPTR32(&nVal);
+    return nVal;
+}
+
+static inline GInt64 OGRPGReadInt64( const GByte *pabyData )
+{
+    GInt64 nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_MSBPTR64(&nVal);
+    return nVal;
+}
+
+/************************************************************************/
+/*                       OGRPGGetBinaryInteger()                        */
+/*                                                                      */
+/*      Decodes a bool, int2, int4 or int8 value.                       */
+/************************************************************************/
+
+static bool OGRPGGetBinaryInteger( const GByte *pabyData, int nLen,
+                                   GIntBig &nVal )
+{
+    switch( nLen )
+    {
+        case 1: nVal = pabyData[0]; return true;
+        case 2: nVal = OGRPGReadInt16(pabyData); return true;
+        case 4: nVal = OGRPGReadInt32(pabyData); return true;
+        case 8: nVal = OGRPGReadInt64(pabyData); return true;
+        default: break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                        OGRPGFloat4ToDouble()                         */
+/*                                                                      */
+/*      Returns the value that would be obtained by parsing the text    */
+/*      representation of a float4, that is 1.1 rather than             */
+/*      1.100000023841858, so that GetNextFeature() returns the same    */
+/*      values with and without binary COPY. This formats the value,    */
+/*      so it is not used by the Arrow path, that stores float4 values  */
+/*      as they are.                                                    */
+/************************************************************************/
+
+static double OGRPGFloat4ToDouble( float fVal )
+{
+    if( !std::isfinite(fVal) )
+        return fVal;
+    char szBuffer[32] = {};
+    for( int nPrecision = 6; nPrecision <= 9; nPrecision++ )
+    {
+        CPLsnprintf(szBuffer, sizeof(szBuffer), "%.*g", nPrecision, fVal);
+        if( static_cast<float>(CPLAtof(szBuffer)) == fVal )
+            break;
+    }
+    return CPLAtof(szBuffer);
+}
+
+/************************************************************************/
+/*                         OGRPGGetBinaryReal()                         */
+/*                                                                      */
+/*      Decodes a float4 or float8 value.                               */
+/************************************************************************/
+
+static bool OGRPGGetBinaryReal( const GByte *pabyData, int nLen, double &dfVal,
+                                bool bFloat4AsText = false )
+{
+    if( nLen == 4 )
+    {
+        float fVal;
+        memcpy(&fVal, pabyData, sizeof(fVal));
+        CPL_MSBPTR32(&fVal);
+        dfVal = bFloat4AsText ? OGRPGFloat4ToDouble(fVal)
+                              : static_cast<double>(fVal);
+        return true;
+    }
+    if( nLen == 8 )
+    {
+        memcpy(&dfVal, pabyData, sizeof(dfVal));
+        CPL_MSBPTR64(&dfVal);
+        return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                         OGRPGGetBinaryDate()                         */
+/*                                                                      */
+/*      Decodes a date value as a number of days since 1970-01-01.      */
+/*      Returns false for -infinity and infinity.                       */
+/************************************************************************/
+
+static bool OGRPGGetBinaryDate( const GByte *pabyData, int nLen, int &nDays )
+{
+    if( nLen != 4 )
+        return false;
+    const GInt32 nPGDays = OGRPGReadInt32(pabyData);
+    if( nPGDays == INT_MIN || nPGDays == INT_MAX ||
+        nPGDays > INT_MAX - POSTGRES_EPOCH_UNIX_DAYS )
+        return false;
+    nDays = nPGDays + POSTGRES_EPOCH_UNIX_DAYS;
+    return true;
+}
+
+/************************************************************************/
+/*                        OGRPGParseBinaryArray()                       */
+/*                                                                      */
+/*      Returns the elements of an array in binary representation,      */
+/*      flattening multi-dimensional arrays. NULL elements have a       */
+/*      negative length.                                                */
+/************************************************************************/
+
+static bool OGRPGParseBinaryArray(
+                        const GByte *pabyData, int nLen,
+                        std::vector<std::pair<const GByte*, int>> &aoElements )
+{
+    aoElements.clear();
+
+    // ndim, has_null flag and element type OID, followed by the size and
+    // lower bound of each dimension.
+    if( nLen < 12 )
+        return false;
+    const int nDims = OGRPGReadInt32(pabyData);
+    if( nDims < 0 || nDims > 6 || nLen < 12 + 8 * nDims )
+        return false;
+
+    GIntBig nCount = nDims == 0 ? 0 : 1;
+    for( int iDim = 0; iDim < nDims; iDim++ )
+    {
+        const int nDimSize = OGRPGReadInt32(pabyData + 12 + 8 * iDim);
+        if( nDimSize < 0 )
+            return false;
+        nCount *= nDimSize;
+        // Each element takes at least 4 bytes for its length
+        if( nCount > nLen / 4 )
+            return false;
+    }
+
+    const GByte *pabyIter = pabyData + 12 + 8 * nDims;
+    const GByte *pabyEnd = pabyData + nLen;
+    for( GIntBig i = 0; i < nCount; i++ )
+    {
+        if( pabyEnd - pabyIter < 4 )
+            return false;
+        const int nEltLen = OGRPGReadInt32(pabyIter);
+        pabyIter += 4;
+        if( nEltLen < 0 )
+        {
+            aoElements.emplace_back(nullptr, -1);
+            continue;
+        }
+        if( pabyEnd - pabyIter < nEltLen )
+            return false;
+        aoElements.emplace_back(pabyIter, nEltLen);
+        pabyIter += nEltLen;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRPGGetBinaryCopyCast()                       */
+/*                                                                      */
+/*      Returns the type to which a column must be cast so that its     */
+/*      binary representation can be decoded into the OGR type, or      */
+/*      nullptr if it can be used as it is.                             */
+/************************************************************************/
+
+static const char *OGRPGGetBinaryCopyCast( OGRFieldType eType, Oid nTypeOID )
+{
+    switch( eType )
+    {
+        case OFTInteger:
+            return (nTypeOID == BOOLOID || nTypeOID == INT2OID ||
+                    nTypeOID == INT4OID) ? nullptr : "int4";
+
+        case OFTInteger64:
+            return (nTypeOID == INT2OID || nTypeOID == INT4OID ||
+                    nTypeOID == INT8OID) ? nullptr : "int8";
+
+        case OFTReal:
+            return (nTypeOID == FLOAT4OID ||
+                    nTypeOID == FLOAT8OID) ? nullptr : "float8";
+
+        case OFTString:
+            // The binary representation of those types is their text
+            return (nTypeOID == TEXTOID || nTypeOID == VARCHAROID ||
+                    nTypeOID == BPCHAROID || nTypeOID == NAMEOID ||
+                    nTypeOID == JSONOID) ? nullptr : "text";
+
+        case OFTBinary:
+            return nTypeOID == BYTEAOID ? nullptr : "bytea";
+
+        case OFTDate:
+            return nTypeOID == DATEOID ? nullptr : "date";
+
+        case OFTIntegerList:
+            return (nTypeOID == BOOLARRAYOID || nTypeOID == INT2ARRAYOID ||
+                    nTypeOID == INT4ARRAYOID) ? nullptr : "int4[]";
+
+        case OFTInteger64List:
+            return (nTypeOID == BOOLARRAYOID || nTypeOID == INT2ARRAYOID ||
+                    nTypeOID == INT4ARRAYOID ||
+                    nTypeOID == INT8ARRAYOID) ? nullptr : "int8[]";
+
+        case OFTRealList:
+            return (nTypeOID == FLOAT4ARRAYOID ||
+                    nTypeOID == FLOAT8ARRAYOID) ? nullptr : "float8[]";
+
+        case OFTStringList:
+            return (nTypeOID == TEXTARRAYOID || nTypeOID == VARCHARARRAYOID ||
+                    nTypeOID == BPCHARARRAYOID) ? nullptr : "text[]";
+
+        default:
+            // OFTTime and OFTDateTime are parsed from their text
+            // representation, which is the only one carrying the time zone
+            break;
+    }
+    return nTypeOID == TEXTOID ? nullptr : "text";
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                        OGRPGBinaryCopyReader                         */
+/* ==================================================================== */
+/************************************************************************/
+
+OGRPGBinaryCopyReader::~OGRPGBinaryCopyReader()
+{
+    Abort();
+}
+
+/************************************************************************/
+/*                               Start()                                */
+/************************************************************************/
+
+bool OGRPGBinaryCopyReader::Start( PGconn *hPGConn, const char *pszStatement )
+{
+    Abort();
+
+    m_hPGConn = hPGConn;
+    m_bCopyDone = false;
+    m_bHeaderRead = false;
+    m_abyBuffer.clear();
+    m_nBufferOffset = 0;
+    m_anFieldOffsets.clear();
+    m_anFieldLengths.clear();
+
+    // Cancelling the COPY aborts the current transaction, so run it in a
+    // savepoint that can be rolled back to.
+    m_bSavePoint = false;
+    if( PQtransactionStatus(hPGConn) == PQTRANS_INTRANS )
+    {
+        PGresult *hResult =
+            OGRPG_PQexec(hPGConn, "SAVEPOINT ogr_binary_copy_savepoint");
+        const bool bOK =
+            hResult && PQresultStatus(hResult) == PGRES_COMMAND_OK;
+        OGRPGClearResult( hResult );
+        if( !bOK )
+            return false;
+        m_bSavePoint = true;
+    }
+
+    PGresult *hResult = OGRPG_PQexec(hPGConn, pszStatement);
+    if( !hResult || PQresultStatus(hResult) != PGRES_COPY_OUT )
+    {
+        if( hResult && PQresultStatus(hResult) != PGRES_FATAL_ERROR )
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "%s did not start a COPY", pszStatement);
+        }
+        OGRPGClearResult( hResult );
+        EndSavePoint();
+        return false;
+    }
+    OGRPGClearResult( hResult );
+
+    m_bActive = true;
+    return true;
+}
+
+/************************************************************************/
+/*                             FillBuffer()                             */
+/*                                                                      */
+/*      Fetches COPY data until at least nSize bytes are buffered.      */
+/************************************************************************/
+
+bool OGRPGBinaryCopyReader::FillBuffer( size_t nSize )
+{
+    while( m_abyBuffer.size() < nSize )
+    {
+        if( m_bCopyDone )
+            return false;
+
+        char *pabyData = nullptr;
+        const int nRet = PQgetCopyData(m_hPGConn, &pabyData, 0);
+        if( nRet < 0 )
+        {
+            m_bCopyDone = true;
+            return false;
+        }
+        try
+        {
+            m_abyBuffer.insert(m_abyBuffer.end(),
+                               reinterpret_cast<GByte*>(pabyData),
+                               reinterpret_cast<GByte*>(pabyData) + nRet);
+        }
+        catch( const std::exception& e )
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+            PQfreemem(pabyData);
+            return false;
+        }
+        PQfreemem(pabyData);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             ReadTuple()                              */
+/*                                                                      */
+/*      Returns 1 if a tuple has been read, 0 at the end of the COPY    */
+/*      and -1 in case of error. The COPY is over when 1 is not         */
+/*      returned.                                                       */
+/************************************************************************/
+
+int OGRPGBinaryCopyReader::ReadTuple( int nExpectedFieldCount )
+{
+    m_anFieldOffsets.clear();
+    m_anFieldLengths.clear();
+
+    if( !m_bActive )
+        return 0;
+
+    // Discard the previous tuple. In practice, the server sends one tuple
+    // per CopyData message, so this is generally a no-op.
+    if( m_nBufferOffset > 0 )
+    {
+        m_abyBuffer.erase(m_abyBuffer.begin(),
+                          m_abyBuffer.begin() + m_nBufferOffset);
+        m_nBufferOffset = 0;
+    }
+
+    if( !m_bHeaderRead )
+    {
+        constexpr size_t HEADER_SIZE = sizeof(achPGCopySignature) + 4 + 4;
+        if( !FillBuffer(HEADER_SIZE) ||
+            memcmp(m_abyBuffer.data(), achPGCopySignature,
+                   sizeof(achPGCopySignature)) != 0 )
+        {
+            return Fail("Invalid binary COPY header");
+        }
+        const int nExtensionLength =
+            OGRPGReadInt32(m_abyBuffer.data() + sizeof(achPGCopySignature) + 4);
+        if( nExtensionLength < 0 ||
+            !FillBuffer(HEADER_SIZE + nExtensionLength) )
+        {
+            return Fail("Invalid binary COPY header");
+        }
+        m_nBufferOffset = HEADER_SIZE + nExtensionLength;
+        m_bHeaderRead = true;
+    }
+
+    size_t nOffset = m_nBufferOffset;
+    if( !FillBuffer(nOffset + 2) )
+        return Fail("Truncated binary COPY data");
+    const int nFieldCount = OGRPGReadInt16(m_abyBuffer.data() + nOffset);
+    nOffset += 2;
+
+    if( nFieldCount == -1 )
+    {
+        // Trailer. Consume the end of the COPY.
+        m_nBufferOffset = nOffset;
+        char *pabyData = nullptr;
+        while( PQgetCopyData(m_hPGConn, &pabyData, 0) > 0 )
+        {
+            PQfreemem(pabyData);
+            pabyData = nullptr;
+        }
+        m_bCopyDone = true;
+        return Finish(true) ? 0 : -1;
+    }
+
+    if( nFieldCount != nExpectedFieldCount )
+    {
+        return Fail(CPLSPrintf("Binary COPY tuple has %d fields, "
+                               "whereas %d were expected",
+                               nFieldCount, nExpectedFieldCount));
+    }
+
+    for( int iField = 0; iField < nFieldCount; iField++ )
+    {
+        if( !FillBuffer(nOffset + 4) )
+            return Fail("Truncated binary COPY data");
+        const int nLength = OGRPGReadInt32(m_abyBuffer.data() + nOffset);
+        nOffset += 4;
+        if( nLength < -1 )
+            return Fail("Invalid field length in binary COPY data");
+        m_anFieldOffsets.push_back(nOffset);
+        m_anFieldLengths.push_back(nLength);
+        if( nLength > 0 )
+        {
+            if( !FillBuffer(nOffset + nLength) )
+                return Fail("Truncated binary COPY data");
+            nOffset += nLength;
+        }
+    }
+    m_nBufferOffset = nOffset;
+
+    return 1;
+}
+
+/************************************************************************/
+/*                                Fail()                                */
+/************************************************************************/
+
+int OGRPGBinaryCopyReader::Fail( const char *pszMessage )
+{
+    // If the server ended the COPY, its error message is more relevant
+    if( m_bCopyDone )
+    {
+        if( Finish(true) )
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", pszMessage);
+    }
+    else
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s", pszMessage);
+        Finish(false);
+    }
+    m_anFieldOffsets.clear();
+    m_anFieldLengths.clear();
+    return -1;
+}
+
+/************************************************************************/
+/*                               Abort()                                */
+/************************************************************************/
+
+void OGRPGBinaryCopyReader::Abort()
+{
+    Finish(false);
+}
+
+/************************************************************************/
+/*                               Finish()                               */
+/*                                                                      */
+/*      Terminates the COPY, so that the connection can be used for     */
+/*      other requests. Returns false if the server reported an error.  */
+/************************************************************************/
+
+bool OGRPGBinaryCopyReader::Finish( bool bReportErrors )
+{
+    if( !m_bActive )
+        return true;
+
+    bool bCanceled = false;
+    if( !m_bCopyDone )
+    {
+        // Ask the server to stop sending data, and discard what is already
+        // in flight.
+        auto hCancel = PQgetCancel(m_hPGConn);
+        if( hCancel )
+        {
+            char szErrBuf[255];
+            if( PQcancel(hCancel, szErrBuf, sizeof(szErrBuf)) )
+                bCanceled = true;
+            else
+                CPLDebug("PG", "Error canceling the COPY: %s", szErrBuf);
+            PQfreeCancel(hCancel);
+        }
+
+        char *pabyData = nullptr;
+        while( PQgetCopyData(m_hPGConn, &pabyData, 0) > 0 )
+        {
+            PQfreemem(pabyData);
+            pabyData = nullptr;
+        }
+        m_bCopyDone = true;
+    }
+
+    bool bRet = true;
+    PGresult *hResult = nullptr;
+    while( (hResult = PQgetResult(m_hPGConn)) != nullptr )
+    {
+        if( PQresultStatus(hResult) != PGRES_COMMAND_OK )
+        {
+            bRet = false;
+            if( bReportErrors && !bCanceled )
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         PQresultErrorMessage(hResult));
+            }
+        }
+        PQclear(hResult);
+    }
+
+    m_bActive = false;
+    m_abyBuffer.clear();
+    m_nBufferOffset = 0;
+
+    EndSavePoint();
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                            EndSavePoint()                            */
+/*                                                                      */
+/*      Releases the savepoint set by Start(), after having rolled      */
+/*      back to it if the COPY was canceled.                            */
+/************************************************************************/
+
+void OGRPGBinaryCopyReader::EndSavePoint()
+{
+    if( !m_bSavePoint )
+        return;
+    m_bSavePoint = false;
+
+    PGresult *hResult = nullptr;
+    if( PQtransactionStatus(m_hPGConn) == PQTRANS_INERROR )
+    {
+        hResult = OGRPG_PQexec(
+            m_hPGConn, "ROLLBACK TO SAVEPOINT ogr_binary_copy_savepoint");
+        OGRPGClearResult( hResult );
+    }
+    hResult = OGRPG_PQexec(
+        m_hPGConn, "RELEASE SAVEPOINT ogr_binary_copy_savepoint");
+    OGRPGClearResult( hResult );
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                    OGRPGTableLayer binary COPY read                  */
+/* ==================================================================== */
+/************************************************************************/
+
+/************************************************************************/
+/*                          CanUseBinaryCopy()                          */
+/************************************************************************/
+
+bool OGRPGTableLayer::CanUseBinaryCopy( bool bForArrow )
+{
+    poFeatureDefn->GetFieldCount();
+
+    // COPY (SELECT ...) TO STDOUT (FORMAT binary) requires PostgreSQL 9.0
+    if( poDS->bUseBinaryCursor || bWkbAsOid ||
+        poDS->sPostgreSQLVersion.nMajor < 9 )
+    {
+        return false;
+    }
+
+    for( int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++ )
+    {
+        const OGRPGGeomFieldDefn* poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        if( (poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOMETRY ||
+             poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOGRAPHY) &&
+            poDS->sPostGISVersion.nMajor < 2 )
+        {
+            return false;
+        }
+        // Spatial filtering on a WKB column requires OGRGeometry objects
+        if( bForArrow && poGeomFieldDefn->ePostgisType == GEOM_TYPE_WKB &&
+            m_poFilterGeom != nullptr && i == m_iGeomFieldFilter )
+        {
+            return false;
+        }
+    }
+
+    if( bForArrow )
+    {
+        for( int i = 0; i < poFeatureDefn->GetFieldCount(); i++ )
+        {
+            const OGRFieldDefn* poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+            if( poFieldDefn->IsIgnored() )
+                continue;
+            switch( poFieldDefn->GetType() )
+            {
+                case OFTInteger:
+                case OFTInteger64:
+                case OFTReal:
+                case OFTString:
+                case OFTBinary:
+                case OFTDate:
+                case OFTTime:
+                case OFTDateTime:
+                    break;
+                default:
+                    // Lists are not handled by OGRArrowArrayHelper
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                          StartBinaryCopy()                           */
+/************************************************************************/
+
+bool OGRPGTableLayer::StartBinaryCopy()
+{
+    PGconn *hPGConn = poDS->GetPGConn();
+
+    poDS->AbortBinaryCopyRead();
+
+    // The connection cannot be used to fetch SRS once the COPY is started
+    for( int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++ )
+        poFeatureDefn->GetGeomFieldDefn(i)->GetSpatialRef();
+
+/* -------------------------------------------------------------------- */
+/*      Build the list of columns to fetch.                             */
+/* -------------------------------------------------------------------- */
+    m_asBinaryCopyColumns.clear();
+    std::vector<CPLString> aosColumns;
+
+    if( pszFIDColumn != nullptr &&
+        poFeatureDefn->GetFieldIndex(pszFIDColumn) == -1 )
+    {
+        BinaryCopyColumn sColumn;
+        sColumn.bFID = true;
+        m_asBinaryCopyColumns.push_back(sColumn);
+        aosColumns.push_back(OGRPGEscapeColumnName(pszFIDColumn));
+    }
+
+    for( int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++ )
+    {
+        const OGRPGGeomFieldDefn* poGeomFieldDefn =
+            poFeatureDefn->GetGeomFieldDefn(i);
+        if( poGeomFieldDefn->IsIgnored() )
+            continue;
+
+        BinaryCopyColumn sColumn;
+        sColumn.iGeomField = i;
+        m_asBinaryCopyColumns.push_back(sColumn);
+
+        CPLString osEscapedGeom =
+            OGRPGEscapeColumnName(poGeomFieldDefn->GetNameRef());
+        if( poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOMETRY ||
+            poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOGRAPHY )
+        {
+            // ISO WKB, which can be forwarded as such to Arrow arrays
+            aosColumns.push_back("ST_AsBinary(" + osEscapedGeom + ")");
+        }
+        else
+        {
+            aosColumns.push_back(osEscapedGeom);
+        }
+    }
+
+    for( int i = 0; i < poFeatureDefn->GetFieldCount(); i++ )
+    {
+        const OGRFieldDefn* poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        const bool bIsFID = pszFIDColumn != nullptr &&
+                            EQUAL(poFieldDefn->GetNameRef(), pszFIDColumn);
+        if( poFieldDefn->IsIgnored() && !bIsFID )
+            continue;
+
+        BinaryCopyColumn sColumn;
+        sColumn.bFID = bIsFID;
+        sColumn.iField = poFieldDefn->IsIgnored() ? -1 : i;
+        m_asBinaryCopyColumns.push_back(sColumn);
+        aosColumns.push_back(OGRPGEscapeColumnName(poFieldDefn->GetNameRef()));
+    }
+
+    if( aosColumns.empty() )
+    {
+        m_asBinaryCopyColumns.push_back(BinaryCopyColumn());
+        aosColumns.push_back("NULL");
+    }
+
+/* -------------------------------------------------------------------- */
+/*      Get the type of the columns, to cast those whose binary         */
+/*      representation is not handled.                                  */
+/* -------------------------------------------------------------------- */
+    CPLString osFieldList;
+    for( const auto& osColumn: aosColumns )
+    {
+        if( !osFieldList.empty() )
+            osFieldList += ", ";
+        osFieldList += osColumn;
+    }
+
+    CPLString osCommand;
+    osCommand.Printf("SELECT %s FROM %s LIMIT 0",
+                     osFieldList.c_str(), pszSqlTableName);
+    PGresult *hResult = OGRPG_PQexec(hPGConn, osCommand);
+    if( !hResult || PQresultStatus(hResult) != PGRES_TUPLES_OK ||
+        PQnfields(hResult) != static_cast<int>(aosColumns.size()) )
+    {
+        OGRPGClearResult( hResult );
+        return false;
+    }
+
+    osFieldList.clear();
+    for( size_t i = 0; i < aosColumns.size(); i++ )
+    {
+        const auto& sColumn = m_asBinaryCopyColumns[i];
+        OGRFieldType eType = OFTInteger64;
+        if( sColumn.iGeomField >= 0 )
+            eType = OFTBinary;
+        else if( sColumn.iField >= 0 )
+            eType = poFeatureDefn->GetFieldDefn(sColumn.iField)->GetType();
+        else if( !sColumn.bFID )
+            eType = OFTString;
+
+        if( !osFieldList.empty() )
+            osFieldList += ", ";
+        const char* pszCast = OGRPGGetBinaryCopyCast(
+            eType, PQftype(hResult, static_cast<int>(i)));
+        if( pszCast )
+        {
+            osFieldList += "CAST(";
+            osFieldList += aosColumns[i];
+            osFieldList += " AS ";
+            osFieldList += pszCast;
+            osFieldList += ")";
+        }
+        else
+        {
+            osFieldList += aosColumns[i];
+        }
+    }
+    OGRPGClearResult( hResult );
+
+    osCommand.Printf("COPY (SELECT %s FROM %s %s) TO STDOUT (FORMAT binary)",
+                     osFieldList.c_str(), pszSqlTableName, osWHERE.c_str());
+    if( !m_oBinaryCopyReader.Start(hPGConn, osCommand) )
+        return false;
+
+    poDS->StartBinaryCopyRead(this);
+    return true;
+}
+
+/************************************************************************/
+/*                          AbortBinaryCopy()                           */
+/************************************************************************/
+
+void OGRPGTableLayer::AbortBinaryCopy()
+{
+    if( m_oBinaryCopyReader.IsActive() )
+    {
+        m_oBinaryCopyReader.Abort();
+        m_bBinaryCopyInterrupted = true;
+        poDS->EndBinaryCopyRead(this);
+    }
+}
+
+/************************************************************************/
+/*                    ReportBinaryCopyInterrupted()                     */
+/************************************************************************/
+
+static void ReportBinaryCopyInterrupted()
+{
+    CPLError(CE_Failure, CPLE_AppDefined,
+             "Binary COPY used to read layer has been interrupted by another "
+             "request on the connection. "
+             "ResetReading() must be explicitly called to restart reading");
+}
+
+/************************************************************************/
+/*                      GetNextBinaryCopyFeature()                      */
+/************************************************************************/
+
+OGRFeature *OGRPGTableLayer::GetNextBinaryCopyFeature()
+{
+    if( m_bBinaryCopyInterrupted )
+    {
+        ReportBinaryCopyInterrupted();
+        return nullptr;
+    }
+
+    if( !m_oBinaryCopyReader.IsActive() )
+    {
+        // End of the pass
+        if( iNextShapeId != 0 )
+            return nullptr;
+
+        if( !StartBinaryCopy() )
+        {
+            iNextShapeId = 1;
+            return nullptr;
+        }
+    }
+
+    if( m_oBinaryCopyReader.ReadTuple(
+            static_cast<int>(m_asBinaryCopyColumns.size())) <= 0 )
+    {
+        poDS->EndBinaryCopyRead(this);
+        iNextShapeId = MAX(1, iNextShapeId);
+        return nullptr;
+    }
+
+    OGRFeature *poFeature = BinaryCopyTupleToFeature();
+    iNextShapeId++;
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                      BinaryCopyTupleToFeature()                      */
+/************************************************************************/
+
+OGRFeature *OGRPGTableLayer::BinaryCopyTupleToFeature()
+{
+    OGRFeature *poFeature = new OGRFeature( poFeatureDefn );
+
+    poFeature->SetFID( iNextShapeId );
+    m_nFeaturesRead++;
+
+    std::string osTmp;
+    std::vector<std::pair<const GByte*, int>> aoElements;
+
+    for( int iCol = 0; iCol < m_oBinaryCopyReader.GetFieldCount(); iCol++ )
+    {
+        const auto& sColumn = m_asBinaryCopyColumns[iCol];
+        if( m_oBinaryCopyReader.IsNull(iCol) )
+        {
+            if( sColumn.iField >= 0 )
+                poFeature->SetFieldNull( sColumn.iField );
+            continue;
+        }
+
+        const GByte *pabyData = m_oBinaryCopyReader.GetData(iCol);
+        const int nLen = m_oBinaryCopyReader.GetLength(iCol);
+
+        if( sColumn.bFID )
+        {
+            GIntBig nFID = 0;
+            if( OGRPGGetBinaryInteger(pabyData, nLen, nFID) )
+                poFeature->SetFID( nFID );
+        }
+
+/* -------------------------------------------------------------------- */
+/*      Geometry (ISO WKB for PostGIS columns).                         */
+/* -------------------------------------------------------------------- */
+        if( sColumn.iGeomField >= 0 )
+        {
+            const OGRPGGeomFieldDefn* poGeomFieldDefn =
+                poFeatureDefn->GetGeomFieldDefn(sColumn.iGeomField);
+            OGRwkbVariant eVariant = wkbVariantIso;
+            if( poGeomFieldDefn->ePostgisType == GEOM_TYPE_WKB )
+            {
+                eVariant = poDS->sPostGISVersion.nMajor < 2 ?
+                                wkbVariantPostGIS1 : wkbVariantOldOgc;
+            }
+
+            OGRGeometry *poGeom = nullptr;
+            if( nLen > 0 )
+            {
+                OGRGeometryFactory::createFromWkb( pabyData, nullptr, &poGeom,
+                                                   nLen, eVariant );
+            }
+            if( poGeom != nullptr )
+            {
+                poGeom->assignSpatialReference( poGeomFieldDefn->GetSpatialRef() );
+                poFeature->SetGeomFieldDirectly( sColumn.iGeomField, poGeom );
+            }
+            continue;
+        }
+
+/* -------------------------------------------------------------------- */
+/*      Regular fields.                                                 */
+/* -------------------------------------------------------------------- */
+        const int iField = sColumn.iField;
+        if( iField < 0 )
+            continue;
+
+        const OGRFieldDefn* poFieldDefn = poFeatureDefn->GetFieldDefn(iField);
+        switch( poFieldDefn->GetType() )
+        {
+            case OFTInteger:
+            {
+                GIntBig nVal = 0;
+                if( OGRPGGetBinaryInteger(pabyData, nLen, nVal) )
+                    poFeature->SetField( iField, static_cast<int>(nVal) );
+                break;
+            }
+
+            case OFTInteger64:
+            {
+                GIntBig nVal = 0;
+                if( OGRPGGetBinaryInteger(pabyData, nLen, nVal) )
+                    poFeature->SetField( iField, nVal );
+                break;
+            }
+
+            case OFTReal:
+            {
+                double dfVal = 0.0;
+                if( OGRPGGetBinaryReal(pabyData, nLen, dfVal, true) )
+                    poFeature->SetField( iField, dfVal );
+                break;
+            }
+
+            case OFTBinary:
+            {
+                poFeature->SetField( iField, nLen, pabyData );
+                break;
+            }
+
+            case OFTDate:
+            {
+                int nDays = 0;
+                if( OGRPGGetBinaryDate(pabyData, nLen, nDays) )
+                {
+                    struct tm brokenDown;
+                    CPLUnixTimeToYMDHMS(static_cast<GIntBig>(nDays) * 86400,
+                                        &brokenDown);
+                    poFeature->SetField( iField, brokenDown.tm_year + 1900,
+                                         brokenDown.tm_mon + 1,
+                                         brokenDown.tm_mday );
+                }
+                break;
+            }
+
+            case OFTTime:
+            case OFTDateTime:
+            {
+                osTmp.assign(reinterpret_cast<const char*>(pabyData), nLen);
+                OGRField sFieldValue;
+                if( OGRParseDate( osTmp.c_str(), &sFieldValue, 0 ) )
+                    poFeature->SetField( iField, &sFieldValue );
+                break;
+            }
+
+            case OFTIntegerList:
+            case OFTInteger64List:
+            {
+                if( !OGRPGParseBinaryArray(pabyData, nLen, aoElements) )
+                {
+                    CPLDebug("PG", "Invalid binary array for field %s",
+                             poFieldDefn->GetNameRef());
+                    break;
+                }
+                std::vector<GIntBig> anValues;
+                anValues.reserve(aoElements.size());
+                for( const auto& oElement: aoElements )
+                {
+                    GIntBig nVal = 0;
+                    if( oElement.second >= 0 )
+                        OGRPGGetBinaryInteger(oElement.first, oElement.second, nVal);
+                    anValues.push_back(nVal);
+                }
+                if( poFieldDefn->GetType() == OFTIntegerList )
+                {
+                    std::vector<int> anIntValues(anValues.begin(), anValues.end());
+                    poFeature->SetField( iField,
+                                         static_cast<int>(anIntValues.size()),
+                                         anIntValues.data() );
+                }
+                else
+                {
+                    poFeature->SetField( iField,
+                                         static_cast<int>(anValues.size()),
+                                         anValues.data() );
+                }
+                break;
+            }
+
+            case OFTRealList:
+            {
+                if( !OGRPGParseBinaryArray(pabyData, nLen, aoElements) )
+                {
+                    CPLDebug("PG", "Invalid binary array for field %s",
+                             poFieldDefn->GetNameRef());
+                    break;
+                }
+                std::vector<double> adfValues;
+                adfValues.reserve(aoElements.size());
+                for( const auto& oElement: aoElements )
+                {
+                    double dfVal = 0.0;
+                    if( oElement.second >= 0 )
+                        OGRPGGetBinaryReal(oElement.first, oElement.second,
+                                           dfVal, true);
+                    adfValues.push_back(dfVal);
+                }
+                poFeature->SetField( iField,
+                                     static_cast<int>(adfValues.size()),
+                                     adfValues.data() );
+                break;
+            }
+
+            case OFTStringList:
+            {
+                if( !OGRPGParseBinaryArray(pabyData, nLen, aoElements) )
+                {
+                    CPLDebug("PG", "Invalid binary array for field %s",
+                             poFieldDefn->GetNameRef());
+                    break;
+                }
+                CPLStringList aosValues;
+                for( const auto& oElement: aoElements )
+                {
+                    if( oElement.second > 0 )
+                        osTmp.assign(reinterpret_cast<const char*>(oElement.first),
+                                     oElement.second);
+                    else
+                        osTmp.clear();
+                    aosValues.AddString(osTmp.c_str());
+                }
+                poFeature->SetField( iField, aosValues.List() );
+                break;
+            }
+
+            default:
+            {
+                osTmp.assign(reinterpret_cast<const char*>(pabyData), nLen);
+                poFeature->SetField( iField, osTmp.c_str() );
+                break;
+            }
+        }
+    }
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/*                                                                      */
+/*      Decodes the binary COPY tuples straight into the Arrow          */
+/*      buffers, without going through OGRFeature.                      */
+/************************************************************************/
+
+int OGRPGTableLayer::GetNextArrowArray( struct ArrowArrayStream* stream,
+                                        struct ArrowArray* out_array )
+{
+    if( CPLTestBool(CPLGetConfigOption("OGR_PG_STREAM_BASE_IMPL", "NO")) ||
+        !CanUseBinaryCopy(true) )
+    {
+        return OGRPGLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    memset(out_array, 0, sizeof(*out_array));
+
+    if( bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE )
+        return EIO;
+
+    if( m_bBinaryCopyInterrupted )
+    {
+        ReportBinaryCopyInterrupted();
+        return EIO;
+    }
+
+    if( !m_oBinaryCopyReader.IsActive() )
+    {
+        // End of the pass. GetArrowStream() resets reading before the
+        // first batch.
+        if( iNextShapeId != 0 || hCursorResult != nullptr )
+            return 0;
+
+        poDS->EndCopy();
+        if( !StartBinaryCopy() )
+        {
+            iNextShapeId = 1;
+            return EIO;
+        }
+    }
+
+    OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if( out_array->release == nullptr )
+    {
+        return ENOMEM;
+    }
+
+    const int nColumns = static_cast<int>(m_asBinaryCopyColumns.size());
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+    std::string osTmp;
+    int errorErrno = EIO;
+    int iFeat = 0;
+
+    while( iFeat < sHelper.nMaxBatchSize )
+    {
+        const int nRet = m_oBinaryCopyReader.ReadTuple(nColumns);
+        if( nRet <= 0 )
+        {
+            poDS->EndBinaryCopyRead(this);
+            iNextShapeId = MAX(1, iNextShapeId);
+            if( nRet < 0 )
+                goto error;
+            break;
+        }
+
+        GIntBig nFID = iNextShapeId;
+        for( int iCol = 0; iCol < nColumns; iCol++ )
+        {
+            const auto& sColumn = m_asBinaryCopyColumns[iCol];
+            const bool bIsNull = m_oBinaryCopyReader.IsNull(iCol);
+            const GByte *pabyData = m_oBinaryCopyReader.GetData(iCol);
+            const int nLen = m_oBinaryCopyReader.GetLength(iCol);
+
+            if( sColumn.bFID && !bIsNull )
+                OGRPGGetBinaryInteger(pabyData, nLen, nFID);
+
+            int iArrowField = -1;
+            if( sColumn.iGeomField >= 0 )
+                iArrowField = sHelper.mapOGRGeomFieldToArrowField[sColumn.iGeomField];
+            else if( sColumn.iField >= 0 )
+                iArrowField = sHelper.mapOGRFieldToArrowField[sColumn.iField];
+            if( iArrowField < 0 )
+                continue;
+
+            if( bIsNull )
+            {
+                if( !sHelper.SetNull(iArrowField, iFeat) )
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                continue;
+            }
+
+            auto psArray = out_array->children[iArrowField];
+
+/* -------------------------------------------------------------------- */
+/*      Geometry.                                                       */
+/* -------------------------------------------------------------------- */
+            if( sColumn.iGeomField >= 0 )
+            {
+                const OGRPGGeomFieldDefn* poGeomFieldDefn =
+                    poFeatureDefn->GetGeomFieldDefn(sColumn.iGeomField);
+                if( poGeomFieldDefn->ePostgisType == GEOM_TYPE_WKB )
+                {
+                    // Arbitrary WKB: normalize it to ISO WKB
+                    OGRGeometry *poGeom = nullptr;
+                    if( nLen > 0 )
+                    {
+                        OGRGeometryFactory::createFromWkb(
+                            pabyData, nullptr, &poGeom, nLen,
+                            poDS->sPostGISVersion.nMajor < 2 ?
+                                wkbVariantPostGIS1 : wkbVariantOldOgc );
+                    }
+                    if( poGeom == nullptr )
+                    {
+                        if( !sHelper.SetNull(iArrowField, iFeat) )
+                        {
+                            errorErrno = ENOMEM;
+                            goto error;
+                        }
+                        continue;
+                    }
+                    const size_t nWKBSize = poGeom->WkbSize();
+                    GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                                                iArrowField, iFeat, nWKBSize);
+                    if( outPtr == nullptr )
+                    {
+                        delete poGeom;
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+                    delete poGeom;
+                }
+                else
+                {
+                    GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                                                iArrowField, iFeat, nLen);
+                    if( outPtr == nullptr )
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    if( nLen )
+                        memcpy(outPtr, pabyData, nLen);
+                }
+                continue;
+            }
+
+/* -------------------------------------------------------------------- */
+/*      Regular fields.                                                 */
+/* -------------------------------------------------------------------- */
+            const OGRFieldDefn *poFieldDefn =
+                poFeatureDefn->GetFieldDefn(sColumn.iField);
+            bool bValid = true;
+            switch( poFieldDefn->GetType() )
+            {
+                case OFTInteger:
+                {
+                    GIntBig nVal = 0;
+                    bValid = OGRPGGetBinaryInteger(pabyData, nLen, nVal);
+                    if( !bValid )
+                        break;
+                    if( poFieldDefn->GetSubType() == OFSTBoolean )
+                    {
+                        if( nVal != 0 )
+                            sHelper.SetBoolOn(psArray, iFeat);
+                    }
+                    else if( poFieldDefn->GetSubType() == OFSTInt16 )
+                    {
+                        sHelper.SetInt16(psArray, iFeat,
+                                         static_cast<int16_t>(nVal));
+                    }
+                    else
+                    {
+                        sHelper.SetInt32(psArray, iFeat,
+                                         static_cast<int32_t>(nVal));
+                    }
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    GIntBig nVal = 0;
+                    bValid = OGRPGGetBinaryInteger(pabyData, nLen, nVal);
+                    if( bValid )
+                        sHelper.SetInt64(psArray, iFeat, nVal);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    double dfVal = 0.0;
+                    bValid = OGRPGGetBinaryReal(pabyData, nLen, dfVal);
+                    if( !bValid )
+                        break;
+                    if( poFieldDefn->GetSubType() == OFSTFloat32 )
+                        sHelper.SetFloat(psArray, iFeat, static_cast<float>(dfVal));
+                    else
+                        sHelper.SetDouble(psArray, iFeat, dfVal);
+                    break;
+                }
+
+                case OFTString:
+                case OFTBinary:
+                {
+                    GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                                                iArrowField, iFeat, nLen);
+                    if( outPtr == nullptr )
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    if( nLen )
+                        memcpy(outPtr, pabyData, nLen);
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    int nDays = 0;
+                    bValid = OGRPGGetBinaryDate(pabyData, nLen, nDays);
+                    if( bValid )
+                        sHelper.SetInt32(psArray, iFeat, nDays);
+                    break;
+                }
+
+                case OFTTime:
+                case OFTDateTime:
+                {
+                    osTmp.assign(reinterpret_cast<const char*>(pabyData), nLen);
+                    OGRField sFieldValue;
+                    bValid = CPL_TO_BOOL(OGRParseDate(osTmp.c_str(), &sFieldValue, 0));
+                    if( !bValid )
+                        break;
+                    if( poFieldDefn->GetType() == OFTDateTime )
+                    {
+                        sHelper.SetDateTime(psArray, iFeat, brokenDown, sFieldValue);
+                    }
+                    else
+                    {
+                        sHelper.SetInt32(psArray, iFeat,
+                            sFieldValue.Date.Hour * 3600000 +
+                            sFieldValue.Date.Minute * 60000 +
+                            static_cast<int>(sFieldValue.Date.Second * 1000 + 0.5));
+                    }
+                    break;
+                }
+
+                default:
+                    CPLAssert( false );
+                    break;
+            }
+
+            if( !bValid && !sHelper.SetNull(iArrowField, iFeat) )
+            {
+                errorErrno = ENOMEM;
+                goto error;
+            }
+        }
+
+        if( sHelper.panFIDValues )
+            sHelper.panFIDValues[iFeat] = nFID;
+
+        iNextShapeId++;
+        m_nFeaturesRead++;
+        iFeat++;
+    }
+
+    if( iFeat == 0 )
+    {
+        // End of stream
+        sHelper.ClearArray();
+        return 0;
+    }
+
+    sHelper.Shrink(iFeat);
+    return 0;
+
+error:
+    sHelper.ClearArray();
+    return errorErrno;
+}
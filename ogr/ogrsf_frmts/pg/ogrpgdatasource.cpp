@@ -3155,6 +3155,8 @@ void OGRPGDataSource::StartCopy( OGRPGTableLayer *poPGLayer )
 
 OGRErr OGRPGDataSource::EndCopy( )
 {
+    AbortBinaryCopyRead();
+
     if( poLayerInCopyMode != nullptr )
     {
         OGRErr result = poLayerInCopyMode->EndCopy();
@@ -3165,3 +3167,42 @@ OGRErr OGRPGDataSource::EndCopy( )
     else
         return OGRERR_NONE;
 }
+
+/************************************************************************/
+/*                        StartBinaryCopyRead()                         */
+/************************************************************************/
+
+void OGRPGDataSource::StartBinaryCopyRead( OGRPGTableLayer *poPGLayer )
+{
+    if( m_poLayerInBinaryCopyRead != poPGLayer )
+        AbortBinaryCopyRead();
+    m_poLayerInBinaryCopyRead = poPGLayer;
+}
+
+/************************************************************************/
+/*                         EndBinaryCopyRead()                          */
+/************************************************************************/
+
+void OGRPGDataSource::EndBinaryCopyRead( OGRPGTableLayer *poPGLayer )
+{
+    if( m_poLayerInBinaryCopyRead == poPGLayer )
+        m_poLayerInBinaryCopyRead = nullptr;
+}
+
+/************************************************************************/
+/*                        AbortBinaryCopyRead()                         */
+/*                                                                      */
+/*      A binary COPY read keeps the connection busy until all its      */
+/*      tuples have been fetched. Interrupt it so that another          */
+/*      request can be issued.                                          */
+/************************************************************************/
+
+void OGRPGDataSource::AbortBinaryCopyRead()
+{
+    if( m_poLayerInBinaryCopyRead != nullptr )
+    {
+        OGRPGTableLayer* poLayer = m_poLayerInBinaryCopyRead;
+        m_poLayerInBinaryCopyRead = nullptr;
+        poLayer->AbortBinaryCopy();
+    }
+}
@@ -125,6 +125,8 @@ void OGRPGLayer::CloseCursor()
     {
         OGRPGClearResult( hCursorResult );
 
+        poDS->AbortBinaryCopyRead();
+
         CPLString    osCommand;
         osCommand.Printf("CLOSE %s", pszCursorName );
 
@@ -1473,6 +1475,8 @@ OGRFeature *OGRPGLayer::GetNextRawFeature()
         return nullptr;
     }
 
+    poDS->AbortBinaryCopyRead();
+
 /* -------------------------------------------------------------------- */
 /*      Do we need to establish an initial query?                       */
 /* -------------------------------------------------------------------- */
@@ -1929,6 +1933,8 @@ OGRErr OGRPGLayer::RunGetExtentRequest( OGREnvelope *psExtent,
     if ( psExtent == nullptr )
         return OGRERR_FAILURE;
 
+    poDS->AbortBinaryCopyRead();
+
     PGconn      *hPGConn = poDS->GetPGConn();
     PGresult    *hResult =
         OGRPG_PQexec( hPGConn, osCommand, FALSE, bErrorAsDebug );
@@ -192,6 +192,8 @@ GIntBig OGRPGResultLayer::GetFeatureCount( int bForce )
     if( TestCapability(OLCFastFeatureCount) == FALSE )
         return OGRPGLayer::GetFeatureCount( bForce );
 
+    poDS->AbortBinaryCopyRead();
+
     PGconn              *hPGConn = poDS->GetPGConn();
     CPLString           osCommand;
     int                 nCount = 0;
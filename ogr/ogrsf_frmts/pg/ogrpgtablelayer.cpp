@@ -195,6 +195,7 @@ OGRPGTableLayer::~OGRPGTableLayer()
 {
     if( bDeferredCreation ) RunDeferredCreationIfNecessary();
     if( bCopyActive ) EndCopy();
+    AbortBinaryCopy();
     UpdateSequenceIfNeeded();
 
     CPLFree( pszSqlTableName );
@@ -897,6 +898,7 @@ void OGRPGTableLayer::ResetReading()
 
     if( bDeferredCreation ) RunDeferredCreationIfNecessary();
     poDS->EndCopy();
+    m_bBinaryCopyInterrupted = false;
     bUseCopyByDefault = FALSE;
 
     BuildFullQueryStatement();
@@ -915,7 +917,8 @@ OGRFeature *OGRPGTableLayer::GetNextFeature()
 {
     if( bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE )
         return nullptr;
-    poDS->EndCopy();
+    if( !m_oBinaryCopyReader.IsActive() )
+        poDS->EndCopy();
 
     if( pszQueryStatement == nullptr )
         ResetReading();
@@ -925,9 +928,18 @@ OGRFeature *OGRPGTableLayer::GetNextFeature()
         poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(m_iGeomFieldFilter);
     poFeatureDefn->GetFieldCount();
 
+    // The binary COPY is only started at the beginning of a pass, so that
+    // SetNextByIndex() keeps using the cursor.
+    const bool bUseBinaryCopy =
+        m_oBinaryCopyReader.IsActive() || m_bBinaryCopyInterrupted ||
+        (iNextShapeId == 0 && hCursorResult == nullptr &&
+         CPLTestBool(CPLGetConfigOption("OGR_PG_BINARY_COPY", "NO")) &&
+         CanUseBinaryCopy(false));
+
     while( true )
     {
-        OGRFeature *poFeature = GetNextRawFeature();
+        OGRFeature *poFeature = bUseBinaryCopy ? GetNextBinaryCopyFeature() :
+                                                 GetNextRawFeature();
         if( poFeature == nullptr )
             return nullptr;
 
@@ -2085,6 +2097,9 @@ int OGRPGTableLayer::TestCapability( const char * pszCap )
     else if( EQUAL(pszCap,OLCTransactions) )
         return TRUE;
 
+    else if( EQUAL(pszCap,OLCFastGetArrowStream) )
+        return CanUseBinaryCopy(true);
+
     else if( EQUAL(pszCap,OLCFastGetExtent) )
     {
         OGRPGGeomFieldDefn* poGeomFieldDefn = nullptr;
@@ -55,7 +55,14 @@
 OGRFeature *SHPReadOGRFeature( SHPHandle hSHP, DBFHandle hDBF,
                                OGRFeatureDefn * poDefn, int iShape,
                                SHPObject *psShape, const char *pszSHPEncoding );
+bool SHPReadOGRFeatureInto( SHPHandle hSHP, DBFHandle hDBF,
+                            OGRFeatureDefn * poDefn, int iShape,
+                            SHPObject *psShape, const char *pszSHPEncoding,
+                            OGRFeature* poFeature );
 OGRGeometry *SHPReadOGRObject( SHPHandle hSHP, int iShape, SHPObject *psShape );
+void SHPConformOGRObjectToLayerType( OGRGeometry *poGeometry,
+                                     OGRwkbGeometryType eLayerGeomType );
+void SHPParseDBFDate( const char *pszDateValue, OGRField *psField );
 OGRFeatureDefn *SHPReadOGRFeatureDefn( const char * pszName,
                                        SHPHandle hSHP, DBFHandle hDBF,
                                        const char *pszSHPEncoding,
@@ -193,6 +200,10 @@ class OGRShapeLayer final: public OGRAbstractProxiedLayer
 
     void                CloseUnderlyingLayer() override;
 
+  protected:
+    int                 GetNextArrowArray( struct ArrowArrayStream*,
+                                           struct ArrowArray* out_array ) override;
+
 // WARNING: Each of the below public methods should start with a call to
 // TouchLayer() and test its return value, so as to make sure that
 // the layer is properly re-opened if necessary.
@@ -210,7 +221,7 @@ class OGRShapeLayer final: public OGRAbstractProxiedLayer
     const char         *GetFullName() { return pszFullName; }
     void                UpdateFollowingDeOrRecompression();
 
-    OGRFeature *        FetchShape( int iShapeId );
+    bool                FetchShape( int iShapeId, OGRFeature* poFeature );
     int                 GetFeatureCountWithSpatialFilterOnly();
 
                         OGRShapeLayer( OGRShapeDataSource* poDSIn,
@@ -224,6 +235,7 @@ class OGRShapeLayer final: public OGRAbstractProxiedLayer
 
     void                ResetReading() override;
     OGRFeature *        GetNextFeature() override;
+    bool                GetNextFeatureInto( OGRFeature& oFeature ) override;
     OGRErr              SetNextByIndex( GIntBig nIndex ) override;
 
     OGRFeature         *GetFeature( GIntBig nFeatureId ) override;
@@ -52,6 +52,7 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogr_srs_api.h"
+#include "ograrrowarrayhelper.h"
 #include "ogrlayerpool.h"
 #include "ogrsf_frmts.h"
 #include "shapefil.h"
@@ -803,11 +804,9 @@ OGRErr OGRShapeLayer::SetNextByIndex( GIntBig nIndex )
 /*      if the shapeid bbox intersects the geometry.                    */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape( int iShapeId )
+bool OGRShapeLayer::FetchShape( int iShapeId, OGRFeature* poFeature )
 
 {
-    OGRFeature *poFeature = nullptr;
-
     if( m_poFilterGeom != nullptr && hSHP != nullptr )
     {
         SHPObject *psShape = SHPReadObject( hSHP, iShapeId );
@@ -822,8 +821,9 @@ OGRFeature *OGRShapeLayer::FetchShape( int iShapeId )
                     || psShape->dfYMin == psShape->dfYMax))
             || psShape->nSHPType == SHPT_NULL )
         {
-            poFeature = SHPReadOGRFeature( hSHP, hDBF, poFeatureDefn,
-                                           iShapeId, psShape, osEncoding );
+            return SHPReadOGRFeatureInto( hSHP, hDBF, poFeatureDefn,
+                                          iShapeId, psShape, osEncoding,
+                                          poFeature );
         }
         else if( m_sFilterEnvelope.MaxX < psShape->dfXMin
                  || m_sFilterEnvelope.MaxY < psShape->dfYMin
@@ -831,21 +831,18 @@ OGRFeature *OGRShapeLayer::FetchShape( int iShapeId )
                  || psShape->dfYMax < m_sFilterEnvelope.MinY )
         {
             SHPDestroyObject(psShape);
-            poFeature = nullptr;
+            return false;
         }
         else
         {
-            poFeature = SHPReadOGRFeature( hSHP, hDBF, poFeatureDefn,
-                                           iShapeId, psShape, osEncoding );
+            return SHPReadOGRFeatureInto( hSHP, hDBF, poFeatureDefn,
+                                          iShapeId, psShape, osEncoding,
+                                          poFeature );
         }
     }
-    else
-    {
-        poFeature = SHPReadOGRFeature( hSHP, hDBF, poFeatureDefn,
-                                       iShapeId, nullptr, osEncoding );
-    }
 
-    return poFeature;
+    return SHPReadOGRFeatureInto( hSHP, hDBF, poFeatureDefn,
+                                  iShapeId, nullptr, osEncoding, poFeature );
 }
 
 /************************************************************************/
@@ -855,8 +852,24 @@ OGRFeature *OGRShapeLayer::FetchShape( int iShapeId )
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
 {
-    if( !TouchLayer() )
+    auto poFeature = cpl::make_unique<OGRFeature>(poFeatureDefn);
+    if( !OGRShapeLayer::GetNextFeatureInto(*poFeature) )
         return nullptr;
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRShapeLayer::GetNextFeatureInto( OGRFeature& oFeature )
+
+{
+    if( oFeature.GetDefnRef() != poFeatureDefn )
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    if( !TouchLayer() )
+        return false;
 
 /* -------------------------------------------------------------------- */
 /*      Collect a matching list if we have attribute or spatial         */
@@ -872,21 +885,23 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
 /* -------------------------------------------------------------------- */
 /*      Loop till we find a feature matching our criteria.              */
 /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = nullptr;
-
     while( true )
     {
+        bool bGotFeature = false;
+
         if( panMatchingFIDs != nullptr )
         {
             if( panMatchingFIDs[iMatchingFID] == OGRNullFID )
             {
-                return nullptr;
+                return false;
             }
 
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
-            poFeature =
-                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]));
+            oFeature.Reset();
+            bGotFeature =
+                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]),
+                           &oFeature);
 
             iMatchingFID++;
         }
@@ -894,27 +909,33 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
         {
             if( iNextShapeId >= nTotalShapeCount )
             {
-                return nullptr;
+                return false;
             }
 
             if( hDBF )
             {
                 if( DBFIsRecordDeleted( hDBF, iNextShapeId ) )
-                    poFeature = nullptr;
+                    bGotFeature = false;
                 else if( VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)) )
-                    return nullptr;  //* I/O error.
+                    return false;  //* I/O error.
                 else
-                    poFeature = FetchShape(iNextShapeId);
+                {
+                    oFeature.Reset();
+                    bGotFeature = FetchShape(iNextShapeId, &oFeature);
+                }
             }
             else
-                poFeature = FetchShape(iNextShapeId);
+            {
+                oFeature.Reset();
+                bGotFeature = FetchShape(iNextShapeId, &oFeature);
+            }
 
             iNextShapeId++;
         }
 
-        if( poFeature != nullptr )
+        if( bGotFeature )
         {
-            OGRGeometry* poGeom = poFeature->GetGeometryRef();
+            OGRGeometry* poGeom = oFeature.GetGeometryRef();
             if( poGeom != nullptr )
             {
                 poGeom->assignSpatialReference( GetSpatialRef() );
@@ -924,14 +945,359 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
 
             if( (m_poFilterGeom == nullptr || FilterGeometry( poGeom ) )
                 && (m_poAttrQuery == nullptr ||
-                    m_poAttrQuery->Evaluate( poFeature )) )
+                    m_poAttrQuery->Evaluate( &oFeature )) )
             {
-                return poFeature;
+                return true;
             }
+        }
+    }
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/*                                                                      */
+/*      Columnar reader that decodes DBF records and SHP shapes         */
+/*      straight into the Arrow buffers, without going through          */
+/*      OGRFeature.                                                     */
+/************************************************************************/
+
+int OGRShapeLayer::GetNextArrowArray( struct ArrowArrayStream* stream,
+                                      struct ArrowArray* out_array )
+{
+    // Attribute filters are evaluated against OGRFeature, so defer to the
+    // generic implementation in that case.
+    if( m_poAttrQuery != nullptr ||
+        (m_poFilterGeom != nullptr && poFeatureDefn->IsGeometryIgnored()) ||
+        CPLTestBool(CPLGetConfigOption("OGR_SHAPE_STREAM_BASE_IMPL", "NO")) )
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    memset(out_array, 0, sizeof(*out_array));
+
+    if( !TouchLayer() )
+        return EIO;
+
+/* -------------------------------------------------------------------- */
+/*      Use the .qix/.sbn spatial index on the first batch of a pass.   */
+/* -------------------------------------------------------------------- */
+    if( m_poFilterGeom != nullptr && iNextShapeId == 0 &&
+        panMatchingFIDs == nullptr )
+    {
+        ScanIndices();
+    }
 
-            delete poFeature;
+    OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if( out_array->release == nullptr )
+    {
+        return ENOMEM;
+    }
+
+    const int iGeomArrowField = sHelper.nGeomFieldCount > 0 ?
+                                sHelper.mapOGRGeomFieldToArrowField[0] : -1;
+    const OGRwkbGeometryType eLayerGeomType = sHelper.nGeomFieldCount > 0 ?
+        poFeatureDefn->GetGeomFieldDefn(0)->GetType() : wkbNone;
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    int errorErrno = EIO;
+    int iFeat = 0;
+    while( iFeat < sHelper.nMaxBatchSize )
+    {
+/* -------------------------------------------------------------------- */
+/*      Select the next candidate shape.                                */
+/* -------------------------------------------------------------------- */
+        int iShape = 0;
+        if( panMatchingFIDs != nullptr )
+        {
+            if( panMatchingFIDs[iMatchingFID] == OGRNullFID )
+                break;
+            iShape = static_cast<int>(panMatchingFIDs[iMatchingFID]);
+            iMatchingFID++;
+
+            if( iShape < 0
+                || (hSHP != nullptr && iShape >= hSHP->nRecords)
+                || (hDBF != nullptr && iShape >= hDBF->nRecords) )
+            {
+                CPLError( CE_Failure, CPLE_AppDefined,
+                          "Attempt to read shape with feature id (%d) out of "
+                          "available range.", iShape );
+                continue;
+            }
+            if( hDBF && DBFIsRecordDeleted( hDBF, iShape ) )
+                continue;
+        }
+        else
+        {
+            if( iNextShapeId >= nTotalShapeCount )
+                break;
+            iShape = iNextShapeId++;
+
+            if( hDBF )
+            {
+                if( DBFIsRecordDeleted( hDBF, iShape ) )
+                    continue;
+                if( VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)) )
+                    break;  // I/O error.
+            }
         }
+
+/* -------------------------------------------------------------------- */
+/*      Read the shape and apply the spatial filter.                    */
+/* -------------------------------------------------------------------- */
+        SHPObject *psShape = nullptr;
+        if( hSHP != nullptr && (iGeomArrowField >= 0 || m_poFilterGeom != nullptr) )
+        {
+            psShape = SHPReadObject( hSHP, iShape );
+
+            // Same bounding box pre-filtering as FetchShape(): do not trust
+            // degenerate bounds on non-point geometries or bounds on null
+            // shapes.
+            if( m_poFilterGeom != nullptr && psShape != nullptr
+                && (psShape->nSHPType == SHPT_POINT
+                    || psShape->nSHPType == SHPT_POINTZ
+                    || psShape->nSHPType == SHPT_POINTM
+                    || (psShape->dfXMin != psShape->dfXMax
+                        && psShape->dfYMin != psShape->dfYMax))
+                && psShape->nSHPType != SHPT_NULL
+                && (m_sFilterEnvelope.MaxX < psShape->dfXMin
+                    || m_sFilterEnvelope.MaxY < psShape->dfYMin
+                    || psShape->dfXMax < m_sFilterEnvelope.MinX
+                    || psShape->dfYMax < m_sFilterEnvelope.MinY) )
+            {
+                SHPDestroyObject( psShape );
+                continue;
+            }
+        }
+
+        m_nFeaturesRead++;
+
+        if( psShape != nullptr && m_poFilterGeom == nullptr &&
+            iGeomArrowField >= 0 &&
+            (psShape->nSHPType == SHPT_POINT
+             || psShape->nSHPType == SHPT_POINTZ
+             || psShape->nSHPType == SHPT_POINTM) )
+        {
+            // Fast path: encode points as ISO WKB directly from the shape.
+            bool bHasZ = psShape->nSHPType == SHPT_POINTZ;
+            bool bHasM = psShape->nSHPType == SHPT_POINTM ||
+                         (psShape->nSHPType == SHPT_POINTZ &&
+                          psShape->bMeasureIsUsed);
+            const double dfZ = bHasZ ? psShape->padfZ[0] : 0.0;
+            const double dfM = bHasM ? psShape->padfM[0] : 0.0;
+            if( eLayerGeomType != wkbUnknown )
+            {
+                bHasZ = CPL_TO_BOOL(wkbHasZ(eLayerGeomType));
+                bHasM = CPL_TO_BOOL(wkbHasM(eLayerGeomType));
+            }
+
+            double adfCoords[4] = { psShape->padfX[0], psShape->padfY[0],
+                                    0.0, 0.0 };
+            int nCoords = 2;
+            if( bHasZ )
+                adfCoords[nCoords++] = dfZ;
+            if( bHasM )
+                adfCoords[nCoords++] = dfM;
+            SHPDestroyObject( psShape );
+
+            const size_t nWKBSize = 1 + sizeof(uint32_t) +
+                                    nCoords * sizeof(double);
+            GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                iGeomArrowField, iFeat, nWKBSize);
+            if( outPtr == nullptr )
+            {
+                errorErrno = ENOMEM;
+                goto error;
+            }
+            outPtr[0] = wkbNDR;
+            uint32_t nWKBType = static_cast<uint32_t>(wkbPoint) +
+                                (bHasZ ? 1000 : 0) + (bHasM ? 2000 : 0);
+            CPL_LSBPTR32(&nWKBType);
+            memcpy(outPtr + 1, &nWKBType, sizeof(uint32_t));
+            for( int i = 0; i < nCoords; i++ )
+            {
+                CPL_LSBPTR64(&adfCoords[i]);
+            }
+            memcpy(outPtr + 1 + sizeof(uint32_t), adfCoords,
+                   nCoords * sizeof(double));
+        }
+        else if( psShape != nullptr )
+        {
+            // SHPReadOGRObject() takes ownership of psShape.
+            std::unique_ptr<OGRGeometry> poGeom(
+                SHPReadOGRObject( hSHP, iShape, psShape ));
+            if( poGeom )
+            {
+                SHPConformOGRObjectToLayerType( poGeom.get(), eLayerGeomType );
+            }
+
+            if( m_poFilterGeom != nullptr && !FilterGeometry( poGeom.get() ) )
+                continue;
+
+            if( iGeomArrowField >= 0 )
+            {
+                if( poGeom == nullptr )
+                {
+                    if( !sHelper.SetNull(iGeomArrowField, iFeat) )
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                }
+                else
+                {
+                    const size_t nWKBSize = poGeom->WkbSize();
+                    GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                        iGeomArrowField, iFeat, nWKBSize);
+                    if( outPtr == nullptr )
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+                }
+            }
+        }
+        else if( m_poFilterGeom != nullptr )
+        {
+            // Unreadable shape: never matches the spatial filter.
+            continue;
+        }
+        else if( iGeomArrowField >= 0 )
+        {
+            if( !sHelper.SetNull(iGeomArrowField, iFeat) )
+            {
+                errorErrno = ENOMEM;
+                goto error;
+            }
+        }
+
+        if( sHelper.panFIDValues )
+            sHelper.panFIDValues[iFeat] = iShape;
+
+/* -------------------------------------------------------------------- */
+/*      Decode DBF attributes.                                          */
+/* -------------------------------------------------------------------- */
+        for( int iField = 0; hDBF != nullptr && iField < sHelper.nFieldCount;
+             iField++ )
+        {
+            const int iArrowField = sHelper.mapOGRFieldToArrowField[iField];
+            if( iArrowField < 0 )
+                continue;
+            auto psArray = out_array->children[iArrowField];
+
+            const OGRFieldType eType =
+                poFeatureDefn->GetFieldDefn(iField)->GetType();
+            const char* pszFieldVal = nullptr;
+            if( eType == OFTString )
+            {
+                pszFieldVal = DBFReadStringAttribute( hDBF, iShape, iField );
+                if( pszFieldVal != nullptr && pszFieldVal[0] == '\0' )
+                    pszFieldVal = nullptr;
+            }
+            else if( !DBFIsAttributeNULL( hDBF, iShape, iField ) )
+            {
+                pszFieldVal = DBFReadStringAttribute( hDBF, iShape, iField );
+                // Some DBF files have date fields filled with spaces
+                // (trimmed by DBFReadStringAttribute) to indicate null
+                // values (#4265).
+                if( eType == OFTDate && pszFieldVal != nullptr &&
+                    pszFieldVal[0] == '\0' )
+                {
+                    pszFieldVal = nullptr;
+                }
+            }
+
+            if( pszFieldVal == nullptr )
+            {
+                if( !sHelper.SetNull(iArrowField, iFeat) )
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                continue;
+            }
+
+            switch( eType )
+            {
+                case OFTString:
+                {
+                    char* pszUTF8 = nullptr;
+                    if( !osEncoding.empty() )
+                    {
+                        pszUTF8 = CPLRecode( pszFieldVal, osEncoding,
+                                             CPL_ENC_UTF8 );
+                        pszFieldVal = pszUTF8;
+                    }
+                    const size_t nLen = strlen(pszFieldVal);
+                    GByte* outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if( outPtr == nullptr )
+                    {
+                        CPLFree(pszUTF8);
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    memcpy(outPtr, pszFieldVal, nLen);
+                    CPLFree(pszUTF8);
+                    break;
+                }
+
+                case OFTInteger:
+                {
+                    const GIntBig nVal = CPLAtoGIntBig(pszFieldVal);
+                    sHelper.SetInt32(psArray, iFeat,
+                        nVal > INT_MAX ? INT_MAX :
+                        nVal < INT_MIN ? INT_MIN : static_cast<int>(nVal));
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    sHelper.SetInt64(psArray, iFeat,
+                                     CPLAtoGIntBig(pszFieldVal));
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    sHelper.SetDouble(psArray, iFeat,
+                                      CPLStrtod(pszFieldVal, nullptr));
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    OGRField sFld;
+                    SHPParseDBFDate( pszFieldVal, &sFld );
+                    sHelper.SetDate(psArray, iFeat, brokenDown, sFld);
+                    break;
+                }
+
+                default:
+                    CPLAssert( false );
+                    break;
+            }
+        }
+
+        iFeat++;
+    }
+
+    if( iFeat == 0 )
+    {
+        // End of stream
+        sHelper.ClearArray();
+        return 0;
     }
+
+    sHelper.Shrink(iFeat);
+    return 0;
+
+error:
+    sHelper.ClearArray();
+    return errorErrno;
 }
 
 /************************************************************************/
@@ -1702,6 +2068,9 @@ int OGRShapeLayer::TestCapability( const char * pszCap )
     if( EQUAL(pszCap,OLCMeasuredGeometries) )
         return TRUE;
 
+    if( EQUAL(pszCap,OLCFastGetArrowStream) )
+        return m_poAttrQuery == nullptr;
+
     if( EQUAL(pszCap,OLCZGeometries) )
         return TRUE;
 
@@ -1255,6 +1255,66 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn( const char * pszName,
     return poDefn;
 }
 
+/************************************************************************/
+/*                          SHPParseDBFDate()                           */
+/*                                                                      */
+/*      Parse a DBF date value, either in YYYYMMDD or MM/DD/YYYY form.  */
+/************************************************************************/
+
+void SHPParseDBFDate( const char *pszDateValue, OGRField *psField )
+
+{
+    memset( psField, 0, sizeof(*psField) );
+
+    if( strlen(pszDateValue) >= 10 &&
+        pszDateValue[2] == '/' && pszDateValue[5] == '/' )
+    {
+        psField->Date.Month = static_cast<GByte>(atoi(pszDateValue + 0));
+        psField->Date.Day   = static_cast<GByte>(atoi(pszDateValue + 3));
+        psField->Date.Year  = static_cast<GInt16>(atoi(pszDateValue + 6));
+    }
+    else
+    {
+        const int nFullDate = atoi(pszDateValue);
+        psField->Date.Year = static_cast<GInt16>(nFullDate / 10000);
+        psField->Date.Month = static_cast<GByte>((nFullDate / 100) % 100);
+        psField->Date.Day = static_cast<GByte>(nFullDate % 100);
+    }
+}
+
+/************************************************************************/
+/*                   SHPConformOGRObjectToLayerType()                   */
+/*                                                                      */
+/*      Set/unset the Z and M flags of a geometry read from a shape so  */
+/*      that they match the layer geometry type.                        */
+/************************************************************************/
+
+void SHPConformOGRObjectToLayerType( OGRGeometry *poGeometry,
+                                     OGRwkbGeometryType eLayerGeomType )
+
+{
+    if( eLayerGeomType == wkbUnknown )
+        return;
+
+    const OGRwkbGeometryType eGeomInType = poGeometry->getGeometryType();
+    if( wkbHasZ(eLayerGeomType) && !wkbHasZ(eGeomInType) )
+    {
+        poGeometry->set3D(TRUE);
+    }
+    else if( !wkbHasZ(eLayerGeomType) && wkbHasZ(eGeomInType) )
+    {
+        poGeometry->set3D(FALSE);
+    }
+    if( wkbHasM(eLayerGeomType) && !wkbHasM(eGeomInType) )
+    {
+        poGeometry->setMeasured(TRUE);
+    }
+    else if( !wkbHasM(eLayerGeomType) && wkbHasM(eGeomInType) )
+    {
+        poGeometry->setMeasured(FALSE);
+    }
+}
+
 /************************************************************************/
 /*                         SHPReadOGRFeature()                          */
 /************************************************************************/
@@ -1263,6 +1323,29 @@ OGRFeature *SHPReadOGRFeature( SHPHandle hSHP, DBFHandle hDBF,
                                OGRFeatureDefn * poDefn, int iShape,
                                SHPObject *psShape, const char *pszSHPEncoding )
 
+{
+    OGRFeature *poFeature = new OGRFeature( poDefn );
+    if( !SHPReadOGRFeatureInto( hSHP, hDBF, poDefn, iShape, psShape,
+                                pszSHPEncoding, poFeature ) )
+    {
+        delete poFeature;
+        return nullptr;
+    }
+    return poFeature;
+}
+
+/************************************************************************/
+/*                       SHPReadOGRFeatureInto()                        */
+/*                                                                      */
+/*      Same as SHPReadOGRFeature(), but reads into an existing         */
+/*      feature, which must be in its state after construction.         */
+/************************************************************************/
+
+bool SHPReadOGRFeatureInto( SHPHandle hSHP, DBFHandle hDBF,
+                            OGRFeatureDefn * poDefn, int iShape,
+                            SHPObject *psShape, const char *pszSHPEncoding,
+                            OGRFeature* poFeature )
+
 {
     if( iShape < 0
         || (hSHP != nullptr && iShape >= hSHP->nRecords)
@@ -1271,7 +1354,7 @@ OGRFeature *SHPReadOGRFeature( SHPHandle hSHP, DBFHandle hDBF,
         CPLError( CE_Failure, CPLE_AppDefined,
                   "Attempt to read shape with feature id (%d) out of available"
                   " range.", iShape );
-        return nullptr;
+        return false;
     }
 
     if( hDBF && DBFIsRecordDeleted( hDBF, iShape ) )
@@ -1282,11 +1365,9 @@ OGRFeature *SHPReadOGRFeature( SHPHandle hSHP, DBFHandle hDBF,
                   iShape );
         if( psShape != nullptr )
             SHPDestroyObject(psShape);
-        return nullptr;
+        return false;
     }
 
-    OGRFeature  *poFeature = new OGRFeature( poDefn );
-
 /* -------------------------------------------------------------------- */
 /*      Fetch geometry from Shapefile to OGRFeature.                    */
 /* -------------------------------------------------------------------- */
@@ -1307,31 +1388,9 @@ OGRFeature *SHPReadOGRFeature( SHPHandle hSHP, DBFHandle hDBF,
 
             if( poGeometry )
             {
-                // Set/unset flags.
-                const OGRwkbGeometryType eMyGeomType =
-                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType();
-
-                if( eMyGeomType != wkbUnknown )
-                {
-                    OGRwkbGeometryType eGeomInType =
-                        poGeometry->getGeometryType();
-                    if( wkbHasZ(eMyGeomType) && !wkbHasZ(eGeomInType) )
-                    {
-                        poGeometry->set3D(TRUE);
-                    }
-                    else if( !wkbHasZ(eMyGeomType) && wkbHasZ(eGeomInType) )
-                    {
-                        poGeometry->set3D(FALSE);
-                    }
-                    if( wkbHasM(eMyGeomType) && !wkbHasM(eGeomInType) )
-                    {
-                        poGeometry->setMeasured(TRUE);
-                    }
-                    else if( !wkbHasM(eMyGeomType) && wkbHasM(eGeomInType) )
-                    {
-                        poGeometry->setMeasured(FALSE);
-                    }
-                }
+                SHPConformOGRObjectToLayerType(
+                    poGeometry,
+                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType() );
             }
 
             poFeature->SetGeometryDirectly( poGeometry );
@@ -1412,22 +1471,7 @@ OGRFeature *SHPReadOGRFeature( SHPHandle hSHP, DBFHandle hDBF,
                   continue;
 
               OGRField sFld;
-              memset( &sFld, 0, sizeof(sFld) );
-
-              if( strlen(pszDateValue) >= 10 &&
-                  pszDateValue[2] == '/' && pszDateValue[5] == '/' )
-              {
-                  sFld.Date.Month = static_cast<GByte>(atoi(pszDateValue + 0));
-                  sFld.Date.Day   = static_cast<GByte>(atoi(pszDateValue + 3));
-                  sFld.Date.Year  = static_cast<GInt16>(atoi(pszDateValue + 6));
-              }
-              else
-              {
-                  const int nFullDate = atoi(pszDateValue);
-                  sFld.Date.Year = static_cast<GInt16>(nFullDate / 10000);
-                  sFld.Date.Month = static_cast<GByte>((nFullDate / 100) % 100);
-                  sFld.Date.Day = static_cast<GByte>(nFullDate % 100);
-              }
+              SHPParseDBFDate( pszDateValue, &sFld );
 
               poFeature->SetField( iField, &sFld );
           }
@@ -1438,10 +1482,9 @@ OGRFeature *SHPReadOGRFeature( SHPHandle hSHP, DBFHandle hDBF,
         }
     }
 
-    if( poFeature != nullptr )
-        poFeature->SetFID( iShape );
+    poFeature->SetFID( iShape );
 
-    return poFeature;
+    return true;
 }
 
 /************************************************************************/
@@ -67,6 +67,20 @@ void swqerror( swq_parse_context *context, const char *msg )
     CPLError( CE_Failure, CPLE_AppDefined, "%s", osMsg.c_str() );
 }
 
+/************************************************************************/
+/*                       swq_is_followed_by_by()                        */
+/************************************************************************/
+
+static bool swq_is_followed_by_by( const char* pszNext )
+{
+    while( *pszNext == ' ' || *pszNext == '\t'
+           || *pszNext == 10 || *pszNext == 13 )
+        pszNext++;
+    return EQUALN(pszNext, "BY", 2) &&
+           !(isalnum(pszNext[2]) || pszNext[2] == '_' ||
+             static_cast<unsigned char>(pszNext[2]) > 127);
+}
+
 /************************************************************************/
 /*                               swqlex()                               */
 /*                                                                      */
@@ -267,6 +281,10 @@ int swqlex( YYSTYPE *ppNode, swq_parse_context *context )
             nReturn = SWQT_ON;
         else if( EQUAL(osToken, "ORDER") )
             nReturn = SWQT_ORDER;
+        // GROUP is only a keyword when followed by BY, so that existing
+        // SQL using it as an unquoted column name keeps working.
+        else if( EQUAL(osToken, "GROUP") && swq_is_followed_by_by(pszNext) )
+            nReturn = SWQT_GROUP;
         else if( EQUAL(osToken, "BY") )
             nReturn = SWQT_BY;
         else if( EQUAL(osToken, "FROM") )
@@ -383,12 +401,6 @@ swq_select_summarize( swq_select *select_info,
                 select_info->column_summary[i].oSetDistinctValues =
                     std::set<CPLString, swq_summary::Comparator>(oComparator);
             }
-            select_info->column_summary[i].min =
-                std::numeric_limits<double>::infinity();
-            select_info->column_summary[i].max =
-                -std::numeric_limits<double>::infinity();
-            select_info->column_summary[i].osMin = "9999/99/99 99:99:99";
-            select_info->column_summary[i].osMax = "0000/00/00 00:00:00";
         }
         assert( !select_info->column_summary.empty() );
     }
@@ -424,6 +436,43 @@ swq_select_summarize( swq_select *select_info,
         return nullptr;
     }
 
+    return swq_summarize_value( def, summary, value );
+}
+
+/************************************************************************/
+/*                        swq_summarize_value()                         */
+/*                                                                      */
+/*      Accumulate one value of a column into a summary.  This is       */
+/*      also used for GROUP BY queries, where a summary is kept per     */
+/*      group and per column.                                           */
+/************************************************************************/
+
+const char *
+swq_summarize_value( const swq_col_def *def, swq_summary &summary,
+                     const char *value )
+
+{
+/* -------------------------------------------------------------------- */
+/*      COUNT(DISTINCT field): only the number of distinct values is   */
+/*      needed.                                                         */
+/* -------------------------------------------------------------------- */
+    if( def->distinct_flag )
+    {
+        if( value == nullptr )
+            value = SZ_OGR_NULL;
+        try
+        {
+            if( summary.oSetDistinctValues.insert(value).second )
+                summary.count ++;
+        }
+        catch( std::bad_alloc& )
+        {
+            return "Out of memory";
+        }
+
+        return nullptr;
+    }
+
 /* -------------------------------------------------------------------- */
 /*      Process various options.                                        */
 /* -------------------------------------------------------------------- */
@@ -437,7 +486,8 @@ swq_select_summarize( swq_select *select_info,
                 def->field_type == SWQ_TIME ||
                 def->field_type == SWQ_TIMESTAMP )
             {
-                if( strcmp( value, summary.osMin ) < 0 )
+                if( summary.osMin.empty() ||
+                    strcmp( value, summary.osMin ) < 0 )
                 {
                     summary.osMin = value;
                 }
@@ -458,7 +508,8 @@ swq_select_summarize( swq_select *select_info,
                 def->field_type == SWQ_TIME ||
                 def->field_type == SWQ_TIMESTAMP )
             {
-                if( strcmp( value, summary.osMax ) > 0 )
+                if( summary.osMax.empty() ||
+                    strcmp( value, summary.osMax ) > 0 )
                 {
                     summary.osMax = value;
                 }
@@ -206,7 +206,8 @@ extern int swqdebug;
     SWQT_OR = 289,
     SWQT_AND = 290,
     SWQT_UMINUS = 291,
-    SWQT_RESERVED_KEYWORD = 292
+    SWQT_RESERVED_KEYWORD = 292,
+    SWQT_GROUP = 293
   };
 #endif
 
@@ -527,19 +528,19 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  20
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   401
+#define YYLAST   404
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  51
+#define YYNTOKENS  52
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  22
+#define YYNNTS  25
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  95
+#define YYNRULES  100
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  201
+#define YYNSTATES  210
 
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   292
+#define YYMAXUTOK   293
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -555,7 +556,7 @@ static const yytype_int8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,    39,     2,     2,     2,    44,     2,     2,
-      47,    48,    42,    40,    49,    41,    50,    43,     2,     2,
+      48,    49,    42,    40,    50,    41,    51,    43,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
       37,    36,    38,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -580,23 +581,24 @@ static const yytype_int8 yytranslate[] =
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    45,    46
+      35,    45,    46,    47
 };
 
 #if YYDEBUG
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   122,   122,   123,   129,   136,   141,   146,   151,   158,
-     166,   174,   182,   190,   198,   206,   214,   222,   230,   238,
-     250,   259,   272,   280,   292,   301,   314,   323,   336,   345,
-     358,   365,   377,   383,   390,   398,   411,   416,   421,   425,
-     430,   435,   440,   475,   482,   489,   496,   503,   510,   546,
-     554,   560,   567,   576,   594,   614,   615,   618,   623,   629,
-     630,   632,   640,   641,   644,   653,   664,   679,   700,   731,
-     766,   791,   820,   826,   828,   829,   834,   835,   841,   848,
-     849,   852,   853,   856,   862,   868,   875,   876,   883,   884,
-     892,   902,   913,   924,   937,   948
+       0,   125,   125,   126,   132,   139,   144,   149,   154,   161,
+     169,   177,   185,   193,   201,   209,   217,   225,   233,   241,
+     253,   262,   275,   283,   295,   304,   317,   326,   339,   348,
+     361,   368,   380,   386,   393,   401,   414,   419,   424,   428,
+     433,   438,   443,   478,   485,   492,   499,   506,   513,   549,
+     557,   563,   570,   579,   597,   617,   618,   621,   626,   632,
+     633,   635,   643,   644,   647,   656,   667,   682,   703,   734,
+     769,   794,   823,   829,   831,   832,   837,   838,   844,   851,
+     852,   855,   856,   859,   866,   867,   870,   871,   874,   880,
+     886,   893,   894,   901,   902,   910,   920,   931,   942,   955,
+     966
 };
 #endif
 
@@ -613,12 +615,13 @@ static const char *const yytname[] =
   "\"DISTINCT\"", "\"CAST\"", "\"UNION\"", "\"ALL\"", "\"LIMIT\"",
   "\"OFFSET\"", "SWQT_VALUE_START", "SWQT_SELECT_START", "\"NOT\"",
   "\"OR\"", "\"AND\"", "'='", "'<'", "'>'", "'!'", "'+'", "'-'", "'*'",
-  "'/'", "'%'", "SWQT_UMINUS", "\"reserved keyword\"", "'('", "')'", "','",
-  "'.'", "$accept", "input", "value_expr", "value_expr_list",
+  "'/'", "'%'", "SWQT_UMINUS", "\"reserved keyword\"", "\"GROUP\"", "'('",
+  "')'", "','", "'.'", "$accept", "input", "value_expr", "value_expr_list",
   "field_value", "value_expr_non_logical", "type_def", "select_statement",
   "select_core", "opt_union_all", "union_all", "select_field_list",
-  "column_spec", "as_clause", "opt_where", "opt_joins", "opt_order_by",
-  "sort_spec_list", "sort_spec", "opt_limit", "opt_offset", "table_def", YY_NULLPTR
+  "column_spec", "as_clause", "opt_where", "opt_joins", "opt_group_by",
+  "group_spec_list", "group_spec", "opt_order_by", "sort_spec_list",
+  "sort_spec", "opt_limit", "opt_offset", "table_def", YY_NULLPTR
 };
 #endif
 
@@ -631,12 +634,12 @@ static const yytype_int16 yytoknum[] =
      265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,    61,    60,    62,    33,
-      43,    45,    42,    47,    37,   291,   292,    40,    41,    44,
-      46
+      43,    45,    42,    47,    37,   291,   292,   293,    40,    41,
+      44,    46
 };
 # endif
 
-#define YYPACT_NINF (-133)
+#define YYPACT_NINF (-127)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -650,27 +653,27 @@ static const yytype_int16 yytoknum[] =
      STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     -19,   197,    -7,     1,  -133,  -133,  -133,   -42,  -133,   -28,
-     197,   207,   197,   329,  -133,   184,    77,    11,  -133,     2,
-    -133,   197,    25,   197,   362,  -133,   261,    -8,   197,   197,
-     207,     9,   249,   197,   197,    89,   102,   157,    36,   207,
-     207,   207,   207,   207,   -27,   173,  -133,   279,    56,    30,
-      38,    60,  -133,    -7,   228,    42,  -133,   313,  -133,   197,
-      88,    94,   104,  -133,    99,    73,   197,   197,   207,   346,
-     242,   197,   197,  -133,   197,   197,  -133,   197,  -133,   197,
-      20,    20,  -133,  -133,  -133,   147,    -4,   100,  -133,   117,
-    -133,    63,   173,     2,  -133,  -133,   197,  -133,   119,    81,
-     197,   197,   207,  -133,   197,   123,   124,   351,  -133,  -133,
-    -133,  -133,  -133,  -133,   131,   106,  -133,    63,  -133,    92,
-       4,    69,  -133,  -133,  -133,   108,   110,  -133,  -133,  -133,
-     184,   116,   197,   197,   207,   115,   120,     8,    69,   150,
-     161,  -133,   154,    63,   164,    54,  -133,  -133,  -133,  -133,
-     184,     8,  -133,   164,     8,     8,    63,   153,   197,   155,
-      48,    64,  -133,   155,  -133,  -133,   166,   197,   329,   162,
-     158,  -133,   183,  -133,   188,   158,   197,   295,   131,   189,
-     165,   148,   149,   165,   295,  -133,    93,  -133,   156,  -133,
-     204,  -133,  -133,  -133,  -133,  -133,  -133,  -133,   131,  -133,
-    -133
+      53,   201,    -8,    14,  -127,  -127,  -127,   -35,  -127,   -47,
+     201,   206,   201,   318,  -127,   306,    77,    11,  -127,     3,
+    -127,   201,    33,   201,   365,  -127,   230,    -7,   201,   201,
+     206,    -2,   190,   201,   201,    89,   102,   167,     9,   206,
+     206,   206,   206,   206,     8,   148,  -127,   267,    34,    13,
+      20,    44,  -127,    -8,   222,    28,  -127,   285,  -127,   201,
+      80,    86,   121,  -127,    92,    50,   201,   201,   206,   325,
+     332,   201,   201,  -127,   201,   201,  -127,   201,  -127,   201,
+     -23,   -23,  -127,  -127,  -127,   143,    -4,   108,  -127,   107,
+    -127,    82,   148,     3,  -127,  -127,   201,  -127,   127,    85,
+     201,   201,   206,  -127,   201,   126,   129,   179,  -127,  -127,
+    -127,  -127,  -127,  -127,   136,    95,  -127,    82,  -127,    94,
+       2,    96,  -127,  -127,  -127,   110,   118,  -127,  -127,  -127,
+     306,   128,   201,   201,   206,   131,   134,     1,    96,   153,
+     172,  -127,   164,    82,   169,    61,  -127,  -127,  -127,  -127,
+     306,     1,  -127,   169,     1,     1,    82,   170,   201,   140,
+      67,    71,  -127,   140,  -127,  -127,   174,   201,   318,   175,
+     183,  -127,   191,  -127,   213,   183,   201,   275,   136,   197,
+     195,   176,   177,   195,   275,  -127,  -127,  -127,   178,   136,
+     233,   210,  -127,  -127,   210,  -127,   136,   100,  -127,   194,
+    -127,   242,  -127,  -127,  -127,  -127,  -127,   136,  -127,  -127
 };
 
   /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -690,23 +693,23 @@ static const yytype_int8 yydefact[] =
       65,     0,     0,    59,    61,    60,     0,    48,     0,     0,
        0,     0,     0,    31,     0,    19,    23,     0,    15,    16,
       14,    10,    17,    11,     0,     0,    67,     0,    72,     0,
-      90,    76,    63,    56,    32,    50,     0,    26,    20,    24,
+      95,    76,    63,    56,    32,    50,     0,    26,    20,    24,
       28,     0,     0,     0,     0,    34,     0,    68,    76,     0,
-       0,    91,     0,     0,    74,     0,    49,    27,    21,    25,
-      29,    70,    69,    74,    92,    94,     0,     0,     0,    79,
-       0,     0,    71,    79,    93,    95,     0,     0,    75,     0,
-      86,    51,     0,    53,     0,    86,     0,    76,     0,     0,
-      88,     0,     0,    88,    76,    77,    83,    80,    82,    87,
-       0,    57,    52,    54,    58,    78,    84,    85,     0,    89,
-      81
+       0,    96,     0,     0,    74,     0,    49,    27,    21,    25,
+      29,    70,    69,    74,    97,    99,     0,     0,     0,    79,
+       0,     0,    71,    79,    98,   100,     0,     0,    75,     0,
+      84,    51,     0,    53,     0,    84,     0,    76,     0,     0,
+      91,     0,     0,    91,    76,    77,    83,    80,    82,     0,
+       0,    93,    52,    54,    93,    78,     0,    88,    85,    87,
+      92,     0,    57,    58,    81,    89,    90,     0,    94,    86
 };
 
   /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -133,  -133,    -1,   -43,  -111,     7,  -133,   163,   191,   125,
-    -133,   -41,  -133,   -96,    68,  -132,    59,    19,  -133,    57,
-      46,  -100
+    -127,  -127,    -1,   -42,  -110,     7,  -127,   193,   231,   157,
+    -127,   -40,  -127,   -94,    98,  -126,    90,    56,  -127,    87,
+      63,  -127,    88,    83,  -114
 };
 
   /* YYDEFGOTO[NTERM-NUM].  */
@@ -714,7 +717,7 @@ static const yytype_int16 yydefgoto[] =
 {
       -1,     3,    54,    55,    14,    15,   126,    18,    19,    52,
       53,    48,    49,    90,   159,   144,   170,   187,   188,   180,
-     191,   121
+     198,   199,   191,   202,   121
 };
 
   /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -722,134 +725,135 @@ static const yytype_int16 yydefgoto[] =
      number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_uint8 yytable[] =
 {
-      13,    20,    56,   136,    87,    21,   153,    16,    22,    24,
-      88,    26,     1,     2,    88,    47,    99,   138,    25,    23,
-      85,    63,    57,    86,   141,    16,    89,    60,    61,    51,
-      89,    56,    69,    70,    73,    76,    78,    62,   116,    59,
-      17,   152,    64,   157,    47,   185,    80,    81,    82,    83,
-      84,   122,   195,   124,   140,   162,   166,   160,   164,   165,
-     161,   131,    41,    42,    43,   105,   106,   186,   119,   120,
-     108,   109,    79,   110,   111,   107,   112,    91,   113,    92,
-       4,     5,     6,    44,   142,   143,    93,   186,    94,     8,
-      97,    47,     4,     5,     6,     7,   171,   172,   100,   128,
-     129,     8,    45,     9,   101,     4,     5,     6,     7,   130,
-      10,   103,   173,   174,     8,     9,   196,   197,    11,    46,
-     104,   117,    10,   118,    12,   125,    71,    72,     9,   127,
-      11,   148,   149,   132,   133,    10,    12,   135,    74,   102,
-      75,   150,   139,    11,    39,    40,    41,    42,    43,    12,
-       4,     5,     6,     7,   137,   145,   154,   168,   146,     8,
-       4,     5,     6,     7,   147,    22,   177,   155,   151,     8,
-     156,   167,   114,     9,   169,   184,     4,     5,     6,    44,
-      10,   158,   178,     9,   176,     8,   181,   179,    11,   115,
-      10,   182,   189,    77,    12,   190,   192,   193,    11,     9,
-       4,     5,     6,     7,    12,   198,    10,   199,    50,     8,
-       4,     5,     6,     7,    11,    46,    95,   200,   123,     8,
-      12,   163,   175,     9,    39,    40,    41,    42,    43,   194,
-      10,     0,   183,     9,     0,    27,    28,    29,    11,    30,
-       0,    31,     0,     0,    12,     0,     0,     0,    11,    27,
-      28,    29,     0,    30,    12,    31,    65,    66,    67,     0,
-      68,    32,    33,    34,    35,    36,    37,    38,    27,    28,
-      29,     0,    30,     0,    31,    32,     0,    96,    35,    36,
-      37,    38,     0,     0,     0,    88,    27,    28,    29,     0,
-      30,     0,    31,     0,    32,    33,    34,    35,    36,    37,
-      38,    89,    27,    28,    29,     0,    30,     0,    31,    58,
-     142,   143,    32,    33,    34,    35,    36,    37,    38,     0,
-      27,    28,    29,     0,    30,     0,    31,     0,    32,    33,
-      34,    35,    36,    37,    38,    98,    27,    28,    29,     0,
-      30,     0,    31,     0,     0,     0,    32,    33,    34,    35,
-      36,    37,    38,    27,    28,    29,     0,    30,     0,    31,
-       0,     0,    32,    33,    34,    35,    36,    37,    38,    27,
-      28,    29,     0,    30,     0,    31,     0,     0,     0,    32,
-       0,    34,    35,    36,    37,    38,   134,     0,     0,     0,
-       0,    39,    40,    41,    42,    43,     0,     0,    35,    36,
-      37,    38
+      13,    23,    56,   138,   136,    87,    16,    88,    88,    24,
+      63,    26,   153,    21,    20,    47,    22,    99,    25,    41,
+      42,    43,    57,    89,    89,    16,   141,    60,    61,   157,
+      51,    64,    69,    70,    73,    76,    78,    62,   116,    56,
+      17,    59,   166,   152,    47,    79,    80,    81,    82,    83,
+      84,   185,   122,   140,   124,    91,    85,   162,   195,    86,
+     164,   165,   131,    92,   160,   105,   106,   161,   186,    93,
+     108,   109,    94,   110,   111,   107,   112,    97,   113,   197,
+       4,     5,     6,    44,     1,     2,   186,   119,   120,     8,
+     100,    47,     4,     5,     6,     7,   101,   197,   104,   128,
+     129,     8,    45,     9,   103,     4,     5,     6,     7,   130,
+      10,   142,   143,   118,     8,     9,   171,   172,    11,    46,
+     173,   174,    10,   205,   206,    12,    71,    72,     9,   117,
+      11,   148,   149,   125,   127,    10,   132,    12,    74,   133,
+      75,   150,   135,    11,   137,   139,     4,     5,     6,     7,
+      12,     4,     5,     6,    44,     8,   102,   168,   145,   154,
+       8,    39,    40,    41,    42,    43,   177,   146,   114,     9,
+       4,     5,     6,     7,     9,   184,    10,   147,   155,     8,
+     156,    10,    22,   151,    11,   115,   158,   169,   167,    11,
+      46,    12,   176,     9,   181,   178,    12,    65,    66,    67,
+      10,    68,   179,    77,     4,     5,     6,     7,    11,     4,
+       5,     6,     7,     8,   134,    12,   182,   189,     8,    39,
+      40,    41,    42,    43,   190,   192,   193,     9,   196,    27,
+      28,    29,     9,    30,    10,    31,   200,    27,    28,    29,
+     201,    30,    11,    31,   207,   208,    95,    11,    50,    12,
+     123,   163,   204,   175,    12,    32,    33,    34,    35,    36,
+      37,    38,   183,    32,    33,    34,    35,    36,    37,    38,
+     209,   194,    96,    88,    27,    28,    29,   203,    30,    58,
+      31,     0,    27,    28,    29,     0,    30,     0,    31,    89,
+     142,   143,    27,    28,    29,     0,    30,     0,    31,     0,
+      32,    33,    34,    35,    36,    37,    38,    98,    32,    33,
+      34,    35,    36,    37,    38,     0,     0,     0,    32,    33,
+      34,    35,    36,    37,    38,    27,    28,    29,     0,    30,
+       0,    31,    27,    28,    29,     0,    30,     0,    31,    27,
+      28,    29,     0,    30,     0,    31,    39,    40,    41,    42,
+      43,    32,    33,    34,    35,    36,    37,    38,    32,     0,
+      34,    35,    36,    37,    38,    32,     0,     0,    35,    36,
+      37,    38,    27,    28,    29,     0,    30,     0,    31,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    35,    36,    37,    38
 };
 
 static const yytype_int16 yycheck[] =
 {
-       1,     0,     6,   114,    45,    47,   138,    14,    50,    10,
-       6,    12,    31,    32,     6,    16,    59,   117,    11,    47,
-      47,    12,    23,    50,   120,    14,    22,    28,    29,    27,
-      22,     6,    33,    34,    35,    36,    37,    30,    42,    47,
-      47,   137,    33,   143,    45,   177,    39,    40,    41,    42,
-      43,    92,   184,    96,    50,   151,   156,     3,   154,   155,
-       6,   104,    42,    43,    44,    66,    67,   178,     5,     6,
-      71,    72,    36,    74,    75,    68,    77,    21,    79,    49,
-       3,     4,     5,     6,    15,    16,    48,   198,    28,    12,
-      48,    92,     3,     4,     5,     6,    48,    49,    10,   100,
-     101,    12,    25,    26,    10,     3,     4,     5,     6,   102,
-      33,    12,    48,    49,    12,    26,    23,    24,    41,    42,
-      47,    21,    33,     6,    47,     6,    37,    38,    26,    48,
-      41,   132,   133,    10,    10,    33,    47,     6,    36,    35,
-      38,   134,    50,    41,    40,    41,    42,    43,    44,    47,
-       3,     4,     5,     6,    48,    47,     6,   158,    48,    12,
-       3,     4,     5,     6,    48,    50,   167,     6,    48,    12,
-      16,    18,    25,    26,    19,   176,     3,     4,     5,     6,
-      33,    17,    20,    26,    18,    12,     3,    29,    41,    42,
-      33,     3,     3,    36,    47,    30,    48,    48,    41,    26,
-       3,     4,     5,     6,    47,    49,    33,     3,    17,    12,
-       3,     4,     5,     6,    41,    42,    53,   198,    93,    12,
-      47,   153,   163,    26,    40,    41,    42,    43,    44,   183,
-      33,    -1,   175,    26,    -1,     7,     8,     9,    41,    11,
-      -1,    13,    -1,    -1,    47,    -1,    -1,    -1,    41,     7,
-       8,     9,    -1,    11,    47,    13,     7,     8,     9,    -1,
-      11,    33,    34,    35,    36,    37,    38,    39,     7,     8,
-       9,    -1,    11,    -1,    13,    33,    -1,    49,    36,    37,
-      38,    39,    -1,    -1,    -1,     6,     7,     8,     9,    -1,
-      11,    -1,    13,    -1,    33,    34,    35,    36,    37,    38,
-      39,    22,     7,     8,     9,    -1,    11,    -1,    13,    48,
-      15,    16,    33,    34,    35,    36,    37,    38,    39,    -1,
-       7,     8,     9,    -1,    11,    -1,    13,    -1,    33,    34,
-      35,    36,    37,    38,    39,    22,     7,     8,     9,    -1,
-      11,    -1,    13,    -1,    -1,    -1,    33,    34,    35,    36,
-      37,    38,    39,     7,     8,     9,    -1,    11,    -1,    13,
-      -1,    -1,    33,    34,    35,    36,    37,    38,    39,     7,
-       8,     9,    -1,    11,    -1,    13,    -1,    -1,    -1,    33,
-      -1,    35,    36,    37,    38,    39,    35,    -1,    -1,    -1,
-      -1,    40,    41,    42,    43,    44,    -1,    -1,    36,    37,
-      38,    39
+       1,    48,     6,   117,   114,    45,    14,     6,     6,    10,
+      12,    12,   138,    48,     0,    16,    51,    59,    11,    42,
+      43,    44,    23,    22,    22,    14,   120,    28,    29,   143,
+      27,    33,    33,    34,    35,    36,    37,    30,    42,     6,
+      48,    48,   156,   137,    45,    36,    39,    40,    41,    42,
+      43,   177,    92,    51,    96,    21,    48,   151,   184,    51,
+     154,   155,   104,    50,     3,    66,    67,     6,   178,    49,
+      71,    72,    28,    74,    75,    68,    77,    49,    79,   189,
+       3,     4,     5,     6,    31,    32,   196,     5,     6,    12,
+      10,    92,     3,     4,     5,     6,    10,   207,    48,   100,
+     101,    12,    25,    26,    12,     3,     4,     5,     6,   102,
+      33,    15,    16,     6,    12,    26,    49,    50,    41,    42,
+      49,    50,    33,    23,    24,    48,    37,    38,    26,    21,
+      41,   132,   133,     6,    49,    33,    10,    48,    36,    10,
+      38,   134,     6,    41,    49,    51,     3,     4,     5,     6,
+      48,     3,     4,     5,     6,    12,    35,   158,    48,     6,
+      12,    40,    41,    42,    43,    44,   167,    49,    25,    26,
+       3,     4,     5,     6,    26,   176,    33,    49,     6,    12,
+      16,    33,    51,    49,    41,    42,    17,    47,    18,    41,
+      42,    48,    18,    26,     3,    20,    48,     7,     8,     9,
+      33,    11,    19,    36,     3,     4,     5,     6,    41,     3,
+       4,     5,     6,    12,    35,    48,     3,    20,    12,    40,
+      41,    42,    43,    44,    29,    49,    49,    26,    50,     7,
+       8,     9,    26,    11,    33,    13,     3,     7,     8,     9,
+      30,    11,    41,    13,    50,     3,    53,    41,    17,    48,
+      93,   153,   196,   163,    48,    33,    34,    35,    36,    37,
+      38,    39,   175,    33,    34,    35,    36,    37,    38,    39,
+     207,   183,    50,     6,     7,     8,     9,   194,    11,    49,
+      13,    -1,     7,     8,     9,    -1,    11,    -1,    13,    22,
+      15,    16,     7,     8,     9,    -1,    11,    -1,    13,    -1,
+      33,    34,    35,    36,    37,    38,    39,    22,    33,    34,
+      35,    36,    37,    38,    39,    -1,    -1,    -1,    33,    34,
+      35,    36,    37,    38,    39,     7,     8,     9,    -1,    11,
+      -1,    13,     7,     8,     9,    -1,    11,    -1,    13,     7,
+       8,     9,    -1,    11,    -1,    13,    40,    41,    42,    43,
+      44,    33,    34,    35,    36,    37,    38,    39,    33,    -1,
+      35,    36,    37,    38,    39,    33,    -1,    -1,    36,    37,
+      38,    39,     7,     8,     9,    -1,    11,    -1,    13,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    36,    37,    38,    39
 };
 
   /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
      symbol of state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
-       0,    31,    32,    52,     3,     4,     5,     6,    12,    26,
-      33,    41,    47,    53,    55,    56,    14,    47,    58,    59,
-       0,    47,    50,    47,    53,    56,    53,     7,     8,     9,
+       0,    31,    32,    53,     3,     4,     5,     6,    12,    26,
+      33,    41,    48,    54,    56,    57,    14,    48,    59,    60,
+       0,    48,    51,    48,    54,    57,    54,     7,     8,     9,
       11,    13,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,     6,    25,    42,    53,    62,    63,
-      59,    27,    60,    61,    53,    54,     6,    53,    48,    47,
-      53,    53,    56,    12,    33,     7,     8,     9,    11,    53,
-      53,    37,    38,    53,    36,    38,    53,    36,    53,    36,
-      56,    56,    56,    56,    56,    47,    50,    62,     6,    22,
-      64,    21,    49,    48,    28,    58,    49,    48,    22,    54,
-      10,    10,    35,    12,    47,    53,    53,    56,    53,    53,
-      53,    53,    53,    53,    25,    42,    42,    21,     6,     5,
-       6,    72,    62,    60,    54,     6,    57,    48,    53,    53,
-      56,    54,    10,    10,    35,     6,    55,    48,    72,    50,
-      50,    64,    15,    16,    66,    47,    48,    48,    53,    53,
-      56,    48,    64,    66,     6,     6,    16,    72,    17,    65,
-       3,     6,    64,    65,    64,    64,    72,    18,    53,    19,
-      67,    48,    49,    48,    49,    67,    18,    53,    20,    29,
-      70,     3,     3,    70,    53,    66,    55,    68,    69,     3,
-      30,    71,    48,    48,    71,    66,    23,    24,    49,     3,
-      68
+      41,    42,    43,    44,     6,    25,    42,    54,    63,    64,
+      60,    27,    61,    62,    54,    55,     6,    54,    49,    48,
+      54,    54,    57,    12,    33,     7,     8,     9,    11,    54,
+      54,    37,    38,    54,    36,    38,    54,    36,    54,    36,
+      57,    57,    57,    57,    57,    48,    51,    63,     6,    22,
+      65,    21,    50,    49,    28,    59,    50,    49,    22,    55,
+      10,    10,    35,    12,    48,    54,    54,    57,    54,    54,
+      54,    54,    54,    54,    25,    42,    42,    21,     6,     5,
+       6,    76,    63,    61,    55,     6,    58,    49,    54,    54,
+      57,    55,    10,    10,    35,     6,    56,    49,    76,    51,
+      51,    65,    15,    16,    67,    48,    49,    49,    54,    54,
+      57,    49,    65,    67,     6,     6,    16,    76,    17,    66,
+       3,     6,    65,    66,    65,    65,    76,    18,    54,    47,
+      68,    49,    50,    49,    50,    68,    18,    54,    20,    19,
+      71,     3,     3,    71,    54,    67,    56,    69,    70,    20,
+      29,    74,    49,    49,    74,    67,    50,    56,    72,    73,
+       3,    30,    75,    75,    69,    23,    24,    50,     3,    72
 };
 
   /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_int8 yyr1[] =
 {
-       0,    51,    52,    52,    52,    53,    53,    53,    53,    53,
-      53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
-      53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
-      53,    53,    54,    54,    55,    55,    56,    56,    56,    56,
-      56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
-      57,    57,    57,    57,    57,    58,    58,    59,    59,    60,
-      60,    61,    62,    62,    63,    63,    63,    63,    63,    63,
-      63,    63,    64,    64,    65,    65,    66,    66,    66,    67,
-      67,    68,    68,    69,    69,    69,    70,    70,    71,    71,
-      72,    72,    72,    72,    72,    72
+       0,    52,    53,    53,    53,    54,    54,    54,    54,    54,
+      54,    54,    54,    54,    54,    54,    54,    54,    54,    54,
+      54,    54,    54,    54,    54,    54,    54,    54,    54,    54,
+      54,    54,    55,    55,    56,    56,    57,    57,    57,    57,
+      57,    57,    57,    57,    57,    57,    57,    57,    57,    57,
+      58,    58,    58,    58,    58,    59,    59,    60,    60,    61,
+      61,    62,    63,    63,    64,    64,    64,    64,    64,    64,
+      64,    64,    65,    65,    66,    66,    67,    67,    67,    68,
+      68,    69,    69,    70,    71,    71,    72,    72,    73,    73,
+      73,    74,    74,    75,    75,    76,    76,    76,    76,    76,
+      76
 };
 
   /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
@@ -860,11 +864,12 @@ static const yytype_int8 yyr2[] =
        5,     6,     3,     4,     5,     6,     5,     6,     5,     6,
        3,     4,     3,     1,     1,     3,     1,     1,     1,     1,
        3,     1,     2,     3,     3,     3,     3,     3,     4,     6,
-       1,     4,     6,     4,     6,     2,     4,     9,    10,     0,
+       1,     4,     6,     4,     6,     2,     4,    10,    11,     0,
        2,     2,     1,     3,     1,     2,     1,     3,     4,     5,
        5,     6,     2,     1,     0,     2,     0,     5,     6,     0,
-       3,     3,     1,     1,     2,     2,     0,     2,     0,     2,
-       1,     2,     3,     4,     3,     4
+       3,     3,     1,     1,     0,     3,     3,     1,     1,     2,
+       2,     0,     2,     0,     2,     1,     2,     3,     4,     3,
+       4
 };
 
 
@@ -1317,27 +1322,27 @@ yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, swq_parse_context
             { delete (*yyvaluep); }
         break;
 
-    case 53: /* value_expr  */
+    case 54: /* value_expr  */
             { delete (*yyvaluep); }
         break;
 
-    case 54: /* value_expr_list  */
+    case 55: /* value_expr_list  */
             { delete (*yyvaluep); }
         break;
 
-    case 55: /* field_value  */
+    case 56: /* field_value  */
             { delete (*yyvaluep); }
         break;
 
-    case 56: /* value_expr_non_logical  */
+    case 57: /* value_expr_non_logical  */
             { delete (*yyvaluep); }
         break;
 
-    case 57: /* type_def  */
+    case 58: /* type_def  */
             { delete (*yyvaluep); }
         break;
 
-    case 72: /* table_def  */
+    case 76: /* table_def  */
             { delete (*yyvaluep); }
         break;
 
@@ -2147,14 +2152,14 @@ yyreduce:
 
   case 57:
     {
-        delete yyvsp[-5];
+        delete yyvsp[-6];
     }
     break;
 
   case 58:
     {
         context->poCurSelect->query_mode = SWQM_DISTINCT_LIST;
-        delete yyvsp[-5];
+        delete yyvsp[-6];
     }
     break;
 
@@ -2379,6 +2384,14 @@ yyreduce:
     break;
 
   case 83:
+        {
+            context->poCurSelect->PushGroupBy( yyvsp[0]->table_name, yyvsp[0]->string_value );
+            delete yyvsp[0];
+            yyvsp[0] = nullptr;
+        }
+    break;
+
+  case 88:
         {
             context->poCurSelect->PushOrderBy( yyvsp[0]->table_name, yyvsp[0]->string_value, TRUE );
             delete yyvsp[0];
@@ -2386,7 +2399,7 @@ yyreduce:
         }
     break;
 
-  case 84:
+  case 89:
         {
             context->poCurSelect->PushOrderBy( yyvsp[-1]->table_name, yyvsp[-1]->string_value, TRUE );
             delete yyvsp[-1];
@@ -2394,7 +2407,7 @@ yyreduce:
         }
     break;
 
-  case 85:
+  case 90:
         {
             context->poCurSelect->PushOrderBy( yyvsp[-1]->table_name, yyvsp[-1]->string_value, FALSE );
             delete yyvsp[-1];
@@ -2402,7 +2415,7 @@ yyreduce:
         }
     break;
 
-  case 87:
+  case 92:
     {
         context->poCurSelect->SetLimit( yyvsp[0]->int_value );
         delete yyvsp[0];
@@ -2410,7 +2423,7 @@ yyreduce:
     }
     break;
 
-  case 89:
+  case 94:
     {
         context->poCurSelect->SetOffset( yyvsp[0]->int_value );
         delete yyvsp[0];
@@ -2418,7 +2431,7 @@ yyreduce:
     }
     break;
 
-  case 90:
+  case 95:
     {
         const int iTable =
             context->poCurSelect->PushTableDef( nullptr, yyvsp[0]->string_value,
@@ -2429,7 +2442,7 @@ yyreduce:
     }
     break;
 
-  case 91:
+  case 96:
     {
         const int iTable =
             context->poCurSelect->PushTableDef( nullptr, yyvsp[-1]->string_value,
@@ -2441,7 +2454,7 @@ yyreduce:
     }
     break;
 
-  case 92:
+  case 97:
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-2]->string_value,
@@ -2453,7 +2466,7 @@ yyreduce:
     }
     break;
 
-  case 93:
+  case 98:
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-3]->string_value,
@@ -2467,7 +2480,7 @@ yyreduce:
     }
     break;
 
-  case 94:
+  case 99:
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-2]->string_value,
@@ -2479,7 +2492,7 @@ yyreduce:
     }
     break;
 
-  case 95:
+  case 100:
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-3]->string_value,
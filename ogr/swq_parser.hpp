@@ -84,7 +84,8 @@ extern int swqdebug;
     SWQT_OR = 289,
     SWQT_AND = 290,
     SWQT_UMINUS = 291,
-    SWQT_RESERVED_KEYWORD = 292
+    SWQT_RESERVED_KEYWORD = 292,
+    SWQT_GROUP = 293
   };
 #endif
 
@@ -88,6 +88,14 @@ swq_select::~swq_select()
 
     CPLFree( order_defs );
 
+    for( int i = 0; i < group_specs; i++ )
+    {
+        CPLFree( group_defs[i].table_name );
+        CPLFree( group_defs[i].field_name );
+    }
+
+    CPLFree( group_defs );
+
     for( int i = 0; i < join_count; i++ )
     {
         delete join_defs[i].poExpr;
@@ -269,6 +277,18 @@ void swq_select::Dump( FILE *fp )
         where_expr->Dump( fp, 2 );
     }
 
+/* -------------------------------------------------------------------- */
+/*      Group by                                                        */
+/* -------------------------------------------------------------------- */
+
+    for( int i = 0; i < group_specs; i++ )
+    {
+        fprintf( fp, "  GROUP BY: %s (%d/%d)\n",
+                 group_defs[i].field_name,
+                 group_defs[i].table_index,
+                 group_defs[i].field_index );
+    }
+
 /* -------------------------------------------------------------------- */
 /*      Order by                                                        */
 /* -------------------------------------------------------------------- */
@@ -396,6 +416,20 @@ char* swq_select::Unparse()
         CPLFree(pszTmp);
     }
 
+    for( int i = 0; i < group_specs; i++ )
+    {
+        osSelect += (i == 0) ? " GROUP BY " : ", ";
+        if( group_defs[i].table_name != nullptr &&
+            group_defs[i].table_name[0] != '\0' )
+        {
+            osSelect +=
+                swq_expr_node::QuoteIfNecessary(group_defs[i].table_name, '"');
+            osSelect += ".";
+        }
+        osSelect +=
+            swq_expr_node::QuoteIfNecessary(group_defs[i].field_name, '"');
+    }
+
     for( int i = 0; i < order_specs; i++ )
     {
         osSelect += " ORDER BY ";
@@ -744,6 +778,25 @@ void swq_select::PushOrderBy( const char* pszTableName,
     order_defs[order_specs-1].ascending_flag = bAscending;
 }
 
+/************************************************************************/
+/*                            PushGroupBy()                             */
+/************************************************************************/
+
+void swq_select::PushGroupBy( const char* pszTableName,
+                              const char *pszFieldName )
+
+{
+    group_specs++;
+    group_defs = static_cast<swq_group_def *>(
+        CPLRealloc(group_defs, sizeof(swq_group_def) * group_specs));
+
+    group_defs[group_specs-1].table_name =
+        CPLStrdup(pszTableName ? pszTableName : "");
+    group_defs[group_specs-1].field_name = CPLStrdup(pszFieldName);
+    group_defs[group_specs-1].table_index = -1;
+    group_defs[group_specs-1].field_index = -1;
+}
+
 /************************************************************************/
 /*                              PushJoin()                              */
 /************************************************************************/
@@ -1019,6 +1072,28 @@ static bool CheckCompatibleJoinExpr( swq_expr_node* poExpr,
     return false;
 }
 
+/************************************************************************/
+/*                            FindGroupBy()                             */
+/*                                                                      */
+/*      Return the index of the GROUP BY spec matching a column, or     */
+/*      -1 if the column is not a grouping column.                      */
+/************************************************************************/
+
+int swq_select::FindGroupBy( const swq_expr_node* poExpr,
+                             int table_index, int field_index ) const
+{
+    if( poExpr != nullptr && poExpr->eNodeType != SNT_COLUMN )
+        return -1;
+
+    for( int i = 0; i < group_specs; i++ )
+    {
+        if( group_defs[i].table_index == table_index &&
+            group_defs[i].field_index == field_index )
+            return i;
+    }
+    return -1;
+}
+
 /************************************************************************/
 /*                               parse()                                */
 /*                                                                      */
@@ -1100,10 +1175,56 @@ CPLErr swq_select::parse( swq_field_list *field_list,
         }
     }
 
+/* -------------------------------------------------------------------- */
+/*      Process column names in GROUP BY specs.                         */
+/* -------------------------------------------------------------------- */
+    if( group_specs > 0 && query_mode == SWQM_DISTINCT_LIST )
+    {
+        CPLError( CE_Failure, CPLE_NotSupported,
+                  "SELECT DISTINCT and GROUP BY not supported together." );
+        return CE_Failure;
+    }
+
+    if( group_specs > 0 && join_count > 0 )
+    {
+        CPLError( CE_Failure, CPLE_NotSupported,
+                  "GROUP BY not supported together with JOIN." );
+        return CE_Failure;
+    }
+
+    for( int i = 0; i < group_specs; i++ )
+    {
+        swq_group_def *def = group_defs + i;
+
+        // Identify field.
+        swq_field_type field_type;
+        def->field_index = swq_identify_field(def->table_name,
+                                              def->field_name, field_list,
+                                              &field_type, &(def->table_index));
+        if( def->field_index == -1 )
+        {
+            CPLError( CE_Failure, CPLE_AppDefined,
+                      "Unrecognized field name %s in GROUP BY.",
+                      def->table_name[0] ?
+                      CPLSPrintf("%s.%s", def->table_name, def->field_name)
+                      : def->field_name );
+            return CE_Failure;
+        }
+
+        if( field_type == SWQ_GEOMETRY )
+        {
+            CPLError( CE_Failure, CPLE_AppDefined,
+                      "Cannot use geometry field '%s' in a GROUP BY clause",
+                      def->field_name );
+            return CE_Failure;
+        }
+    }
+
 /* -------------------------------------------------------------------- */
 /*      Check if we are producing a one row summary result or a set     */
 /*      of records.  Generate an error if we get conflicting            */
-/*      indications.                                                    */
+/*      indications.  With GROUP BY, we produce one summary record     */
+/*      per group.                                                      */
 /* -------------------------------------------------------------------- */
 
     int bAllowDistinctOnMultipleFields = (
@@ -1157,6 +1278,20 @@ CPLErr swq_select::parse( swq_field_list *field_list,
                 def->distinct_flag = TRUE;
                 this_indicator = SWQM_DISTINCT_LIST;
             }
+            else if( group_specs > 0 )
+            {
+                if( FindGroupBy(def->expr, def->table_index,
+                                def->field_index) < 0 )
+                {
+                    CPLError( CE_Failure, CPLE_AppDefined,
+                              "Column '%s' must appear in the GROUP BY clause "
+                              "or be used in an aggregate function.",
+                              def->field_name[0] ? def->field_name :
+                              def->field_alias ? def->field_alias : "" );
+                    return CE_Failure;
+                }
+                this_indicator = SWQM_SUMMARY_RECORD;
+            }
             else
                 this_indicator = SWQM_RECORDSET;
         }
@@ -1232,6 +1367,16 @@ CPLErr swq_select::parse( swq_field_list *field_list,
                       def->field_name );
             return CE_Failure;
         }
+
+        if( group_specs > 0 &&
+            FindGroupBy(nullptr, def->table_index, def->field_index) < 0 )
+        {
+            CPLError( CE_Failure, CPLE_AppDefined,
+                      "Field '%s' in ORDER BY clause must appear in the "
+                      "GROUP BY clause",
+                      def->field_name );
+            return CE_Failure;
+        }
     }
 
 /* -------------------------------------------------------------------- */
@@ -37,6 +37,7 @@
 static void Usage()
 {
     printf("Usage: bench_ogr_c_api [-where filter] [-spat xmin ymin xmax ymax]\n");
+    printf("                       [-reuse_feature]\n");
     printf("                       filename [layer_name]\n");
     exit(1);
 }
@@ -58,6 +59,7 @@ int main(int argc, char* argv[])
     const char* pszDataset = nullptr;
     std::unique_ptr<OGRPolygon> poSpatialFilter;
     const char* pszLayerName = nullptr;
+    bool bReuseFeature = false;
     for( int iArg = 1; iArg < argc; ++iArg )
     {
         if( iArg + 1 < argc && strcmp(argv[iArg], "-where") == 0 )
@@ -84,6 +86,10 @@ int main(int argc, char* argv[])
 
             iArg += 4;
         }
+        else if( strcmp(argv[iArg], "-reuse_feature") == 0 )
+        {
+            bReuseFeature = true;
+        }
         else if( argv[iArg][0] == '-' )
         {
             Usage();
@@ -143,11 +149,22 @@ int main(int argc, char* argv[])
         aeTypes.push_back(OGR_Fld_GetType(OGR_FD_GetFieldDefn(hFDefn, i)));
     int nYear, nMonth, nDay, nHour, nMin, nSecond, nTZ;
     std::vector<GByte> abyWKB;
+    OGRFeatureH hReusedFeat = bReuseFeature ? OGR_F_Create(hFDefn) : nullptr;
     while( true )
     {
-        OGRFeatureH hFeat = OGR_L_GetNextFeature(hLayer);
-        if( hFeat == nullptr )
-            break;
+        OGRFeatureH hFeat;
+        if( hReusedFeat )
+        {
+            if( !OGR_L_GetNextFeatureInto(hLayer, hReusedFeat) )
+                break;
+            hFeat = hReusedFeat;
+        }
+        else
+        {
+            hFeat = OGR_L_GetNextFeature(hLayer);
+            if( hFeat == nullptr )
+                break;
+        }
         OGR_F_GetFID(hFeat);
         for( int i = 0; i < nFields; i++ )
         {
@@ -170,8 +187,11 @@ int main(int argc, char* argv[])
             abyWKB.resize(size);
             OGR_G_ExportToIsoWkb(hGeom, wkbNDR, abyWKB.data());
         }
-        OGR_F_Destroy(hFeat);
+        if( hFeat != hReusedFeat )
+            OGR_F_Destroy(hFeat);
     }
+    if( hReusedFeat )
+        OGR_F_Destroy(hReusedFeat);
 
     poDS.reset();
 
@@ -1720,6 +1720,34 @@ CPLGetConfigOption( const char *pszKey, const char *pszDefault )
     return pszResult;
 }
 
+/************************************************************************/
+/*                          CPLGetNumThreads()                          */
+/************************************************************************/
+
+/**
+  * Return the number of threads specified by a value such as the one of the
+  * GDAL_NUM_THREADS configuration option.
+  *
+  * The value may be ALL_CPUS, for the number of CPUs returned by
+  * CPLGetNumCPUs(), or an integer.
+  *
+  * @param pszValue value to parse, typically the result of
+  * CPLGetConfigOption("GDAL_NUM_THREADS", ...). May be NULL.
+  * @param nMaxThreads maximum number of threads to return.
+  *
+  * @return a number of threads between 1 and nMaxThreads. 1 is returned
+  * for a NULL or invalid value.
+  * @since GDAL 3.7
+  */
+int CPLGetNumThreads( const char* pszValue, int nMaxThreads )
+{
+    if( pszValue == nullptr )
+        return 1;
+    const int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    return std::max(1, std::min(nThreads, nMaxThreads));
+}
+
 /************************************************************************/
 /*                         CPLGetConfigOptions()                        */
 /************************************************************************/
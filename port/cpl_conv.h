@@ -68,6 +68,7 @@ char CPL_DLL** CPLGetThreadLocalConfigOptions(void);
 void CPL_DLL   CPLSetThreadLocalConfigOptions(const char* const * papszConfigOptions);
 void CPL_DLL   CPLLoadConfigOptionsFromFile(const char* pszFilename, int bOverrideEnvVars);
 void CPL_DLL   CPLLoadConfigOptionsFromPredefinedFiles(void);
+int CPL_DLL    CPLGetNumThreads( const char* pszValue, int nMaxThreads );
 
 /* -------------------------------------------------------------------- */
 /*      Safe malloc() API.  Thin cover over VSI functions with fatal    */
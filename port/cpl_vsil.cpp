@@ -3168,3 +3168,31 @@ size_t VSIVirtualHandle::PRead( CPL_UNUSED void* pBuffer,
 {
     return 0;
 }
+
+/************************************************************************/
+/*                            AdviseRead()                              */
+/************************************************************************/
+
+/** Advise the file handle of ranges that will be read in the near future.
+ *
+ * This is a hint that network file systems may use to start fetching the
+ * ranges in the background, so that the caller can keep on doing other work
+ * (typically decompressing already available data) while they are
+ * downloaded. Subsequent Read() or ReadMultiRange() calls within those ranges
+ * will be served from the prefetched data, waiting for it if needed.
+ *
+ * The default implementation does nothing.
+ *
+ * Ranges must be sorted in ascending start offset, and must not overlap each
+ * other.
+ *
+ * @param nRanges number of ranges.
+ * @param panOffsets array of nRanges offsets of the ranges.
+ * @param panSizes array of nRanges sizes of the ranges (in bytes).
+ * @since GDAL 3.7
+ */
+void VSIVirtualHandle::AdviseRead( CPL_UNUSED int nRanges,
+                                   CPL_UNUSED const vsi_l_offset* panOffsets,
+                                   CPL_UNUSED const size_t* panSizes )
+{
+}
@@ -101,6 +101,10 @@ class VSICachedFile final : public VSIVirtualHandle
     bool HasPRead() const override { return m_poBase->HasPRead(); }
     size_t PRead( void* pBuffer, size_t nSize, vsi_l_offset nOffset ) const override
         { return m_poBase->PRead(pBuffer, nSize, nOffset); }
+
+    void AdviseRead( int nRanges, const vsi_l_offset* panOffsets,
+                     const size_t* panSizes ) override
+        { m_poBase->AdviseRead(nRanges, panOffsets, panSizes); }
 };
 
 /************************************************************************/
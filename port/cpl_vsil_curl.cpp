@@ -40,6 +40,7 @@
 #include "cpl_json.h"
 #include "cpl_json_header.h"
 #include "cpl_minixml.h"
+#include "cpl_sha256.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
@@ -47,6 +48,11 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_mem_cache.h"
+#include "cpl_worker_thread_pool.h"
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
 
 #ifndef S_IRUSR
 #define S_IRUSR     00400
@@ -455,6 +461,8 @@ VSICurlHandle::VSICurlHandle( VSICurlFilesystemHandlerBase* poFSIn,
 
 VSICurlHandle::~VSICurlHandle()
 {
+    JoinAdviseReadThread(true);
+
     if( !m_bCached )
     {
         poFS->InvalidateCachedData(m_pszURL);
@@ -2021,6 +2029,11 @@ size_t VSICurlHandle::Read( void * const pBufferIn, size_t const nSize,
                 (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
         std::string osRegion;
         std::shared_ptr<std::string> psRegion = poFS->GetRegion(m_pszURL, nOffsetToDownload);
+        if( psRegion == nullptr && WaitForAdviseReadChunk(nOffsetToDownload) )
+        {
+            // The chunk was being prefetched by AdviseRead()
+            psRegion = poFS->GetRegion(m_pszURL, nOffsetToDownload);
+        }
         if( psRegion != nullptr )
         {
             osRegion = *psRegion;
@@ -2059,9 +2072,10 @@ size_t VSICurlHandle::Read( void * const pBufferIn, size_t const nSize,
             // this should not cause bugs. Just missed optimization.
             for( int i = 1; i < nBlocksToDownload; i++ )
             {
-                if( poFS->GetRegion(
-                        m_pszURL,
-                        nOffsetToDownload + i * knDOWNLOAD_CHUNK_SIZE) != nullptr )
+                const vsi_l_offset nChunkOffset =
+                    nOffsetToDownload + i * knDOWNLOAD_CHUNK_SIZE;
+                if( IsAdviseReadChunkPending(nChunkOffset) ||
+                    poFS->GetRegion(m_pszURL, nChunkOffset) != nullptr )
                 {
                     nBlocksToDownload = i;
                     break;
@@ -2135,6 +2149,37 @@ int VSICurlHandle::ReadMultiRange( int const nRanges, void ** const ppData,
     NetworkStatisticsFile oContextFile(m_osFilename);
     NetworkStatisticsAction oContextAction("ReadMultiRange");
 
+    if( m_bHasAdvisedRead )
+    {
+        // If all ranges are already cached, or being prefetched by
+        // AdviseRead(), serve them through Read() rather than issuing new
+        // requests.
+        const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+        bool bAllAvailable = true;
+        for( int i = 0; bAllAvailable && i < nRanges; ++i )
+        {
+            if( panSizes[i] == 0 )
+                continue;
+            const vsi_l_offset nEnd = panOffsets[i] + panSizes[i];
+            for( vsi_l_offset nChunkOffset =
+                    (panOffsets[i] / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+                 nChunkOffset < nEnd; nChunkOffset += knDOWNLOAD_CHUNK_SIZE )
+            {
+                if( !IsAdviseReadChunkPending(nChunkOffset) &&
+                    poFS->GetRegion(m_pszURL, nChunkOffset) == nullptr )
+                {
+                    bAllAvailable = false;
+                    break;
+                }
+            }
+        }
+        if( bAllAvailable )
+        {
+            return VSIVirtualHandle::ReadMultiRange(
+                                    nRanges, ppData, panOffsets, panSizes);
+        }
+    }
+
     const char* pszMultiRangeStrategy =
         CPLGetConfigOption("GDAL_HTTP_MULTIRANGE", "");
     if( EQUAL(pszMultiRangeStrategy, "SINGLE_GET") )
@@ -2898,6 +2943,415 @@ size_t VSICurlHandle::PRead( void* pBuffer, size_t nSize, vsi_l_offset nOffset )
     return nRet;
 }
 
+/************************************************************************/
+/*                             AdviseRead()                             */
+/************************************************************************/
+
+void VSICurlHandle::AdviseRead( int nRanges,
+                                const vsi_l_offset* panOffsets,
+                                const size_t* panSizes )
+{
+    if( !CPLTestBool(
+            CPLGetConfigOption("GDAL_HTTP_ENABLE_ADVISE_READ", "TRUE")) )
+        return;
+    if( bInterrupted && bStopOnInterruptUntilUninstall )
+        return;
+
+    // Do not wait for the batches still in flight, unless there are too
+    // many of them.
+    JoinFinishedAdviseReadThreads();
+    constexpr size_t knMAX_ADVISE_READ_BATCHES = 4;
+    if( m_apoAdviseReadBatches.size() >= knMAX_ADVISE_READ_BATCHES )
+    {
+        m_apoAdviseReadBatches.front()->oThread.join();
+        m_apoAdviseReadBatches.erase(m_apoAdviseReadBatches.begin());
+    }
+
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if( oFileProp.eExists == EXIST_NO )
+        return;
+    if( !oFileProp.bHasComputedFileSize )
+    {
+        GetFileSize(false);
+        if( !oFileProp.bHasComputedFileSize || oFileProp.eExists == EXIST_NO )
+            return;
+    }
+    const vsi_l_offset nFileSize = oFileProp.fileSize;
+
+    ManagePlanetaryComputerSigning();
+
+    bool bHasExpired = false;
+    const CPLString osURL(GetRedirectURLIfValid(bHasExpired));
+    if( bHasExpired )
+        return;
+
+    // Collect the chunks that are neither cached, nor already being fetched.
+    // Do not prefetch more than what the region cache can hold, otherwise
+    // prefetched chunks would evict each other.
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    size_t nMaxChunks = static_cast<size_t>(GetMaxRegions());
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexAdviseRead);
+        if( m_oSetAdviseReadPendingChunks.size() >= nMaxChunks )
+            return;
+        nMaxChunks -= m_oSetAdviseReadPendingChunks.size();
+    }
+    std::set<vsi_l_offset> oSetChunks;
+    for( int i = 0; i < nRanges && oSetChunks.size() < nMaxChunks; ++i )
+    {
+        if( panSizes[i] == 0 || panOffsets[i] >= nFileSize )
+            continue;
+        const vsi_l_offset nEnd =
+            std::min(panOffsets[i] + panSizes[i], nFileSize);
+        for( vsi_l_offset nChunkOffset =
+                (panOffsets[i] / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+             nChunkOffset < nEnd && oSetChunks.size() < nMaxChunks;
+             nChunkOffset += knDOWNLOAD_CHUNK_SIZE )
+        {
+            if( poFS->GetRegion(m_pszURL, nChunkOffset) == nullptr &&
+                !IsAdviseReadChunkPending(nChunkOffset) )
+            {
+                oSetChunks.insert(nChunkOffset);
+            }
+        }
+    }
+    if( oSetChunks.empty() )
+        return;
+
+    std::unique_ptr<AdviseReadBatch> poBatch(new AdviseReadBatch());
+    auto& aoRequests = poBatch->aoRequests;
+
+    // Group consecutive chunks into requests
+    const bool bMergeConsecutiveRanges = CPLTestBool(CPLGetConfigOption(
+        "GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    for( const vsi_l_offset nChunkOffset: oSetChunks )
+    {
+        const size_t nChunkSize = static_cast<size_t>(std::min(
+            static_cast<vsi_l_offset>(knDOWNLOAD_CHUNK_SIZE),
+            nFileSize - nChunkOffset));
+        if( bMergeConsecutiveRanges && !aoRequests.empty() &&
+            aoRequests.back()->nStartOffset +
+                aoRequests.back()->nSize == nChunkOffset )
+        {
+            aoRequests.back()->nSize += nChunkSize;
+        }
+        else
+        {
+            std::unique_ptr<AdviseReadRequest> poRequest(new AdviseReadRequest());
+            poRequest->nStartOffset = nChunkOffset;
+            poRequest->nSize = nChunkSize;
+            aoRequests.emplace_back(std::move(poRequest));
+        }
+    }
+
+    // Prepare the curl handles in this thread, since GetCurlHeaders() is
+    // not thread-safe.
+    for( auto& poRequest: aoRequests )
+    {
+        CURL* hCurlHandle = curl_easy_init();
+        poRequest->hCurlHandle = hCurlHandle;
+
+        struct curl_slist* headers =
+            VSICurlSetOptions(hCurlHandle, osURL, m_papszHTTPOptions);
+
+        VSICURLInitWriteFuncStruct(&poRequest->sWriteFuncData,
+                                   nullptr, nullptr, nullptr);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
+                                   &poRequest->sWriteFuncData);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                                   VSICurlHandleWriteFunc);
+
+        VSICURLInitWriteFuncStruct(&poRequest->sWriteFuncHeaderData,
+                                   nullptr, nullptr, nullptr);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
+                                   &poRequest->sWriteFuncHeaderData);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
+                                   VSICurlHandleWriteFunc);
+        poRequest->sWriteFuncHeaderData.bIsHTTP = STARTS_WITH(m_pszURL, "http");
+        poRequest->sWriteFuncHeaderData.nStartOffset = poRequest->nStartOffset;
+        poRequest->sWriteFuncHeaderData.nEndOffset =
+            poRequest->nStartOffset + poRequest->nSize - 1;
+
+        char rangeStr[512] = {};
+        snprintf(rangeStr, sizeof(rangeStr),
+                 CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                 poRequest->sWriteFuncHeaderData.nStartOffset,
+                 poRequest->sWriteFuncHeaderData.nEndOffset);
+        poRequest->osRange = rangeStr;
+
+        if( ENABLE_DEBUG )
+            CPLDebug(poFS->GetDebugKey(),
+                     "Prefetching %s (%s)...", rangeStr, osURL.c_str());
+
+        if( poRequest->sWriteFuncHeaderData.bIsHTTP )
+        {
+            CPLString osHeaderRange;
+            osHeaderRange.Printf("Range: bytes=%s", rangeStr);
+            // So it gets included in Azure signature
+            headers = curl_slist_append(headers, osHeaderRange.c_str());
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
+        }
+        else
+        {
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE,
+                                       poRequest->osRange.c_str());
+        }
+
+        poRequest->szCurlErrBuf[0] = '\0';
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
+                                   &poRequest->szCurlErrBuf[0]);
+
+        headers = VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
+        poRequest->psHeaders = headers;
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexAdviseRead);
+        m_oSetAdviseReadPendingChunks.insert(oSetChunks.begin(),
+                                             oSetChunks.end());
+        m_bStopAdviseRead = false;
+    }
+    poBatch->oSetChunks = std::move(oSetChunks);
+    poBatch->osURL = m_pszURL;
+    m_bHasAdvisedRead = true;
+    AdviseReadBatch* poBatchPtr = poBatch.get();
+    poBatch->oThread =
+        std::thread([this, poBatchPtr]() { AdviseReadThread(poBatchPtr); });
+    m_apoAdviseReadBatches.emplace_back(std::move(poBatch));
+}
+
+/************************************************************************/
+/*                          AdviseReadThread()                          */
+/************************************************************************/
+
+void VSICurlHandle::AdviseReadThread( AdviseReadBatch* poBatch )
+{
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix());
+    NetworkStatisticsFile oContextFile(m_osFilename);
+    NetworkStatisticsAction oContextAction("AdviseRead");
+
+    CURLM* hMultiHandle = curl_multi_init();
+#ifdef CURLPIPE_MULTIPLEX
+    if( CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")) )
+    {
+        curl_multi_setopt(hMultiHandle, CURLMOPT_PIPELINING,
+                          CURLPIPE_MULTIPLEX);
+    }
+#endif
+
+    std::map<CURL*, AdviseReadRequest*> oMapHandleToRequest;
+    for( auto& poRequest: poBatch->aoRequests )
+    {
+        curl_multi_add_handle(hMultiHandle, poRequest->hCurlHandle);
+        oMapHandleToRequest[poRequest->hCurlHandle] = poRequest.get();
+    }
+
+    // Unlike MultiPerform(), process each request as soon as it completes,
+    // so that readers waiting for it can resume as early as possible.
+    void* old_handler = CPLHTTPIgnoreSigPipe();
+    int repeats = 0;
+    while( true )
+    {
+        int still_running = 0;
+        while( curl_multi_perform(hMultiHandle, &still_running) ==
+                                        CURLM_CALL_MULTI_PERFORM )
+        {
+            // loop
+        }
+
+        CURLMsg* msg;
+        do
+        {
+            int msgq = 0;
+            msg = curl_multi_info_read(hMultiHandle, &msgq);
+            if( msg && msg->msg == CURLMSG_DONE )
+            {
+                auto oIter = oMapHandleToRequest.find(msg->easy_handle);
+                if( oIter != oMapHandleToRequest.end() )
+                {
+                    FinishAdviseReadRequest(*poBatch, *(oIter->second));
+                    oMapHandleToRequest.erase(oIter);
+                }
+            }
+        } while( msg );
+
+        if( !still_running )
+            break;
+
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutexAdviseRead);
+            if( m_bStopAdviseRead )
+                break;
+        }
+
+        CPLMultiPerformWait(hMultiHandle, repeats);
+    }
+    CPLHTTPRestoreSigPipeHandler(old_handler);
+
+    size_t nTotalDownloaded = 0;
+    for( auto& poRequest: poBatch->aoRequests )
+    {
+        nTotalDownloaded += poRequest->sWriteFuncData.nSize;
+        curl_multi_remove_handle(hMultiHandle, poRequest->hCurlHandle);
+        VSICURLResetHeaderAndWriterFunctions(poRequest->hCurlHandle);
+        curl_easy_cleanup(poRequest->hCurlHandle);
+        CPLFree(poRequest->sWriteFuncData.pBuffer);
+        CPLFree(poRequest->sWriteFuncHeaderData.pBuffer);
+        curl_slist_free_all(poRequest->psHeaders);
+    }
+    curl_multi_cleanup(hMultiHandle);
+
+    NetworkStatisticsLogger::LogGET(nTotalDownloaded);
+
+    {
+        // Release readers waiting for requests of this batch that did not
+        // complete
+        std::lock_guard<std::mutex> oLock(m_oMutexAdviseRead);
+        for( const vsi_l_offset nChunkOffset: poBatch->oSetChunks )
+            m_oSetAdviseReadPendingChunks.erase(nChunkOffset);
+        poBatch->bDone = true;
+    }
+    m_oCondAdviseRead.notify_all();
+}
+
+/************************************************************************/
+/*                      FinishAdviseReadRequest()                       */
+/************************************************************************/
+
+void VSICurlHandle::FinishAdviseReadRequest( const AdviseReadBatch& oBatch,
+                                              AdviseReadRequest& oRequest )
+{
+    long response_code = 0;
+    curl_easy_getinfo(oRequest.hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+
+    if( ENABLE_DEBUG && oRequest.szCurlErrBuf[0] != '\0' )
+    {
+        CPLDebug(poFS->GetDebugKey(),
+                 "AdviseRead(%s), %s: response_code=%d, msg=%s",
+                 oBatch.osURL.c_str(),
+                 oRequest.osRange.c_str(),
+                 static_cast<int>(response_code),
+                 &oRequest.szCurlErrBuf[0]);
+    }
+
+    // Errors are silently ignored: the data will be requested again by
+    // Read() if needed, which will report them.
+    if( (response_code == 206 || response_code == 225) &&
+        oRequest.sWriteFuncData.nSize == oRequest.nSize )
+    {
+        const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+        size_t nOffset = 0;
+        while( nOffset < oRequest.nSize )
+        {
+            const size_t nChunkSize = std::min(
+                static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE),
+                oRequest.nSize - nOffset);
+            poFS->AddRegion(oBatch.osURL.c_str(),
+                            oRequest.nStartOffset + nOffset,
+                            nChunkSize,
+                            oRequest.sWriteFuncData.pBuffer + nOffset);
+            nOffset += nChunkSize;
+        }
+    }
+    else
+    {
+        CPLDebug(poFS->GetDebugKey(),
+                 "AdviseRead(): request for %s failed with response_code=%ld",
+                 oRequest.osRange.c_str(), response_code);
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexAdviseRead);
+        auto oIter = m_oSetAdviseReadPendingChunks.lower_bound(
+            oRequest.nStartOffset);
+        while( oIter != m_oSetAdviseReadPendingChunks.end() &&
+               *oIter < oRequest.nStartOffset + oRequest.nSize )
+        {
+            oIter = m_oSetAdviseReadPendingChunks.erase(oIter);
+        }
+    }
+    m_oCondAdviseRead.notify_all();
+}
+
+/************************************************************************/
+/*                      IsAdviseReadChunkPending()                      */
+/************************************************************************/
+
+bool VSICurlHandle::IsAdviseReadChunkPending( vsi_l_offset nChunkOffset )
+{
+    if( !m_bHasAdvisedRead )
+        return false;
+    std::lock_guard<std::mutex> oLock(m_oMutexAdviseRead);
+    return m_oSetAdviseReadPendingChunks.find(nChunkOffset) !=
+                                        m_oSetAdviseReadPendingChunks.end();
+}
+
+/************************************************************************/
+/*                       WaitForAdviseReadChunk()                       */
+/************************************************************************/
+
+/** Wait for the chunk at nChunkOffset to be downloaded, if it is being
+ * prefetched by AdviseRead(). Returns true if it was the case. */
+bool VSICurlHandle::WaitForAdviseReadChunk( vsi_l_offset nChunkOffset )
+{
+    if( !m_bHasAdvisedRead )
+        return false;
+    std::unique_lock<std::mutex> oLock(m_oMutexAdviseRead);
+    bool bWaited = false;
+    while( m_oSetAdviseReadPendingChunks.find(nChunkOffset) !=
+                                        m_oSetAdviseReadPendingChunks.end() )
+    {
+        bWaited = true;
+        m_oCondAdviseRead.wait(oLock);
+    }
+    return bWaited;
+}
+
+/************************************************************************/
+/*                        JoinAdviseReadThread()                        */
+/************************************************************************/
+
+void VSICurlHandle::JoinAdviseReadThread( bool bAbort )
+{
+    if( bAbort && !m_apoAdviseReadBatches.empty() )
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexAdviseRead);
+        m_bStopAdviseRead = true;
+    }
+    for( auto& poBatch: m_apoAdviseReadBatches )
+        poBatch->oThread.join();
+    m_apoAdviseReadBatches.clear();
+}
+
+/************************************************************************/
+/*                   JoinFinishedAdviseReadThreads()                    */
+/************************************************************************/
+
+// Join the threads of the batches that have completed, without waiting for
+// the ones still in flight.
+void VSICurlHandle::JoinFinishedAdviseReadThreads()
+{
+    for( auto oIter = m_apoAdviseReadBatches.begin();
+         oIter != m_apoAdviseReadBatches.end(); )
+    {
+        bool bDone;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutexAdviseRead);
+            bDone = (*oIter)->bDone;
+        }
+        if( bDone )
+        {
+            (*oIter)->oThread.join();
+            oIter = m_apoAdviseReadBatches.erase(oIter);
+        }
+        else
+        {
+            ++oIter;
+        }
+    }
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -3013,6 +3467,8 @@ void CachedConnection::clear()
     }
 }
 
+static void VSICurlFlushPersistentRegionWrites( bool bStop );
+
 /************************************************************************/
 /*                  ~VSICurlFilesystemHandlerBase()                         */
 /************************************************************************/
@@ -3020,6 +3476,7 @@ void CachedConnection::clear()
 VSICurlFilesystemHandlerBase::~VSICurlFilesystemHandlerBase()
 {
     VSICurlFilesystemHandlerBase::ClearCache();
+    VSICurlFlushPersistentRegionWrites(true);
     GetConnectionCache().erase(this);
 
     if( hMutex != nullptr )
@@ -3076,6 +3533,523 @@ VSICurlFilesystemHandlerBase::RegionCacheType* VSICurlFilesystemHandlerBase::Get
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
+/************************************************************************/
+/*                   Persistent (on-disk) region cache                  */
+/************************************************************************/
+
+// Each cached chunk is stored in its own file in the directory pointed by
+// CPL_VSIL_CURL_PERSISTENT_CACHE_DIR, whose name is the SHA256 of the cache
+// key (SHA256 of the URL without its signature parameters, ETag or
+// Last-Modified/size, chunk size and offset). The URL itself is never stored,
+// as it may contain credentials.
+// File layout:
+// - 8 bytes: magic
+// - 4 bytes: LSB uint32 size of the key
+// - key
+// - 8 bytes: LSB uint64 size of the data
+// - data
+// Files are written under a temporary name and then renamed, so that
+// concurrent readers, possibly in other processes, never see partial files.
+// Eviction is done on the modification time, which is refreshed when an
+// entry is hit.
+
+constexpr char PERSISTENT_CACHE_MAGIC[] = "GDALVCC1";
+constexpr size_t PERSISTENT_CACHE_MAGIC_SIZE = 8;
+constexpr char PERSISTENT_CACHE_PREFIX[] = "gdal_vsicurl_";
+constexpr char PERSISTENT_CACHE_TMP_EXT[] = ".tmp";
+// Do not refresh the modification time of an entry more often than that
+constexpr int PERSISTENT_CACHE_TOUCH_DELAY_SEC = 60;
+
+static CPLMutex* hPersistentCacheMutex = nullptr;
+// Number of bytes written since the last scan of the cache directory.
+// -1 means that no scan has been done yet by this process.
+static GIntBig gnPersistentCacheBytesSinceLastScan = -1;
+
+/************************************************************************/
+/*                    VSICurlGetPersistentCacheDir()                    */
+/************************************************************************/
+
+static std::string VSICurlGetPersistentCacheDir()
+{
+    return CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", "");
+}
+
+/************************************************************************/
+/*                  VSICurlGetPersistentCacheMaxSize()                  */
+/************************************************************************/
+
+static GIntBig VSICurlGetPersistentCacheMaxSize()
+{
+    const GIntBig nMaxSize = CPLAtoGIntBig(
+        CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE",
+                           "1073741824"));
+    return nMaxSize > 0 ? nMaxSize : 1073741824;
+}
+
+/************************************************************************/
+/*                  VSICurlGetPersistentCacheURLHash()                  */
+/************************************************************************/
+
+// Returns the SHA256 of the URL. The query parameters of known URL signing
+// schemes are removed before, as they change at each signing and contain
+// secrets, but do not change the resource. A scheme is only recognized from
+// its own signature parameter (and host for Azure and CloudFront), so that
+// parameters of other URLs that happen to have the same names are kept.
+static std::string VSICurlGetPersistentCacheURLHash( const char* pszURL )
+{
+    std::string osURL(pszURL);
+    const auto nQueryPos = osURL.find('?');
+    if( nQueryPos != std::string::npos )
+    {
+        const CPLStringList aosParams(
+            CSLTokenizeString2(osURL.c_str() + nQueryPos + 1, "&", 0));
+        const auto GetParamName = [](const char* pszParam)
+        {
+            const char* pszEqual = strchr(pszParam, '=');
+            return pszEqual ? std::string(pszParam, pszEqual - pszParam)
+                            : std::string(pszParam);
+        };
+        std::set<std::string> oSetParamNames;
+        for( int i = 0; i < aosParams.size(); ++i )
+            oSetParamNames.insert(GetParamName(aosParams[i]));
+        const auto HasParam = [&oSetParamNames](const char* pszName)
+        {
+            return oSetParamNames.find(pszName) != oSetParamNames.end();
+        };
+
+        std::string osHost(osURL.substr(0, nQueryPos));
+        const auto nSchemePos = osHost.find("://");
+        if( nSchemePos != std::string::npos )
+            osHost = osHost.substr(nSchemePos + 3);
+        osHost = osHost.substr(0, osHost.find('/'));
+        osHost = osHost.substr(0, osHost.find(':'));
+        const auto HostEndsWith = [&osHost](const char* pszSuffix)
+        {
+            const size_t nLen = strlen(pszSuffix);
+            return osHost.size() >= nLen &&
+                   EQUAL(osHost.c_str() + osHost.size() - nLen, pszSuffix);
+        };
+
+        // Names of the parameters to remove, or prefix when ending with '*'
+        std::vector<const char*> apszSignatureParams;
+        // AWS S3 signature version 4 and 2 presigned URLs
+        if( HasParam("X-Amz-Signature") )
+            apszSignatureParams.push_back("X-Amz-*");
+        if( HasParam("AWSAccessKeyId") && HasParam("Signature") )
+        {
+            for( const char* pszName: { "AWSAccessKeyId", "Signature",
+                                        "Expires", "x-amz-security-token" } )
+                apszSignatureParams.push_back(pszName);
+        }
+        // Google Cloud Storage V4 and V2 signed URLs
+        if( HasParam("X-Goog-Signature") )
+            apszSignatureParams.push_back("X-Goog-*");
+        if( HasParam("GoogleAccessId") && HasParam("Signature") &&
+            HostEndsWith("googleapis.com") )
+        {
+            for( const char* pszName: { "GoogleAccessId", "Signature",
+                                        "Expires" } )
+                apszSignatureParams.push_back(pszName);
+        }
+        // Azure shared access signatures
+        if( HasParam("sig") && HasParam("sv") &&
+            HostEndsWith(".core.windows.net") )
+        {
+            for( const char* pszName: { "sig", "sv", "ss", "srt", "sp", "se",
+                                        "st", "spr", "sr", "sdd", "si",
+                                        "skoid", "sktid", "skt", "ske", "sks",
+                                        "skv", "saoid", "suoid", "scid" } )
+                apszSignatureParams.push_back(pszName);
+        }
+        // CloudFront signed URLs
+        if( HasParam("Key-Pair-Id") && HasParam("Signature") &&
+            HostEndsWith(".cloudfront.net") )
+        {
+            for( const char* pszName: { "Key-Pair-Id", "Signature", "Expires",
+                                        "Policy" } )
+                apszSignatureParams.push_back(pszName);
+        }
+
+        if( !apszSignatureParams.empty() )
+        {
+            osURL.resize(nQueryPos);
+            char chSep = '?';
+            for( int i = 0; i < aosParams.size(); ++i )
+            {
+                const std::string osName(GetParamName(aosParams[i]));
+                bool bIsSignatureParam = false;
+                for( const char* pszSignatureParam: apszSignatureParams )
+                {
+                    const size_t nLen = strlen(pszSignatureParam);
+                    if( pszSignatureParam[nLen - 1] == '*' ?
+                            STARTS_WITH(osName.c_str(),
+                                std::string(pszSignatureParam,
+                                            nLen - 1).c_str()) :
+                            osName == pszSignatureParam )
+                    {
+                        bIsSignatureParam = true;
+                        break;
+                    }
+                }
+                if( !bIsSignatureParam )
+                {
+                    osURL += chSep;
+                    osURL += aosParams[i];
+                    chSep = '&';
+                }
+            }
+        }
+    }
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osURL.data(), osURL.size(), abyHash);
+    char* pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osHash(pszHex);
+    CPLFree(pszHex);
+    return osHash;
+}
+
+/************************************************************************/
+/*                   VSICurlGetPersistentCacheKey()                     */
+/************************************************************************/
+
+// Returns an empty string if the file has no validator (ETag or
+// Last-Modified), in which case the content must not be persisted since
+// we would have no way of detecting changes of the remote file.
+static std::string VSICurlGetPersistentCacheKey( const char* pszURL,
+                                                 const FileProp& oFileProp,
+                                                 vsi_l_offset nFileOffsetStart )
+{
+    if( oFileProp.eExists != EXIST_YES || !oFileProp.bHasComputedFileSize )
+        return std::string();
+    std::string osValidator;
+    if( !oFileProp.ETag.empty() )
+    {
+        osValidator = "etag:";
+        osValidator += oFileProp.ETag;
+    }
+    else if( oFileProp.mTime != 0 )
+    {
+        osValidator = CPLSPrintf("mtime:" CPL_FRMT_GIB ",size:" CPL_FRMT_GUIB,
+                                 static_cast<GIntBig>(oFileProp.mTime),
+                                 static_cast<GUIntBig>(oFileProp.fileSize));
+    }
+    else
+    {
+        return std::string();
+    }
+    std::string osKey(VSICurlGetPersistentCacheURLHash(pszURL));
+    osKey += '\n';
+    osKey += osValidator;
+    osKey += CPLSPrintf("\n%d\n" CPL_FRMT_GUIB,
+                        VSICURLGetDownloadChunkSize(),
+                        static_cast<GUIntBig>(nFileOffsetStart));
+    return osKey;
+}
+
+/************************************************************************/
+/*                 VSICurlGetPersistentCacheFilename()                  */
+/************************************************************************/
+
+static std::string VSICurlGetPersistentCacheFilename( const std::string& osDir,
+                                                      const std::string& osKey )
+{
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char* pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osBasename(PERSISTENT_CACHE_PREFIX);
+    osBasename += pszHex;
+    CPLFree(pszHex);
+    return CPLFormFilename(osDir.c_str(), osBasename.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                   VSICurlReadPersistentRegion()                      */
+/************************************************************************/
+
+static std::shared_ptr<std::string>
+VSICurlReadPersistentRegion( const std::string& osDir,
+                             const std::string& osKey )
+{
+    const std::string osFilename =
+        VSICurlGetPersistentCacheFilename(osDir, osKey);
+    VSIStatBufL sStat;
+    if( VSIStatL(osFilename.c_str(), &sStat) != 0 )
+        return nullptr;
+    const size_t nHeaderSize = PERSISTENT_CACHE_MAGIC_SIZE + sizeof(GUInt32) +
+                               osKey.size() + sizeof(GUInt64);
+    if( static_cast<vsi_l_offset>(sStat.st_size) < nHeaderSize )
+        return nullptr;
+
+    VSILFILE* fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if( fp == nullptr )
+        return nullptr;
+
+    std::shared_ptr<std::string> out;
+    std::string osHeader;
+    osHeader.resize(nHeaderSize);
+    if( VSIFReadL(&osHeader[0], 1, nHeaderSize, fp) == nHeaderSize &&
+        memcmp(osHeader.data(), PERSISTENT_CACHE_MAGIC,
+               PERSISTENT_CACHE_MAGIC_SIZE) == 0 )
+    {
+        GUInt32 nKeySize = 0;
+        memcpy(&nKeySize, osHeader.data() + PERSISTENT_CACHE_MAGIC_SIZE,
+               sizeof(nKeySize));
+        CPL_LSBPTR32(&nKeySize);
+        GUInt64 nDataSize = 0;
+        memcpy(&nDataSize, osHeader.data() + nHeaderSize - sizeof(nDataSize),
+               sizeof(nDataSize));
+        CPL_LSBPTR64(&nDataSize);
+        // Check the key to protect against hash collisions, and the data
+        // size against truncated files.
+        if( nKeySize == osKey.size() &&
+            memcmp(osHeader.data() + PERSISTENT_CACHE_MAGIC_SIZE +
+                        sizeof(GUInt32), osKey.data(), osKey.size()) == 0 &&
+            nDataSize <= static_cast<GUInt64>(VSICURLGetDownloadChunkSize()) &&
+            static_cast<vsi_l_offset>(sStat.st_size) == nHeaderSize + nDataSize )
+        {
+            out = std::make_shared<std::string>();
+            out->resize(static_cast<size_t>(nDataSize));
+            if( nDataSize > 0 &&
+                VSIFReadL(&(*out)[0], 1, out->size(), fp) != out->size() )
+            {
+                out.reset();
+            }
+        }
+    }
+    VSIFCloseL(fp);
+
+    // Refresh the modification time, used for LRU eviction, by rewriting
+    // the magic in place.
+    if( out && sStat.st_mtime + PERSISTENT_CACHE_TOUCH_DELAY_SEC < time(nullptr) )
+    {
+        fp = VSIFOpenL(osFilename.c_str(), "r+b");
+        if( fp )
+        {
+            CPL_IGNORE_RET_VAL(VSIFWriteL(PERSISTENT_CACHE_MAGIC, 1,
+                                          PERSISTENT_CACHE_MAGIC_SIZE, fp));
+            VSIFCloseL(fp);
+        }
+    }
+
+    return out;
+}
+
+/************************************************************************/
+/*                    VSICurlEvictPersistentCache()                     */
+/************************************************************************/
+
+static void VSICurlEvictPersistentCache( const std::string& osDir,
+                                         GIntBig nMaxSize )
+{
+    struct Entry
+    {
+        std::string osFilename{};
+        time_t      nMTime = 0;
+        GIntBig     nSize = 0;
+    };
+    std::vector<Entry> aoEntries;
+    GIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+
+    const CPLStringList aosFiles(VSIReadDir(osDir.c_str()));
+    for( int i = 0; i < aosFiles.size(); ++i )
+    {
+        const char* pszName = aosFiles[i];
+        if( !STARTS_WITH(pszName, PERSISTENT_CACHE_PREFIX) )
+            continue;
+        Entry oEntry;
+        oEntry.osFilename = CPLFormFilename(osDir.c_str(), pszName, nullptr);
+        VSIStatBufL sStat;
+        if( VSIStatL(oEntry.osFilename.c_str(), &sStat) != 0 )
+            continue;
+        if( EQUAL(CPLGetExtension(pszName), PERSISTENT_CACHE_TMP_EXT + 1) )
+        {
+            // Leftover of a process that died while writing
+            if( sStat.st_mtime + 3600 < nNow )
+                VSIUnlink(oEntry.osFilename.c_str());
+            continue;
+        }
+        oEntry.nMTime = sStat.st_mtime;
+        oEntry.nSize = static_cast<GIntBig>(sStat.st_size);
+        nTotalSize += oEntry.nSize;
+        aoEntries.emplace_back(std::move(oEntry));
+    }
+    if( nTotalSize <= nMaxSize )
+        return;
+
+    // Remove oldest entries until we are at 90% of the maximum size, to
+    // avoid rescanning on each write.
+    std::sort(aoEntries.begin(), aoEntries.end(),
+              [](const Entry& a, const Entry& b)
+              { return a.nMTime < b.nMTime; });
+    const GIntBig nTargetSize = nMaxSize / 10 * 9;
+    for( const auto& oEntry: aoEntries )
+    {
+        if( nTotalSize <= nTargetSize )
+            break;
+        // Might fail if another process removed it concurrently.
+        VSIUnlink(oEntry.osFilename.c_str());
+        nTotalSize -= oEntry.nSize;
+    }
+}
+
+/************************************************************************/
+/*                   VSICurlWritePersistentRegion()                     */
+/************************************************************************/
+
+static void VSICurlWritePersistentRegion( const std::string& osDir,
+                                          const std::string& osKey,
+                                          const char* pData,
+                                          size_t nSize )
+{
+    const GIntBig nMaxSize = VSICurlGetPersistentCacheMaxSize();
+    bool bScan = false;
+    {
+        CPLMutexHolder oHolder( &hPersistentCacheMutex );
+        if( gnPersistentCacheBytesSinceLastScan < 0 )
+        {
+            bScan = true;
+            gnPersistentCacheBytesSinceLastScan = 0;
+        }
+        gnPersistentCacheBytesSinceLastScan += nSize;
+        if( gnPersistentCacheBytesSinceLastScan > nMaxSize / 10 )
+        {
+            bScan = true;
+            gnPersistentCacheBytesSinceLastScan = 0;
+        }
+    }
+
+    const std::string osFilename =
+        VSICurlGetPersistentCacheFilename(osDir, osKey);
+    const std::string osTmpFilename = osFilename +
+        CPLSPrintf(".%d_" CPL_FRMT_GIB "%s", CPLGetCurrentProcessID(),
+                   CPLGetPID(), PERSISTENT_CACHE_TMP_EXT);
+    VSILFILE* fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if( fp == nullptr )
+    {
+        // The cached content is private to the user.
+        VSIMkdirRecursive(osDir.c_str(), 0700);
+        fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+        if( fp == nullptr )
+        {
+            CPLDebug("VSICURL", "Cannot create %s", osTmpFilename.c_str());
+            return;
+        }
+    }
+#ifndef _WIN32
+    if( !STARTS_WITH(osTmpFilename.c_str(), "/vsi") )
+        CPL_IGNORE_RET_VAL(chmod(osTmpFilename.c_str(), 0600));
+#endif
+    GUInt32 nKeySize = static_cast<GUInt32>(osKey.size());
+    CPL_LSBPTR32(&nKeySize);
+    GUInt64 nDataSize = static_cast<GUInt64>(nSize);
+    CPL_LSBPTR64(&nDataSize);
+    bool bOK =
+        VSIFWriteL(PERSISTENT_CACHE_MAGIC, 1,
+                   PERSISTENT_CACHE_MAGIC_SIZE, fp) == PERSISTENT_CACHE_MAGIC_SIZE &&
+        VSIFWriteL(&nKeySize, sizeof(nKeySize), 1, fp) == 1 &&
+        VSIFWriteL(osKey.data(), 1, osKey.size(), fp) == osKey.size() &&
+        VSIFWriteL(&nDataSize, sizeof(nDataSize), 1, fp) == 1 &&
+        (nSize == 0 || VSIFWriteL(pData, 1, nSize, fp) == nSize);
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    // On Windows, renaming over an existing file fails. This is harmless
+    // since the existing file has the same content.
+    if( !bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0 )
+    {
+        VSIUnlink(osTmpFilename.c_str());
+    }
+
+    if( bScan )
+        VSICurlEvictPersistentCache(osDir, nMaxSize);
+}
+
+/************************************************************************/
+/*                    Deferred persistent cache writes                  */
+/************************************************************************/
+
+// Chunks are written to the persistent cache by a background thread, so as
+// not to slow down the download path. Chunks are dropped when too many are
+// pending, which is harmless since this is only a cache.
+
+constexpr size_t PERSISTENT_CACHE_MAX_PENDING_BYTES = 64 * 1024 * 1024;
+
+// Protected by hPersistentCacheMutex
+static CPLWorkerThreadPool* gpoPersistentCacheWriter = nullptr;
+static size_t gnPersistentCachePendingBytes = 0;
+
+struct VSICurlPersistentRegionWriteJob
+{
+    std::string osDir{};
+    std::string osKey{};
+    std::shared_ptr<std::string> poData{};
+};
+
+static void VSICurlPersistentRegionWriteJobFunc( void* pData )
+{
+    std::unique_ptr<VSICurlPersistentRegionWriteJob> psJob(
+        static_cast<VSICurlPersistentRegionWriteJob*>(pData));
+    VSICurlWritePersistentRegion(psJob->osDir, psJob->osKey,
+                                 psJob->poData->data(), psJob->poData->size());
+    CPLMutexHolder oHolder( &hPersistentCacheMutex );
+    gnPersistentCachePendingBytes -= psJob->poData->size();
+}
+
+static void VSICurlQueuePersistentRegionWrite(
+                                const std::string& osDir,
+                                const std::string& osKey,
+                                const std::shared_ptr<std::string>& poData )
+{
+    CPLMutexHolder oHolder( &hPersistentCacheMutex );
+    if( gnPersistentCachePendingBytes + poData->size() >
+                                        PERSISTENT_CACHE_MAX_PENDING_BYTES )
+    {
+        CPLDebug("VSICURL",
+                 "Too many pending writes to the persistent cache. "
+                 "Skipping chunk");
+        return;
+    }
+    if( gpoPersistentCacheWriter == nullptr )
+    {
+        auto poWriter = new CPLWorkerThreadPool();
+        if( !poWriter->Setup(1, nullptr, nullptr) )
+        {
+            delete poWriter;
+            return;
+        }
+        gpoPersistentCacheWriter = poWriter;
+    }
+    auto psJob = new VSICurlPersistentRegionWriteJob();
+    psJob->osDir = osDir;
+    psJob->osKey = osKey;
+    psJob->poData = poData;
+    gnPersistentCachePendingBytes += poData->size();
+    if( !gpoPersistentCacheWriter->SubmitJob(
+                        VSICurlPersistentRegionWriteJobFunc, psJob) )
+    {
+        gnPersistentCachePendingBytes -= poData->size();
+        delete psJob;
+    }
+}
+
+// Wait for pending writes, and stop the writer thread if bStop.
+static void VSICurlFlushPersistentRegionWrites( bool bStop )
+{
+    CPLWorkerThreadPool* poWriter;
+    {
+        CPLMutexHolder oHolder( &hPersistentCacheMutex );
+        poWriter = gpoPersistentCacheWriter;
+        if( bStop )
+            gpoPersistentCacheWriter = nullptr;
+    }
+    if( poWriter )
+    {
+        poWriter->WaitCompletion();
+        if( bStop )
+            delete poWriter;
+    }
+}
+
 /************************************************************************/
 /*                          GetRegion()                                 */
 /************************************************************************/
@@ -3084,17 +4058,46 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion( const char* pszURL,
                                      vsi_l_offset nFileOffsetStart )
 {
-    CPLMutexHolder oHolder( &hMutex );
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if( GetRegionCache()->tryGet(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out) )
     {
-        return out;
+        CPLMutexHolder oHolder( &hMutex );
+
+        std::shared_ptr<std::string> out;
+        if( GetRegionCache()->tryGet(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out) )
+        {
+            return out;
+        }
+    }
+
+    // Fallback to the persistent cache, if enabled. Done without holding
+    // hMutex as it involves file I/O.
+    const std::string osDir = VSICurlGetPersistentCacheDir();
+    if( !osDir.empty() )
+    {
+        FileProp oFileProp;
+        if( GetCachedFileProp(pszURL, oFileProp) )
+        {
+            const std::string osKey =
+                VSICurlGetPersistentCacheKey(pszURL, oFileProp,
+                                             nFileOffsetStart);
+            if( !osKey.empty() )
+            {
+                auto out = VSICurlReadPersistentRegion(osDir, osKey);
+                if( out )
+                {
+                    CPLMutexHolder oHolder( &hMutex );
+                    GetRegionCache()->insert(
+                        FilenameOffsetPair(std::string(pszURL),
+                                           nFileOffsetStart),
+                        out);
+                    return out;
+                }
+            }
+        }
     }
 
     return nullptr;
@@ -3109,13 +4112,31 @@ void VSICurlFilesystemHandlerBase::AddRegion( const char* pszURL,
                                           size_t nSize,
                                           const char *pData )
 {
-    CPLMutexHolder oHolder( &hMutex );
-
     std::shared_ptr<std::string> value(new std::string());
     value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
-        value);
+    {
+        CPLMutexHolder oHolder( &hMutex );
+
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart),
+            value);
+    }
+
+    const std::string osDir = VSICurlGetPersistentCacheDir();
+    if( !osDir.empty() )
+    {
+        FileProp oFileProp;
+        if( GetCachedFileProp(pszURL, oFileProp) )
+        {
+            const std::string osKey =
+                VSICurlGetPersistentCacheKey(pszURL, oFileProp,
+                                             nFileOffsetStart);
+            if( !osKey.empty() )
+            {
+                VSICurlQueuePersistentRegionWrite(osDir, osKey, value);
+            }
+        }
+    }
 }
 
 /************************************************************************/
@@ -3254,6 +4275,8 @@ void VSICurlFilesystemHandlerBase::InvalidateCachedData( const char* pszURL )
 
 void VSICurlFilesystemHandlerBase::ClearCache()
 {
+    VSICurlFlushPersistentRegionWrites(false);
+
     CPLMutexHolder oHolder( &hMutex );
 
     GetRegionCache()->clear();
@@ -42,10 +42,14 @@
 #include "cpl_curl_priv.h"
 
 #include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <set>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 //! @cond Doxygen_Suppress
 
@@ -394,6 +398,44 @@ class VSICurlHandle : public VSIVirtualHandle
     void         UpdateRedirectInfo( CURL* hCurlHandle,
                                      const WriteFuncStruct& sWriteFuncHeaderData );
 
+    // State of the background prefetching started by AdviseRead(). Each call
+    // starts a batch of requests, downloaded by its own thread, so that
+    // AdviseRead() does not have to wait for the previous batches.
+    struct AdviseReadRequest
+    {
+        CURL*               hCurlHandle = nullptr;
+        struct curl_slist*  psHeaders = nullptr;
+        WriteFuncStruct     sWriteFuncData{};
+        WriteFuncStruct     sWriteFuncHeaderData{};
+        std::string         osRange{};
+        std::array<char, CURL_ERROR_SIZE+1> szCurlErrBuf{};
+        vsi_l_offset        nStartOffset = 0;
+        size_t              nSize = 0;
+    };
+    struct AdviseReadBatch
+    {
+        std::thread             oThread{};
+        std::string             osURL{}; // copy of m_pszURL
+        std::vector<std::unique_ptr<AdviseReadRequest>> aoRequests{};
+        std::set<vsi_l_offset>  oSetChunks{};
+        bool                    bDone = false; // protected by m_oMutexAdviseRead
+    };
+    std::vector<std::unique_ptr<AdviseReadBatch>> m_apoAdviseReadBatches{};
+    // Chunks being downloaded by the batches. Protected by m_oMutexAdviseRead
+    std::set<vsi_l_offset>  m_oSetAdviseReadPendingChunks{};
+    std::mutex              m_oMutexAdviseRead{};
+    std::condition_variable m_oCondAdviseRead{};
+    bool                    m_bStopAdviseRead = false; // protected by m_oMutexAdviseRead
+    bool                    m_bHasAdvisedRead = false;
+
+    void         AdviseReadThread( AdviseReadBatch* poBatch );
+    void         FinishAdviseReadRequest( const AdviseReadBatch& oBatch,
+                                          AdviseReadRequest& oRequest );
+    void         JoinFinishedAdviseReadThreads();
+    bool         IsAdviseReadChunkPending( vsi_l_offset nChunkOffset );
+    bool         WaitForAdviseReadChunk( vsi_l_offset nChunkOffset );
+    void         JoinAdviseReadThread( bool bAbort );
+
   protected:
     virtual struct curl_slist* GetCurlHeaders( const CPLString& /*osVerb*/,
                                 const struct curl_slist* /* psExistingHeaders */)
@@ -427,6 +469,9 @@ class VSICurlHandle : public VSIVirtualHandle
     bool      HasPRead() const override { return true; }
     size_t    PRead( void* pBuffer, size_t nSize, vsi_l_offset nOffset ) const override;
 
+    void      AdviseRead( int nRanges, const vsi_l_offset* panOffsets,
+                          const size_t* panSizes ) override;
+
     bool IsKnownFileSize() const { return oFileProp.bHasComputedFileSize; }
     vsi_l_offset         GetFileSizeOrHeaders(bool bSetError, bool bGetHeaders);
     virtual vsi_l_offset GetFileSize( bool bSetError ) { return GetFileSizeOrHeaders(bSetError, false); }
@@ -138,6 +138,11 @@ class VSIWebHDFSHandle final : public VSICurlHandle
                                                  panOffsets, panSizes );
     }
 
+    // WebHDFS does not use Range requests
+    void AdviseRead( int /* nRanges */,
+                     const vsi_l_offset* /* panOffsets */,
+                     const size_t* /* panSizes */ ) override {}
+
     vsi_l_offset GetFileSize( bool bSetError ) override;
 };
 
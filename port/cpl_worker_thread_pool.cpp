@@ -424,6 +424,25 @@ void CPLWorkerThreadPool::WaitEvent()
     }
 }
 
+/************************************************************************/
+/*                       IsCurrentThreadWorker()                        */
+/************************************************************************/
+
+/** Return whether the calling thread is one of the worker threads of this
+ * pool.
+ *
+ * Code that may run inside a job of a pool must not wait for the completion
+ * of other jobs it submits to the same pool, since all worker threads could
+ * end up blocked waiting for jobs that no thread is left to run. Such code
+ * should check this method and do its work serially when it returns true.
+ *
+ * @since GDAL 3.7
+ */
+bool CPLWorkerThreadPool::IsCurrentThreadWorker() const
+{
+    return threadLocalCurrentThreadPool == this;
+}
+
 /************************************************************************/
 /*                                Setup()                               */
 /************************************************************************/
@@ -115,6 +115,7 @@ class CPL_DLL CPLWorkerThreadPool
         bool SubmitJobs(CPLThreadFunc pfnFunc, const std::vector<void*>& apData);
         void WaitCompletion(int nMaxRemainingJobs = 0);
         void WaitEvent();
+        bool IsCurrentThreadWorker() const;
 
         /** Return the number of threads setup */
         int GetThreadCount() const { return m_nMaxThreads; }
@@ -499,6 +499,7 @@ typedef void retGetPoints;
 %constant char *OLCZGeometries         = "ZGeometries";
 %constant char *OLCRename              = "Rename";
 %constant char *OLCFastGetArrowStream  = "FastGetArrowStream";
+%constant char *OLCFastWriteArrowBatch = "FastWriteArrowBatch";
 
 %constant char *ODsCCreateLayer        = "CreateLayer";
 %constant char *ODsCDeleteLayer        = "DeleteLayer";
@@ -550,6 +551,7 @@ typedef int OGRErr;
 #define OLCZGeometries         "ZGeometries"
 #define OLCRename              "Rename"
 #define OLCFastGetArrowStream  "FastGetArrowStream";
+#define OLCFastWriteArrowBatch "FastWriteArrowBatch";
 
 #define ODsCCreateLayer        "CreateLayer"
 #define ODsCDeleteLayer        "DeleteLayer"
@@ -1447,6 +1449,10 @@ public:
           return NULL;
       }
   }
+
+  bool WriteArrowBatch(ArrowSchema* schema, ArrowArray* array, char** options = NULL) {
+      return OGR_L_WriteArrowBatch(self, schema, array, options);
+  }
 #endif
 
 #ifdef SWIGPYTHON
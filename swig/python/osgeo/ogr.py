@@ -367,6 +367,8 @@ OLCRename = _ogr.OLCRename
 
 OLCFastGetArrowStream = _ogr.OLCFastGetArrowStream
 
+OLCFastWriteArrowBatch = _ogr.OLCFastWriteArrowBatch
+
 ODsCCreateLayer = _ogr.ODsCCreateLayer
 
 ODsCDeleteLayer = _ogr.ODsCDeleteLayer
@@ -2173,6 +2175,10 @@ class Layer(MajorObject):
         r"""GetArrowStream(Layer self, char ** options=None) -> ArrowArrayStream"""
         return _ogr.Layer_GetArrowStream(self, *args)
 
+    def WriteArrowBatch(self, *args) -> "bool":
+        r"""WriteArrowBatch(Layer self, ArrowSchema schema, ArrowArray array, char ** options=None) -> bool"""
+        return _ogr.Layer_WriteArrowBatch(self, *args)
+
     def GetGeometryTypes(self, *args, **kwargs) -> "void":
         r"""
         GetGeometryTypes(Layer self, int geom_field=0, int flags=0, GDALProgressFunc callback=0, void * callback_data=None)